@@ -1,4 +0,0 @@
-python pic2array.py assets/SpiralFaceShadow.png include
-python pic2array.py assets/SpiralFaceShadowCenter.png include
-python pic2array.py assets/SpiralFaceWithShadow.png include
-pause
\ No newline at end of file
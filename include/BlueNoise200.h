@@ -1,2502 +0,0 @@
-const unsigned char BlueNoise200[] PROGMEM = {
-0x4b, 0x32, 0xce, 0x08, 0x2b, 0x9a, 0xf1, 0xda, 0xb3, 0x44, 0xef, 0x9b, 0xce, 0xfc, 0x88, 0x30, 
-0xd6, 0x94, 0xac, 0xde, 0xbf, 0x75, 0xe7, 0xb6, 0x2e, 0xc6, 0x80, 0x6f, 0x3e, 0x2f, 0x10, 0x69, 
-0xea, 0x51, 0x2a, 0x9a, 0xe2, 0xfc, 0xc4, 0x43, 0x5e, 0xd6, 0x81, 0x50, 0xc4, 0x6b, 0x93, 0x4d, 
-0x74, 0x03, 0x9d, 0x2f, 0xdb, 0x95, 0xf3, 0x04, 0x32, 0xa9, 0x24, 0x55, 0x9f, 0xb6, 0x8c, 0x05, 
-0xab, 0x36, 0xfd, 0xc5, 0x2e, 0x99, 0x6d, 0xc9, 0xba, 0x62, 0x41, 0x7f, 0x90, 0xc9, 0xef, 0x41, 
-0x0e, 0xf2, 0x8c, 0x04, 0xfa, 0x90, 0x56, 0xee, 0x18, 0x81, 0x2b, 0xdb, 0x5d, 0x91, 0x1e, 0xd2, 
-0x59, 0xf8, 0xac, 0xc3, 0x60, 0x3b, 0xa6, 0xc7, 0x69, 0x45, 0x85, 0xae, 0x12, 0x4c, 0xa1, 0x80, 
-0xad, 0xdb, 0x13, 0x26, 0x5a, 0xa9, 0x8c, 0x46, 0xba, 0x6d, 0xe3, 0x03, 0x3a, 0xfa, 0x0b, 0x44, 
-0xeb, 0x9e, 0x3c, 0x88, 0x6d, 0x1a, 0x44, 0x8f, 0x50, 0x0d, 0x40, 0x9a, 0xbd, 0x3a, 0x0e, 0xb2, 
-0xe6, 0x2a, 0x5d, 0xcf, 0xef, 0xa2, 0xe1, 0xc4, 0x21, 0x5e, 0xa6, 0x6b, 0xf9, 0x05, 0x7b, 0x8b, 
-0x53, 0xfa, 0xc3, 0x5b, 0x29, 0x8c, 0x3e, 0x9f, 0x56, 0x6f, 0x2f, 0x43, 0x23, 0xf8, 0xac, 0x4d, 
-0x26, 0xa5, 0xc0, 0x1c, 0x34, 0xc7, 0x72, 0x29, 0xfb, 0xd5, 0xc5, 0x9f, 0x21, 0x4c, 0x09, 0x2d, 
-0x86, 0xf1, 0x67, 0x33, 0xbf, 0x10, 0xce, 0xe7, 0xe0, 0x62, 0x88, 0xff, 0x3f, 0xc5, 0x81, 0x53, 
-0x73, 0x01, 0x29, 0x80, 0x37, 0x10, 0xc6, 0x69, 0xba, 0x15, 0x3a, 0x58, 0x1b, 0x4a, 0x13, 0x68, 
-0xd6, 0x4d, 0x19, 0xaa, 0xf1, 0xc2, 0xa0, 0xdd, 0x88, 0xb8, 0xcb, 0x82, 0x16, 0x4e, 0x6d, 0xa1, 
-0x18, 0xaa, 0x00, 0xf0, 0xdc, 0x2f, 0xa0, 0xce, 0x39, 0xdf, 0xee, 0xab, 0x70, 0x23, 0x57, 0xb4, 
-0x75, 0x48, 0xfd, 0xd2, 0x3d, 0x76, 0x2b, 0xeb, 0xbf, 0x81, 0x15, 0x50, 0xdb, 0x0f, 0xf2, 0x49, 
-0x78, 0x28, 0xf9, 0xb4, 0x37, 0x5e, 0x6b, 0xba, 0x81, 0xb1, 0x63, 0x38, 0x25, 0x7b, 0xb9, 0x98, 
-0xcb, 0xaf, 0xe8, 0x89, 0x04, 0xc9, 0xb2, 0x73, 0xa1, 0x31, 0x44, 0x84, 0x11, 0x28, 0xfd, 0x80, 
-0x31, 0x1c, 0xe4, 0xfa, 0x95, 0xc5, 0xe0, 0x08, 0x2e, 0x8a, 0x9e, 0xf6, 0xe3, 0x34, 0x17, 0x07, 
-0x61, 0x31, 0xa9, 0xc0, 0x56, 0xa0, 0xb0, 0x85, 0x78, 0xdc, 0xc3, 0xf5, 0xa6, 0x2f, 0xd0, 0xfe, 
-0x70, 0xe6, 0xab, 0x1d, 0x76, 0x85, 0x95, 0x47, 0x7d, 0x9d, 0x6f, 0x16, 0xb1, 0x54, 0x3a, 0x98, 
-0x7d, 0xf5, 0xc9, 0x1c, 0xb1, 0x41, 0xcc, 0x2c, 0x69, 0x97, 0xde, 0x7d, 0xb0, 0xcb, 0x69, 0xf1, 
-0x0c, 0xaa, 0x81, 0xe5, 0x8e, 0x6c, 0xc3, 0xd6, 0x13, 0x6e, 0x3d, 0x52, 0x90, 0x06, 0xde, 0x4c, 
-0x3f, 0x7e, 0x0d, 0x59, 0xde, 0x6b, 0xfe, 0x57, 0x73, 0xa3, 0xb8, 0xd7, 0x80, 0x50, 0x6d, 0xb4, 
-0xaf, 0x73, 0x1a, 0xab, 0x5c, 0x90, 0x15, 0x36, 0xf9, 0xa7, 0xc2, 0x59, 0xb2, 0xea, 0x25, 0x52, 
-0x7a, 0xe5, 0x8e, 0x6d, 0xff, 0xcd, 0x97, 0x06, 0x8a, 0xfb, 0x62, 0x28, 0xe3, 0x8e, 0x4a, 0x22, 
-0x38, 0x02, 0xee, 0x41, 0xb2, 0xd5, 0x8f, 0x31, 0xbe, 0xf8, 0x27, 0x8c, 0x43, 0x7b, 0x09, 0xfc, 
-0x62, 0x8e, 0x55, 0x41, 0xcf, 0x12, 0xe2, 0x8d, 0xe9, 0x1b, 0xbc, 0x87, 0x61, 0x12, 0xd8, 0x58, 
-0x95, 0x68, 0xe8, 0xa3, 0x7b, 0xb7, 0x39, 0xe5, 0x04, 0x9e, 0xd7, 0x11, 0xe6, 0x26, 0xa8, 0xda, 
-0x19, 0x4e, 0xa0, 0xcf, 0x6f, 0xe4, 0x4a, 0x12, 0x3c, 0x75, 0x22, 0x46, 0xa6, 0xff, 0x3e, 0x0f, 
-0xea, 0x8c, 0x1f, 0xee, 0xcf, 0x73, 0x4c, 0x96, 0xdc, 0xbd, 0x52, 0x02, 0x6e, 0x40, 0x21, 0xf4, 
-0x54, 0xcd, 0x6e, 0x0a, 0x4c, 0xc3, 0x77, 0xde, 0xd2, 0x1c, 0xf5, 0x78, 0x28, 0xda, 0x6c, 0x1e, 
-0x32, 0x59, 0x0e, 0x22, 0xe5, 0x7e, 0x5d, 0x01, 0x27, 0x87, 0xd7, 0xf9, 0x5b, 0xe9, 0xd0, 0x65, 
-0xd8, 0x00, 0xf9, 0x8a, 0x2f, 0x77, 0x04, 0xda, 0x4b, 0x31, 0x0c, 0x51, 0x8f, 0x5c, 0xec, 0xa9, 
-0xb6, 0x0a, 0x38, 0x1a, 0x4e, 0x00, 0xd9, 0x35, 0xc1, 0xd4, 0x14, 0x4e, 0xbc, 0x01, 0x38, 0xee, 
-0x85, 0xb5, 0xf3, 0xd4, 0x7f, 0xa3, 0x63, 0xb4, 0x8d, 0x18, 0xa8, 0xf4, 0x41, 0x91, 0xac, 0xbe, 
-0x14, 0x41, 0x07, 0x27, 0x9a, 0xfa, 0x39, 0x02, 0x3a, 0xd1, 0x52, 0x26, 0xe5, 0xd4, 0xb8, 0x68, 
-0x22, 0x86, 0xe2, 0x4b, 0x6e, 0x96, 0xa7, 0x0b, 0xf4, 0x47, 0xc8, 0x24, 0xa6, 0x33, 0x7e, 0xe2, 
-0xae, 0x36, 0x99, 0xcd, 0x12, 0x56, 0x73, 0xf5, 0xa7, 0x63, 0x94, 0x78, 0x25, 0x61, 0x09, 0xe7, 
-0x74, 0x56, 0x9a, 0x65, 0xbc, 0xea, 0x1a, 0xb2, 0x29, 0xc8, 0x0d, 0xb8, 0x86, 0x4b, 0xc3, 0xa0, 
-0x39, 0x6a, 0x98, 0x07, 0xf2, 0xc4, 0xa4, 0x1f, 0x45, 0xd2, 0x00, 0x40, 0x63, 0x21, 0x8f, 0xac, 
-0x5a, 0x86, 0x4c, 0x70, 0x99, 0x01, 0x8a, 0xf9, 0x73, 0x2c, 0xea, 0xbf, 0x1b, 0xad, 0xd8, 0x66, 
-0xf9, 0x5a, 0xd5, 0x0d, 0x68, 0x7d, 0x2c, 0xc2, 0x62, 0xd7, 0xba, 0x56, 0x9e, 0xb2, 0xe5, 0x07, 
-0x5d, 0x76, 0xa3, 0x2b, 0xd6, 0xb5, 0x8f, 0x65, 0xbc, 0x3b, 0x7c, 0xb4, 0x97, 0x65, 0xf0, 0xb1, 
-0x9c, 0x88, 0x43, 0x93, 0x11, 0x49, 0xe7, 0x90, 0xce, 0xb3, 0x68, 0x4c, 0x94, 0xbb, 0x3a, 0x9d, 
-0xb3, 0x62, 0x34, 0x4c, 0x05, 0x2f, 0x17, 0xad, 0x53, 0x37, 0xbd, 0x46, 0xcc, 0xeb, 0x64, 0xab, 
-0xbe, 0x71, 0xa1, 0xe5, 0xd4, 0x22, 0x72, 0x10, 0x49, 0xe5, 0xbf, 0x71, 0xfd, 0x9a, 0x84, 0x24, 
-0x79, 0x5a, 0x97, 0xf3, 0x61, 0xa1, 0x7c, 0x57, 0x99, 0x08, 0x61, 0x2c, 0xb0, 0xf8, 0x22, 0xcc, 
-0xed, 0x69, 0xc0, 0x27, 0x7a, 0x01, 0x35, 0xe9, 0xcd, 0x95, 0xf4, 0x5f, 0xac, 0x15, 0xc6, 0x76, 
-0x13, 0xbc, 0xed, 0xa2, 0x7b, 0x06, 0x4b, 0xea, 0xcb, 0x9e, 0x0e, 0xd3, 0x1b, 0x40, 0xde, 0x8a, 
-0x34, 0xb2, 0x01, 0x82, 0xeb, 0xb7, 0x5d, 0x44, 0x22, 0xc0, 0x7a, 0x42, 0xb2, 0x81, 0x0a, 0xcf, 
-0xbf, 0x47, 0xd9, 0x0f, 0xa4, 0xf3, 0xc8, 0x3d, 0x80, 0xcf, 0x0e, 0x35, 0xd3, 0x54, 0xa6, 0x48, 
-0x81, 0x6e, 0x1f, 0x9a, 0xf0, 0x7a, 0x2b, 0x5e, 0x0d, 0xcb, 0x51, 0xb0, 0x33, 0x7d, 0x4d, 0xf9, 
-0xb5, 0x2d, 0x89, 0xcc, 0xf9, 0x54, 0xd6, 0x2f, 0xc2, 0xed, 0x1e, 0xce, 0xbc, 0x59, 0x48, 0x3a, 
-0xc3, 0x07, 0x91, 0x58, 0x3e, 0x85, 0x30, 0x00, 0x8b, 0xbe, 0x9a, 0xf0, 0xb7, 0x55, 0xe3, 0x99, 
-0x4c, 0x01, 0x7a, 0x36, 0x0d, 0x68, 0x3f, 0x23, 0xac, 0xf1, 0x3c, 0x87, 0x5a, 0xea, 0x77, 0x13, 
-0xa5, 0xdd, 0x20, 0xe9, 0x2a, 0x86, 0x3c, 0x51, 0x26, 0x5b, 0xca, 0xec, 0xbb, 0x61, 0xc5, 0x02, 
-0xf1, 0x3e, 0x9a, 0xd3, 0x72, 0x18, 0xd9, 0xf2, 0xc7, 0x14, 0x93, 0xb8, 0xa2, 0xc1, 0x73, 0xf6, 
-0x22, 0xa7, 0xe3, 0x96, 0x1c, 0xb8, 0x27, 0x8e, 0x13, 0xf0, 0x83, 0x66, 0xba, 0x34, 0x9c, 0xf3, 
-0x7f, 0x63, 0x92, 0x2b, 0xa8, 0x5d, 0xe7, 0x48, 0xb6, 0xe2, 0x3c, 0x1d, 0xcd, 0x2c, 0xe0, 0x45, 
-0x22, 0xcc, 0xe5, 0x48, 0x10, 0x59, 0x79, 0x0c, 0x30, 0x52, 0x98, 0xe5, 0xb4, 0xd6, 0x84, 0x64, 
-0x1d, 0x52, 0x7a, 0xdb, 0x47, 0xec, 0x87, 0x57, 0x69, 0x84, 0x0c, 0x41, 0x6d, 0x2f, 0xad, 0x95, 
-0x3e, 0x5e, 0x31, 0x7c, 0xf8, 0x62, 0xc0, 0x72, 0x5a, 0xd5, 0xa0, 0x64, 0x50, 0x15, 0xd9, 0x72, 
-0xf2, 0x55, 0x19, 0xee, 0x66, 0xd9, 0x9d, 0x2f, 0x18, 0x6f, 0xfd, 0x32, 0xbb, 0x50, 0x95, 0x1d, 
-0xb6, 0x48, 0xe4, 0xac, 0x21, 0x76, 0x92, 0xe3, 0xc0, 0xda, 0xf8, 0x34, 0x66, 0x01, 0xaf, 0xfb, 
-0xd7, 0x7f, 0xed, 0x27, 0xe0, 0x92, 0x15, 0x6c, 0xe2, 0x77, 0xaa, 0x1b, 0xbc, 0x9b, 0x80, 0x15, 
-0x68, 0xa5, 0x3e, 0x7c, 0x31, 0xea, 0xd2, 0x9e, 0x61, 0xde, 0x7a, 0xfe, 0x0e, 0x9c, 0xf1, 0xc6, 
-0xa6, 0x29, 0x4f, 0x37, 0xcb, 0x20, 0x87, 0x15, 0xae, 0x6c, 0xfb, 0x91, 0xc8, 0xf3, 0x82, 0xd6, 
-0x8e, 0xc4, 0x0d, 0xce, 0x1b, 0x9c, 0x32, 0x4d, 0xff, 0x06, 0x5c, 0x46, 0xd3, 0x11, 0xa6, 0x00, 
-0xfc, 0x72, 0x16, 0x36, 0xab, 0x82, 0x2f, 0x53, 0xa4, 0x7d, 0x27, 0xfb, 0x07, 0x46, 0x86, 0x54, 
-0x76, 0x41, 0xd1, 0x6b, 0xf0, 0x8a, 0x42, 0xc9, 0x80, 0x5e, 0x0d, 0x6b, 0x4f, 0x80, 0xfc, 0x59, 
-0x3e, 0xcf, 0x29, 0x45, 0x02, 0x8a, 0xd9, 0xc6, 0x3c, 0x20, 0xd1, 0xec, 0x40, 0xc7, 0x19, 0x90, 
-0x67, 0x06, 0xa7, 0x87, 0x6f, 0xb3, 0x15, 0xfd, 0xa7, 0x73, 0x8b, 0xbc, 0x97, 0x38, 0xe4, 0x9f, 
-0xd8, 0x84, 0x3a, 0x5f, 0x1a, 0x4f, 0xa0, 0x29, 0xdf, 0xb2, 0x8c, 0x2e, 0x6a, 0x1f, 0x95, 0xe3, 
-0xd9, 0x2b, 0x98, 0xc7, 0xe0, 0x88, 0xfa, 0x13, 0x76, 0xbb, 0xee, 0x92, 0xb5, 0x04, 0xce, 0x29, 
-0x99, 0x1d, 0xf7, 0x3e, 0xbf, 0x2c, 0x9a, 0x08, 0xa5, 0xd1, 0x8a, 0x00, 0xbc, 0x39, 0xf8, 0x91, 
-0x53, 0xaf, 0x89, 0x5b, 0xe3, 0x83, 0x69, 0x2d, 0xfb, 0xa0, 0x6b, 0x84, 0xf7, 0x10, 0x61, 0x30, 
-0x06, 0x59, 0xa5, 0x46, 0xd3, 0xe7, 0x8b, 0x3f, 0x1f, 0xa6, 0x44, 0x73, 0x5d, 0xcd, 0x3c, 0x9d, 
-0x08, 0x5c, 0x38, 0xea, 0x6e, 0x0a, 0x46, 0xf6, 0xdd, 0x07, 0x92, 0xfe, 0x64, 0xae, 0x17, 0x80, 
-0x22, 0xb4, 0x46, 0xa8, 0xd1, 0x5e, 0x4c, 0x6e, 0x1c, 0xdf, 0x82, 0x14, 0x93, 0x6e, 0xf5, 0xd0, 
-0x3c, 0xdf, 0x29, 0xa5, 0x1a, 0x50, 0xb9, 0x31, 0x13, 0x4c, 0x69, 0xb0, 0xf7, 0x44, 0xc0, 0xd2, 
-0x81, 0x91, 0xc4, 0xa0, 0xf6, 0x6c, 0xbf, 0xce, 0x80, 0xb8, 0xe0, 0x69, 0x09, 0x98, 0xff, 0x71, 
-0x1b, 0xdf, 0xbd, 0x5e, 0xad, 0xeb, 0x2b, 0xa6, 0x21, 0xe2, 0x80, 0x10, 0x25, 0x51, 0x9b, 0x08, 
-0xdf, 0x90, 0xf0, 0x3b, 0xd6, 0x9b, 0x09, 0xdb, 0xc2, 0x1b, 0x95, 0xb0, 0xfe, 0x4f, 0x15, 0x59, 
-0xa6, 0x85, 0x04, 0x54, 0x78, 0x0d, 0xaf, 0x32, 0xef, 0xc9, 0x29, 0xf7, 0x4b, 0xd7, 0x92, 0x5f, 
-0xc2, 0x36, 0x18, 0x68, 0xf0, 0xc8, 0x43, 0x6f, 0xb2, 0x05, 0xfc, 0xcf, 0x73, 0xc6, 0x43, 0xfa, 
-0x70, 0x3b, 0xca, 0x08, 0xbb, 0xd1, 0x3d, 0x0c, 0xb1, 0x5f, 0xf2, 0x4e, 0xba, 0x61, 0x20, 0x56, 
-0xd7, 0x08, 0x49, 0x26, 0xa3, 0x3b, 0x50, 0xf0, 0x7c, 0x0f, 0xe0, 0x6f, 0x8f, 0xcb, 0xfa, 0x84, 
-0x31, 0x68, 0xe6, 0x4d, 0xa3, 0x1f, 0x5e, 0x7a, 0xe5, 0x27, 0xc4, 0x13, 0x42, 0x03, 0xaf, 0xd7, 
-0x15, 0x5c, 0x05, 0xc6, 0x41, 0xb9, 0xee, 0x9f, 0x3d, 0x8c, 0x13, 0x76, 0xbd, 0x18, 0x52, 0x6e, 
-0xc0, 0x92, 0x14, 0xbb, 0x02, 0xa9, 0xef, 0x81, 0xbe, 0xd7, 0x93, 0x4f, 0x29, 0xc8, 0xb0, 0x74, 
-0x36, 0xb6, 0x52, 0xc6, 0x28, 0x0b, 0x8f, 0xf6, 0xc8, 0x34, 0x14, 0x6c, 0x27, 0xbb, 0xe7, 0x7c, 
-0x40, 0xb3, 0x63, 0xea, 0xae, 0x47, 0x2f, 0x9e, 0x5c, 0xbc, 0x86, 0x47, 0xd9, 0x61, 0x9a, 0x72, 
-0xfb, 0x9f, 0xe2, 0x7a, 0x60, 0x04, 0xe7, 0x25, 0x6a, 0xb0, 0x2e, 0x75, 0x19, 0x8f, 0x5e, 0xe5, 
-0x2f, 0x42, 0xa3, 0x4f, 0xcc, 0x21, 0xda, 0xb8, 0x45, 0x0d, 0x89, 0x34, 0xcb, 0x91, 0x69, 0xbe, 
-0x04, 0xf6, 0xaa, 0x5e, 0xe7, 0xd6, 0x68, 0x34, 0xb5, 0x29, 0x78, 0xc7, 0xab, 0x2d, 0x6e, 0x48, 
-0xa3, 0x75, 0x5e, 0xdd, 0x7b, 0xc1, 0x6e, 0x2d, 0xf8, 0xb6, 0xdc, 0x9e, 0xbc, 0xf7, 0x6f, 0xd7, 
-0x9f, 0x54, 0x78, 0xbb, 0x0d, 0x3d, 0x82, 0x05, 0xe9, 0x52, 0xde, 0x27, 0x80, 0xab, 0x14, 0x8c, 
-0xc3, 0x4a, 0x23, 0xa4, 0x10, 0xec, 0x89, 0x0b, 0xa9, 0x17, 0xf5, 0x9d, 0x82, 0x51, 0xb0, 0x72, 
-0x11, 0x7c, 0x1d, 0x36, 0x01, 0xd0, 0x9a, 0xe8, 0x84, 0xc4, 0x65, 0xde, 0x86, 0x14, 0xe5, 0xa8, 
-0xba, 0x49, 0x87, 0x24, 0xac, 0x0e, 0x61, 0x48, 0xb1, 0xc4, 0x95, 0x2a, 0x72, 0xe1, 0xc7, 0x44, 
-0x05, 0xa1, 0xd5, 0x75, 0x99, 0xcf, 0xf0, 0x78, 0x3a, 0x8b, 0xdd, 0x97, 0x51, 0x27, 0xd5, 0x70, 
-0xcb, 0xe9, 0xb4, 0x5f, 0x25, 0x98, 0xaa, 0xe0, 0x2e, 0x58, 0xf8, 0x86, 0xdc, 0x67, 0x2c, 0x53, 
-0x21, 0xff, 0x0e, 0xa4, 0x85, 0xf1, 0x5b, 0x21, 0xd0, 0x88, 0x1a, 0x9c, 0x73, 0xe3, 0x4b, 0x6b, 
-0x56, 0xe1, 0x95, 0xee, 0x88, 0x37, 0x07, 0x96, 0xcd, 0xfd, 0x0b, 0x76, 0xd4, 0x04, 0xc4, 0x7c, 
-0x0e, 0x1e, 0xee, 0x75, 0x0a, 0xe8, 0x25, 0xcb, 0x58, 0x3b, 0x1e, 0x2b, 0x97, 0x86, 0xa8, 0x57, 
-0x11, 0x3f, 0xed, 0x53, 0xdc, 0x36, 0x4a, 0x1f, 0x98, 0x0f, 0x8a, 0xf7, 0x7a, 0x3d, 0x5b, 0x8e, 
-0xaa, 0x67, 0xe6, 0x51, 0x79, 0x14, 0xdd, 0x5b, 0x9b, 0x4b, 0x2e, 0xc4, 0x3c, 0xaf, 0x15, 0xf7, 
-0x4c, 0xa0, 0x17, 0x57, 0x10, 0xf3, 0xb3, 0x86, 0xe9, 0x32, 0xf2, 0x0f, 0x39, 0xa9, 0xeb, 0x96, 
-0x1c, 0x4b, 0x6a, 0x30, 0x8b, 0x23, 0x4f, 0x82, 0x3f, 0x14, 0x62, 0x99, 0xe6, 0xac, 0x6b, 0x2e, 
-0xb7, 0x78, 0x9a, 0xd2, 0x00, 0x5e, 0xf9, 0x2b, 0x57, 0xe0, 0x7c, 0x90, 0x2f, 0x67, 0xbd, 0x96, 
-0x5c, 0xc2, 0x49, 0x62, 0xe7, 0x28, 0xff, 0xd9, 0xe6, 0xd4, 0xa9, 0x8e, 0x71, 0xb0, 0x2a, 0x3b, 
-0xa0, 0x1c, 0xad, 0xfc, 0x74, 0x58, 0x90, 0x69, 0x2f, 0xc7, 0x5c, 0xd2, 0xea, 0x39, 0x79, 0xde, 
-0x20, 0x11, 0x3e, 0xfe, 0xac, 0x87, 0x16, 0xb4, 0xf2, 0x65, 0x39, 0xea, 0x23, 0x62, 0x4b, 0xa4, 
-0xc0, 0xec, 0x1e, 0x32, 0x7a, 0xae, 0x87, 0x1b, 0x4d, 0x2c, 0x7f, 0xff, 0xc7, 0x38, 0x7d, 0xce, 
-0x0e, 0xe7, 0x9e, 0x37, 0x4a, 0x1a, 0xc7, 0x8d, 0xb1, 0x44, 0xcf, 0x62, 0xe1, 0x3b, 0x91, 0xa2, 
-0xe7, 0x61, 0x43, 0xf2, 0xd5, 0xa8, 0x3d, 0xb9, 0xa1, 0x02, 0x7e, 0x4e, 0xaf, 0xd8, 0x19, 0xa3, 
-0x57, 0x2f, 0x8f, 0x3c, 0xa4, 0x53, 0xe5, 0x66, 0xf8, 0xab, 0x55, 0xc3, 0x39, 0xb0, 0x8c, 0x00, 
-0xec, 0x81, 0xb5, 0xdb, 0xc8, 0x37, 0x73, 0xb8, 0xdf, 0xcb, 0x84, 0x05, 0xbb, 0xac, 0x7a, 0xf3, 
-0xb2, 0xd8, 0x62, 0x29, 0xad, 0xed, 0x0b, 0xd2, 0x2a, 0xf5, 0xc4, 0x20, 0xa2, 0x42, 0xfa, 0x36, 
-0xcd, 0x88, 0x70, 0x96, 0x06, 0x7c, 0x89, 0xcc, 0x70, 0xdb, 0xbb, 0x8b, 0x42, 0xe1, 0x5e, 0x20, 
-0x03, 0xb7, 0x4d, 0x9e, 0x25, 0x63, 0x0a, 0xce, 0x7a, 0xe6, 0x0f, 0x3d, 0xd0, 0x63, 0xe2, 0x02, 
-0xc2, 0xfe, 0xd2, 0x35, 0x1d, 0xc8, 0x4e, 0xa0, 0xf8, 0x12, 0x42, 0xb2, 0x4e, 0x93, 0xdc, 0x1c, 
-0x6b, 0xed, 0xbc, 0x40, 0xad, 0xda, 0x52, 0x24, 0x7e, 0xed, 0x31, 0x74, 0x1a, 0xa6, 0x01, 0x7e, 
-0x47, 0x9c, 0x54, 0xfd, 0xde, 0x48, 0x7d, 0xf6, 0x52, 0x6f, 0x2f, 0x42, 0xc9, 0x21, 0xd7, 0x0a, 
-0x40, 0xfe, 0x9b, 0x05, 0x50, 0xa1, 0xbc, 0xee, 0x59, 0xd4, 0x7f, 0x62, 0x08, 0x51, 0xd7, 0x2d, 
-0x7f, 0x93, 0x50, 0xaa, 0xbb, 0x32, 0x90, 0x0d, 0x55, 0x72, 0xb3, 0xce, 0xfa, 0x65, 0x01, 0xf4, 
-0x9a, 0xac, 0x0d, 0xd7, 0x4f, 0x05, 0xf3, 0x61, 0x47, 0x7a, 0x6a, 0xd1, 0xb5, 0xf4, 0x75, 0xe5, 
-0x35, 0x6b, 0x7c, 0x1d, 0xba, 0x02, 0x4b, 0x13, 0x7b, 0x2c, 0xbd, 0x03, 0x58, 0x82, 0x15, 0x2b, 
-0xf2, 0xd0, 0x21, 0xc1, 0x62, 0xf8, 0x45, 0x6b, 0xe5, 0xbc, 0x1e, 0x5f, 0xf3, 0x26, 0xb6, 0x8a, 
-0x43, 0x95, 0x2e, 0xd1, 0x9d, 0x7d, 0x44, 0x6a, 0xbf, 0xa4, 0x48, 0x08, 0xf3, 0x50, 0x16, 0xf9, 
-0x94, 0x62, 0xa3, 0x23, 0xfc, 0x95, 0x0c, 0xca, 0x6b, 0x53, 0xe8, 0x03, 0xc1, 0x6d, 0x9e, 0x4e, 
-0x81, 0x3b, 0x99, 0x00, 0xd7, 0xb2, 0x83, 0x0c, 0xb6, 0x16, 0xdb, 0xfd, 0x54, 0xbd, 0xec, 0x5b, 
-0x3d, 0x21, 0xff, 0x66, 0xcd, 0x7d, 0x37, 0x96, 0xd4, 0x6a, 0xc9, 0x7e, 0xd6, 0x8d, 0xb5, 0x43, 
-0x5e, 0xc2, 0x92, 0xac, 0xec, 0x18, 0xa6, 0x94, 0xb2, 0x25, 0x7d, 0x8c, 0x5b, 0xf2, 0xdb, 0x24, 
-0x88, 0xc5, 0x65, 0xf4, 0x2f, 0x76, 0xcd, 0xa6, 0x37, 0x99, 0x17, 0x5d, 0xf6, 0x09, 0x38, 0xe3, 
-0xcd, 0x05, 0xb2, 0xdc, 0x93, 0xcc, 0x44, 0x5b, 0xc6, 0x31, 0x09, 0xc1, 0x63, 0x15, 0xc6, 0x0a, 
-0xb6, 0xdc, 0x94, 0x02, 0xbb, 0x9c, 0xf4, 0xb0, 0x78, 0x18, 0xb4, 0x80, 0x6c, 0x2b, 0x16, 0x8e, 
-0x70, 0x9e, 0xf1, 0xb6, 0xce, 0x37, 0x9a, 0x6d, 0xc1, 0x0b, 0x1d, 0xf8, 0x83, 0x16, 0xca, 0xff, 
-0x26, 0x40, 0x60, 0x0c, 0xa1, 0x45, 0xde, 0x59, 0xc5, 0x69, 0x43, 0x93, 0x71, 0xa3, 0x88, 0x28, 
-0xb0, 0xc4, 0x05, 0x22, 0x94, 0x56, 0x0a, 0x9b, 0x14, 0xc5, 0xed, 0x2e, 0xac, 0x6e, 0xd9, 0xc7, 
-0xfc, 0xb1, 0x6e, 0x93, 0x35, 0xc3, 0xdb, 0x8d, 0x73, 0x5d, 0x3b, 0x9b, 0x0c, 0x78, 0xc8, 0x24, 
-0x83, 0x4c, 0xda, 0xc6, 0x7f, 0x99, 0x18, 0x37, 0xd5, 0x03, 0x6e, 0x5d, 0x13, 0xff, 0xdc, 0x30, 
-0x16, 0xd3, 0x5e, 0x8f, 0x6b, 0xa1, 0xd4, 0x2c, 0x0b, 0x4b, 0x39, 0xd7, 0x67, 0x58, 0x2b, 0x86, 
-0x3b, 0x15, 0xb9, 0x46, 0x91, 0x34, 0xe4, 0x17, 0xbc, 0x76, 0x5c, 0xef, 0x6d, 0x29, 0x54, 0x74, 
-0xef, 0x61, 0x40, 0x28, 0xa3, 0x1c, 0x2f, 0xa9, 0x01, 0x7b, 0x98, 0x2a, 0x0a, 0xa5, 0xc3, 0xfb, 
-0x55, 0x8a, 0x12, 0x3f, 0xfa, 0x53, 0xe3, 0x32, 0xa3, 0x22, 0xfd, 0x7f, 0x59, 0xc6, 0x46, 0x31, 
-0x69, 0xe4, 0x4a, 0xa8, 0x04, 0x70, 0x93, 0x0c, 0x5a, 0x39, 0xe1, 0xa3, 0x09, 0xbf, 0x3f, 0x81, 
-0xb5, 0x03, 0xd3, 0x75, 0xc9, 0x85, 0xa0, 0x72, 0x45, 0x9c, 0x89, 0x54, 0x39, 0xc0, 0x6c, 0xf3, 
-0x67, 0x8b, 0x79, 0x25, 0x3d, 0xa4, 0x91, 0x5d, 0xcd, 0x17, 0xf1, 0x60, 0x7d, 0x36, 0x4d, 0x88, 
-0x62, 0xe4, 0x35, 0xd6, 0xf1, 0xc4, 0x41, 0xae, 0x03, 0x33, 0x4a, 0x24, 0x8b, 0xe4, 0x5c, 0xf6, 
-0x48, 0xde, 0xd0, 0x59, 0x6e, 0xe0, 0xac, 0x7c, 0xd5, 0x9d, 0xe7, 0x83, 0x16, 0xbd, 0x36, 0x8f, 
-0x23, 0xe6, 0x32, 0xef, 0x1e, 0xbb, 0xe1, 0x15, 0x93, 0xfd, 0x33, 0xa8, 0x81, 0x40, 0xd6, 0xad, 
-0x5d, 0x87, 0x9f, 0x52, 0xf8, 0x82, 0x97, 0x34, 0x55, 0x0e, 0xd2, 0xee, 0x21, 0x64, 0xfd, 0x0c, 
-0x47, 0xb1, 0xec, 0xdb, 0x2c, 0xa8, 0x8e, 0xef, 0x02, 0xae, 0x94, 0x0f, 0x6e, 0xdf, 0x4f, 0xc0, 
-0x75, 0xe4, 0xb2, 0xec, 0x20, 0xbb, 0x50, 0x95, 0xf6, 0x76, 0x26, 0xe9, 0x19, 0xc0, 0x41, 0x8a, 
-0x7a, 0xee, 0xb4, 0x74, 0xc5, 0x41, 0xea, 0xd5, 0x9c, 0x75, 0xa4, 0xcf, 0x7e, 0x1f, 0x62, 0xc9, 
-0xfc, 0x0f, 0xad, 0x8e, 0x49, 0xbf, 0xe6, 0x94, 0x20, 0xab, 0xc3, 0x79, 0xe6, 0x69, 0x48, 0x8e, 
-0xc6, 0xe4, 0xb2, 0x52, 0xef, 0x6e, 0x17, 0x45, 0x26, 0xad, 0xe5, 0xc0, 0x1d, 0x72, 0x00, 0x85, 
-0xd4, 0x6d, 0x4d, 0x05, 0x2a, 0x75, 0xf2, 0x87, 0x57, 0x0f, 0xbe, 0xec, 0x42, 0xb8, 0x30, 0xaf, 
-0xd5, 0x7c, 0x1b, 0x8d, 0x6d, 0xef, 0x13, 0x62, 0xff, 0x52, 0x8c, 0x2b, 0x48, 0x1c, 0xb5, 0xfc, 
-0x14, 0x65, 0x25, 0xf8, 0x13, 0x83, 0x2c, 0xd6, 0x18, 0xdf, 0xec, 0xb4, 0x85, 0xf4, 0xe4, 0x32, 
-0x77, 0x89, 0x4a, 0xa8, 0xd4, 0x0f, 0xea, 0x25, 0xcc, 0x95, 0x48, 0x20, 0x58, 0x86, 0xfa, 0xce, 
-0x52, 0xe7, 0xc2, 0x0c, 0x77, 0xa3, 0x12, 0x21, 0xaa, 0x8a, 0x3d, 0xa0, 0x00, 0x37, 0x49, 0x67, 
-0x08, 0xb7, 0x91, 0x4f, 0xf0, 0x6d, 0xaa, 0x79, 0x0a, 0xb7, 0x86, 0x5a, 0xcf, 0x3d, 0x67, 0x53, 
-0xd4, 0x41, 0x5d, 0xdb, 0xed, 0x6d, 0x2b, 0xfb, 0x49, 0x06, 0xd2, 0x3e, 0x16, 0xc0, 0x24, 0x66, 
-0xa8, 0x8a, 0x4a, 0xa1, 0x77, 0xae, 0x50, 0x9a, 0xcc, 0x7d, 0x15, 0x6d, 0x54, 0x3f, 0xb8, 0x5b, 
-0x37, 0x73, 0xf8, 0x44, 0x31, 0xac, 0x0a, 0xfc, 0xa2, 0x28, 0x4a, 0x8d, 0x78, 0xa6, 0x65, 0x0c, 
-0xb0, 0x40, 0x9c, 0x34, 0x7f, 0xb1, 0x5d, 0xe4, 0xc7, 0x9c, 0x1c, 0x0f, 0x8c, 0xa9, 0x01, 0xbd, 
-0x1d, 0xfd, 0x2a, 0x5c, 0xf5, 0xd8, 0xaa, 0x88, 0x44, 0x27, 0xdb, 0x35, 0xce, 0x18, 0xa5, 0x3b, 
-0xd3, 0x4c, 0x8d, 0x0a, 0xcf, 0x9b, 0xd7, 0xf4, 0x16, 0x60, 0x44, 0xd6, 0x34, 0x90, 0xb5, 0xd9, 
-0x78, 0x9f, 0x60, 0x2f, 0x94, 0xa7, 0xbc, 0xf1, 0x11, 0x39, 0xb3, 0xde, 0x9e, 0xbb, 0x0a, 0xda, 
-0xc9, 0xa0, 0x75, 0x16, 0xd3, 0x83, 0xfa, 0x68, 0x44, 0xea, 0xbc, 0x26, 0x57, 0xdf, 0x9c, 0x47, 
-0x22, 0xc3, 0xe1, 0xa9, 0xf1, 0x69, 0x56, 0xc3, 0x30, 0xd2, 0xe9, 0xb8, 0xa3, 0x5f, 0xe6, 0xac, 
-0xbc, 0x39, 0x5b, 0x10, 0xd1, 0x6c, 0x4d, 0x20, 0xae, 0x3b, 0xe0, 0x27, 0x6e, 0xc3, 0x5a, 0xa3, 
-0x03, 0x6d, 0xbd, 0xaa, 0x09, 0x9a, 0x65, 0x26, 0x7d, 0x93, 0xaa, 0x68, 0xca, 0x42, 0xed, 0xbc, 
-0x7a, 0x63, 0x29, 0xc8, 0x96, 0xf3, 0xbd, 0x8b, 0x2f, 0xdf, 0x39, 0x1f, 0xd2, 0x2a, 0xc8, 0xfc, 
-0x51, 0xdb, 0x9d, 0x11, 0xac, 0xf7, 0x2d, 0x9e, 0xb8, 0x77, 0x89, 0x0f, 0xbc, 0x1b, 0xca, 0x79, 
-0xb7, 0x26, 0xe8, 0x90, 0x5e, 0xdc, 0x44, 0xf0, 0xe0, 0x1b, 0x3a, 0xe6, 0x06, 0xbe, 0x2d, 0xe4, 
-0x1f, 0x35, 0xbb, 0x88, 0xfb, 0xcf, 0x12, 0xe2, 0xa1, 0xd4, 0x1b, 0x5c, 0xeb, 0xcf, 0x65, 0x81, 
-0x59, 0xca, 0x0f, 0xd9, 0x3e, 0x2c, 0xcd, 0x87, 0x56, 0xc3, 0xe0, 0xcf, 0x52, 0xfe, 0x23, 0x02, 
-0x69, 0x54, 0x2f, 0xf8, 0xdc, 0x51, 0x7e, 0x63, 0x49, 0xdd, 0x89, 0x0d, 0x3d, 0x51, 0x05, 0x71, 
-0xa1, 0x58, 0xb7, 0x68, 0x08, 0x87, 0x5f, 0xfc, 0x03, 0x6b, 0xeb, 0x34, 0x5c, 0x13, 0xb4, 0x72, 
-0x38, 0x86, 0xa2, 0x07, 0xc1, 0x5c, 0x83, 0x0c, 0xe9, 0x39, 0x07, 0xf4, 0x4a, 0x67, 0x26, 0x5a, 
-0x9b, 0xea, 0x8b, 0xcd, 0x65, 0x40, 0x96, 0x20, 0x3a, 0xf8, 0x2c, 0x64, 0x9c, 0x1f, 0x50, 0xcb, 
-0x9a, 0x0f, 0xaa, 0x4a, 0xd0, 0x34, 0xb0, 0x88, 0xe9, 0x6f, 0x0c, 0x3a, 0x96, 0xda, 0x00, 0x90, 
-0xa7, 0x7f, 0x48, 0x71, 0x0a, 0xce, 0x4c, 0x05, 0x71, 0xa6, 0x96, 0x45, 0x2c, 0x9e, 0x03, 0xba, 
-0xed, 0x64, 0x9a, 0x12, 0xfc, 0x90, 0xb2, 0x43, 0xdb, 0x2e, 0xef, 0x7b, 0xe2, 0x38, 0xb8, 0x0d, 
-0xda, 0x5e, 0x1c, 0xfc, 0x2b, 0x54, 0x92, 0x35, 0x0c, 0xfc, 0xb3, 0xe8, 0x76, 0x23, 0x56, 0xec, 
-0x19, 0x74, 0xc3, 0x5a, 0x7f, 0x9a, 0x41, 0x61, 0x1c, 0xcc, 0x6e, 0x48, 0x79, 0x00, 0x83, 0xeb, 
-0x0b, 0x20, 0xe5, 0x4f, 0xa0, 0x62, 0x3b, 0x96, 0xe1, 0x68, 0xab, 0x74, 0x10, 0xa1, 0x7a, 0x08, 
-0xba, 0x6c, 0x7f, 0xcb, 0x5c, 0x41, 0x84, 0xa8, 0x68, 0x94, 0xdf, 0x04, 0x9e, 0x21, 0x7e, 0x68, 
-0x2c, 0xc2, 0x8a, 0xb7, 0x9f, 0x24, 0x8f, 0x3b, 0x1b, 0x99, 0x69, 0xf6, 0xbf, 0x07, 0xe4, 0xf0, 
-0x21, 0x68, 0x17, 0x8a, 0x0e, 0x70, 0xa7, 0x39, 0xb7, 0xd2, 0x82, 0xa2, 0x38, 0x22, 0xf1, 0x97, 
-0x33, 0xae, 0x6d, 0xc4, 0x99, 0xb5, 0x2e, 0xee, 0xe0, 0x1b, 0x96, 0xf5, 0xe3, 0x78, 0xc4, 0x2f, 
-0x9e, 0x7d, 0xbc, 0xae, 0x43, 0x81, 0x28, 0x53, 0xbf, 0xfa, 0x20, 0x76, 0xe1, 0x28, 0xf3, 0x4c, 
-0x68, 0xcd, 0x86, 0xb0, 0xd1, 0xdd, 0x7f, 0xc7, 0x44, 0x73, 0x1c, 0x54, 0x14, 0xfa, 0x82, 0x6f, 
-0xb6, 0x4e, 0x8e, 0xdc, 0x39, 0xc1, 0x06, 0x77, 0x2a, 0x60, 0xfd, 0x82, 0x95, 0x74, 0x0e, 0xd6, 
-0x2e, 0xa1, 0x7f, 0x5f, 0xb9, 0x25, 0x79, 0x3d, 0xe2, 0x5b, 0x1b, 0x95, 0x3f, 0xf2, 0x79, 0xbf, 
-0x22, 0x05, 0xf7, 0x78, 0xc4, 0xdb, 0x58, 0x7f, 0xd1, 0x0b, 0xc0, 0x53, 0x82, 0x39, 0x16, 0x79, 
-0xf8, 0x8b, 0x5c, 0x12, 0x4d, 0xd2, 0x74, 0xea, 0x44, 0xa0, 0x3a, 0xd1, 0x86, 0xb0, 0xda, 0x6a, 
-0xc5, 0x4f, 0x19, 0x43, 0x5f, 0x0f, 0xa2, 0xd0, 0xaf, 0x64, 0xf9, 0xa7, 0x10, 0xed, 0x05, 0x84, 
-0xa7, 0x3a, 0x28, 0xe7, 0xbf, 0x91, 0xc7, 0x4b, 0x6f, 0xaa, 0xcb, 0x2e, 0x8e, 0xf6, 0x09, 0x83, 
-0x19, 0x53, 0xc5, 0x37, 0xf4, 0xce, 0xb2, 0x58, 0x30, 0x9b, 0xfa, 0x26, 0x91, 0xd8, 0xf7, 0x0a, 
-0x55, 0xf1, 0x44, 0x5f, 0xc6, 0x4b, 0xf1, 0x95, 0x0a, 0x53, 0x3e, 0x7b, 0x03, 0x49, 0xdc, 0xbc, 
-0xed, 0xb0, 0x31, 0x82, 0x5b, 0x9e, 0x4a, 0x7b, 0x37, 0xa9, 0xf7, 0xb9, 0x47, 0x98, 0xdb, 0xf2, 
-0x90, 0x46, 0xe3, 0x60, 0xc1, 0x6f, 0xb3, 0xd0, 0x08, 0x56, 0xef, 0x15, 0xe5, 0x7b, 0xcc, 0x91, 
-0x39, 0xc2, 0x7e, 0x4f, 0x24, 0x42, 0xb3, 0x56, 0xda, 0x27, 0x1b, 0xf8, 0x95, 0xdc, 0xed, 0x04, 
-0x93, 0xd1, 0x66, 0xaf, 0x9a, 0x3f, 0xc8, 0xa7, 0x1a, 0xbb, 0x56, 0x73, 0x10, 0x3b, 0x18, 0xfc, 
-0xab, 0x2c, 0xbf, 0xe7, 0x34, 0xae, 0xd5, 0x59, 0xea, 0x01, 0x7b, 0xb0, 0x5c, 0xe5, 0xa7, 0xf0, 
-0x8e, 0xd9, 0x3a, 0x01, 0xc4, 0x1f, 0xf6, 0x67, 0x53, 0xbe, 0x45, 0x15, 0xea, 0xc8, 0x4e, 0xf3, 
-0x0d, 0xb1, 0xc5, 0xdc, 0x26, 0x9f, 0x34, 0x17, 0xdc, 0xd0, 0xaf, 0x62, 0x89, 0x1a, 0xff, 0x30, 
-0x8f, 0x42, 0xf3, 0xab, 0x2c, 0xe7, 0xca, 0x4e, 0xb7, 0x1d, 0xa1, 0xc1, 0x90, 0x2a, 0xa6, 0x15, 
-0x85, 0xf5, 0xba, 0x70, 0x16, 0xe7, 0x07, 0x80, 0x9f, 0xe2, 0x94, 0x87, 0xd9, 0xc2, 0x7d, 0x3e, 
-0x4f, 0x03, 0x94, 0x45, 0xd6, 0x6b, 0xbb, 0xde, 0x90, 0xf6, 0xb5, 0x63, 0x1a, 0x34, 0x5c, 0xdc, 
-0x3a, 0xf9, 0x64, 0xb4, 0x44, 0xdd, 0xbf, 0xa7, 0x46, 0xf9, 0x02, 0x88, 0x2a, 0x4e, 0x1e, 0x8d, 
-0xd5, 0xc1, 0x50, 0x13, 0xb4, 0x70, 0x1a, 0xc3, 0x7a, 0xd0, 0xac, 0x2d, 0x76, 0xb4, 0x39, 0xd8, 
-0xad, 0xff, 0xe5, 0x66, 0xca, 0xf6, 0x71, 0x0d, 0x52, 0xd5, 0x43, 0x93, 0x1c, 0x6c, 0xb3, 0xd8, 
-0x96, 0x03, 0x74, 0x5b, 0x2d, 0xc9, 0x7d, 0x15, 0x28, 0x74, 0x06, 0x18, 0x92, 0x44, 0x12, 0xe7, 
-0x77, 0x8f, 0xbc, 0x44, 0x66, 0x24, 0x5d, 0x0f, 0x4a, 0x6c, 0x0b, 0xaa, 0xd3, 0x9a, 0x16, 0xee, 
-0x89, 0xca, 0x66, 0x51, 0x0c, 0xc4, 0x5f, 0xaa, 0x31, 0x4b, 0x14, 0xec, 0x54, 0x10, 0x70, 0x93, 
-0x33, 0xfe, 0x9b, 0x2a, 0xe8, 0xa2, 0x52, 0x88, 0x0b, 0x61, 0x93, 0x7d, 0xa2, 0x48, 0x0f, 0x29, 
-0xa4, 0xce, 0x19, 0xf1, 0x26, 0x85, 0x6b, 0x40, 0x13, 0xb1, 0x70, 0xe1, 0x5d, 0xb6, 0x40, 0xa6, 
-0x05, 0xcd, 0xfa, 0x86, 0x31, 0xab, 0x9e, 0x6b, 0x88, 0x2d, 0xfe, 0x67, 0x8b, 0x52, 0xb5, 0x84, 
-0x8f, 0x14, 0x4e, 0x27, 0xe8, 0x40, 0xab, 0x71, 0xa3, 0x1e, 0x7a, 0x6a, 0xd9, 0x5d, 0x98, 0x09, 
-0x67, 0x36, 0xd6, 0x42, 0xff, 0x62, 0xb4, 0x51, 0xc7, 0x2e, 0x01, 0x4c, 0x98, 0x5f, 0x26, 0x46, 
-0xce, 0x30, 0x6e, 0x04, 0xaa, 0x32, 0xfd, 0x8d, 0x27, 0xe7, 0x79, 0x34, 0xb2, 0x23, 0x56, 0x2f, 
-0x4c, 0x13, 0x7f, 0x9b, 0xd5, 0xfe, 0xa6, 0x25, 0x98, 0x16, 0x7f, 0x02, 0x74, 0x22, 0x5a, 0x30, 
-0xd3, 0x9c, 0xbb, 0x63, 0xde, 0x9a, 0x6d, 0xf2, 0x40, 0x00, 0x62, 0xa3, 0xee, 0x2f, 0x4c, 0x9e, 
-0x3b, 0x24, 0x0e, 0x8e, 0xe7, 0x19, 0x5a, 0x86, 0x70, 0x25, 0x13, 0x93, 0x31, 0xab, 0x87, 0x2a, 
-0xa2, 0x78, 0x01, 0xe2, 0xc8, 0xfd, 0x12, 0x29, 0xc1, 0x43, 0xde, 0xa1, 0xeb, 0x0a, 0x62, 0x50, 
-0xbe, 0xa4, 0xeb, 0xb0, 0xce, 0xfc, 0x5c, 0x2e, 0xa4, 0x1f, 0x37, 0x82, 0xd1, 0xa7, 0xff, 0xb2, 
-0x84, 0xf0, 0xcb, 0x2e, 0xf9, 0x63, 0x73, 0x39, 0x0f, 0x46, 0xe4, 0xa6, 0x75, 0x3b, 0x8b, 0x6e, 
-0xe6, 0xb9, 0x7e, 0x38, 0x88, 0xf9, 0xd4, 0x23, 0x7c, 0xda, 0x03, 0x45, 0xc1, 0x91, 0x6a, 0xe2, 
-0xb6, 0xd8, 0xf5, 0x06, 0x6d, 0xc6, 0xe2, 0x88, 0x65, 0x40, 0xc2, 0x93, 0x49, 0x10, 0xd6, 0xbb, 
-0x55, 0xc9, 0x2f, 0xa0, 0x4e, 0xee, 0x7a, 0x8c, 0xe7, 0x1d, 0x94, 0x72, 0xd7, 0x11, 0x59, 0x20, 
-0xd5, 0x3b, 0x78, 0x03, 0xac, 0xea, 0xd8, 0x6d, 0xf0, 0x6e, 0x38, 0xb9, 0x99, 0x06, 0xc1, 0x60, 
-0xe2, 0x4d, 0xcd, 0x00, 0xb9, 0x21, 0xa6, 0xf4, 0x86, 0xea, 0x71, 0x02, 0x81, 0x1e, 0xee, 0x6e, 
-0x91, 0x5b, 0xd8, 0x7c, 0xf2, 0xc3, 0xa9, 0xf8, 0x5a, 0x1f, 0xbc, 0xf4, 0x52, 0x67, 0x17, 0xdc, 
-0x9e, 0xbb, 0xcc, 0x17, 0x89, 0xe4, 0x9f, 0xc3, 0x71, 0xef, 0x06, 0x53, 0x40, 0x74, 0x09, 0x85, 
-0xbc, 0x56, 0xd3, 0xf3, 0x97, 0xc5, 0xec, 0x69, 0x78, 0x1f, 0xe7, 0x3e, 0x7e, 0xc8, 0x0c, 0xa9, 
-0x84, 0xe7, 0x77, 0x39, 0x86, 0xcd, 0x67, 0xea, 0xb8, 0x82, 0xfd, 0x65, 0xd5, 0xa1, 0x00, 0xc5, 
-0x47, 0xa4, 0xcf, 0xbb, 0x51, 0x1c, 0x5d, 0xc5, 0xfb, 0x64, 0xb9, 0x25, 0xa4, 0x3c, 0x89, 0x52, 
-0x63, 0xcc, 0x81, 0x23, 0x3d, 0xad, 0x8c, 0xcf, 0xfa, 0x3c, 0x68, 0x52, 0x25, 0x7a, 0x8a, 0xc8, 
-0x4c, 0xd8, 0xf7, 0x9f, 0x00, 0x50, 0x33, 0xda, 0x17, 0x9d, 0x3f, 0x58, 0x8c, 0x04, 0xe0, 0xa9, 
-0x94, 0xb7, 0x80, 0x2e, 0xd4, 0x21, 0xfc, 0x0e, 0x9f, 0x25, 0xdc, 0xc7, 0x01, 0xb2, 0x60, 0xbe, 
-0x51, 0x8c, 0x65, 0xb4, 0xf2, 0x1f, 0xcc, 0x32, 0x4a, 0x22, 0x3b, 0xcf, 0x5d, 0x1f, 0xb9, 0x97, 
-0xff, 0x34, 0x73, 0x57, 0xa1, 0xfb, 0x33, 0x98, 0x7d, 0x19, 0xf8, 0x87, 0x26, 0x13, 0xd3, 0x2c, 
-0x5a, 0x39, 0xb2, 0x62, 0x49, 0xf6, 0x92, 0xe4, 0xba, 0xa0, 0x4d, 0xc0, 0x15, 0x5c, 0x20, 0x3b, 
-0x82, 0xa1, 0xca, 0xf9, 0x7b, 0x54, 0xd4, 0x26, 0x0f, 0xec, 0x97, 0x35, 0x8b, 0x47, 0x74, 0xd0, 
-0x26, 0x55, 0xaf, 0xc8, 0xde, 0x9b, 0x39, 0x09, 0xe3, 0x22, 0x9f, 0xb5, 0x31, 0x3e, 0x8a, 0x12, 
-0xb3, 0x79, 0xe9, 0x9c, 0x40, 0xca, 0xb1, 0x09, 0x59, 0x6c, 0xf2, 0x4b, 0x61, 0xfe, 0x7c, 0x1b, 
-0xd8, 0xab, 0xca, 0x8a, 0xe4, 0xb0, 0xd0, 0x65, 0xee, 0x42, 0xa8, 0x33, 0x4e, 0x11, 0x85, 0xaf, 
-0x0b, 0x92, 0x57, 0xb4, 0x12, 0xfd, 0x49, 0x2d, 0xdc, 0x1f, 0xc8, 0xae, 0x0f, 0xde, 0x92, 0x04, 
-0x59, 0xdc, 0x99, 0x37, 0x4e, 0xbb, 0xf7, 0x31, 0xdd, 0x5f, 0x81, 0x3b, 0xf0, 0x9c, 0xdf, 0x3e, 
-0x17, 0x8e, 0x4c, 0xee, 0x59, 0x75, 0xdd, 0xaa, 0xef, 0x90, 0x0f, 0xf8, 0xbc, 0x6e, 0xe1, 0x32, 
-0x1e, 0x95, 0x83, 0xda, 0x34, 0x9d, 0x03, 0xe3, 0x64, 0xb4, 0x70, 0x18, 0xe8, 0xc0, 0x75, 0x95, 
-0x63, 0xe7, 0xb6, 0x20, 0x7b, 0xbc, 0xc8, 0x52, 0xfe, 0x5e, 0x00, 0xec, 0x9b, 0xb3, 0x4f, 0xce, 
-0x41, 0x5b, 0x91, 0x69, 0xa3, 0x2b, 0x42, 0xe2, 0x19, 0xef, 0x37, 0x77, 0x59, 0x82, 0x07, 0xa7, 
-0x79, 0x9a, 0x53, 0x8c, 0xf0, 0x30, 0x76, 0x50, 0x09, 0xd7, 0xb4, 0xe3, 0x05, 0xca, 0x62, 0x22, 
-0xeb, 0xa8, 0x44, 0x66, 0xc0, 0x99, 0xaf, 0x6d, 0xc3, 0x9d, 0xe3, 0x26, 0x03, 0xb6, 0x3e, 0x7d, 
-0x09, 0x61, 0xcd, 0xf0, 0x43, 0x7d, 0xd1, 0x91, 0x40, 0xe4, 0x0a, 0x65, 0x18, 0xe0, 0x88, 0xb4, 
-0x3d, 0x81, 0xbd, 0x59, 0xfc, 0xde, 0x0f, 0x3a, 0xbc, 0x93, 0x13, 0x2f, 0x5c, 0x4a, 0xbe, 0xcf, 
-0xa8, 0x42, 0x67, 0xec, 0x1a, 0x74, 0xe0, 0x66, 0xd7, 0x39, 0x0d, 0x83, 0x28, 0xe5, 0x73, 0x86, 
-0x42, 0x2e, 0xaa, 0x0d, 0x97, 0x38, 0x01, 0x46, 0x67, 0x3c, 0x2a, 0x60, 0x1e, 0x30, 0x4e, 0x11, 
-0xe0, 0x28, 0x8c, 0x6e, 0xe5, 0x9f, 0x3d, 0xd9, 0x4b, 0xf1, 0x33, 0xa5, 0x24, 0x75, 0xbe, 0x5a, 
-0x69, 0x9c, 0x4c, 0xfc, 0x5d, 0x43, 0x22, 0xa8, 0x73, 0x46, 0x17, 0xca, 0x70, 0x24, 0x7d, 0x96, 
-0x1d, 0xe9, 0x0f, 0x72, 0xd5, 0x06, 0x7a, 0xb5, 0xe8, 0x34, 0xd2, 0x80, 0x0c, 0x30, 0xbc, 0x05, 
-0x1f, 0x6f, 0x36, 0x58, 0x96, 0x49, 0x00, 0x7b, 0x5b, 0xb7, 0x0b, 0xc3, 0xf4, 0xac, 0x42, 0xbe, 
-0x0f, 0x29, 0x94, 0x3e, 0x5c, 0x89, 0x1e, 0x45, 0xc6, 0x06, 0x70, 0xdb, 0xa3, 0x48, 0x32, 0x25, 
-0x6f, 0x1d, 0xc1, 0x3f, 0x69, 0x13, 0x85, 0xbf, 0x7a, 0xf0, 0x18, 0x49, 0xe7, 0x76, 0x96, 0x0d, 
-0xa9, 0xc9, 0x9d, 0x0f, 0xd6, 0x40, 0xfa, 0x63, 0xe7, 0xc4, 0x18, 0xb3, 0xa0, 0x44, 0xe8, 0x17, 
-0xaa, 0x80, 0x1e, 0x2c, 0x8a, 0xad, 0x79, 0x4e, 0xd4, 0x8f, 0x04, 0xdd, 0xe9, 0x0b, 0x3e, 0xfc, 
-0x17, 0x4e, 0x79, 0xd1, 0x84, 0xc6, 0x6d, 0x2b, 0xfa, 0x1c, 0x8d, 0x32, 0x98, 0xa7, 0xfb, 0x2a, 
-0x1b, 0x52, 0xb3, 0x91, 0x47, 0x31, 0x6d, 0x9d, 0xf9, 0x66, 0x2a, 0xa4, 0x19, 0xb1, 0x80, 0x61, 
-0xe3, 0x44, 0xa4, 0x7d, 0xf7, 0x8d, 0x11, 0x75, 0xfa, 0x81, 0x0d, 0xc8, 0x56, 0x96, 0x03, 0x4f, 
-0xa4, 0x92, 0x4a, 0xd3, 0x5d, 0x1b, 0x96, 0xf6, 0xc2, 0x1e, 0xdf, 0x74, 0xc6, 0xb5, 0xd1, 0xa4, 
-0x91, 0xeb, 0xbd, 0x9e, 0xf4, 0xc3, 0x90, 0x9f, 0x79, 0xc8, 0x06, 0xba, 0x1c, 0x59, 0xff, 0x29, 
-0xbc, 0xcb, 0x83, 0x61, 0xd4, 0x8e, 0xeb, 0x37, 0xb6, 0x8c, 0x09, 0x2a, 0xba, 0x7e, 0xc5, 0xf8, 
-0x2e, 0xc0, 0xb0, 0x08, 0x8b, 0xeb, 0x41, 0x69, 0xb6, 0x4e, 0x8e, 0x2b, 0xad, 0x67, 0x48, 0x97, 
-0x0f, 0x6d, 0x9f, 0xaf, 0xcb, 0x62, 0xf9, 0x9d, 0x4b, 0xe6, 0xb3, 0xd5, 0x19, 0xc6, 0xf3, 0x9e, 
-0xd6, 0xe8, 0x17, 0x4a, 0x5f, 0x1d, 0x6c, 0x83, 0xf0, 0x56, 0x7c, 0xcc, 0xde, 0xae, 0xf3, 0x2b, 
-0xa5, 0x51, 0x36, 0x91, 0xea, 0x0d, 0xf3, 0x84, 0xce, 0xa0, 0xde, 0x8d, 0x57, 0xf1, 0x32, 0xe2, 
-0x0b, 0xad, 0x35, 0xcc, 0xba, 0x55, 0xf7, 0x82, 0x6c, 0x4b, 0x28, 0xe4, 0xaf, 0x94, 0x2b, 0xb8, 
-0x11, 0x6f, 0xf8, 0x7f, 0x03, 0xd8, 0x87, 0xcb, 0x5b, 0xf4, 0x47, 0x6b, 0xbe, 0x3e, 0xf3, 0x0d, 
-0x6d, 0xbc, 0x38, 0x77, 0x53, 0x82, 0x61, 0xd8, 0x88, 0x0c, 0xf2, 0xa3, 0x34, 0xea, 0xa9, 0x51, 
-0xd3, 0xae, 0x70, 0xe2, 0x0a, 0x66, 0x4f, 0x71, 0x8a, 0x71, 0xd2, 0x24, 0xa5, 0xf3, 0xc9, 0x11, 
-0x50, 0xd3, 0x07, 0xc7, 0x6d, 0x4d, 0x99, 0xc9, 0x05, 0xf2, 0x6a, 0xd4, 0x23, 0xb2, 0x64, 0x2d, 
-0x52, 0xbb, 0x8c, 0x29, 0xa5, 0xd0, 0xff, 0xbe, 0x25, 0xf3, 0x6b, 0xc1, 0xa6, 0xb7, 0x36, 0x4e, 
-0xd1, 0xa1, 0x8c, 0xee, 0x54, 0x28, 0x84, 0xf7, 0x59, 0x0b, 0x76, 0x17, 0x80, 0x44, 0x6c, 0xfb, 
-0x39, 0xad, 0x60, 0xdc, 0x7c, 0xcd, 0xa9, 0x66, 0x18, 0x72, 0x06, 0xe4, 0x42, 0x9e, 0x03, 0xce, 
-0x16, 0xf1, 0xd5, 0x70, 0x98, 0xec, 0x15, 0x54, 0x8d, 0xe4, 0x62, 0xf3, 0x55, 0x9d, 0xae, 0x0b, 
-0xcb, 0xfc, 0xa1, 0xc1, 0xf5, 0x20, 0xcd, 0x84, 0x54, 0xf5, 0x22, 0x44, 0x17, 0x95, 0x83, 0x3e, 
-0xcf, 0x79, 0xa2, 0x2b, 0x84, 0x66, 0xab, 0x26, 0x44, 0x6d, 0xa7, 0x78, 0x8f, 0xec, 0xd2, 0x36, 
-0x98, 0xab, 0xfc, 0x13, 0x31, 0x68, 0x09, 0xd7, 0x7b, 0xfb, 0xcd, 0x15, 0x5c, 0x6a, 0x99, 0xb1, 
-0x0a, 0x4a, 0x7a, 0x28, 0xd2, 0xa5, 0x73, 0x23, 0x62, 0x99, 0xff, 0x85, 0x08, 0x1f, 0xd0, 0x3b, 
-0xdd, 0xb7, 0x89, 0x1b, 0x6f, 0x51, 0xcf, 0x86, 0x46, 0xd4, 0x36, 0x61, 0x2a, 0xbc, 0x68, 0x39, 
-0x9c, 0xc4, 0x92, 0xe8, 0x5d, 0x18, 0xdb, 0xa2, 0x2e, 0x5a, 0xac, 0xcf, 0x28, 0xb6, 0x95, 0x31, 
-0xa9, 0xc9, 0x41, 0x66, 0x1a, 0x5b, 0x0c, 0x9a, 0x43, 0x83, 0x57, 0x26, 0xb4, 0xc9, 0x1a, 0xbe, 
-0xf4, 0xc1, 0x36, 0xed, 0x80, 0x5a, 0xaf, 0x20, 0x93, 0x7a, 0xe1, 0x3f, 0xf1, 0x24, 0xe9, 0x31, 
-0x88, 0x50, 0x1b, 0xc2, 0x3c, 0xe7, 0xa2, 0xd9, 0x17, 0xf0, 0x3a, 0xde, 0x6c, 0x43, 0x7d, 0x33, 
-0x87, 0x19, 0xe2, 0x06, 0x7a, 0xed, 0x0f, 0x65, 0x7d, 0x03, 0x5e, 0x3e, 0x14, 0x6c, 0xdd, 0x1f, 
-0x33, 0xb3, 0x4c, 0xdf, 0xcc, 0x06, 0xb8, 0x15, 0x56, 0x21, 0xf0, 0x43, 0x92, 0x32, 0x0a, 0x89, 
-0x99, 0x52, 0xf9, 0xb7, 0x1d, 0x4f, 0x6e, 0xab, 0x80, 0x3f, 0x53, 0xa6, 0x35, 0x63, 0xd3, 0x3d, 
-0xa0, 0x20, 0x80, 0x34, 0xd2, 0x1a, 0xe2, 0x5c, 0x38, 0x79, 0x03, 0x44, 0x5a, 0x37, 0xe4, 0xb9, 
-0x2d, 0xdb, 0xbf, 0x67, 0xd7, 0xe7, 0x55, 0x27, 0xc2, 0x0a, 0x5f, 0xfc, 0x3f, 0xe7, 0x12, 0x55, 
-0x8b, 0x30, 0xff, 0xcd, 0x25, 0xb4, 0x08, 0x4e, 0xc6, 0x21, 0x47, 0xbc, 0xa1, 0x4c, 0x91, 0xb5, 
-0x5f, 0x86, 0x26, 0xad, 0xc1, 0x3e, 0xd5, 0x54, 0xe4, 0x38, 0xf7, 0xbb, 0x07, 0x47, 0x92, 0xb7, 
-0xd9, 0x51, 0x71, 0x29, 0xaa, 0x64, 0x9c, 0x2e, 0x03, 0x5b, 0xfd, 0xc2, 0x35, 0xe9, 0x00, 0x9f, 
-0x24, 0x58, 0x92, 0xe1, 0xa5, 0x4f, 0xfa, 0x0d, 0x27, 0x71, 0x07, 0x36, 0xd0, 0x82, 0x96, 0x48, 
-0xc7, 0xfe, 0x14, 0x9b, 0xf4, 0x46, 0x1d, 0xef, 0x58, 0x74, 0x23, 0x97, 0xbf, 0xdb, 0x8d, 0xf2, 
-0x17, 0xbb, 0xd7, 0xeb, 0x3f, 0x85, 0xf1, 0x35, 0x63, 0x4b, 0x9c, 0x16, 0xbc, 0x01, 0x43, 0xe7, 
-0x36, 0xaa, 0x5b, 0x8b, 0x9f, 0x77, 0x14, 0xb8, 0xab, 0xdb, 0x75, 0x97, 0x58, 0x03, 0x7b, 0x45, 
-0x98, 0xad, 0x60, 0x07, 0xea, 0xb5, 0x12, 0x61, 0xcc, 0xae, 0x58, 0x2e, 0x42, 0x8e, 0xdc, 0x26, 
-0xfc, 0xb8, 0x30, 0xd4, 0xac, 0xbf, 0x4a, 0x7b, 0xca, 0xe7, 0x69, 0x93, 0x36, 0x5d, 0xa7, 0xe5, 
-0xcf, 0x84, 0x9c, 0x0e, 0x6c, 0xf4, 0x49, 0xc2, 0xe0, 0x39, 0xaa, 0x2c, 0x89, 0xd9, 0xf7, 0x29, 
-0x60, 0xc5, 0x1b, 0xdf, 0x88, 0x01, 0xb1, 0x79, 0x0d, 0xda, 0x48, 0xa9, 0x73, 0x2b, 0xbe, 0x84, 
-0xd8, 0x24, 0x6c, 0xdc, 0x89, 0x9e, 0x0b, 0x74, 0xa8, 0x02, 0x8c, 0x7c, 0x38, 0x08, 0xb7, 0x6b, 
-0x8e, 0xde, 0x17, 0x50, 0x92, 0x73, 0xb2, 0xd3, 0xbd, 0x05, 0x99, 0x3d, 0x56, 0xe1, 0xa2, 0x77, 
-0xdb, 0x62, 0x03, 0x86, 0xed, 0x77, 0xc9, 0x3b, 0x1a, 0xe4, 0x47, 0x73, 0xef, 0x2c, 0x7c, 0x1c, 
-0x8f, 0x65, 0xa9, 0x16, 0x5f, 0xc8, 0xf9, 0x3a, 0x02, 0xc3, 0x43, 0xdf, 0xec, 0x8f, 0xc0, 0xf0, 
-0x7b, 0xa5, 0x66, 0x42, 0x9a, 0x7d, 0x5e, 0xbf, 0xed, 0xaf, 0x0b, 0xc9, 0x75, 0x1e, 0x8f, 0xb4, 
-0xe0, 0x53, 0xf0, 0x9f, 0xb5, 0x29, 0x00, 0xe6, 0x7d, 0x20, 0x89, 0x66, 0x09, 0xdc, 0x6d, 0xbc, 
-0x01, 0xe2, 0xb4, 0xff, 0x4a, 0x71, 0x27, 0xc8, 0x78, 0x36, 0x00, 0x69, 0x9e, 0x13, 0x5c, 0xe0, 
-0xa7, 0x0e, 0xdd, 0x78, 0x66, 0xd7, 0x8a, 0x70, 0xc1, 0xf7, 0x19, 0x2d, 0xbf, 0xd7, 0x56, 0x65, 
-0x39, 0x26, 0xf6, 0x0f, 0xb7, 0x89, 0xfd, 0xc9, 0x24, 0x73, 0xd4, 0x4d, 0x91, 0x22, 0x9d, 0xf1, 
-0x3e, 0x70, 0x97, 0xfb, 0xc4, 0x51, 0x71, 0xad, 0x98, 0x48, 0xe5, 0x77, 0x95, 0xf3, 0x06, 0x9f, 
-0x8b, 0x13, 0xa9, 0x24, 0xf6, 0xda, 0x88, 0x2c, 0x73, 0x4c, 0xc4, 0xb0, 0x26, 0xe3, 0xb4, 0x76, 
-0x22, 0xd1, 0x64, 0x7b, 0xc2, 0x5b, 0x0d, 0x9a, 0xe8, 0x73, 0xaf, 0xf9, 0x26, 0x4b, 0xe7, 0xc8, 
-0x6c, 0xf7, 0xba, 0x04, 0x90, 0xfa, 0x4f, 0x13, 0xa8, 0x93, 0xee, 0xb4, 0x17, 0xc6, 0x64, 0xeb, 
-0x3f, 0x5d, 0xff, 0x4d, 0x9b, 0xf0, 0xa9, 0x1d, 0xf6, 0x3a, 0xa7, 0xbb, 0xcc, 0x09, 0x35, 0x7e, 
-0xf0, 0x60, 0xc4, 0x14, 0x86, 0x69, 0x32, 0x16, 0x8e, 0xe7, 0x6f, 0xd4, 0x23, 0x59, 0x10, 0xf8, 
-0x97, 0xbc, 0x01, 0x9f, 0x8b, 0x10, 0xfd, 0xb5, 0xc5, 0x2d, 0x74, 0x96, 0xe8, 0x80, 0x1d, 0x6a, 
-0x8b, 0xa4, 0x12, 0x7d, 0x59, 0x17, 0x3f, 0x4e, 0xd7, 0x14, 0xcb, 0x0b, 0xf2, 0xac, 0x19, 0xd8, 
-0x77, 0x3e, 0xf4, 0x16, 0x47, 0xeb, 0x7e, 0xd0, 0x41, 0xac, 0x79, 0x1b, 0x4c, 0xfa, 0x6f, 0x5f, 
-0xb2, 0x3f, 0xea, 0x4f, 0xc5, 0xa3, 0x7c, 0xd3, 0x4c, 0x8b, 0x37, 0x7f, 0x06, 0xac, 0x3b, 0xe3, 
-0x61, 0xa5, 0xfd, 0x8f, 0x49, 0xd1, 0xab, 0x77, 0x84, 0xc9, 0x57, 0x3c, 0x97, 0xfb, 0x26, 0xd0, 
-0x49, 0x08, 0xb5, 0x6a, 0x45, 0x01, 0xfe, 0x92, 0xcd, 0x82, 0xa1, 0x42, 0xd0, 0x30, 0x69, 0x54, 
-0x0b, 0xbe, 0x85, 0x31, 0xc5, 0x74, 0x53, 0xdd, 0xba, 0x0e, 0xd4, 0x7f, 0x1f, 0xa2, 0xce, 0x3a, 
-0x1a, 0xc6, 0x86, 0x0f, 0x24, 0x65, 0x38, 0x5b, 0xfb, 0x42, 0xc0, 0x54, 0x7b, 0x1a, 0x47, 0x99, 
-0x03, 0xfa, 0x35, 0xd5, 0x53, 0x9f, 0x5d, 0x06, 0xef, 0x45, 0xa1, 0x18, 0xf1, 0x38, 0xb4, 0x46, 
-0x85, 0x32, 0x07, 0x94, 0x69, 0xbe, 0x9b, 0x57, 0x2a, 0x95, 0x5c, 0xce, 0x3c, 0x67, 0x9a, 0xe8, 
-0x43, 0x62, 0x2f, 0x50, 0x7e, 0xf7, 0x4a, 0x94, 0x25, 0xce, 0xb4, 0x1b, 0xc9, 0x2b, 0x76, 0x48, 
-0xd3, 0x7c, 0x65, 0xec, 0x23, 0x9c, 0xdf, 0x4c, 0x1d, 0x70, 0xe4, 0xad, 0xf6, 0x46, 0xc1, 0xf1, 
-0x29, 0xb2, 0x3f, 0x99, 0x33, 0xa9, 0xd9, 0x6d, 0x2e, 0x55, 0xd2, 0x62, 0xdd, 0x4d, 0xa2, 0x5b, 
-0x03, 0xed, 0xd8, 0x3e, 0x4f, 0xaf, 0x2e, 0xe5, 0x56, 0xf5, 0xd3, 0x37, 0xb6, 0xcb, 0x73, 0x23, 
-0xb1, 0x95, 0x31, 0x84, 0xdc, 0x27, 0x4c, 0x6a, 0x30, 0x87, 0x99, 0x65, 0xaa, 0xc2, 0x33, 0x5d, 
-0x18, 0x89, 0xd8, 0x66, 0xc6, 0x8c, 0xa8, 0x33, 0xd7, 0xbe, 0x72, 0x2f, 0x8f, 0x3b, 0x0f, 0x2a, 
-0x9c, 0x63, 0x14, 0xd1, 0xeb, 0x56, 0x87, 0xb5, 0x0f, 0x50, 0x24, 0xc2, 0x71, 0x2d, 0xf8, 0x09, 
-0xfc, 0x1e, 0xb2, 0xe5, 0x2e, 0x51, 0x0f, 0x9f, 0x5f, 0x83, 0x98, 0xed, 0xc8, 0x7f, 0xa5, 0x10, 
-0x4a, 0xe5, 0x5e, 0x6f, 0xeb, 0x18, 0xa6, 0xe0, 0x3c, 0xf2, 0xa3, 0x17, 0xfb, 0xab, 0x00, 0x8b, 
-0x27, 0x4c, 0xa8, 0x38, 0x03, 0x62, 0xf3, 0x0b, 0x5b, 0x6b, 0xef, 0x52, 0xa7, 0xe2, 0xd0, 0xb3, 
-0x2b, 0x72, 0x00, 0xd4, 0xa1, 0xb6, 0x6a, 0xe9, 0xbb, 0x62, 0x1b, 0x78, 0x87, 0x13, 0xcb, 0x34, 
-0x83, 0x93, 0x0e, 0xe3, 0x71, 0x91, 0xd3, 0x20, 0xbd, 0xdb, 0x4f, 0xcf, 0x7d, 0x40, 0x10, 0xf0, 
-0x37, 0x14, 0x81, 0xe5, 0x23, 0xc4, 0x7c, 0x07, 0xca, 0xb8, 0xd2, 0x10, 0xac, 0x34, 0x1c, 0xd6, 
-0x78, 0xa1, 0x32, 0x6f, 0xe0, 0x87, 0x5c, 0xc0, 0x99, 0x30, 0x02, 0x85, 0x43, 0x5c, 0xf6, 0x8c, 
-0xa4, 0x42, 0x2e, 0x93, 0x0d, 0xd5, 0x7f, 0x5d, 0xa5, 0x53, 0xcb, 0x0d, 0xf4, 0xbf, 0x82, 0x43, 
-0xeb, 0xb1, 0x7b, 0x34, 0xc3, 0x21, 0x6e, 0xcf, 0x45, 0x83, 0x20, 0xba, 0x0a, 0xd4, 0x9f, 0x75, 
-0xb3, 0x26, 0x95, 0x69, 0x0c, 0xa2, 0xfa, 0x8b, 0x56, 0xe5, 0x47, 0x72, 0x59, 0xc5, 0x91, 0xfc, 
-0x07, 0xbb, 0x52, 0xd7, 0x2c, 0x02, 0x6d, 0xa1, 0xfd, 0x0d, 0x2f, 0xba, 0x3d, 0xe3, 0x0f, 0x52, 
-0x1a, 0x9d, 0x06, 0xe0, 0xab, 0xfc, 0x55, 0xe5, 0xae, 0xf6, 0xc6, 0x2e, 0xa1, 0x69, 0x1a, 0xf6, 
-0x94, 0xce, 0x81, 0xe1, 0x10, 0xb7, 0x93, 0x3d, 0x94, 0x6d, 0x7e, 0x06, 0xa6, 0xc7, 0xb7, 0x78, 
-0xe6, 0x33, 0xd8, 0x52, 0x21, 0x37, 0xe0, 0x6e, 0xbb, 0x1f, 0x06, 0xc1, 0x8e, 0x4c, 0xb3, 0x7f, 
-0x94, 0x5a, 0xd9, 0x47, 0x66, 0xd1, 0x3b, 0xed, 0x7c, 0x67, 0xf2, 0xd9, 0xbd, 0x85, 0xe6, 0x90, 
-0xb2, 0xd5, 0x2d, 0xbc, 0x44, 0x8e, 0x1b, 0x7e, 0xdc, 0x96, 0xef, 0x62, 0x2f, 0xc8, 0x10, 0x3d, 
-0xd8, 0xa6, 0x91, 0xe5, 0x3d, 0xf8, 0xac, 0x6d, 0xdb, 0xb9, 0x58, 0xc9, 0x4c, 0x02, 0xa4, 0x67, 
-0xfe, 0x14, 0xa1, 0x5d, 0xf4, 0x1d, 0xaa, 0x86, 0xd4, 0xb5, 0xa4, 0x50, 0x18, 0xaf, 0xf1, 0x33, 
-0x72, 0x20, 0xfe, 0x99, 0x70, 0xe1, 0xbd, 0x87, 0x12, 0xee, 0x56, 0x0d, 0xae, 0x41, 0x06, 0xed, 
-0x15, 0x56, 0xb3, 0xdb, 0x6d, 0xc4, 0x2b, 0x15, 0xb6, 0xda, 0x7c, 0x5b, 0x23, 0xb8, 0x9d, 0x3a, 
-0x12, 0xfd, 0x7a, 0x8b, 0x4d, 0x64, 0x05, 0xa2, 0x8c, 0x1f, 0x0c, 0xf4, 0x40, 0x94, 0xe6, 0x31, 
-0xac, 0x99, 0x68, 0xf3, 0x8c, 0x5e, 0x13, 0x42, 0xcb, 0x19, 0x4d, 0xeb, 0x81, 0x2e, 0xe0, 0x05, 
-0x6b, 0xbb, 0xf7, 0xa0, 0x17, 0xb5, 0x3b, 0xa5, 0xd0, 0xe6, 0x22, 0x80, 0xf8, 0x91, 0xe4, 0x4f, 
-0xc7, 0x96, 0xec, 0x58, 0x22, 0x7c, 0xd0, 0x94, 0xef, 0x83, 0x5a, 0xce, 0x16, 0x64, 0x85, 0xc1, 
-0x1e, 0x40, 0x76, 0x92, 0x47, 0xc0, 0xd3, 0x31, 0x44, 0x67, 0xad, 0x39, 0x57, 0xea, 0x63, 0x22, 
-0x2b, 0xbe, 0x44, 0xf1, 0x8c, 0x67, 0x3a, 0xf4, 0x1e, 0xa9, 0x0d, 0x73, 0x8f, 0xb0, 0x5a, 0x2d, 
-0x99, 0xf8, 0xad, 0x35, 0xdb, 0x24, 0xf8, 0x11, 0x2b, 0x6e, 0x06, 0xb7, 0x81, 0x2c, 0x5d, 0xa2, 
-0xca, 0x1b, 0x92, 0x5a, 0x46, 0x2c, 0x76, 0x21, 0x40, 0xa0, 0x7e, 0x02, 0xfd, 0x70, 0xc4, 0x0d, 
-0x4b, 0xaa, 0x3a, 0x86, 0x4e, 0xff, 0x8f, 0x23, 0x7f, 0x57, 0x0a, 0xc0, 0x67, 0x2a, 0x97, 0x4e, 
-0x1d, 0xfd, 0x29, 0xae, 0x33, 0x81, 0xea, 0x54, 0x78, 0x8d, 0x3a, 0xb7, 0x2c, 0xe0, 0xc3, 0x73, 
-0x62, 0x43, 0xff, 0x76, 0xdc, 0x5e, 0x47, 0xa3, 0x84, 0x56, 0x8c, 0x01, 0x60, 0x40, 0x9d, 0x52, 
-0x68, 0xba, 0xdc, 0x8f, 0xf9, 0x66, 0xa3, 0xe2, 0x8c, 0xcb, 0xfe, 0x9f, 0x0f, 0xac, 0x77, 0xd1, 
-0x65, 0x01, 0xed, 0xca, 0x4d, 0x72, 0x06, 0xe9, 0xc3, 0x20, 0x6a, 0xdf, 0xad, 0x1c, 0xe5, 0x2a, 
-0xc8, 0x68, 0xdf, 0xa7, 0x83, 0xb7, 0x09, 0x79, 0xf7, 0x12, 0x56, 0xca, 0x34, 0x7a, 0xfd, 0xde, 
-0x86, 0x63, 0xc0, 0xaa, 0xd9, 0x45, 0x5f, 0xc3, 0x3a, 0x1b, 0x2a, 0xd0, 0x03, 0xed, 0x7a, 0x60, 
-0x12, 0x44, 0xa0, 0x5b, 0xaf, 0x3d, 0xb8, 0x24, 0x7f, 0x44, 0x6f, 0xa3, 0x09, 0xf4, 0xb0, 0x63, 
-0x26, 0x45, 0xf7, 0x79, 0x24, 0xb5, 0x46, 0x70, 0x96, 0x07, 0x5c, 0xdd, 0x21, 0x0c, 0x7a, 0x9c, 
-0xde, 0x04, 0xf2, 0x1e, 0x9d, 0x79, 0xd2, 0xa3, 0xa2, 0x12, 0xd0, 0x5b, 0x22, 0xdd, 0x14, 0x87, 
-0x56, 0xbc, 0x43, 0xfb, 0xcf, 0x16, 0xef, 0xd5, 0x7b, 0x41, 0x87, 0x56, 0x74, 0x9c, 0x64, 0xcf, 
-0xbc, 0xec, 0x9e, 0x23, 0xe2, 0x96, 0xbe, 0x0c, 0xe5, 0x34, 0xb3, 0x12, 0x9c, 0xde, 0xb8, 0x50, 
-0xf9, 0x17, 0xdb, 0x60, 0x99, 0x27, 0x55, 0xe9, 0x66, 0xcc, 0x16, 0xe4, 0x0b, 0x9e, 0x74, 0xed, 
-0x4b, 0x2d, 0xf5, 0xb4, 0x47, 0xde, 0x00, 0xc4, 0x7c, 0x3f, 0x68, 0x8b, 0xf3, 0x1c, 0xb2, 0x3e, 
-0x28, 0xcc, 0xe6, 0x0a, 0x6d, 0x49, 0x91, 0x0c, 0xe8, 0x26, 0x02, 0x98, 0x2e, 0x8d, 0xbf, 0x0e, 
-0xda, 0xe6, 0x39, 0xc1, 0xf0, 0x27, 0xcc, 0xfb, 0x07, 0x3c, 0x7f, 0x4a, 0x19, 0xbc, 0x37, 0x26, 
-0x70, 0x49, 0x1e, 0x34, 0x51, 0x8f, 0x3d, 0xfb, 0x54, 0x98, 0x37, 0xa8, 0xf9, 0x8a, 0xdc, 0x62, 
-0x93, 0x46, 0xb9, 0x2d, 0x3c, 0xd1, 0x77, 0x52, 0xfe, 0x97, 0x48, 0x59, 0x16, 0xd5, 0x63, 0x50, 
-0xbd, 0xdd, 0x2a, 0x9e, 0xad, 0x4a, 0xbb, 0x03, 0x2d, 0xf0, 0x3a, 0x08, 0x8e, 0x20, 0x76, 0x9d, 
-0xf0, 0x91, 0xad, 0x62, 0x88, 0x4b, 0xe1, 0x2b, 0x8d, 0x70, 0xc7, 0x0a, 0x76, 0x14, 0xdc, 0x65, 
-0x06, 0xd3, 0xb4, 0xdb, 0x8a, 0x48, 0x73, 0x35, 0xca, 0xba, 0xa6, 0x39, 0x91, 0xd8, 0xf2, 0x32, 
-0xcf, 0xec, 0x84, 0xb5, 0xf8, 0xab, 0xea, 0x52, 0x26, 0x74, 0xc7, 0x89, 0x46, 0x08, 0xc1, 0x15, 
-0x73, 0x38, 0xeb, 0x98, 0xb5, 0x74, 0x48, 0x9c, 0xca, 0xe2, 0x29, 0x64, 0x9e, 0x84, 0x4d, 0x0b, 
-0x63, 0xc7, 0x17, 0xf1, 0xcb, 0x01, 0x47, 0x38, 0x8b, 0x50, 0x79, 0x41, 0xf5, 0x15, 0x50, 0x75, 
-0x44, 0x88, 0x6e, 0xf6, 0xcd, 0x0a, 0x65, 0x98, 0xc5, 0x72, 0x36, 0xae, 0xcd, 0x3c, 0xb7, 0x9f, 
-0x8b, 0x23, 0xbd, 0x6e, 0xb1, 0xd6, 0x5c, 0xac, 0xc3, 0xd1, 0x9b, 0x20, 0x75, 0x8c, 0xed, 0x5b, 
-0xa0, 0xd5, 0x09, 0x9a, 0xcf, 0x5d, 0xc3, 0xdf, 0x06, 0x64, 0xad, 0x82, 0x9a, 0xd5, 0x54, 0x32, 
-0xa1, 0xcb, 0xbd, 0x68, 0xd3, 0x14, 0xf6, 0x6c, 0x27, 0xb0, 0x4a, 0xa7, 0x7e, 0x15, 0x72, 0xb0, 
-0x2d, 0xa7, 0xc5, 0x25, 0xd1, 0x94, 0x7b, 0xd6, 0xac, 0x61, 0x80, 0xc7, 0xef, 0xde, 0x09, 0xbb, 
-0x22, 0x84, 0xc1, 0x6a, 0x19, 0x42, 0x28, 0xac, 0x7d, 0xd6, 0x00, 0x9f, 0xf0, 0x94, 0x5d, 0xb4, 
-0x36, 0x10, 0xbf, 0x75, 0x2c, 0xfa, 0x8e, 0x1e, 0x39, 0x87, 0x74, 0x06, 0xe6, 0x20, 0x93, 0x6c, 
-0xa7, 0x9a, 0x7a, 0x52, 0xfc, 0xb6, 0xcf, 0x14, 0x7f, 0x50, 0xd7, 0x75, 0x35, 0x9a, 0x1c, 0xcc, 
-0xf9, 0xb4, 0x35, 0xf0, 0xd0, 0x49, 0x86, 0xf3, 0xa8, 0x37, 0x1c, 0x60, 0x2d, 0xc4, 0x9f, 0x03, 
-0xdf, 0x6b, 0x0e, 0x50, 0xc6, 0x02, 0xa0, 0x14, 0x53, 0xa5, 0x29, 0x4d, 0x6d, 0x3a, 0x5f, 0x8b, 
-0xbb, 0xa4, 0x5a, 0xdb, 0xb3, 0xff, 0x31, 0x53, 0xe1, 0x88, 0x51, 0x0a, 0x32, 0xff, 0xd5, 0x02, 
-0x6b, 0x92, 0x7c, 0x07, 0xb7, 0x3b, 0xc3, 0xa8, 0x27, 0xe1, 0xa1, 0x2f, 0xb6, 0x7d, 0xe7, 0xab, 
-0xda, 0x1a, 0xc9, 0xb1, 0x6b, 0x8c, 0xdc, 0xaf, 0xfc, 0xc4, 0x28, 0x4e, 0x7b, 0xab, 0x32, 0xea, 
-0x07, 0x58, 0x8b, 0xed, 0x11, 0x83, 0xf3, 0x05, 0x33, 0xf9, 0x46, 0x80, 0x2a, 0x3e, 0x1d, 0x03, 
-0x6c, 0x38, 0x84, 0x60, 0x0f, 0xcd, 0xaf, 0x37, 0x13, 0xb5, 0xe7, 0x74, 0x43, 0x0f, 0x7c, 0x92, 
-0x9f, 0xf4, 0x45, 0x23, 0xfc, 0xbd, 0x17, 0xef, 0x80, 0x59, 0x88, 0x38, 0xea, 0x53, 0x3f, 0x9b, 
-0xcd, 0x63, 0x1b, 0xd5, 0x91, 0x55, 0xdd, 0x47, 0x95, 0xeb, 0x5f, 0x73, 0xf3, 0x58, 0x0c, 0x44, 
-0xf5, 0x04, 0xba, 0x96, 0x67, 0x28, 0x7e, 0xa2, 0x49, 0xe9, 0x0e, 0x2f, 0xe2, 0x9c, 0xc7, 0x51, 
-0x33, 0xed, 0x58, 0x70, 0x19, 0x84, 0xc5, 0x08, 0xd9, 0x85, 0xf1, 0xb0, 0x3c, 0x9d, 0xc2, 0xea, 
-0xa6, 0xcf, 0x46, 0xf0, 0x66, 0xd4, 0x37, 0xc7, 0x59, 0x16, 0xd7, 0xc5, 0x6d, 0x35, 0x58, 0xa8, 
-0xe8, 0x42, 0x0c, 0xff, 0xb6, 0xc3, 0x57, 0xa9, 0x82, 0x4e, 0x1b, 0x67, 0x90, 0xbd, 0x30, 0x57, 
-0x93, 0x78, 0xf7, 0x50, 0xe4, 0x18, 0xfe, 0x57, 0x85, 0x1f, 0x99, 0xe4, 0x73, 0x5d, 0x81, 0xe1, 
-0x68, 0xbe, 0x10, 0xcb, 0x8f, 0x06, 0xc6, 0x16, 0xfb, 0x33, 0x0e, 0x6c, 0x24, 0x93, 0x61, 0xed, 
-0xc5, 0x65, 0xac, 0xcb, 0x7d, 0x61, 0xa6, 0x25, 0xb2, 0x37, 0xf2, 0x5a, 0xe7, 0x22, 0x71, 0xfa, 
-0x8c, 0x52, 0x6c, 0x0f, 0x93, 0x5b, 0x20, 0x6b, 0x0a, 0xf9, 0x33, 0x60, 0x04, 0xd1, 0x2f, 0x1f, 
-0x5b, 0x02, 0xa3, 0xe3, 0x3d, 0x1a, 0x85, 0xd2, 0x46, 0xbd, 0xe0, 0x1f, 0x4f, 0x68, 0xd3, 0x78, 
-0x5d, 0xa4, 0xda, 0x55, 0xf1, 0xbb, 0x89, 0xe3, 0x94, 0x16, 0xeb, 0xd7, 0xa3, 0x51, 0x26, 0x83, 
-0xf2, 0x63, 0x23, 0x52, 0xa9, 0xfb, 0x2d, 0x6d, 0x4d, 0xbb, 0x11, 0x5c, 0x76, 0x3a, 0xa9, 0x6a, 
-0xda, 0x47, 0x1b, 0xae, 0x9e, 0x79, 0xb6, 0x82, 0x04, 0xfa, 0x77, 0x31, 0xe8, 0x0b, 0xbd, 0x84, 
-0x1e, 0xd8, 0x00, 0xa0, 0x31, 0xb2, 0xe8, 0xc2, 0x85, 0x2f, 0xe3, 0x41, 0x13, 0xb0, 0x5b, 0xc9, 
-0x71, 0xd5, 0x91, 0x5d, 0xb6, 0x74, 0x0b, 0xf6, 0x16, 0x89, 0xca, 0xb2, 0x4b, 0xf9, 0x26, 0x42, 
-0xa4, 0x6a, 0x22, 0xd1, 0x60, 0x00, 0x4b, 0x6d, 0x0e, 0x5d, 0xb7, 0x1b, 0x8b, 0x54, 0x7f, 0xf9, 
-0xe2, 0x43, 0xaf, 0x29, 0x1a, 0x97, 0xdc, 0x06, 0x2f, 0xc7, 0x6c, 0x23, 0xde, 0x10, 0x3e, 0x69, 
-0x01, 0xe7, 0x9c, 0xda, 0x26, 0xa4, 0x17, 0xe3, 0xc9, 0x0f, 0xbc, 0x9c, 0x7c, 0x90, 0xb7, 0x41, 
-0xd1, 0xee, 0xb2, 0x30, 0xfb, 0x43, 0x27, 0xb0, 0x3b, 0xfe, 0x78, 0x33, 0xe6, 0xa6, 0xd7, 0x7f, 
-0x40, 0xe2, 0x4e, 0xcf, 0x7d, 0x3e, 0xe0, 0xbc, 0xfb, 0x42, 0x28, 0xe3, 0x18, 0xc0, 0x3e, 0xee, 
-0x51, 0x17, 0xcd, 0xa7, 0x47, 0xd6, 0x96, 0x02, 0xbb, 0x43, 0xed, 0xd8, 0x3a, 0xff, 0xbf, 0xa2, 
-0x82, 0x56, 0x92, 0xa4, 0xef, 0x3e, 0x9d, 0x82, 0xcd, 0x69, 0x8d, 0xb9, 0x60, 0xf0, 0x94, 0x6d, 
-0x28, 0xa1, 0x7a, 0x30, 0xa9, 0x97, 0x43, 0xe3, 0x1b, 0xc4, 0x91, 0x08, 0x9b, 0x62, 0xca, 0x48, 
-0xfb, 0x57, 0xa9, 0x43, 0x31, 0xfc, 0x6f, 0xc1, 0x49, 0x8f, 0xc6, 0x34, 0xdd, 0xb7, 0x1e, 0xd6, 
-0x35, 0xca, 0x89, 0xea, 0xd1, 0x00, 0x8d, 0x25, 0xb5, 0x08, 0xf3, 0xce, 0x23, 0x0d, 0xdd, 0x2d, 
-0x59, 0x95, 0xc6, 0x43, 0x68, 0x9c, 0xf5, 0x38, 0x6d, 0x4f, 0x89, 0xcc, 0x15, 0x4d, 0x6d, 0x9a, 
-0x18, 0xa5, 0x57, 0x76, 0xd1, 0xe8, 0x36, 0xf4, 0x17, 0x3f, 0xab, 0xfc, 0x4a, 0x83, 0xda, 0xbb, 
-0x68, 0xa6, 0x24, 0xe6, 0x0b, 0x65, 0x9c, 0x7a, 0xec, 0x50, 0x15, 0x8b, 0xe5, 0x7c, 0xda, 0x26, 
-0x94, 0xff, 0x30, 0xa1, 0xc3, 0x10, 0xb2, 0x26, 0x0c, 0x8a, 0x64, 0xf4, 0x82, 0xec, 0x48, 0x65, 
-0xba, 0x86, 0x9f, 0x5c, 0x7d, 0x90, 0xf5, 0xd6, 0x29, 0xc0, 0x42, 0x7c, 0x55, 0xfe, 0x70, 0xb1, 
-0x41, 0x28, 0x6b, 0xd0, 0x3a, 0x0a, 0x67, 0xa8, 0x2b, 0x7a, 0x60, 0x12, 0x89, 0xbd, 0xd1, 0x95, 
-0x18, 0x8a, 0xda, 0x9c, 0x63, 0x21, 0x4c, 0x6f, 0x99, 0xb4, 0x8c, 0xee, 0xac, 0x01, 0x9b, 0x82, 
-0xb8, 0x00, 0x6f, 0xa0, 0x91, 0x56, 0x85, 0xdb, 0x77, 0xbd, 0x89, 0x2e, 0x0f, 0x81, 0x5d, 0x32, 
-0xcf, 0x7a, 0x1f, 0xad, 0x89, 0x4c, 0xd2, 0x2b, 0x42, 0xc4, 0xe2, 0x26, 0xba, 0x72, 0x54, 0xab, 
-0xe9, 0x37, 0x13, 0xd9, 0x23, 0xc2, 0x55, 0xff, 0x15, 0xb5, 0x62, 0xf8, 0xc8, 0x0d, 0xbc, 0x2a, 
-0xaf, 0x3b, 0x73, 0x17, 0xe0, 0x34, 0x7a, 0x23, 0xb4, 0x74, 0x06, 0xbb, 0x7e, 0xdd, 0x08, 0x9c, 
-0x1a, 0xd8, 0x79, 0x02, 0x87, 0x97, 0x61, 0xf0, 0x7e, 0x19, 0xab, 0x2c, 0x9e, 0x4e, 0xc5, 0xf7, 
-0x3d, 0x77, 0x93, 0x6e, 0x5f, 0xfc, 0x4a, 0xc0, 0xec, 0xa8, 0x11, 0x88, 0xb7, 0x27, 0x5d, 0xca, 
-0x10, 0xfe, 0xbb, 0x3a, 0x7d, 0xdc, 0x21, 0x5f, 0x3e, 0xd9, 0xfa, 0x22, 0xa0, 0x89, 0x02, 0x95, 
-0x66, 0x2a, 0x79, 0x08, 0xcc, 0x22, 0x5a, 0x3a, 0x97, 0x44, 0x78, 0x31, 0x90, 0xcf, 0xba, 0xe1, 
-0x30, 0xad, 0xc6, 0x44, 0xa2, 0x32, 0xb4, 0xc9, 0x82, 0x51, 0xe0, 0x78, 0x40, 0xdb, 0x9b, 0x4c, 
-0x72, 0xbe, 0xa0, 0x00, 0x3e, 0xb4, 0x75, 0x90, 0xf6, 0x19, 0xe5, 0xb1, 0x30, 0x4a, 0xa5, 0x74, 
-0x94, 0x5e, 0xb1, 0x0d, 0xea, 0x3b, 0x03, 0x82, 0x60, 0xec, 0x4b, 0xac, 0x22, 0xd9, 0xe8, 0x4d, 
-0x0f, 0x94, 0x3c, 0xda, 0xa7, 0x1d, 0x6c, 0xed, 0x4b, 0x5b, 0x04, 0x43, 0xf0, 0xbd, 0x2c, 0xf5, 
-0x09, 0x1e, 0x63, 0x2e, 0x18, 0xc9, 0x4d, 0x69, 0x8c, 0xe8, 0xd4, 0x49, 0xf7, 0x0f, 0x2d, 0x9a, 
-0x0b, 0x62, 0xfd, 0x9c, 0x6a, 0xdd, 0xf1, 0xb3, 0x14, 0x9e, 0x58, 0xc3, 0x05, 0x72, 0x18, 0x99, 
-0xf2, 0x75, 0x0d, 0x4a, 0x86, 0x18, 0xdf, 0x09, 0x48, 0xf3, 0x9b, 0x7f, 0x44, 0x05, 0xae, 0x38, 
-0xda, 0x8d, 0x01, 0x40, 0xe7, 0x6e, 0x56, 0x89, 0xfe, 0x63, 0xd1, 0x4d, 0xaa, 0xf5, 0x10, 0xa1, 
-0xd9, 0x2c, 0xc8, 0x66, 0x1d, 0x91, 0x5d, 0xb2, 0x3e, 0xf8, 0xa4, 0x58, 0xe9, 0x46, 0x0c, 0xa1, 
-0x55, 0xe5, 0x6f, 0x40, 0x65, 0xde, 0x7d, 0x5d, 0xa3, 0xe3, 0x50, 0xc4, 0x36, 0x85, 0xa2, 0x6c, 
-0x3a, 0x20, 0x51, 0xf2, 0xd0, 0x03, 0xa4, 0x7a, 0xb1, 0x98, 0x63, 0xe5, 0xaa, 0x8f, 0xf7, 0xc7, 
-0xaf, 0x8d, 0x09, 0x69, 0x46, 0xc3, 0x52, 0xae, 0xdc, 0xc0, 0xe5, 0xa2, 0x34, 0x8f, 0xaf, 0xe3, 
-0x10, 0xff, 0xbf, 0xdc, 0x52, 0x3a, 0x17, 0x5a, 0x03, 0x94, 0x70, 0xee, 0x0f, 0x57, 0xf6, 0x19, 
-0x3d, 0xad, 0x07, 0x6b, 0xf4, 0x2e, 0x63, 0xec, 0xd0, 0x33, 0xe5, 0x5b, 0xc9, 0xa4, 0x0d, 0xd0, 
-0x27, 0x53, 0x41, 0x07, 0xec, 0xce, 0x1f, 0x0c, 0xef, 0x34, 0xcf, 0x88, 0x65, 0xc3, 0xd4, 0x9f, 
-0xdc, 0x8f, 0x07, 0xfa, 0x86, 0x5a, 0x76, 0xc2, 0xf9, 0xcd, 0xba, 0x4a, 0xf3, 0x57, 0x0a, 0x7d, 
-0xc9, 0xb8, 0xaa, 0x74, 0x13, 0x85, 0xad, 0x5a, 0xd1, 0xc2, 0xa3, 0x75, 0xf9, 0x5b, 0xdc, 0x32, 
-0x57, 0x1a, 0x81, 0x37, 0x69, 0xca, 0xe6, 0xaa, 0x40, 0xd2, 0x4c, 0x1c, 0xc7, 0xab, 0x4f, 0x3f, 
-0x68, 0xe3, 0x82, 0x31, 0xf4, 0x64, 0xde, 0xb4, 0x5c, 0x1e, 0xaa, 0xd7, 0x66, 0xfe, 0xc1, 0x7b, 
-0x29, 0xb2, 0x56, 0x71, 0xce, 0xa4, 0xe6, 0x78, 0x4a, 0xc0, 0x58, 0x80, 0x93, 0x18, 0xda, 0xa0, 
-0x04, 0x7e, 0xea, 0x29, 0x85, 0xba, 0x6b, 0x51, 0x3c, 0x87, 0xe5, 0x99, 0xf4, 0x38, 0xd1, 0xe8, 
-0x6b, 0x2e, 0xbb, 0x15, 0x70, 0xd0, 0x3a, 0xc2, 0xb3, 0x04, 0x94, 0xfb, 0xba, 0x0d, 0x1c, 0x32, 
-0xd0, 0x13, 0x2a, 0xaa, 0xe7, 0x19, 0xd5, 0x07, 0x8e, 0xdc, 0xb1, 0x73, 0x3b, 0xe6, 0x4a, 0xd9, 
-0x2f, 0x21, 0x44, 0x0d, 0x59, 0x2a, 0x05, 0x72, 0x32, 0x7b, 0xcb, 0xb6, 0x2d, 0x7f, 0xfd, 0x20, 
-0x43, 0x85, 0x15, 0x55, 0x6b, 0xee, 0x02, 0x72, 0xd0, 0x60, 0x1c, 0x82, 0xa0, 0xf5, 0x74, 0x88, 
-0xcc, 0xfd, 0x62, 0x28, 0xbe, 0x91, 0x74, 0x65, 0xe8, 0x9a, 0xd2, 0x21, 0xba, 0x92, 0x04, 0xa9, 
-0x1d, 0x7d, 0x94, 0x4e, 0xda, 0x20, 0x38, 0x5d, 0xdf, 0xac, 0x95, 0xc3, 0x6f, 0x60, 0xb8, 0x83, 
-0x51, 0xdf, 0x18, 0xa9, 0x23, 0x94, 0x4e, 0x33, 0x1f, 0xb7, 0x72, 0xc5, 0x30, 0xa3, 0x17, 0x8d, 
-0x24, 0x68, 0x00, 0x82, 0x9b, 0x36, 0xd7, 0x9f, 0x22, 0x30, 0xf7, 0xd3, 0x52, 0x97, 0xdf, 0x78, 
-0x35, 0xea, 0x51, 0x41, 0xba, 0x8f, 0x0e, 0xc3, 0x2e, 0xb2, 0xc4, 0xa5, 0x20, 0xb5, 0x5b, 0x70, 
-0x23, 0xe8, 0xb6, 0x3a, 0x74, 0x27, 0x08, 0x93, 0xfc, 0x25, 0xd5, 0x48, 0x92, 0xa7, 0x10, 0x7e, 
-0x34, 0xec, 0x8f, 0xc8, 0x2e, 0x9a, 0x3b, 0x5e, 0x91, 0xc7, 0x1c, 0xfa, 0x30, 0x8a, 0x65, 0x0f, 
-0x9b, 0x20, 0xef, 0xd2, 0x26, 0xb7, 0x35, 0xee, 0x46, 0x1f, 0xc0, 0x98, 0x3e, 0x02, 0xcc, 0x92, 
-0xf7, 0x5d, 0x17, 0x47, 0xab, 0x54, 0x28, 0x85, 0x0e, 0x4f, 0x8b, 0xca, 0x26, 0x81, 0xfa, 0x68, 
-0x2a, 0x48, 0xd5, 0x22, 0x84, 0xaf, 0xe8, 0x9a, 0x6c, 0x89, 0xbb, 0x03, 0x45, 0x97, 0xb5, 0x62, 
-0x7b, 0xc8, 0x2c, 0x61, 0x82, 0x1c, 0x91, 0x57, 0xee, 0x86, 0xd1, 0xf4, 0x9d, 0xbf, 0xd5, 0x45, 
-0xea, 0x14, 0x4d, 0xf1, 0xe1, 0x10, 0x71, 0xd1, 0x5f, 0x9b, 0xf5, 0xb4, 0xd3, 0x47, 0x9e, 0x2d, 
-0x88, 0x4e, 0xa9, 0x06, 0x6a, 0xb4, 0xd6, 0x24, 0x4b, 0x38, 0xb2, 0x83, 0xdd, 0x40, 0xa8, 0x0a, 
-0xc1, 0x2c, 0x5e, 0x80, 0x45, 0xcb, 0x56, 0x87, 0x3d, 0xfd, 0x11, 0x2a, 0x6f, 0x87, 0xf9, 0xbf, 
-0x81, 0x73, 0x34, 0xd9, 0x16, 0x8d, 0xf8, 0x3b, 0xc5, 0x9d, 0x71, 0x48, 0xf0, 0xb5, 0x11, 0x76, 
-0xf5, 0x56, 0x14, 0x98, 0x46, 0xf0, 0xb5, 0x38, 0x56, 0xa2, 0xe3, 0x71, 0x29, 0xc3, 0x63, 0x42, 
-0xe5, 0x6e, 0x90, 0x1d, 0x39, 0xc9, 0x01, 0x46, 0x91, 0x13, 0x86, 0xe3, 0x23, 0x9e, 0x6e, 0x84, 
-0xda, 0x62, 0x0c, 0x50, 0xdf, 0x89, 0x08, 0xf5, 0x94, 0x7e, 0x03, 0x8e, 0xe0, 0xed, 0x85, 0xc4, 
-0xa5, 0x71, 0x0a, 0xbc, 0xe7, 0x3d, 0xcb, 0x4e, 0xbd, 0x6a, 0x40, 0x0a, 0x52, 0xb3, 0x11, 0xd3, 
-0xe7, 0x69, 0x07, 0xdf, 0xbb, 0x51, 0x28, 0xf7, 0xc7, 0x6f, 0xa3, 0x3b, 0xab, 0x50, 0x77, 0x60, 
-0xce, 0xad, 0x6e, 0x56, 0xda, 0x5f, 0xe9, 0x20, 0xb0, 0x0a, 0xd3, 0x7a, 0xc4, 0x01, 0x74, 0xc8, 
-0x9d, 0xe1, 0x63, 0xf3, 0xb0, 0x9b, 0x1a, 0xe0, 0x8d, 0x77, 0xc5, 0x5f, 0x38, 0x53, 0xc3, 0x45, 
-0xfe, 0x59, 0xd9, 0x7f, 0xf1, 0x54, 0x23, 0xf8, 0x42, 0xe4, 0x0a, 0x9e, 0xfb, 0xad, 0xc3, 0x70, 
-0x15, 0xb6, 0x68, 0x78, 0x35, 0x50, 0x83, 0xb4, 0x5b, 0x9a, 0xa8, 0x61, 0x92, 0x3b, 0xa2, 0xbb, 
-0x30, 0x06, 0x74, 0x3b, 0x1b, 0x80, 0xc3, 0xf4, 0xb2, 0x3c, 0xc7, 0xf0, 0x2c, 0x45, 0x0d, 0xa8, 
-0xe3, 0x9b, 0x1c, 0x09, 0xca, 0x50, 0x22, 0xd7, 0x89, 0x4c, 0xf0, 0x13, 0xb0, 0xf8, 0x6d, 0xe2, 
-0xb7, 0x62, 0xab, 0xc1, 0xeb, 0x9d, 0x65, 0x14, 0x48, 0x02, 0xfd, 0x58, 0xa2, 0x45, 0x29, 0xad, 
-0x69, 0x04, 0xfc, 0x2d, 0x7d, 0xda, 0x5d, 0xc9, 0xa9, 0x3d, 0xdf, 0x64, 0xce, 0x05, 0x6c, 0xd6, 
-0xf4, 0x44, 0xb1, 0x1a, 0xea, 0x8c, 0xf9, 0xb3, 0x83, 0x08, 0x5e, 0xbe, 0xec, 0x68, 0x24, 0xb8, 
-0xfc, 0x6b, 0xaf, 0x06, 0xd6, 0x39, 0xec, 0x16, 0xee, 0x73, 0x98, 0xfe, 0x7b, 0x45, 0xc0, 0x36, 
-0x53, 0xc9, 0x66, 0xa2, 0x56, 0xba, 0x60, 0x1a, 0x38, 0x52, 0xaf, 0x61, 0x1c, 0x29, 0x87, 0xfb, 
-0x00, 0x97, 0xe4, 0x82, 0xf2, 0x75, 0xa5, 0x22, 0x86, 0x4c, 0xa2, 0x3f, 0x92, 0x15, 0xd5, 0x81, 
-0x32, 0xe3, 0x0c, 0x67, 0xfc, 0x06, 0xc8, 0x9b, 0x2c, 0x86, 0x0b, 0xfa, 0x1a, 0xa4, 0x7a, 0x32, 
-0xc1, 0x6e, 0xa2, 0x2f, 0xf0, 0x8e, 0xb3, 0xfe, 0x20, 0xa9, 0x42, 0x0c, 0x33, 0x4c, 0x5c, 0xaa, 
-0x12, 0xf3, 0xa5, 0x0b, 0xed, 0x70, 0x8e, 0x26, 0x0c, 0xa7, 0x3b, 0x66, 0xc6, 0x72, 0xd1, 0x33, 
-0xa6, 0x58, 0x17, 0xc0, 0x46, 0x32, 0x0d, 0xdf, 0x3d, 0xa6, 0x02, 0xc6, 0xe2, 0x1a, 0x95, 0xfe, 
-0x1f, 0xdd, 0x29, 0x0a, 0xd6, 0x54, 0x1b, 0x88, 0xe9, 0x4d, 0xc9, 0x92, 0xe1, 0x27, 0x57, 0x65, 
-0x14, 0xe5, 0x22, 0x92, 0xde, 0x5e, 0x8e, 0xc2, 0x68, 0x7a, 0xf4, 0x5e, 0xeb, 0x9d, 0x7c, 0xfb, 
-0x37, 0x71, 0xa3, 0xde, 0x8e, 0x1d, 0x34, 0x0d, 0xd4, 0x48, 0x78, 0xcf, 0x06, 0x40, 0xb3, 0xe6, 
-0xa6, 0xca, 0x86, 0x24, 0xbd, 0x78, 0xe6, 0x13, 0xd7, 0x5a, 0x90, 0xbf, 0x3a, 0x08, 0x8d, 0xea, 
-0x27, 0x85, 0xbe, 0x7b, 0x23, 0xe5, 0x84, 0x99, 0x0c, 0x7d, 0x32, 0xcb, 0x58, 0x06, 0x4d, 0x18, 
-0xa5, 0xdb, 0x3f, 0x9d, 0x7d, 0xa8, 0xe3, 0x5c, 0x9f, 0x2b, 0xcc, 0x7e, 0x64, 0x4c, 0xb7, 0xa9, 
-0x05, 0x3e, 0x25, 0xce, 0x31, 0x17, 0xa1, 0xda, 0xaf, 0x15, 0xfb, 0x31, 0x0f, 0x41, 0xd3, 0x7a, 
-0xea, 0xca, 0x8a, 0xf7, 0x79, 0x9e, 0x59, 0xd9, 0xa4, 0x24, 0xce, 0x60, 0x1b, 0xdd, 0x43, 0xf8, 
-0xbe, 0x34, 0x7d, 0xaf, 0x6c, 0xef, 0x5c, 0xac, 0x43, 0x8c, 0x55, 0xbe, 0x7f, 0xe5, 0x8f, 0x12, 
-0xf4, 0xdf, 0x38, 0xb4, 0xc7, 0x8d, 0x41, 0xdd, 0x4d, 0x83, 0xea, 0x40, 0x65, 0x1b, 0x49, 0x5b, 
-0x39, 0x72, 0xda, 0x93, 0xea, 0x78, 0xd9, 0xbb, 0x3e, 0x51, 0x2f, 0x97, 0xdb, 0x16, 0xab, 0xcd, 
-0x79, 0xe6, 0x1d, 0xa0, 0x2d, 0x90, 0x10, 0x84, 0xbc, 0x96, 0xec, 0x6c, 0x8a, 0xd1, 0x62, 0x9a, 
-0xf8, 0x4e, 0x8f, 0x24, 0x5f, 0xac, 0x08, 0x68, 0x3a, 0xbf, 0x6e, 0x82, 0xc5, 0xb3, 0xf0, 0x65, 
-0xd9, 0xac, 0x10, 0xfa, 0x69, 0xb9, 0x09, 0xd6, 0x98, 0x7a, 0x6e, 0x54, 0xba, 0x80, 0xfa, 0x33, 
-0x13, 0x53, 0xbc, 0x3c, 0x2e, 0x6a, 0xb1, 0x14, 0xb9, 0xd0, 0x01, 0x55, 0x3c, 0x7a, 0xc2, 0x96, 
-0x28, 0xa0, 0x18, 0x59, 0x30, 0x90, 0x52, 0x1e, 0x2d, 0x97, 0x67, 0xee, 0x10, 0xce, 0x99, 0x4d, 
-0x81, 0x20, 0xa8, 0xe3, 0x52, 0xa3, 0x6b, 0x44, 0x9b, 0x01, 0xff, 0x36, 0xb0, 0x4b, 0x5c, 0x2b, 
-0xbb, 0xd2, 0x65, 0x92, 0xaa, 0xbf, 0x79, 0x35, 0xcc, 0x55, 0xff, 0x10, 0x2d, 0x4d, 0x89, 0x1a, 
-0xd8, 0x3c, 0x55, 0x98, 0xf7, 0x2a, 0xcf, 0x04, 0x8c, 0xbc, 0xe6, 0x67, 0x90, 0xf2, 0x5e, 0x75, 
-0x26, 0x46, 0xd4, 0x82, 0xaa, 0xf2, 0x94, 0x2a, 0x04, 0x9b, 0x43, 0x0f, 0xd0, 0xb3, 0x6f, 0x15, 
-0x47, 0x77, 0xb0, 0x36, 0xbc, 0x8d, 0x6c, 0x02, 0x59, 0xeb, 0x0f, 0xd7, 0x25, 0xc3, 0x02, 0x99, 
-0xb9, 0x18, 0xd0, 0x2b, 0x47, 0x1e, 0x6c, 0x40, 0x59, 0xa3, 0x4b, 0x77, 0x2a, 0x69, 0x07, 0xff, 
-0x98, 0x10, 0x25, 0xd9, 0xbd, 0x9b, 0xe4, 0xd1, 0x82, 0x07, 0xb7, 0x55, 0xc3, 0x21, 0x03, 0x86, 
-0x6f, 0xe3, 0xcb, 0x7d, 0xb8, 0x4a, 0xf5, 0x63, 0x35, 0xb9, 0x50, 0xf7, 0x06, 0xb0, 0xe9, 0x4c, 
-0x1c, 0x76, 0xd7, 0x51, 0x22, 0xf0, 0x77, 0xba, 0x2b, 0x7f, 0xce, 0xe9, 0x42, 0xbc, 0xef, 0x7c, 
-0xd1, 0x8d, 0x44, 0xf9, 0x31, 0x77, 0x00, 0x41, 0x26, 0x7d, 0x5a, 0x9f, 0x32, 0x85, 0xa9, 0x40, 
-0xfb, 0x30, 0xa5, 0xd1, 0x01, 0x3d, 0x20, 0xcd, 0xe8, 0xa3, 0x86, 0xd5, 0x93, 0x06, 0xdd, 0x45, 
-0x60, 0x24, 0x95, 0xc7, 0x66, 0xe8, 0xa7, 0x53, 0xf4, 0x86, 0xdf, 0xef, 0xba, 0x7e, 0xf4, 0xd1, 
-0x76, 0xde, 0x3e, 0x4f, 0xb1, 0x35, 0x6d, 0xf6, 0xb7, 0x41, 0xd2, 0x76, 0x16, 0xf6, 0xbc, 0x1a, 
-0xd4, 0x60, 0x4f, 0x91, 0x0f, 0xa5, 0xc7, 0xeb, 0x19, 0x51, 0xfe, 0x23, 0xe0, 0x12, 0x6b, 0xee, 
-0x95, 0x27, 0x74, 0xb1, 0xd3, 0xf4, 0x0b, 0xbf, 0x75, 0xec, 0x0f, 0xc3, 0x1c, 0x72, 0x93, 0x5e, 
-0x7a, 0xae, 0x0f, 0x56, 0xa7, 0xc8, 0x02, 0x87, 0xee, 0x97, 0x6d, 0xc0, 0x21, 0x4c, 0x6f, 0xb4, 
-0xdc, 0x65, 0x2f, 0xe1, 0x50, 0x38, 0xea, 0xbf, 0x30, 0xee, 0x55, 0x07, 0x9d, 0x4d, 0x2c, 0xcd, 
-0x95, 0xb6, 0x61, 0xfe, 0x49, 0x78, 0x38, 0xe9, 0x63, 0x75, 0xf7, 0x95, 0xa1, 0xdb, 0xc2, 0xb1, 
-0x81, 0xd4, 0x14, 0x93, 0xf0, 0x53, 0xd1, 0xa9, 0x63, 0xb8, 0x59, 0x88, 0x06, 0x6f, 0x32, 0x13, 
-0xc1, 0xf6, 0x2b, 0x89, 0x69, 0xa3, 0xd0, 0xff, 0x26, 0x9e, 0x07, 0x66, 0x23, 0x3d, 0x87, 0x01, 
-0xde, 0x95, 0x84, 0xca, 0x41, 0x5c, 0xdd, 0x69, 0xff, 0x39, 0x00, 0xb3, 0xa4, 0x3f, 0x06, 0x58, 
-0x1b, 0xdc, 0x38, 0x9f, 0x73, 0x89, 0x2e, 0x4d, 0x14, 0xe7, 0x9e, 0x1d, 0x4c, 0x99, 0xcc, 0xa5, 
-0x8d, 0xc0, 0x1d, 0x44, 0xc6, 0xec, 0x50, 0x8e, 0x0f, 0xbe, 0x49, 0x19, 0xee, 0xae, 0x75, 0x96, 
-0x47, 0x04, 0x25, 0xab, 0x74, 0xc7, 0x55, 0x8d, 0xee, 0x80, 0xad, 0xfe, 0x2a, 0x0a, 0xd9, 0x3f, 
-0x70, 0x04, 0x66, 0x3b, 0x9a, 0x6a, 0x0c, 0xbe, 0x5b, 0xad, 0x09, 0x8f, 0xe4, 0x61, 0x00, 0x8b, 
-0x2e, 0xeb, 0x0c, 0x65, 0x2a, 0xce, 0x81, 0x32, 0xe5, 0x75, 0xb4, 0xee, 0xdb, 0x6f, 0x3e, 0x8b, 
-0x76, 0xa6, 0x39, 0x85, 0x47, 0x9f, 0xd3, 0xb7, 0x1b, 0x88, 0xc2, 0x63, 0x44, 0x97, 0x69, 0x34, 
-0xaa, 0x8d, 0x47, 0xb2, 0xe2, 0xa5, 0x3e, 0xf4, 0xf7, 0x48, 0xdb, 0x82, 0x1e, 0xb9, 0x4c, 0xe1, 
-0x3a, 0xb8, 0x09, 0xe6, 0x5e, 0xcb, 0x13, 0xff, 0x55, 0xab, 0x83, 0xc1, 0x20, 0x8f, 0x09, 0x62, 
-0x93, 0xd3, 0x86, 0xfb, 0xc7, 0xe6, 0xa9, 0x78, 0xda, 0x18, 0x2f, 0x9d, 0x86, 0xa7, 0xd2, 0x50, 
-0x20, 0xdf, 0x09, 0xae, 0x5e, 0x35, 0xed, 0x27, 0x00, 0x67, 0xb8, 0xe1, 0x1f, 0xbd, 0x80, 0x18, 
-0x30, 0xf3, 0xce, 0xa6, 0x50, 0xfa, 0xac, 0x8f, 0x63, 0x9e, 0x45, 0x16, 0xee, 0x38, 0x48, 0x61, 
-0xb1, 0x36, 0x57, 0xf8, 0x92, 0xd2, 0xa4, 0x59, 0x29, 0x6c, 0x14, 0xd7, 0x76, 0x9b, 0xc1, 0x28, 
-0xa9, 0x8e, 0xca, 0x2f, 0x81, 0xe4, 0x94, 0xcb, 0xa9, 0x6a, 0x09, 0x55, 0xfa, 0x0f, 0xca, 0xa7, 
-0x58, 0xb8, 0x07, 0xaf, 0xdd, 0x5a, 0x6b, 0xff, 0x37, 0xde, 0xf1, 0x73, 0x06, 0xda, 0x20, 0x6d, 
-0xcb, 0x60, 0xdc, 0x89, 0x9b, 0x64, 0x55, 0xb5, 0xda, 0x6c, 0xfe, 0x4b, 0x1a, 0xf1, 0x2a, 0x9f, 
-0xe3, 0x35, 0x16, 0x72, 0x47, 0xbb, 0x7f, 0x1e, 0xb5, 0xc9, 0xa9, 0x1b, 0xd8, 0x26, 0x47, 0xa0, 
-0x36, 0x18, 0xf5, 0xc0, 0x7c, 0x20, 0xdb, 0xc3, 0xa1, 0x5d, 0xc8, 0x9a, 0x8a, 0xae, 0x5a, 0x4a, 
-0xa6, 0xc6, 0x19, 0x2e, 0x81, 0x1f, 0xf9, 0x06, 0xb6, 0xda, 0x0e, 0x6e, 0xf2, 0x2a, 0x5e, 0x3a, 
-0x4a, 0xe7, 0x02, 0xde, 0x1f, 0x83, 0xcd, 0x50, 0xf7, 0x22, 0x63, 0x84, 0x32, 0x58, 0x0e, 0xd7, 
-0x9f, 0x6c, 0x35, 0xcc, 0x41, 0x70, 0x2d, 0x9d, 0x65, 0x1b, 0x52, 0x8c, 0x33, 0x9c, 0x7d, 0x3c, 
-0x8e, 0x17, 0xef, 0x6c, 0xa4, 0xfc, 0x7e, 0xdc, 0xab, 0x1a, 0x6d, 0x41, 0x23, 0x63, 0x15, 0x3d, 
-0x89, 0x4f, 0x72, 0xcb, 0x1c, 0x0d, 0xf1, 0x8d, 0x2f, 0xc6, 0x81, 0x4d, 0x11, 0x73, 0x8a, 0x50, 
-0xcb, 0xf8, 0x31, 0x5d, 0x9d, 0x3b, 0xe8, 0x49, 0x90, 0x78, 0x3a, 0x1c, 0xdf, 0x7c, 0x22, 0x3e, 
-0xe8, 0x77, 0xcc, 0xad, 0xd7, 0x7f, 0x96, 0x13, 0xc8, 0x8a, 0xe7, 0xbe, 0x10, 0x72, 0xe5, 0xc5, 
-0xae, 0xf2, 0x48, 0xa8, 0x20, 0x37, 0x09, 0x7f, 0x45, 0x5b, 0xe0, 0x66, 0x11, 0xbc, 0xfc, 0x48, 
-0x8a, 0xf1, 0xb5, 0xc2, 0x20, 0x66, 0x99, 0xdb, 0x24, 0x75, 0x65, 0xf2, 0x8a, 0x24, 0x13, 0xb8, 
-0x0b, 0x52, 0x63, 0xb0, 0x96, 0x7c, 0x38, 0xb4, 0xf2, 0x80, 0x27, 0x37, 0xe4, 0x0b, 0xf6, 0x2a, 
-0x7f, 0x38, 0xbf, 0xe0, 0x61, 0xb6, 0x40, 0x10, 0x69, 0xc4, 0x51, 0xd6, 0x9c, 0xf0, 0x90, 0x59, 
-0xf8, 0x2c, 0x8a, 0x50, 0xc5, 0xff, 0x8d, 0xe2, 0x83, 0xd3, 0x6e, 0x2b, 0x9b, 0x56, 0xab, 0x3a, 
-0x14, 0x7d, 0x4c, 0xfd, 0x3d, 0x03, 0xe9, 0x23, 0x94, 0x0d, 0x6a, 0xd1, 0x55, 0x9e, 0x63, 0xce, 
-0x48, 0x59, 0x98, 0xc5, 0xb2, 0x04, 0x90, 0xf7, 0x7e, 0xab, 0x58, 0x9f, 0x39, 0xb5, 0xe6, 0x07, 
-0x9c, 0xc8, 0xdc, 0x00, 0xfe, 0x7a, 0xb9, 0x8f, 0xc5, 0x06, 0xee, 0x96, 0xe5, 0x12, 0xfd, 0xd2, 
-0xac, 0x7d, 0xd9, 0xf8, 0xa8, 0x00, 0xd5, 0xbc, 0x26, 0xc7, 0x46, 0x06, 0x5a, 0xb8, 0x3e, 0x25, 
-0x4a, 0xc4, 0x0d, 0x97, 0x7b, 0xb4, 0xec, 0x09, 0xf7, 0xad, 0xe4, 0x41, 0xbc, 0x5a, 0x6e, 0xb3, 
-0x9f, 0x69, 0x3d, 0xb7, 0xd3, 0xfe, 0x19, 0xaa, 0x97, 0x76, 0x44, 0x8a, 0x09, 0x71, 0xad, 0xc8, 
-0x01, 0xe5, 0x6a, 0x98, 0x46, 0xc9, 0xb6, 0x58, 0xda, 0x00, 0x50, 0x26, 0x5e, 0x09, 0xb9, 0xf1, 
-0x75, 0x1c, 0x41, 0xa1, 0x4e, 0x31, 0x19, 0x7d, 0x3b, 0x08, 0xbd, 0x64, 0xfa, 0x8b, 0xd1, 0xef, 
-0xb7, 0x0c, 0xf4, 0x9c, 0x53, 0x70, 0x1f, 0x30, 0x60, 0x12, 0x7a, 0x90, 0x33, 0xe2, 0x3f, 0x80, 
-0xed, 0x34, 0xc8, 0x3d, 0x7c, 0xd0, 0xeb, 0x48, 0x94, 0x82, 0x28, 0xd4, 0x13, 0x5c, 0xe6, 0xa1, 
-0x03, 0x55, 0xab, 0x6c, 0xbb, 0x45, 0xc5, 0x13, 0x8f, 0x5a, 0x9a, 0x0e, 0x7c, 0x89, 0xd1, 0xa9, 
-0x7a, 0x05, 0xb6, 0x88, 0x5e, 0x18, 0x36, 0xd0, 0x9e, 0x43, 0xe8, 0x60, 0x11, 0x74, 0xb5, 0x03, 
-0x61, 0x4d, 0xa5, 0x40, 0xcd, 0xec, 0x48, 0xf9, 0x70, 0xb4, 0x22, 0xdc, 0xbb, 0x6c, 0xd5, 0x7a, 
-0xfa, 0x3a, 0x8a, 0x46, 0xac, 0xbe, 0x35, 0x90, 0x28, 0xf0, 0x1e, 0xe4, 0x7a, 0x51, 0xda, 0x67, 
-0x0d, 0xcf, 0x2c, 0x71, 0xee, 0x15, 0x7a, 0x5d, 0x2e, 0x70, 0xb8, 0x3f, 0x99, 0xd1, 0x18, 0x49, 
-0x53, 0x87, 0x29, 0x60, 0xb0, 0x7a, 0x8e, 0x58, 0x0d, 0xc6, 0x28, 0x3e, 0x73, 0xec, 0x4a, 0x63, 
-0xe6, 0x73, 0x9f, 0xd8, 0x30, 0xce, 0x73, 0xf1, 0xa1, 0x5e, 0xf4, 0xdf, 0x2e, 0xcf, 0x58, 0x9e, 
-0xc2, 0x22, 0x65, 0x90, 0xf6, 0x28, 0xdb, 0x44, 0x06, 0xf4, 0xe5, 0x26, 0x91, 0xc0, 0x62, 0x3a, 
-0xe6, 0x0f, 0xc4, 0xa7, 0xda, 0xfb, 0x64, 0x27, 0x56, 0xb3, 0xc3, 0x2c, 0x0a, 0xf0, 0x6c, 0x11, 
-0x30, 0xbe, 0x98, 0xfb, 0x70, 0xe3, 0x31, 0x4c, 0xa8, 0xdc, 0x69, 0x81, 0xd5, 0xb5, 0xfd, 0x52, 
-0x9b, 0xe8, 0x83, 0x2d, 0xe0, 0x51, 0x6c, 0x1b, 0x98, 0x73, 0x25, 0xc2, 0x3b, 0xd9, 0x7e, 0xb1, 
-0xd6, 0x3f, 0xe8, 0x4e, 0xd0, 0xb1, 0x01, 0x5d, 0xbd, 0x93, 0x10, 0x54, 0x9f, 0x2f, 0xaa, 0x70, 
-0xe3, 0xcb, 0xa4, 0x3e, 0xfb, 0xbc, 0x2a, 0x46, 0x91, 0x15, 0xfe, 0xd4, 0x1d, 0x84, 0xa2, 0xd2, 
-0xef, 0x1f, 0xcc, 0xa6, 0x34, 0xf6, 0x22, 0x59, 0xda, 0xf7, 0x3d, 0x23, 0xe4, 0xac, 0x02, 0x69, 
-0x78, 0x0b, 0xd6, 0x7e, 0xaf, 0x3f, 0x2b, 0xeb, 0xc6, 0x1e, 0xfb, 0x88, 0x07, 0x19, 0x65, 0x86, 
-0xd1, 0x06, 0x91, 0x33, 0x56, 0x12, 0x9d, 0xb1, 0x5f, 0xc0, 0xda, 0xf4, 0x02, 0xea, 0x12, 0xe1, 
-0x80, 0xae, 0x65, 0x34, 0x41, 0xa3, 0xc8, 0x22, 0x9a, 0xbc, 0xfb, 0x8e, 0x4e, 0xc5, 0xac, 0x42, 
-0xe2, 0x8b, 0x1b, 0x4f, 0x69, 0x28, 0xe6, 0xa6, 0xf9, 0xb9, 0xa6, 0x0c, 0x4e, 0xc2, 0x22, 0x36, 
-0xef, 0x48, 0x98, 0x68, 0xb6, 0x1e, 0x89, 0xad, 0x0f, 0x38, 0xf4, 0x80, 0x93, 0x12, 0x53, 0x01, 
-0x84, 0x36, 0xb9, 0x50, 0xa7, 0x85, 0x46, 0x6c, 0x34, 0x7f, 0xd3, 0x00, 0x37, 0xab, 0x7d, 0xcd, 
-0x18, 0x88, 0x58, 0xa3, 0x04, 0x45, 0x7e, 0xd5, 0x21, 0x58, 0xf1, 0x2a, 0x50, 0x13, 0x83, 0xd5, 
-0x9e, 0x19, 0xf9, 0x88, 0x5f, 0xa3, 0x91, 0x80, 0xf6, 0xa7, 0x85, 0x3d, 0xc5, 0x8d, 0x22, 0xd1, 
-0x5c, 0x02, 0x2b, 0xed, 0x0d, 0x60, 0x8c, 0x23, 0x6e, 0xce, 0x5b, 0x16, 0x9f, 0xb0, 0xc8, 0x3c, 
-0xe6, 0x4c, 0xd1, 0x88, 0x15, 0xa6, 0xe7, 0x08, 0xc6, 0x9b, 0x28, 0xa6, 0x6c, 0x85, 0xf5, 0x1b, 
-0x4b, 0xac, 0xfc, 0xd9, 0x03, 0xc1, 0x5f, 0x1b, 0x33, 0xb6, 0x02, 0x6b, 0x4e, 0x86, 0xcf, 0x68, 
-0xdf, 0xc3, 0x40, 0x97, 0x79, 0x50, 0x32, 0x60, 0x71, 0x43, 0xe7, 0x52, 0x00, 0x6d, 0xbe, 0x47, 
-0x91, 0x2f, 0xa3, 0xcb, 0x6f, 0x44, 0xc2, 0xdd, 0x25, 0xbc, 0x93, 0x33, 0xf0, 0xa1, 0x54, 0x6f, 
-0x98, 0x34, 0xd8, 0xaf, 0x75, 0xbb, 0x96, 0x25, 0xe6, 0x5b, 0xf1, 0xa9, 0x83, 0xee, 0x43, 0x2e, 
-0x09, 0x50, 0x9b, 0x27, 0x7c, 0x6c, 0x40, 0xa6, 0x71, 0xc9, 0x08, 0x88, 0xbf, 0x13, 0xe9, 0x75, 
-0x37, 0x45, 0x12, 0x62, 0xd7, 0x25, 0x94, 0xfc, 0x12, 0xa5, 0xce, 0xef, 0xae, 0xc3, 0x5f, 0x76, 
-0x46, 0x67, 0xd4, 0x3a, 0xf2, 0xdd, 0x6b, 0xa5, 0xbb, 0x88, 0xe1, 0x0b, 0xcb, 0x56, 0x2f, 0xda, 
-0x97, 0x58, 0xb6, 0x1b, 0x65, 0xe1, 0xad, 0xc9, 0xe6, 0x90, 0x1e, 0x72, 0x04, 0xff, 0x1a, 0x92, 
-0xdf, 0x13, 0x5c, 0x9f, 0xe8, 0x52, 0x97, 0x62, 0xba, 0x34, 0x77, 0xd9, 0x6b, 0xef, 0x2d, 0xb5, 
-0xa0, 0x87, 0x6b, 0xb2, 0xce, 0x37, 0x92, 0xee, 0x3f, 0x7d, 0x4c, 0xab, 0xd6, 0x18, 0x3a, 0xcf, 
-0x4a, 0x61, 0x1d, 0x0b, 0xaf, 0x55, 0xa0, 0x80, 0xfc, 0x92, 0xc5, 0xaf, 0x99, 0x3d, 0xc4, 0xde, 
-0x12, 0xb6, 0x90, 0x3e, 0x77, 0x02, 0x2a, 0x60, 0xa8, 0x80, 0x33, 0xb2, 0xf9, 0x45, 0x65, 0x8f, 
-0x51, 0x71, 0x1a, 0xff, 0x0e, 0x45, 0xa0, 0x73, 0xd4, 0x2b, 0x84, 0x6b, 0x42, 0x8f, 0xf6, 0x7b, 
-0x55, 0xf1, 0x8d, 0x21, 0xed, 0x9c, 0x1a, 0xae, 0x77, 0x2d, 0x5c, 0x07, 0xeb, 0xb2, 0xdf, 0x04, 
-0xaa, 0xba, 0x2c, 0x8d, 0xb3, 0xe2, 0x9b, 0x19, 0xed, 0x64, 0x7f, 0x0d, 0x96, 0xea, 0x85, 0x52, 
-0xfb, 0xa7, 0x5a, 0x1b, 0xc3, 0x08, 0xd5, 0x80, 0xbc, 0x11, 0x69, 0x57, 0x29, 0xe1, 0xcb, 0x36, 
-0x9e, 0x44, 0xc2, 0x75, 0x1b, 0xc6, 0x8f, 0xce, 0xf2, 0x73, 0x18, 0xb6, 0x5a, 0x96, 0xd5, 0x4f, 
-0x16, 0xf5, 0x55, 0x95, 0xfc, 0x2b, 0x5c, 0xb0, 0x8a, 0xe2, 0x7c, 0xa5, 0x05, 0x36, 0x68, 0xba, 
-0x76, 0x57, 0x38, 0x7e, 0x0e, 0x8a, 0x33, 0x09, 0x04, 0xe8, 0x78, 0x1e, 0x83, 0x9c, 0x44, 0x02, 
-0x76, 0x5c, 0x18, 0xf3, 0x82, 0xa2, 0xfa, 0x07, 0x7c, 0xd0, 0x27, 0x4b, 0xfa, 0x9c, 0x42, 0x79, 
-0x2b, 0x66, 0xd5, 0x3f, 0xc3, 0xda, 0x2a, 0xbc, 0xf2, 0xaf, 0x49, 0xc6, 0x73, 0x10, 0x1f, 0xdf, 
-0xfa, 0x4a, 0xc9, 0x11, 0xad, 0x53, 0x94, 0x15, 0xe1, 0x3e, 0x03, 0x7c, 0x9a, 0x1e, 0xbf, 0x5b, 
-0x0c, 0xe1, 0x6f, 0x35, 0xea, 0x54, 0xbf, 0xe5, 0x28, 0x74, 0xeb, 0xdb, 0x68, 0xf0, 0x0f, 0x40, 
-0xb9, 0x35, 0x79, 0x1f, 0x4a, 0x72, 0xf1, 0xa0, 0x35, 0x4c, 0xf8, 0xd9, 0xbe, 0xe9, 0x94, 0xfd, 
-0x0f, 0xda, 0x69, 0x03, 0x59, 0x99, 0x21, 0x35, 0xef, 0xbe, 0xdd, 0x58, 0xb7, 0x30, 0xc8, 0xe7, 
-0x62, 0x13, 0xa5, 0xe9, 0x1f, 0xb5, 0xdc, 0x0a, 0x9e, 0x44, 0xd6, 0x77, 0xc2, 0x36, 0x09, 0x53, 
-0xe8, 0x8a, 0xa6, 0xcc, 0x67, 0x26, 0x92, 0xf9, 0x86, 0x10, 0x7a, 0xfb, 0x5f, 0x3a, 0x78, 0xcd, 
-0x07, 0xb0, 0x4d, 0xfd, 0x58, 0x2c, 0xb6, 0x3a, 0x10, 0x71, 0x46, 0xdf, 0x69, 0x89, 0xfa, 0x22, 
-0x44, 0xe9, 0x8e, 0xf2, 0x48, 0x7f, 0x0a, 0x53, 0xb2, 0x10, 0x67, 0x2c, 0xe2, 0x4d, 0x63, 0x21, 
-0xa4, 0x85, 0xe6, 0x34, 0xcb, 0xfd, 0x23, 0xc0, 0x2f, 0xdc, 0x44, 0xb6, 0xd3, 0x6e, 0x4c, 0xf2, 
-0x1b, 0xcd, 0x55, 0xb6, 0xf3, 0x83, 0xca, 0x4b, 0x0a, 0xd7, 0x26, 0x9e, 0xf9, 0x45, 0xd2, 0xe1, 
-0x57, 0x2b, 0x94, 0xbd, 0x5a, 0x13, 0xf9, 0xc8, 0xd7, 0x2e, 0xaf, 0x4e, 0x37, 0xbb, 0x66, 0x45, 
-0xed, 0x6b, 0xa5, 0xc4, 0x87, 0x35, 0x1d, 0xbd, 0xee, 0x14, 0xb1, 0x99, 0x7d, 0x62, 0xa3, 0x52, 
-0x75, 0x89, 0x27, 0xfd, 0xb9, 0x8c, 0x3f, 0xae, 0x28, 0x9e, 0x8f, 0xe8, 0x20, 0xc5, 0xf8, 0x71, 
-0x4d, 0xc2, 0xeb, 0x60, 0xf6, 0x48, 0x73, 0xa8, 0x29, 0xb8, 0xca, 0x03, 0x24, 0x7a, 0x9a, 0x06, 
-0xab, 0xba, 0x8f, 0x35, 0x48, 0xca, 0x72, 0x1b, 0xdd, 0x66, 0x54, 0xf8, 0xd7, 0x04, 0x29, 0x83, 
-0x66, 0x07, 0xa8, 0x21, 0x69, 0x47, 0x85, 0x56, 0xc4, 0x22, 0x90, 0xbd, 0xeb, 0x78, 0xc8, 0xac, 
-0x7f, 0x02, 0x8a, 0x64, 0xd3, 0x96, 0x22, 0x8c, 0x3c, 0xc3, 0x7a, 0x59, 0xcd, 0x4c, 0x28, 0x85, 
-0xc8, 0x64, 0x11, 0xa8, 0x5a, 0xdd, 0x82, 0xfa, 0x21, 0xba, 0x39, 0xf6, 0x12, 0x4b, 0xc3, 0x3d, 
-0x55, 0xdc, 0xc5, 0x48, 0x15, 0xd5, 0x29, 0x56, 0x89, 0xde, 0xbc, 0x13, 0xd2, 0x79, 0x1b, 0xa0, 
-0x8e, 0xec, 0xcd, 0x2a, 0x9b, 0x4e, 0x39, 0xae, 0x5f, 0xa2, 0x01, 0xbf, 0x3b, 0xa9, 0xfd, 0x6e, 
-0xda, 0x81, 0xf7, 0xa2, 0x01, 0xb4, 0x7c, 0xdc, 0x3d, 0xbc, 0x67, 0x49, 0xaa, 0x09, 0x82, 0x62, 
-0x8d, 0xa0, 0x79, 0x22, 0x0f, 0x82, 0xa1, 0x01, 0xbe, 0x6b, 0x27, 0x3e, 0xdd, 0x9d, 0x1d, 0xee, 
-0x8c, 0xe5, 0xc1, 0x6d, 0x5a, 0x1e, 0xb8, 0xa0, 0x89, 0xc7, 0x42, 0xb1, 0xd2, 0x32, 0x8b, 0x64, 
-0x1f, 0xeb, 0x9e, 0x7a, 0xd2, 0x24, 0x94, 0x19, 0xc0, 0x39, 0x13, 0xe9, 0x06, 0xd4, 0x6e, 0x57, 
-0xa1, 0x4a, 0xf6, 0x59, 0x10, 0xe7, 0x38, 0x06, 0xcf, 0x3e, 0x0c, 0x66, 0x31, 0xd2, 0xee, 0x6c, 
-0x7f, 0x0a, 0x60, 0x40, 0x31, 0x85, 0x63, 0x0d, 0xcf, 0x8d, 0x2c, 0xb9, 0x11, 0xe0, 0xd1, 0x8b, 
-0xfc, 0x64, 0x96, 0x84, 0xb1, 0xf7, 0x6b, 0x41, 0x5a, 0x13, 0xd3, 0x9c, 0x2a, 0xb4, 0x86, 0xa5, 
-0xea, 0x09, 0xcb, 0x89, 0xa6, 0x5b, 0xbe, 0xb0, 0xd2, 0xea, 0x56, 0x7e, 0x31, 0xce, 0x18, 0xb4, 
-0x76, 0x43, 0xe2, 0x4f, 0x2b, 0xd2, 0x0d, 0xf7, 0x48, 0x2b, 0xa3, 0x3b, 0x7b, 0xf1, 0x05, 0x54, 
-0xb3, 0xf9, 0x08, 0x34, 0x9a, 0x72, 0xa8, 0x3b, 0xfe, 0xba, 0x2e, 0xe6, 0x41, 0xb4, 0x6f, 0xd2, 
-0x45, 0x0d, 0x72, 0x9b, 0x82, 0xd8, 0x6f, 0x1c, 0x9d, 0x64, 0x24, 0xa3, 0x93, 0xf1, 0xab, 0xc6, 
-0x3f, 0x6d, 0x26, 0x38, 0xa9, 0x67, 0xf2, 0xd9, 0x5f, 0xb3, 0x00, 0x7a, 0xf5, 0xba, 0x0e, 0xca, 
-0x78, 0xdc, 0x1c, 0xcd, 0x9b, 0x5f, 0x17, 0x8c, 0xc7, 0x20, 0x3f, 0x91, 0xd4, 0x37, 0xfe, 0x11, 
-0x59, 0x04, 0xd3, 0x91, 0x15, 0x72, 0xe3, 0xb3, 0x39, 0x03, 0xed, 0x67, 0xac, 0x3c, 0xdb, 0x91, 
-0x33, 0xe7, 0x97, 0x0d, 0x72, 0x5b, 0x2e, 0xab, 0x62, 0x3f, 0xb2, 0x02, 0xea, 0x93, 0x78, 0x65, 
-0x70, 0x16, 0xff, 0x09, 0x6d, 0xe4, 0xab, 0x51, 0xb7, 0x91, 0x43, 0x6a, 0x04, 0xe8, 0x5b, 0xdd, 
-0xaf, 0x8b, 0x53, 0x79, 0x5f, 0xb2, 0x93, 0xdd, 0x0d, 0x88, 0x33, 0xcd, 0x25, 0x8d, 0xb8, 0x6a, 
-0xee, 0x9b, 0xe4, 0xa7, 0x80, 0x4d, 0x04, 0x57, 0xc1, 0xf2, 0xd5, 0x75, 0xa4, 0xba, 0xdb, 0x38, 
-0xaa, 0x20, 0x55, 0xa3, 0x3d, 0x68, 0x05, 0x33, 0x50, 0x1b, 0xd9, 0x45, 0x5d, 0xc8, 0x2e, 0xe2, 
-0x83, 0xfd, 0x4e, 0x7b, 0x02, 0xf6, 0x5d, 0x25, 0x98, 0x44, 0xb3, 0x16, 0x39, 0xe4, 0x79, 0x42, 
-0x1d, 0x8c, 0xc3, 0x9a, 0x0e, 0xf7, 0xa2, 0x37, 0xed, 0x9c, 0x09, 0xa7, 0x87, 0x3e, 0x5e, 0x6c, 
-0xd7, 0xb5, 0xe5, 0x1d, 0x4c, 0xbe, 0x6d, 0xe2, 0x9e, 0x49, 0x89, 0xdb, 0xf5, 0x0d, 0x5f, 0xe0, 
-0x15, 0x70, 0x97, 0x89, 0x06, 0x28, 0x99, 0x60, 0x90, 0xc7, 0x4f, 0xe3, 0x2c, 0xa7, 0xb8, 0xef, 
-0x34, 0xd2, 0xeb, 0x70, 0x0c, 0x82, 0x65, 0x1d, 0xa0, 0xf5, 0x95, 0xe4, 0x88, 0xc4, 0x07, 0x4d, 
-0x31, 0x81, 0x40, 0xab, 0x58, 0x1f, 0x92, 0xe5, 0x2d, 0x51, 0x83, 0x6c, 0x25, 0xeb, 0xb9, 0x4a, 
-0x30, 0xe9, 0x5d, 0xbc, 0x53, 0x6e, 0x9b, 0x8a, 0xb0, 0xeb, 0x29, 0xf8, 0x55, 0x3f, 0x99, 0xf0, 
-0xcd, 0x5b, 0xbc, 0xe2, 0x2e, 0xc9, 0xf8, 0x61, 0x48, 0xac, 0x81, 0xff, 0xc4, 0x46, 0xd3, 0x7b, 
-0x15, 0x97, 0x31, 0x82, 0x4a, 0xda, 0x2d, 0x3c, 0xac, 0xd4, 0x5f, 0xa1, 0x4b, 0x27, 0x7e, 0x08, 
-0x38, 0xdf, 0x13, 0xfc, 0xc5, 0xa7, 0x84, 0x71, 0x2d, 0xfd, 0x9e, 0xe0, 0x46, 0x2e, 0xf2, 0x24, 
-0xc8, 0x68, 0xe3, 0x74, 0xa7, 0xfa, 0x47, 0x81, 0x1f, 0xc3, 0x5d, 0x18, 0xdd, 0x97, 0xc8, 0xa3, 
-0x2f, 0x1d, 0xb1, 0x4e, 0xfe, 0x01, 0x47, 0x97, 0xf2, 0x76, 0xd8, 0x83, 0x95, 0xc6, 0xb0, 0x7f, 
-0xe8, 0xa0, 0x3b, 0xf0, 0x0f, 0xa4, 0x1a, 0x92, 0xc5, 0x20, 0x65, 0xc0, 0xe5, 0x3b, 0xd7, 0x4f, 
-0xc1, 0x7c, 0x2c, 0x6d, 0xf2, 0x94, 0x10, 0x51, 0xff, 0x70, 0x3a, 0xe2, 0xb1, 0x4f, 0xdb, 0x6d, 
-0x29, 0xcf, 0x61, 0xfc, 0xb7, 0x1c, 0xa0, 0x8e, 0x14, 0x56, 0x95, 0xfb, 0x0c, 0xaa, 0x34, 0x80, 
-0x17, 0x2a, 0x68, 0xba, 0x1c, 0xc6, 0x8e, 0xb2, 0x54, 0x22, 0xec, 0x4d, 0xca, 0xf6, 0x17, 0xa9, 
-0x31, 0xed, 0xb0, 0x1a, 0x5b, 0x43, 0x0e, 0x78, 0x8e, 0x06, 0xb2, 0x40, 0xc1, 0x50, 0x33, 0xd8, 
-0x11, 0x7a, 0x4b, 0x5d, 0x1f, 0x42, 0x99, 0xb9, 0x22, 0xe7, 0xc8, 0x15, 0xd7, 0x72, 0xef, 0x64, 
-0xa7, 0x3e, 0xf9, 0x91, 0x34, 0xd1, 0x76, 0x03, 0x99, 0xae, 0x78, 0x16, 0xe6, 0x23, 0x2f, 0xc4, 
-0x47, 0x74, 0xa0, 0x7f, 0xc1, 0xad, 0x1a, 0x27, 0x4e, 0x13, 0x8b, 0x46, 0x9b, 0x57, 0x14, 0x78, 
-0x22, 0xd1, 0x52, 0x1a, 0xb3, 0x8f, 0x04, 0xf2, 0xbf, 0x53, 0xfc, 0xc9, 0x18, 0xa9, 0xc2, 0x88, 
-0x51, 0x7b, 0x1f, 0x8c, 0xee, 0xc5, 0x98, 0xf7, 0xcd, 0x6f, 0x85, 0x2b, 0x54, 0x3c, 0x10, 0x49, 
-0xcd, 0x01, 0x21, 0xbb, 0xcb, 0x0a, 0xa7, 0x7e, 0x3b, 0xaf, 0x02, 0xbf, 0x53, 0x18, 0xd2, 0xad, 
-0x30, 0x51, 0x77, 0xb5, 0x42, 0x24, 0x71, 0xe2, 0x3c, 0x86, 0x95, 0x13, 0xe1, 0x29, 0x7e, 0x58, 
-0xb5, 0x07, 0x34, 0xfd, 0x1a, 0xe4, 0x25, 0x58, 0xbd, 0x09, 0x77, 0xb7, 0x8b, 0x50, 0xd7, 0x6f, 
-0xb2, 0x31, 0xa3, 0x10, 0x8c, 0xaa, 0x6b, 0x14, 0x8e, 0xee, 0xd5, 0xa1, 0x5f, 0x25, 0xc7, 0xdb, 
-0x9e, 0x0b, 0x28, 0x5e, 0x77, 0x89, 0x07, 0x5b, 0x8e, 0x15, 0x7c, 0x33, 0x70, 0xdc, 0xea, 0xbf, 
-0x36, 0x75, 0xc7, 0x66, 0x84, 0xda, 0x5e, 0xc4, 0xd5, 0xf0, 0xa9, 0x51, 0x7d, 0x43, 0xee, 0x31, 
-0x81, 0xd6, 0xa6, 0x62, 0x7b, 0xb9, 0x54, 0xd7, 0x02, 0x7a, 0x66, 0xd1, 0x92, 0xfe, 0xc6, 0x5f, 
-0xab, 0x4e, 0x80, 0x2a, 0xdf, 0xff, 0xb7, 0x8e, 0xed, 0xbf, 0x01, 0xb2, 0xf7, 0x77, 0xce, 0x6b, 
-0xfe, 0x8c, 0x63, 0x9d, 0x36, 0x88, 0x47, 0x08, 0xc3, 0x15, 0xb6, 0xe3, 0x0f, 0x57, 0xa5, 0xf2, 
-0x68, 0xcb, 0x0b, 0x86, 0xcf, 0xac, 0xf3, 0x62, 0x1c, 0xcd, 0x37, 0x0c, 0xdd, 0x61, 0xd5, 0x6c, 
-0x7e, 0xa7, 0xfe, 0x71, 0x07, 0x86, 0xc2, 0xb5, 0xea, 0x06, 0xa1, 0x68, 0x36, 0xe4, 0x9f, 0x6a, 
-0x24, 0xd8, 0x73, 0xa1, 0x61, 0xf2, 0x21, 0x57, 0x93, 0xc0, 0x35, 0xd8, 0x3e, 0x74, 0x1a, 0x58, 
-0xa0, 0x48, 0xbe, 0xb1, 0x90, 0xd5, 0xf5, 0xb7, 0x97, 0x65, 0x80, 0x3d, 0x72, 0x8d, 0x62, 0x50, 
-0xfe, 0x91, 0x45, 0x2c, 0x9c, 0x64, 0x09, 0xe0, 0x93, 0xf9, 0x01, 0xcc, 0xef, 0x8f, 0x13, 0xfb, 
-0xba, 0x65, 0xcc, 0x55, 0x6e, 0x9f, 0xca, 0x1b, 0xe0, 0x6c, 0xc0, 0x4b, 0x5f, 0x75, 0x40, 0xf5, 
-0x90, 0xd4, 0x29, 0x66, 0xe3, 0x37, 0xf8, 0x08, 0x47, 0xd2, 0xf3, 0x56, 0x74, 0x21, 0xce, 0xf9, 
-0x34, 0x57, 0x07, 0xb9, 0x49, 0x85, 0xab, 0x33, 0x64, 0xb6, 0xcc, 0xf2, 0x1c, 0x40, 0xbb, 0xc8, 
-0xf4, 0xaf, 0x48, 0xc1, 0x0e, 0x52, 0x26, 0x45, 0xf3, 0x07, 0xa5, 0x2a, 0x3f, 0xed, 0x21, 0x91, 
-0x75, 0x03, 0x39, 0x96, 0xd2, 0x26, 0x6a, 0xa0, 0x00, 0xbc, 0x3d, 0x0d, 0x33, 0xe1, 0x6c, 0x40, 
-0xf3, 0x88, 0x25, 0xbd, 0x07, 0x7f, 0x2f, 0xe4, 0x15, 0xf7, 0xcd, 0x5a, 0x97, 0x04, 0x6c, 0x44, 
-0x59, 0x2b, 0xd1, 0xa2, 0x33, 0xdc, 0x0c, 0x56, 0xa8, 0x0f, 0x4a, 0xbd, 0xe2, 0x28, 0xb3, 0x98, 
-0x7d, 0xd7, 0x5d, 0xa0, 0x47, 0x80, 0xdd, 0x3c, 0x27, 0x50, 0xfa, 0x41, 0xa1, 0x4b, 0x7d, 0x09, 
-0xe3, 0x8d, 0x6b, 0xf2, 0x4a, 0x30, 0x89, 0xf5, 0xc1, 0x33, 0xd0, 0x20, 0xd9, 0xf0, 0x2a, 0x6c, 
-0x90, 0x3f, 0xf4, 0xda, 0x26, 0x58, 0x83, 0x3d, 0xad, 0x10, 0x8a, 0x42, 0x07, 0x6e, 0xe0, 0x9b, 
-0x6b, 0x0d, 0xe8, 0xae, 0x00, 0xb8, 0x66, 0xd9, 0x25, 0x0c, 0xf1, 0x60, 0x1a, 0x77, 0x26, 0x5a, 
-0xee, 0x33, 0xab, 0xe5, 0xf7, 0x1c, 0xd3, 0xba, 0x18, 0x77, 0xea, 0xd7, 0x87, 0xf1, 0x7a, 0x3f, 
-0xbe, 0x25, 0x8b, 0x64, 0x37, 0xaf, 0x5c, 0x4b, 0x7c, 0x05, 0xed, 0x34, 0xbe, 0x89, 0xef, 0x64, 
-0x40, 0x91, 0xa7, 0x0e, 0xcf, 0x9c, 0xac, 0x13, 0x6b, 0x49, 0xa8, 0xcb, 0x20, 0x80, 0x9e, 0x61, 
-0x7a, 0x97, 0x3e, 0xde, 0xbb, 0x49, 0x9c, 0x0d, 0xaf, 0x76, 0xe2, 0x1e, 0xcd, 0xf7, 0x00, 0x7c, 
-0xeb, 0x90, 0x4b, 0xa7, 0xd8, 0x97, 0xe6, 0x21, 0x39, 0x9a, 0xd4, 0xf0, 0x85, 0x96, 0xaa, 0x7b, 
-0xd5, 0x89, 0x4f, 0xce, 0xb9, 0x9b, 0x0f, 0x44, 0x53, 0xb6, 0xe5, 0x60, 0x0b, 0xbe, 0xe2, 0x4b, 
-0xf2, 0x73, 0xcf, 0xfa, 0x9e, 0x8f, 0x1e, 0xc2, 0xa1, 0x4b, 0xe6, 0x3c, 0x9e, 0xdd, 0x4a, 0x6d, 
-0x9b, 0x3a, 0xbc, 0x1a, 0x77, 0xa5, 0x21, 0xad, 0x86, 0xe2, 0x72, 0x64, 0x15, 0x8f, 0x3b, 0x7f, 
-0xe0, 0x2e, 0x76, 0xf6, 0x05, 0x6d, 0xd1, 0xfc, 0x4f, 0x26, 0x71, 0x06, 0xc7, 0xb1, 0x1d, 0x8b, 
-0xbe, 0xda, 0x94, 0x34, 0x6a, 0x12, 0xd5, 0x97, 0xb6, 0x53, 0xa9, 0x23, 0x95, 0xb9, 0x17, 0x9e, 
-0x0a, 0x42, 0x90, 0x64, 0xaf, 0x3a, 0x4d, 0xa6, 0xcc, 0x5e, 0x7c, 0x8b, 0xbb, 0x16, 0xfa, 0xcc, 
-0x4e, 0xe3, 0x2c, 0xed, 0xb6, 0x36, 0x4d, 0x7e, 0xca, 0x9c, 0x61, 0x82, 0x54, 0xf5, 0x31, 0x8b, 
-0xac, 0x7f, 0xdd, 0x35, 0x9c, 0xe4, 0xa5, 0x0a, 0x8a, 0xd6, 0x4f, 0x0f, 0x9c, 0x48, 0x31, 0xe1, 
-0x9a, 0x0e, 0x5c, 0xc7, 0x1c, 0x33, 0xa1, 0x59, 0x6d, 0xa7, 0x4a, 0xe5, 0x7e, 0x0b, 0x9d, 0xd6, 
-0x29, 0xa5, 0xdb, 0x42, 0x20, 0xaa, 0x0a, 0x30, 0xce, 0xf8, 0x28, 0x87, 0xef, 0x31, 0xdb, 0x80, 
-0xc3, 0x35, 0xfe, 0x57, 0x00, 0xb4, 0xc1, 0x26, 0xec, 0x18, 0x87, 0x04, 0x2b, 0xeb, 0x62, 0x85, 
-0xc5, 0x42, 0x65, 0x97, 0x3b, 0x71, 0x55, 0xc1, 0x17, 0x3c, 0x83, 0x05, 0x31, 0x66, 0x80, 0x4d, 
-0x73, 0x04, 0x59, 0x2b, 0x67, 0xcc, 0x00, 0x60, 0xb3, 0x20, 0xe4, 0x15, 0x72, 0x5a, 0xae, 0xfe, 
-0xcf, 0xa0, 0x2f, 0xf8, 0x74, 0xaa, 0x16, 0x94, 0x5b, 0x1f, 0x8b, 0x49, 0x13, 0xb1, 0x7f, 0x2b, 
-0x61, 0x0f, 0xad, 0x72, 0x58, 0x1d, 0xb2, 0xd5, 0x26, 0x85, 0x66, 0xe6, 0xd4, 0x37, 0xea, 0xc9, 
-0x0b, 0x3c, 0x97, 0x4e, 0xc6, 0xec, 0xae, 0xc1, 0x1e, 0x96, 0xcd, 0x54, 0xa5, 0x3d, 0x5f, 0x1b, 
-0x34, 0xe6, 0x89, 0xf4, 0x2d, 0x66, 0xff, 0x11, 0x72, 0x5e, 0xb4, 0x1f, 0xef, 0xbb, 0x5a, 0x31, 
-0xfc, 0x40, 0x03, 0xca, 0xe8, 0x76, 0x54, 0xe2, 0x5e, 0xb4, 0xe9, 0x52, 0x9f, 0x7c, 0x0c, 0xe3, 
-0x1d, 0x31, 0x10, 0xc6, 0x47, 0xa6, 0x76, 0x09, 0xb9, 0x94, 0x5d, 0xd0, 0x78, 0x91, 0xcb, 0xad, 
-0x30, 0xfc, 0x24, 0x47, 0xa3, 0x14, 0xc2, 0xe6, 0x40, 0xcb, 0x6d, 0x02, 0x4a, 0xc7, 0x68, 0x42, 
-0xbc, 0x18, 0x6f, 0xc3, 0x5d, 0xb3, 0x85, 0x68, 0xc4, 0x39, 0xa3, 0x6e, 0x4c, 0xb7, 0xdc, 0x0c, 
-0xec, 0xc6, 0x1a, 0xd2, 0x2b, 0xf3, 0xc3, 0x6a, 0x1b, 0xb5, 0x8e, 0x60, 0xf7, 0x78, 0x4c, 0xb0, 
-0x7f, 0x15, 0x53, 0xb8, 0x67, 0x04, 0x55, 0x22, 0xea, 0x0c, 0x87, 0x98, 0x71, 0xf2, 0x3b, 0x5a, 
-0xcc, 0xab, 0x68, 0xc7, 0xb2, 0x7b, 0x3a, 0xdb, 0x25, 0xa0, 0xfc, 0x8a, 0x10, 0xd8, 0x9b, 0x29, 
-0xe0, 0x5c, 0xfa, 0x72, 0xc6, 0xb2, 0x0f, 0xfe, 0xaa, 0x8a, 0xe3, 0x16, 0xb5, 0xe8, 0x3d, 0xfd, 
-0x33, 0x6c, 0x93, 0xf7, 0x31, 0xdd, 0x88, 0x25, 0x69, 0x7f, 0x1c, 0x8c, 0x41, 0xda, 0x84, 0x39, 
-0xb4, 0xc6, 0x2c, 0x66, 0xea, 0x56, 0xdb, 0xfd, 0xca, 0x8d, 0xd5, 0x32, 0xf8, 0xc4, 0x8f, 0x01, 
-0xf2, 0xa8, 0x47, 0x0e, 0x8e, 0x50, 0x62, 0x7c, 0xf5, 0xba, 0x1f, 0xfc, 0x82, 0x28, 0x49, 0x5f, 
-0xf2, 0x42, 0xb3, 0x16, 0x80, 0xee, 0x8f, 0xc7, 0xac, 0x9d, 0xbc, 0x3d, 0xd4, 0x95, 0x4c, 0xa2, 
-0xe8, 0x07, 0x7c, 0xc9, 0x8a, 0xe1, 0x74, 0x25, 0x84, 0xdb, 0x64, 0x7f, 0xb0, 0x0f, 0x39, 0xc6, 
-0x7a, 0x29, 0x00, 0xc9, 0x18, 0xf6, 0xbd, 0x5a, 0x99, 0xd7, 0xae, 0x6e, 0xe9, 0x2e, 0xdd, 0x65, 
-0x35, 0x7d, 0x1b, 0xa3, 0x0c, 0xff, 0x27, 0x64, 0x58, 0x72, 0xbd, 0xe1, 0xd1, 0x93, 0x79, 0x4f, 
-0x1c, 0x5b, 0x92, 0xb8, 0xfe, 0x81, 0x2f, 0xd1, 0x79, 0xe8, 0x93, 0x2a, 0xdb, 0x06, 0xf1, 0x24, 
-0x52, 0xf4, 0xb2, 0x26, 0xfb, 0x8e, 0xcd, 0x16, 0x84, 0x39, 0x98, 0x72, 0xb7, 0x52, 0x3c, 0x83, 
-0xf9, 0x47, 0x72, 0x0e, 0x99, 0xc5, 0xe5, 0x5b, 0xdb, 0x9f, 0x74, 0xe5, 0x43, 0xc8, 0x8f, 0xb7, 
-0xa1, 0x62, 0xe1, 0x1b, 0x43, 0xd8, 0x8e, 0x0e, 0xe4, 0x30, 0x4b, 0xff, 0x58, 0x95, 0x1a, 0xf3, 
-0x52, 0x03, 0xb1, 0x31, 0xec, 0xb8, 0x45, 0x6a, 0xaf, 0xce, 0x21, 0x9f, 0x53, 0xe9, 0x29, 0x60, 
-0xd9, 0xbe, 0x43, 0xa2, 0x78, 0x4e, 0x1d, 0x9d, 0xc4, 0x56, 0xab, 0x46, 0x7c, 0x02, 0xca, 0x3b, 
-0xe0, 0x0d, 0xc1, 0x4d, 0xc9, 0x29, 0x65, 0xf9, 0x0e, 0xe6, 0x79, 0xa8, 0xbf, 0x03, 0x71, 0x38, 
-0x16, 0x52, 0xea, 0x0b, 0x84, 0x62, 0x40, 0x77, 0x55, 0xcb, 0x2f, 0xb1, 0xf9, 0xbf, 0x28, 0x9f, 
-0x14, 0x57, 0xd9, 0xa7, 0x08, 0x6a, 0x9c, 0xd4, 0x03, 0x6f, 0x8b, 0xdc, 0x25, 0xbb, 0x0f, 0x78, 
-0x58, 0x0a, 0x69, 0x18, 0x7b, 0x59, 0xba, 0x36, 0xd0, 0x46, 0x2e, 0xa7, 0x4f, 0x00, 0x3e, 0xac, 
-0xc2, 0x14, 0xa0, 0x2e, 0x5b, 0xfb, 0x47, 0xd9, 0x94, 0xf9, 0x84, 0x6e, 0x32, 0xd3, 0x88, 0x3e, 
-0x76, 0xf9, 0x4f, 0x93, 0x03, 0x5b, 0x89, 0x9c, 0xf6, 0xc4, 0xe7, 0x47, 0x56, 0xbc, 0x1a, 0xe4, 
-0x96, 0x04, 0x89, 0x1b, 0x6a, 0x3a, 0x07, 0xfb, 0xa6, 0x2d, 0xec, 0x14, 0x54, 0xab, 0x1f, 0xf3, 
-0x57, 0x39, 0xa6, 0xfd, 0x7f, 0x3d, 0xaa, 0x90, 0x78, 0x03, 0xda, 0x80, 0x0a, 0x40, 0x68, 0x53, 
-0xb3, 0xff, 0x5d, 0x06, 0xa3, 0xda, 0x11, 0x94, 0xca, 0x32, 0xe7, 0xd1, 0x19, 0x3b, 0x24, 0x90, 
-0x02, 0xc3, 0x37, 0x1f, 0x99, 0x7a, 0xfb, 0x3a, 0x4b, 0x75, 0xcf, 0xb0, 0x2e, 0xa5, 0x4f, 0x7d, 
-0xb9, 0x70, 0xa1, 0x1f, 0xd3, 0x0b, 0xa8, 0xbc, 0x6e, 0xce, 0x79, 0x5d, 0x20, 0x80, 0xa6, 0xef, 
-0x12, 0x94, 0x44, 0xba, 0x14, 0x8e, 0xcd, 0x9d, 0x34, 0x1e, 0x6c, 0xf6, 0x2f, 0x90, 0xde, 0x82, 
-0x11, 0xd9, 0x0a, 0xbf, 0x64, 0xa2, 0xba, 0x4a, 0x94, 0xf2, 0x5c, 0xb2, 0xee, 0x03, 0xa4, 0xd1, 
-0x4f, 0x9c, 0x3e, 0xd5, 0x23, 0x95, 0x46, 0xa5, 0xb7, 0x7a, 0x9a, 0xbc, 0x28, 0xa6, 0xe3, 0x12, 
-0xbb, 0x93, 0x1f, 0x7e, 0x70, 0x08, 0x44, 0xd5, 0x90, 0x31, 0x76, 0x41, 0xb8, 0xe7, 0x19, 0x7b, 
-0xbc, 0x31, 0xfa, 0x63, 0x4c, 0x9a, 0xe8, 0x44, 0xd0, 0xf1, 0x4a, 0xe1, 0xa8, 0x01, 0xee, 0x23, 
-0x84, 0x9a, 0xf3, 0x19, 0x64, 0xcf, 0x9d, 0xeb, 0x6c, 0x4e, 0xf4, 0x8f, 0xd3, 0x24, 0xa4, 0x67, 
-0x1b, 0xab, 0x45, 0xdf, 0x96, 0x60, 0x26, 0xe8, 0x08, 0xb7, 0x25, 0x3b, 0xf1, 0xd4, 0x21, 0x44, 
-0x11, 0xb0, 0x28, 0x6b, 0xd9, 0x84, 0x33, 0x73, 0xea, 0x41, 0xcc, 0x2e, 0xf1, 0xb5, 0x61, 0xd4, 
-0xbc, 0x72, 0x9f, 0xda, 0x3d, 0x8d, 0x07, 0x99, 0xb4, 0x12, 0x64, 0x1f, 0x4d, 0x6d, 0xc8, 0x16, 
-0xd2, 0x44, 0x96, 0x57, 0xab, 0xe1, 0x9d, 0x2c, 0x77, 0x21, 0xe2, 0x45, 0x89, 0x64, 0x23, 0xe3, 
-0x5a, 0x00, 0x9f, 0x51, 0x84, 0xb4, 0x6e, 0xee, 0x47, 0x65, 0xf6, 0xd7, 0xb1, 0x16, 0x5b, 0xdc, 
-0x10, 0x28, 0xbe, 0x53, 0xee, 0x6a, 0x14, 0xfa, 0x94, 0x06, 0x3f, 0x8b, 0x75, 0xe4, 0x44, 0x87, 
-0x2a, 0xe9, 0x47, 0xd5, 0xc1, 0x52, 0x07, 0x36, 0x86, 0x75, 0xdc, 0xf5, 0x38, 0x6d, 0x48, 0x08, 
-0x85, 0x53, 0xc8, 0x10, 0xd2, 0x5d, 0xbc, 0x70, 0xf2, 0x3f, 0x8a, 0xed, 0x21, 0xe5, 0x57, 0x19, 
-0x75, 0xa3, 0x34, 0x70, 0x92, 0x56, 0x7d, 0x32, 0x6c, 0x8d, 0x17, 0x5c, 0xee, 0x84, 0xcc, 0xf1, 
-0x64, 0x1f, 0x41, 0x6d, 0x4f, 0xcd, 0xf5, 0x36, 0x6a, 0xd9, 0xee, 0x5b, 0xd1, 0xa4, 0xe3, 0x6c, 
-0xb3, 0xf0, 0x63, 0xce, 0x88, 0x54, 0x38, 0xef, 0xa5, 0x57, 0x0d, 0xaa, 0x37, 0xd6, 0x6c, 0x2e, 
-0x1f, 0x81, 0x93, 0xc6, 0x29, 0x8c, 0xda, 0x67, 0xb1, 0x57, 0xe0, 0x77, 0xb6, 0xf8, 0x11, 0x8d, 
-0x20, 0xcc, 0x43, 0x0a, 0xbd, 0x74, 0x8a, 0x0d, 0xba, 0x35, 0x56, 0xc3, 0x0f, 0xb6, 0x4a, 0xa8, 
-0x69, 0xc9, 0x82, 0xa0, 0x64, 0xbb, 0xa9, 0xcb, 0x53, 0x72, 0x8e, 0x39, 0xa8, 0xee, 0x97, 0xb3, 
-0x63, 0x7a, 0xaf, 0xa0, 0x56, 0x83, 0x99, 0x11, 0x47, 0x87, 0x22, 0x62, 0xc3, 0xe9, 0x71, 0xdf, 
-0x46, 0xcd, 0x8c, 0xba, 0xd4, 0x9a, 0xe7, 0x2e, 0x62, 0xeb, 0xbf, 0x32, 0x73, 0x1d, 0xef, 0xbf, 
-0xd6, 0x92, 0xad, 0x31, 0xf5, 0xc0, 0x76, 0xa6, 0xb1, 0x7e, 0xbe, 0x65, 0xff, 0xd7, 0xa2, 0x30, 
-0xbc, 0x86, 0x0f, 0x50, 0x2d, 0x6c, 0xcc, 0x88, 0xab, 0xf5, 0x7e, 0x06, 0x89, 0xc4, 0x22, 0xd1, 
-0x5e, 0xdc, 0xc0, 0xec, 0x32, 0x65, 0xc9, 0x5b, 0x10, 0x94, 0xa4, 0x15, 0x8e, 0xdf, 0x65, 0xfe, 
-0xc8, 0x2c, 0x03, 0x63, 0x81, 0xa8, 0xef, 0xdd, 0xb8, 0xf2, 0x95, 0x7c, 0xae, 0x08, 0x45, 0x27, 
-0xa7, 0x60, 0x2c, 0xcd, 0x98, 0x36, 0x85, 0xfa, 0xae, 0x09, 0xd8, 0x23, 0xe5, 0x18, 0xc0, 0xaf, 
-0xe0, 0x06, 0xfc, 0xb5, 0x33, 0x50, 0x10, 0x2b, 0x8f, 0xc5, 0xf9, 0xda, 0x06, 0x94, 0x1b, 0x81, 
-0xa2, 0x4b, 0x05, 0x3d, 0x96, 0x33, 0x1b, 0x83, 0x4c, 0x00, 0x9e, 0x17, 0x2c, 0xdf, 0x95, 0xc7, 
-0x22, 0x8f, 0xe5, 0xca, 0x7e, 0x00, 0xb1, 0xfd, 0x9f, 0xb7, 0x36, 0x60, 0xf9, 0x41, 0x75, 0x13, 
-0xc4, 0x09, 0x3b, 0x91, 0x27, 0x45, 0x5e, 0x33, 0x79, 0xe0, 0xb3, 0x68, 0x38, 0xee, 0x4e, 0xcb, 
-0xf2, 0x77, 0xe6, 0x21, 0xa3, 0x75, 0xfe, 0x8f, 0x1b, 0x57, 0xe6, 0x0d, 0x77, 0x16, 0x34, 0x81, 
-0xe0, 0x06, 0xfa, 0xd0, 0x17, 0x04, 0x5b, 0x40, 0xd9, 0xf7, 0x4d, 0x14, 0xe5, 0x25, 0xdb, 0x35, 
-0xef, 0xcb, 0x04, 0x7c, 0x32, 0xb2, 0x5d, 0x29, 0x80, 0xf7, 0x00, 0x35, 0xee, 0x0e, 0x59, 0xb7, 
-0xa2, 0x83, 0x11, 0xf8, 0xcb, 0x5f, 0x89, 0x3a, 0x14, 0x4f, 0x6d, 0xcd, 0x1a, 0xe9, 0x41, 0x2e, 
-0x4c, 0xef, 0x1e, 0x2a, 0x43, 0x09, 0x58, 0x16, 0x7b, 0xab, 0xce, 0x92, 0xa6, 0xef, 0x01, 0x34, 
-0x95, 0x64, 0x3f, 0x9e, 0xe2, 0x37, 0xae, 0x47, 0x2c, 0xa8, 0x17, 0x51, 0xb1, 0x23, 0x9e, 0xfb, 
-0xb6, 0x34, 0x67, 0xf6, 0x3c, 0x26, 0x99, 0xbb, 0x4a, 0x59, 0xae, 0xd4, 0x24, 0xc0, 0x17, 0x78, 
-0x3e, 0x61, 0x26, 0xe4, 0x38, 0xfa, 0x99, 0xc7, 0x1a, 0x7a, 0xb6, 0x50, 0x71, 0x07, 0xd5, 0x67, 
-0x2a, 0xcb, 0x47, 0x83, 0x9d, 0x40, 0xf4, 0x25, 0x48, 0xcb, 0x7f, 0xa1, 0x70, 0xdb, 0xae, 0xe4, 
-0x56, 0x14, 0xa2, 0x31, 0xaf, 0x75, 0x5a, 0xb6, 0x29, 0xe2, 0x88, 0xc5, 0xb5, 0xfe, 0x57, 0xca, 
-0xe9, 0x25, 0xc2, 0xf9, 0xad, 0x70, 0x06, 0x4b, 0x66, 0x3e, 0x72, 0x18, 0xbe, 0x52, 0x88, 0x5e, 
-0x09, 0xd9, 0x71, 0x0d, 0xb0, 0x53, 0xcd, 0xa3, 0x4b, 0xfc, 0x6d, 0xd7, 0xc7, 0x80, 0xe7, 0xbb, 
-0xa4, 0x58, 0x17, 0x96, 0xd7, 0xa8, 0x1e, 0x5e, 0x9b, 0x06, 0x8d, 0x69, 0xed, 0x3c, 0x02, 0xdb, 
-0x34, 0xd3, 0x45, 0xc1, 0xfc, 0x4e, 0x94, 0xf0, 0x5f, 0xbd, 0x9d, 0x4d, 0x64, 0xc5, 0x80, 0xe3, 
-0x28, 0x09, 0x93, 0x70, 0xbd, 0x44, 0x78, 0xad, 0x68, 0x52, 0xa9, 0xf9, 0xd2, 0x4c, 0x0e, 0xa4, 
-0xc2, 0x6d, 0x55, 0xae, 0x79, 0x46, 0x8a, 0x1d, 0x3c, 0x6f, 0x27, 0x4e, 0xb4, 0x01, 0x47, 0xa7, 
-0xf7, 0x09, 0x82, 0xb9, 0x59, 0x04, 0x91, 0xd7, 0x0e, 0x6d, 0xcb, 0x94, 0xad, 0x75, 0xc7, 0xf2, 
-0xde, 0x23, 0x3d, 0x5d, 0xe1, 0x82, 0x47, 0xb5, 0xe9, 0x20, 0xd4, 0x12, 0x5b, 0x74, 0x97, 0xf3, 
-0x86, 0x68, 0x7a, 0xf8, 0x93, 0x00, 0xe0, 0x3f, 0x7d, 0xda, 0x05, 0xad, 0x73, 0xcb, 0x7c, 0x0c, 
-0xe7, 0x8e, 0x9e, 0xed, 0x4d, 0x94, 0x5a, 0x2d, 0xb1, 0x03, 0xa5, 0x4b, 0x69, 0x88, 0x54, 0xea, 
-0xd4, 0x92, 0xfd, 0x15, 0xad, 0xef, 0x42, 0xc2, 0x8f, 0xeb, 0x60, 0xb9, 0x10, 0xd2, 0x5c, 0x76, 
-0x98, 0x63, 0x1b, 0x42, 0xc2, 0x08, 0x68, 0x7d, 0x3c, 0xd5, 0x85, 0x5f, 0xed, 0xe0, 0x43, 0xc9, 
-0xfb, 0x64, 0x18, 0x76, 0x27, 0x69, 0x11, 0xa9, 0x3b, 0x7b, 0x8f, 0x47, 0x5b, 0xd4, 0x81, 0xfd, 
-0xb0, 0xd8, 0x9d, 0xec, 0x27, 0x96, 0xe0, 0x3c, 0xc4, 0x4d, 0x25, 0xe6, 0x9c, 0x1c, 0xef, 0x2a, 
-0x7f, 0x97, 0x1e, 0xac, 0x0e, 0x51, 0x99, 0x05, 0xfd, 0x2b, 0x85, 0xe7, 0x01, 0x7e, 0x2e, 0xdd, 
-0x3e, 0xb3, 0xd6, 0x2f, 0xcd, 0x50, 0xbe, 0x7d, 0xb1, 0x99, 0x29, 0x8b, 0xad, 0xd6, 0x6b, 0x2b, 
-0x1a, 0x3f, 0x85, 0x25, 0xb6, 0xf5, 0x6e, 0x2e, 0x3d, 0xc4, 0xd3, 0x34, 0xff, 0x01, 0xc7, 0x1c, 
-0x90, 0xe1, 0x3f, 0x97, 0x17, 0x8b, 0xf1, 0x39, 0xd9, 0x21, 0x92, 0xe0, 0x27, 0x67, 0xc0, 0xda, 
-0xf1, 0xa9, 0xd1, 0x8d, 0x99, 0xe6, 0x79, 0xc6, 0x65, 0xa0, 0xdb, 0x3d, 0x9a, 0x7c, 0x69, 0xb5, 
-0xfb, 0x86, 0x3a, 0xe9, 0xdc, 0x89, 0x36, 0x99, 0x4a, 0x6b, 0xfc, 0x08, 0x75, 0x1c, 0xc1, 0x56, 
-0x71, 0xc6, 0x4b, 0xfd, 0xb8, 0xcd, 0x02, 0x55, 0xe4, 0x0c, 0xcb, 0x3a, 0xd6, 0x83, 0x6f, 0x16, 
-0x55, 0xc7, 0x88, 0x4c, 0xea, 0x5a, 0x17, 0xb3, 0x3e, 0x70, 0x1c, 0x37, 0x0b, 0xfb, 0xcb, 0x87, 
-0xe6, 0x70, 0xc4, 0xd8, 0x14, 0xb9, 0x2f, 0x02, 0x65, 0x48, 0x38, 0xde, 0x5d, 0x7e, 0x9d, 0x11, 
-0x53, 0x7a, 0x37, 0xfe, 0x6d, 0xa7, 0x8c, 0x0b, 0xec, 0xba, 0x2d, 0xf5, 0x8f, 0x20, 0x9c, 0xfd, 
-0xbd, 0x01, 0x70, 0x49, 0x21, 0x11, 0x8d, 0x34, 0x0b, 0x9a, 0xaf, 0x52, 0xd7, 0xec, 0x87, 0xbe, 
-0x5f, 0xdb, 0x6a, 0x0d, 0x33, 0xa1, 0x1f, 0xbe, 0x13, 0x2e, 0x7c, 0x5c, 0x46, 0xf7, 0x1a, 0x79, 
-0xa4, 0xf5, 0x8e, 0x7d, 0xc1, 0x69, 0x89, 0x38, 0xe2, 0xbe, 0x61, 0x31, 0x8a, 0xdd, 0x67, 0x3b, 
-0xd3, 0x73, 0xae, 0x3f, 0x51, 0xc1, 0x6f, 0xfd, 0x84, 0x4a, 0x17, 0x5f, 0x82, 0x9e, 0x14, 0x5c, 
-0x6d, 0xee, 0x10, 0x61, 0x3d, 0x01, 0xe9, 0xb4, 0xa5, 0xda, 0x76, 0xea, 0x36, 0xa2, 0x1e, 0xd8, 
-0xb4, 0x67, 0x80, 0x5a, 0xa5, 0x88, 0x60, 0xf3, 0x2d, 0x0b, 0xb9, 0x6c, 0x26, 0x78, 0xbd, 0x65, 
-0x9c, 0x43, 0x15, 0xc7, 0xa6, 0xf5, 0x04, 0x95, 0x4b, 0x0b, 0xe3, 0x67, 0x38, 0x22, 0xd4, 0x2e, 
-0x56, 0xeb, 0x1f, 0x2b, 0xf8, 0xab, 0xd0, 0x52, 0x18, 0x9c, 0x5d, 0x06, 0x50, 0x1d, 0x62, 0xb3, 
-0x0c, 0x8b, 0xb8, 0xc6, 0x38, 0x9b, 0xf7, 0x2b, 0x0a, 0xa4, 0x8f, 0x6b, 0x2d, 0x81, 0x1e, 0x3d, 
-0xc2, 0x9f, 0x27, 0x5d, 0x49, 0xaa, 0xbf, 0x2b, 0xef, 0x9c, 0x21, 0xba, 0x2f, 0xd6, 0xa1, 0xf7, 
-0x29, 0xd1, 0xc4, 0x7b, 0xb0, 0x6b, 0x43, 0x9b, 0x11, 0xf5, 0x8e, 0x1f, 0x9d, 0xe1, 0x71, 0xad, 
-0x85, 0xc2, 0x0e, 0xa2, 0x23, 0xcc, 0x31, 0xb6, 0x1f, 0xa9, 0x01, 0xda, 0x4f, 0x2e, 0xc6, 0x3b, 
-0xd6, 0x53, 0xa4, 0xe0, 0x5a, 0xd0, 0x48, 0x30, 0xa9, 0x93, 0xf2, 0xd0, 0x9d, 0xc1, 0x7b, 0xa9, 
-0xd3, 0x47, 0xf1, 0x91, 0x02, 0x41, 0x9e, 0x2d, 0x08, 0x98, 0xf3, 0xcc, 0xb6, 0xe8, 0x42, 0x8d, 
-0x53, 0xf4, 0x08, 0xb7, 0xd2, 0x6c, 0xad, 0x30, 0x64, 0x13, 0xd0, 0x58, 0x3d, 0x03, 0xd6, 0xb4, 
-0x59, 0x06, 0xea, 0x43, 0xf4, 0xb3, 0x18, 0xbf, 0x4b, 0x1f, 0xc9, 0x63, 0xef, 0x9d, 0x0f, 0xab, 
-0x25, 0xc7, 0x98, 0xf9, 0xae, 0x27, 0xf3, 0xe0, 0x1f, 0x4a, 0xc9, 0x74, 0xa0, 0x24, 0x7d, 0x4b, 
-0xc6, 0x08, 0x96, 0x57, 0x12, 0x8c, 0x49, 0xae, 0x9c, 0xef, 0x20, 0x0e, 0xb7, 0x4f, 0xdd, 0x9d, 
-0xc0, 0x80, 0x5b, 0xe9, 0xa7, 0xd6, 0x53, 0x0a, 0xe6, 0x85, 0xfa, 0x5c, 0x3a, 0x82, 0xcd, 0x30, 
-0x5e, 0x7d, 0xbb, 0x14, 0x55, 0xfd, 0x86, 0x0f, 0xb2, 0x8d, 0x76, 0x4d, 0xc2, 0x11, 0x36, 0x25, 
-0xe2, 0xc4, 0xaa, 0x7c, 0xbb, 0xfa, 0x29, 0xe6, 0xd2, 0x56, 0xa0, 0x28, 0xd8, 0x63, 0xac, 0xe5, 
-0x86, 0xdc, 0x37, 0x18, 0xed, 0xa6, 0xda, 0xb2, 0x6f, 0x90, 0xee, 0xb9, 0x1c, 0xe7, 0x64, 0xd0, 
-0x44, 0x76, 0xf9, 0x63, 0x0e, 0x92, 0x45, 0x84, 0x66, 0x53, 0xe4, 0x8b, 0x5e, 0xde, 0x21, 0xd5, 
-0x53, 0x34, 0x44, 0x5d, 0x7d, 0xce, 0x40, 0xf6, 0x20, 0xe6, 0x75, 0xba, 0x8a, 0x4b, 0xf6, 0x63, 
-0xe7, 0xc8, 0x98, 0x87, 0x19, 0xb5, 0xf7, 0x1f, 0x81, 0x6c, 0x03, 0x85, 0x3a, 0x76, 0xe8, 0x62, 
-0x1a, 0x52, 0x28, 0xb5, 0x3b, 0x62, 0xf7, 0x54, 0x70, 0x1f, 0xbc, 0x32, 0x7a, 0xce, 0x4e, 0xe4, 
-0xb1, 0x20, 0x51, 0x75, 0x15, 0x7c, 0x5f, 0xdc, 0x6e, 0xc8, 0xa6, 0x86, 0x38, 0x0e, 0xcc, 0x8a, 
-0xee, 0x46, 0xb3, 0x2c, 0xaa, 0xfe, 0x4a, 0x19, 0x70, 0xa7, 0xce, 0x76, 0x9f, 0x28, 0x6f, 0xec, 
-0x8f, 0xa0, 0xf6, 0x12, 0x8b, 0x37, 0xd2, 0x66, 0x54, 0xeb, 0x75, 0x0d, 0x44, 0xc2, 0x91, 0x3b, 
-0xa9, 0x88, 0xf9, 0xb7, 0xe2, 0xcf, 0x5b, 0x8c, 0xfe, 0x31, 0x66, 0xcc, 0xde, 0xbe, 0x7a, 0xfc, 
-0x2e, 0x49, 0xd9, 0x96, 0xea, 0x26, 0x37, 0x6e, 0x48, 0x14, 0xcd, 0x32, 0x44, 0xfe, 0x1e, 0xaf, 
-0x2d, 0xb8, 0x6f, 0x99, 0x11, 0x50, 0x72, 0xb1, 0xfb, 0x25, 0x42, 0xc8, 0x9f, 0xac, 0x6f, 0xbe, 
-0x40, 0x19, 0xca, 0xe0, 0x5e, 0x89, 0xf1, 0x65, 0x75, 0x40, 0x2d, 0x12, 0xd0, 0xa1, 0x72, 0x40, 
-0x80, 0x17, 0xee, 0x48, 0x7e, 0x91, 0x15, 0x3e, 0x5e, 0x7a, 0xb4, 0x53, 0x94, 0x46, 0x62, 0xfa, 
-0x31, 0x4e, 0x13, 0x74, 0x88, 0x35, 0x0b, 0xa5, 0x8d, 0x07, 0x37, 0xaa, 0xc5, 0x6f, 0x1e, 0xdd, 
-0xa8, 0x00, 0x14, 0xb7, 0x2e, 0xa3, 0x08, 0xbd, 0x7f, 0xb5, 0xa8, 0xea, 0x28, 0x09, 0xa5, 0x5c, 
-0x33, 0x99, 0x54, 0xf2, 0x6b, 0x05, 0xd6, 0x92, 0x71, 0x43, 0x25, 0xef, 0x66, 0x79, 0x9a, 0x4a, 
-0xb0, 0xe8, 0x17, 0xac, 0xc9, 0x11, 0xb7, 0x8a, 0xdb, 0xc2, 0x79, 0x0f, 0x87, 0xdc, 0x03, 0x2a, 
-0xe3, 0x84, 0x61, 0xdd, 0xa5, 0x1d, 0x6f, 0xf7, 0x7e, 0xc1, 0x3f, 0xa8, 0x28, 0xf0, 0x9b, 0x02, 
-0x36, 0x94, 0x4a, 0x1d, 0xe7, 0x9c, 0x56, 0xbb, 0x06, 0xdd, 0x96, 0x1e, 0xe3, 0x76, 0x9f, 0xc7, 
-0x93, 0x23, 0x4f, 0x85, 0x0c, 0x5a, 0xd5, 0x7f, 0x09, 0x56, 0x2e, 0x7a, 0xb1, 0x1e, 0xe4, 0x92, 
-0x04, 0xbb, 0x39, 0xde, 0x6d, 0x55, 0x05, 0x7a, 0xd5, 0x2e, 0x08, 0x53, 0x35, 0x95, 0x13, 0x41, 
-0x71, 0x1f, 0xee, 0xab, 0x41, 0x02, 0x5d, 0xc9, 0xce, 0xab, 0x6e, 0x3e, 0xc9, 0x7a, 0x06, 0xd1, 
-0xb0, 0xf5, 0x8c, 0x9f, 0x04, 0x69, 0x93, 0xca, 0x7c, 0x4c, 0x05, 0xd1, 0xea, 0xbd, 0x1c, 0xe5, 
-0x9d, 0x8a, 0xdd, 0x6b, 0xec, 0x06, 0x4b, 0xda, 0xf0, 0xa5, 0x69, 0x98, 0x0b, 0x46, 0xa4, 0xbd, 
-0x90, 0xd9, 0xee, 0x4b, 0x68, 0x90, 0x01, 0xc2, 0xaa, 0x34, 0x6f, 0xe1, 0x03, 0x52, 0xcd, 0xbd, 
-0x21, 0xf6, 0x04, 0xc8, 0xe6, 0x0e, 0x7b, 0x8c, 0x08, 0xcd, 0xde, 0xad, 0xfc, 0x98, 0x50, 0xec, 
-0xb6, 0x59, 0xda, 0x80, 0xe6, 0x52, 0xf1, 0x32, 0xc0, 0x98, 0xfd, 0x4a, 0xec, 0x3f, 0x71, 0xf9, 
-0x61, 0x18, 0xc8, 0x6c, 0xff, 0x4d, 0x8c, 0xc5, 0xd9, 0x0b, 0x42, 0xcf, 0x2b, 0xaf, 0x3a, 0x18, 
-0x81, 0xb9, 0x5b, 0xcf, 0x3f, 0xde, 0x06, 0x5f, 0xcc, 0x33, 0x95, 0x4c, 0xf3, 0x2a, 0x9f, 0x09, 
-0xf8, 0x36, 0x6a, 0xea, 0xa4, 0x4b, 0xb8, 0x94, 0xc7, 0x3d, 0x0e, 0xfc, 0x56, 0xc5, 0x93, 0x38, 
-0x13, 0x59, 0xdf, 0x91, 0xd6, 0x3b, 0xc5, 0xb2, 0x25, 0xe4, 0xd5, 0x65, 0x75, 0xff, 0x41, 0x24, 
-0x7f, 0x6f, 0x5d, 0xc9, 0x86, 0x64, 0x0a, 0xeb, 0x30, 0xf8, 0xdb, 0x3b, 0xc6, 0xfa, 0x34, 0xa7, 
-0x42, 0xcf, 0xb9, 0xdf, 0x48, 0x5d, 0xc0, 0x40, 0x80, 0xa6, 0x1d, 0x8c, 0xcb, 0xe9, 0xb4, 0x60, 
-0x9c, 0xc4, 0x67, 0x84, 0x1d, 0xef, 0xc1, 0xd8, 0xa0, 0xb8, 0x4d, 0x7f, 0x29, 0x6f, 0xe9, 0x1c, 
-0x02, 0xf7, 0x8d, 0x13, 0x62, 0xa7, 0xfa, 0x94, 0x55, 0x23, 0x75, 0xde, 0xc2, 0x83, 0x38, 0x5d, 
-0xdc, 0xf1, 0x36, 0xab, 0x2a, 0x90, 0x64, 0x3e, 0x07, 0x57, 0xb3, 0x30, 0x1d, 0x82, 0x36, 0x94, 
-0x5b, 0x02, 0x2f, 0xfe, 0xb6, 0x7c, 0xe9, 0x1b, 0x03, 0x59, 0x81, 0xb4, 0xf5, 0x32, 0xd8, 0x5c, 
-0xf9, 0x97, 0xca, 0x23, 0xb6, 0xff, 0x71, 0x9a, 0x4a, 0xd2, 0x68, 0x9f, 0x29, 0xbf, 0xd4, 0x21, 
-0x5c, 0xa1, 0x3f, 0x66, 0x27, 0xd3, 0x7c, 0x13, 0x6b, 0xc2, 0x1a, 0x96, 0x3e, 0x05, 0xb6, 0x79, 
-0x5e, 0x3a, 0x73, 0x1b, 0x82, 0xcf, 0x96, 0x26, 0x8b, 0xe1, 0x01, 0x32, 0x96, 0xb3, 0x11, 0x7b, 
-0x67, 0xb5, 0x87, 0x1a, 0xe2, 0x98, 0x55, 0xfc, 0x08, 0xe4, 0x30, 0xac, 0x14, 0x8e, 0xbb, 0xf0, 
-0x26, 0x75, 0xd8, 0x61, 0xc0, 0x6e, 0x56, 0x7f, 0x46, 0xd1, 0x96, 0x5a, 0x1e, 0x32, 0x68, 0xef, 
-0x15, 0x9f, 0xb3, 0x8b, 0x2c, 0x0a, 0xad, 0x63, 0xcf, 0x87, 0xfe, 0x08, 0x66, 0x50, 0x86, 0xfa, 
-0x5a, 0x7a, 0x0c, 0xb3, 0x2b, 0xc2, 0x91, 0xd8, 0xa8, 0x3a, 0xea, 0x12, 0x34, 0x50, 0xb7, 0x3f, 
-0x7c, 0x61, 0xae, 0x17, 0x96, 0xb9, 0x21, 0x63, 0xe6, 0x94, 0x6b, 0x03, 0xa3, 0xf3, 0x6e, 0x29, 
-0xf8, 0xd5, 0x5b, 0x30, 0xa2, 0x11, 0x2b, 0xf6, 0x1a, 0x42, 0xe7, 0xb0, 0x73, 0xa5, 0x61, 0x09, 
-0x85, 0xe4, 0x0f, 0x92, 0xf6, 0x9f, 0xb4, 0x4b, 0xb6, 0x82, 0x33, 0xe0, 0xbb, 0x45, 0x84, 0x18, 
-0xe4, 0x3b, 0x62, 0x12, 0x4a, 0xac, 0xe9, 0x0c, 0x23, 0xa2, 0x69, 0x86, 0x46, 0xdc, 0x7b, 0xa6, 
-0xd4, 0x16, 0x76, 0x96, 0xd2, 0x62, 0xf8, 0x25, 0x7a, 0xd1, 0x86, 0x3e, 0x20, 0xcf, 0x33, 0x4f, 
-0x9e, 0xcd, 0x22, 0x99, 0x15, 0x45, 0x85, 0x21, 0x4e, 0x10, 0x64, 0xa5, 0x8a, 0x36, 0x0e, 0xe9, 
-0x30, 0xa9, 0x87, 0x3f, 0x74, 0x57, 0x38, 0xb6, 0xf4, 0x81, 0xc0, 0x02, 0x55, 0xc5, 0x3d, 0xdd, 
-0x30, 0xff, 0x4a, 0x27, 0xd1, 0xa4, 0x8a, 0x11, 0xcd, 0xda, 0x90, 0xaa, 0xc5, 0x57, 0xe8, 0x39, 
-0x4d, 0xa0, 0x77, 0xd0, 0x56, 0xdd, 0x3b, 0xeb, 0x24, 0xfb, 0xa6, 0x5f, 0x7c, 0xc2, 0x6f, 0xa4, 
-0xca, 0x4c, 0x9d, 0x77, 0xfb, 0x52, 0x37, 0xa2, 0x87, 0x43, 0xfe, 0x1e, 0x8d, 0x3e, 0xec, 0xb1, 
-0x25, 0xa7, 0x05, 0xc7, 0xff, 0xae, 0xd6, 0x7f, 0x5b, 0x74, 0xe7, 0x4b, 0x6c, 0xd8, 0xef, 0x45, 
-0x26, 0xa3, 0x71, 0x31, 0xbb, 0x10, 0x72, 0x1a, 0xa9, 0x43, 0xf0, 0x8c, 0x50, 0x01, 0x63, 0x17, 
-0xf5, 0x4e, 0x9d, 0xbe, 0xf7, 0x91, 0xd8, 0x1a, 0x8c, 0xc0, 0x02, 0x6c, 0x53, 0xe0, 0x8a, 0xb0, 
-0x16, 0xff, 0x24, 0x87, 0x32, 0xc8, 0x0d, 0x9c, 0x4d, 0xb4, 0x69, 0xef, 0x49, 0x83, 0x75, 0xdd, 
-0x50, 0x8d, 0x0f, 0xd2, 0x4a, 0x28, 0xf7, 0x3b, 0x55, 0x2c, 0xc3, 0x61, 0x19, 0xd1, 0x37, 0x8b, 
-0xe7, 0x4f, 0xc3, 0x21, 0x58, 0xed, 0x2c, 0x69, 0xc5, 0xa2, 0xb8, 0xf0, 0x2a, 0xce, 0x72, 0x99, 
-0xbe, 0x56, 0x17, 0xfc, 0xc7, 0x0c, 0xf4, 0x33, 0xc0, 0xf1, 0x47, 0xe6, 0x52, 0xc4, 0xa1, 0xb4, 
-0xe2, 0x4f, 0xc0, 0xaa, 0x58, 0xdd, 0x69, 0xb1, 0xfb, 0x71, 0x3b, 0xe6, 0x61, 0xc6, 0xae, 0xe5, 
-0xbc, 0x7c, 0xf3, 0x3f, 0x57, 0xdb, 0xb0, 0x7f, 0x5c, 0x12, 0xec, 0x1d, 0xfd, 0x92, 0xa9, 0xe4, 
-0x45, 0x97, 0x1a, 0xee, 0x70, 0xa3, 0x1f, 0x86, 0x9d, 0xad, 0x73, 0xee, 0x5b, 0x69, 0xf8, 0x47, 
-0x22, 0xee, 0x50, 0x2a, 0x68, 0x05, 0x16, 0xb1, 0xc1, 0xf2, 0x41, 0x85, 0x1c, 0xbe, 0x70, 0x9d, 
-0x4a, 0xca, 0x00, 0x36, 0xec, 0x45, 0x22, 0xdb, 0x61, 0x8d, 0x1f, 0xc0, 0x0b, 0xd5, 0x6f, 0x18, 
-0xc5, 0x0e, 0xb6, 0xa8, 0x00, 0xdd, 0xca, 0x18, 0x64, 0xe6, 0x82, 0x41, 0x72, 0x8e, 0x0a, 0x45, 
-0x23, 0xd1, 0x33, 0xc1, 0x1b, 0x80, 0xba, 0x9b, 0x01, 0xe9, 0x4a, 0xaf, 0x95, 0xed, 0xd2, 0x9d, 
-0x2f, 0xbf, 0xcd, 0x37, 0xa2, 0xe2, 0x7b, 0xc9, 0x2e, 0xb4, 0x08, 0x77, 0x26, 0xa8, 0x6d, 0xcb, 
-0x48, 0xe4, 0xa2, 0xef, 0x41, 0x79, 0x06, 0x4c, 0x75, 0x3b, 0xbe, 0x51, 0xda, 0x75, 0x8c, 0xe5, 
-0x17, 0x7b, 0x07, 0xc0, 0x98, 0xd1, 0x3b, 0xa8, 0xb9, 0x6d, 0xff, 0x38, 0xbf, 0x92, 0x7c, 0xb5, 
-0x6c, 0xd3, 0xa9, 0x3f, 0xe1, 0x7b, 0x11, 0x58, 0x60, 0x0b, 0x77, 0xa1, 0x91, 0x08, 0xae, 0xd8, 
-0x4c, 0x00, 0x79, 0x8f, 0x58, 0x1a, 0xf6, 0x40, 0x8a, 0xd6, 0x76, 0xb0, 0x5f, 0x20, 0x4f, 0x94, 
-0x5d, 0x85, 0x24, 0xba, 0x08, 0x8b, 0x10, 0x44, 0x19, 0x6b, 0xea, 0x13, 0x76, 0x95, 0x09, 0x86, 
-0x28, 0xbe, 0x0d, 0xa6, 0x79, 0xde, 0x08, 0x6e, 0x92, 0x2f, 0xd1, 0x07, 0xc5, 0x69, 0x28, 0x92, 
-0xd7, 0xc3, 0x4f, 0xb3, 0xda, 0x16, 0x6d, 0x0d, 0x29, 0x76, 0xe0, 0x36, 0x8f, 0xb9, 0xf4, 0x47, 
-0x60, 0x06, 0x8f, 0xb4, 0x16, 0xc7, 0x2c, 0x9a, 0xaf, 0x6d, 0x0d, 0xba, 0xf7, 0x9c, 0x7d, 0xd9, 
-0x6a, 0x0d, 0x24, 0xab, 0x63, 0xf4, 0x14, 0x2e, 0x8f, 0x57, 0x72, 0xd7, 0x8d, 0x12, 0xb7, 0x33, 
-0x0e, 0xf4, 0x3d, 0x67, 0x85, 0xa8, 0xeb, 0x5c, 0xe1, 0x9c, 0x6a, 0x54, 0x81, 0x34, 0x96, 0x75, 
-0xbe, 0x4f, 0x2e, 0xd9, 0x17, 0x55, 0xc4, 0xa1, 0xf6, 0xac, 0x05, 0x97, 0xf3, 0x5b, 0x35, 0x74, 
-0xdc, 0xc3, 0x18, 0x5e, 0xc9, 0x22, 0x46, 0xe0, 0x68, 0x81, 0x12, 0x5e, 0xf9, 0xb0, 0x47, 0x97, 
-0x6c, 0x89, 0xd4, 0x44, 0xe1, 0x58, 0x10, 0xf2, 0x2b, 0x59, 0x1f, 0x83, 0xd1, 0x29, 0xf3, 0xd8, 
-0xc7, 0xa0, 0x60, 0xee, 0xaa, 0x1d, 0x58, 0x39, 0xa7, 0xdc, 0x41, 0x26, 0xfc, 0x1c, 0x65, 0x00, 
-0xcb, 0x24, 0x9f, 0x5d, 0x04, 0xdb, 0x17, 0xe7, 0x99, 0x06, 0xfb, 0x8a, 0x4f, 0x6a, 0xa6, 0xfd, 
-0xf3, 0x3f, 0xd5, 0xfc, 0x6d, 0xcd, 0x38, 0x7e, 0x98, 0xf9, 0x33, 0xd3, 0xa4, 0x67, 0xb5, 0x30, 
-0x4e, 0xe6, 0x01, 0x3c, 0x9b, 0xb8, 0x6f, 0xce, 0x03, 0xad, 0x6c, 0xa4, 0x3c, 0xf2, 0x71, 0xca, 
-0x34, 0x9c, 0x8c, 0x2b, 0xf5, 0x42, 0xc9, 0xe2, 0x60, 0x49, 0xf2, 0x8a, 0x53, 0x27, 0x39, 0xa1, 
-0x49, 0x18, 0xe8, 0x85, 0x9c, 0x1d, 0xf4, 0x43, 0x04, 0x76, 0x99, 0x33, 0x63, 0xca, 0x89, 0x50, 
-0xd0, 0x61, 0xb0, 0x4c, 0xd5, 0x5c, 0x0c, 0xe3, 0xcb, 0x23, 0xd6, 0x82, 0x36, 0xe3, 0x7b, 0x56, 
-0xe0, 0x85, 0xc9, 0x36, 0x46, 0xe3, 0x5d, 0x2f, 0x8d, 0x53, 0xd5, 0xe7, 0x92, 0x48, 0xa4, 0xd3, 
-0xe4, 0xb2, 0x1f, 0xbe, 0x9b, 0x52, 0xf0, 0x84, 0x72, 0xae, 0xe5, 0xc8, 0x2d, 0x45, 0x22, 0x7e, 
-0x4d, 0x2f, 0xea, 0xcf, 0x23, 0xf3, 0x5c, 0x0e, 0xfa, 0x89, 0x9d, 0xb6, 0xf1, 0x29, 0xdf, 0x39, 
-0x83, 0x50, 0x64, 0xe1, 0x40, 0xa7, 0x0e, 0x8f, 0x52, 0x2a, 0x84, 0xf5, 0x79, 0x36, 0x8a, 0x54, 
-0x03, 0xea, 0x96, 0x71, 0x1b, 0x27, 0xd9, 0x0f, 0x59, 0xe8, 0x1f, 0x65, 0x83, 0x9b, 0x3a, 0xb0, 
-0x75, 0x9a, 0xb8, 0x36, 0xc2, 0xa9, 0x59, 0x98, 0x2f, 0x11, 0x7f, 0x08, 0x43, 0xd2, 0xbb, 0xfb, 
-0x62, 0xc7, 0x91, 0x73, 0xaf, 0x5a, 0xe3, 0x93, 0x31, 0x7d, 0xed, 0x88, 0xac, 0x51, 0xc9, 0x24, 
-0x48, 0x76, 0x32, 0x1e, 0xc7, 0xb6, 0x2b, 0xcd, 0xa3, 0x8c, 0x17, 0x2b, 0x49, 0xba, 0x0f, 0x5e, 
-0xde, 0x1c, 0xc0, 0x45, 0x0b, 0xdc, 0x80, 0x10, 0xca, 0xa7, 0x27, 0xed, 0x80, 0xda, 0x2c, 0xe8, 
-0x42, 0xf7, 0x32, 0xdf, 0x1c, 0x7f, 0x5e, 0xa9, 0xf9, 0xd5, 0x07, 0x62, 0xbc, 0xa0, 0x19, 0x38, 
-0xaa, 0x94, 0xd6, 0x1c, 0xcc, 0xb9, 0xfd, 0x64, 0xee, 0xaa, 0x5e, 0x73, 0x4c, 0xe2, 0xa6, 0xb8, 
-0x65, 0xf9, 0x23, 0x82, 0x47, 0x00, 0xe9, 0xa3, 0xba, 0xfb, 0x0a, 0x84, 0x2d, 0x16, 0x7d, 0xb1, 
-0x6f, 0x3d, 0xe9, 0x51, 0x0d, 0xa2, 0xc1, 0x03, 0x3d, 0x1b, 0xa3, 0x77, 0x8f, 0xcc, 0x20, 0xa7, 
-0xfd, 0xb7, 0x75, 0x36, 0xc2, 0x05, 0x7c, 0x5f, 0x0c, 0x82, 0x41, 0xf9, 0x2c, 0x64, 0xa2, 0xd3, 
-0x47, 0x94, 0x57, 0x01, 0x9a, 0xf9, 0xce, 0xb4, 0x90, 0x07, 0x76, 0x40, 0xbb, 0xa2, 0x48, 0xac, 
-0xd4, 0x3a, 0x0b, 0x61, 0x7a, 0x95, 0xb2, 0x6d, 0x1a, 0xbc, 0x8f, 0x76, 0x22, 0xd4, 0xc7, 0xf9, 
-0x69, 0xab, 0x3c, 0xda, 0x0b, 0xa4, 0xb9, 0xfd, 0xae, 0x28, 0xd6, 0xbb, 0x55, 0x86, 0x3c, 0xf6, 
-0xc2, 0xaa, 0x36, 0xcc, 0xfe, 0x01, 0xc3, 0xde, 0x88, 0x08, 0xfb, 0x65, 0x0d, 0x91, 0x1c, 0x69, 
-0xb6, 0xf6, 0xe0, 0x8f, 0x6a, 0x2b, 0x97, 0x01, 0x84, 0x30, 0xea, 0x10, 0x4b, 0x88, 0xbc, 0xf4, 
-0x47, 0x56, 0x10, 0xe1, 0x75, 0x32, 0x65, 0x8b, 0xf1, 0xb2, 0x5d, 0x9e, 0xec, 0x00, 0x95, 0x3b, 
-0x4e, 0xca, 0xb2, 0x64, 0xe7, 0x89, 0xef, 0xaa, 0x28, 0x56, 0x6f, 0x87, 0xee, 0x25, 0x95, 0xfb, 
-0x5c, 0x6c, 0x91, 0xc2, 0x49, 0x0f, 0x89, 0x9e, 0x17, 0x7a, 0xcb, 0x56, 0x98, 0xbd, 0xe3, 0x22, 
-0x55, 0x7d, 0x4a, 0xad, 0xda, 0x53, 0x70, 0xf8, 0x7d, 0x00, 0x31, 0x6a, 0x42, 0x98, 0x13, 0x87, 
-0xc6, 0x24, 0xb6, 0x35, 0xc0, 0x10, 0x7b, 0x54, 0x37, 0xce, 0xe5, 0xab, 0xc0, 0xf6, 0x31, 0x7a, 
-0x3c, 0x21, 0x9c, 0xc8, 0xa8, 0xf8, 0x96, 0x4e, 0x30, 0x9b, 0xbd, 0x63, 0xfb, 0x45, 0x6c, 0x92, 
-0xd2, 0xfd, 0x5a, 0xe7, 0x09, 0xaf, 0x6f, 0x3f, 0x03, 0x9b, 0x17, 0x5b, 0x29, 0xfa, 0xb4, 0x3a, 
-0xef, 0xa8, 0x68, 0x10, 0xde, 0x79, 0x04, 0xc3, 0x27, 0x1a, 0xd8, 0x78, 0xba, 0x62, 0x11, 0x3a, 
-0xdb, 0xc2, 0xfb, 0x15, 0x8b, 0x68, 0xe2, 0x2c, 0x1e, 0x6f, 0xed, 0xc2, 0x48, 0x01, 0x5d, 0xe8, 
-0xcb, 0x0e, 0xfd, 0x2e, 0xb5, 0x84, 0x4b, 0x14, 0xe6, 0xbc, 0x98, 0x57, 0x6c, 0xce, 0x13, 0x60, 
-0x78, 0x3c, 0x4a, 0xa6, 0xed, 0xcc, 0x9f, 0x75, 0x04, 0x50, 0x8e, 0x15, 0xb6, 0x4b, 0x24, 0x63, 
-0x50, 0xd3, 0x42, 0xe7, 0x73, 0x49, 0xe3, 0x85, 0x3e, 0x54, 0x21, 0xcc, 0xb2, 0xe7, 0x78, 0x4f, 
-0x1f, 0xb6, 0x56, 0x9d, 0xcc, 0x2a, 0x0c, 0x71, 0xa6, 0xd5, 0xb4, 0x21, 0x41, 0xfa, 0xbd, 0xa4, 
-0x10, 0xcc, 0xde, 0x82, 0x40, 0x56, 0xf2, 0x16, 0x2e, 0xe1, 0x02, 0x7b, 0x9e, 0x1e, 0x41, 0x74, 
-0x93, 0xb5, 0xe5, 0x3a, 0xaf, 0x52, 0x75, 0xbb, 0x3d, 0x1c, 0xd4, 0x34, 0x65, 0xff, 0x56, 0xb3, 
-0xc4, 0x64, 0x90, 0x0b, 0xd2, 0x47, 0x2f, 0x02, 0x94, 0xc3, 0x3b, 0xee, 0x0d, 0x84, 0x24, 0xb7, 
-0x5a, 0xc4, 0xed, 0x77, 0xac, 0x59, 0xd9, 0x7a, 0x02, 0x40, 0xde, 0x8e, 0xfc, 0x2b, 0xd5, 0x88, 
-0x1a, 0xa0, 0x0d, 0x57, 0x72, 0x96, 0x1c, 0x5c, 0x90, 0xd9, 0x6c, 0x44, 0xe5, 0x62, 0x1e, 0xc3, 
-0xf1, 0x01, 0x79, 0xa9, 0x8a, 0x1d, 0xb3, 0xec, 0x26, 0x65, 0xb6, 0x2f, 0x19, 0x52, 0xd3, 0x84, 
-0xea, 0x49, 0xcb, 0xe2, 0x8c, 0x6e, 0xce, 0x51, 0x26, 0xc5, 0x93, 0x4d, 0xcb, 0xac, 0x3c, 0x5b, 
-0xff, 0xb4, 0x37, 0xed, 0x4f, 0x8e, 0x73, 0x1e, 0xaa, 0x63, 0x9a, 0x56, 0xd3, 0x08, 0x7e, 0xc7, 
-0x91, 0x52, 0xa4, 0xd0, 0x24, 0xfb, 0x8a, 0x31, 0x9d, 0x45, 0xd9, 0x56, 0x03, 0x9c, 0x62, 0x30, 
-0x7d, 0x20, 0x05, 0xea, 0x44, 0x2e, 0x93, 0xd9, 0x1e, 0xc6, 0x8b, 0x06, 0x33, 0x14, 0x5e, 0xb8, 
-0x29, 0xf0, 0xa3, 0x71, 0xe6, 0x7c, 0x93, 0xf5, 0x17, 0xa8, 0x2c, 0x80, 0xcd, 0xb0, 0xf9, 0x00, 
-0xd5, 0x70, 0xa5, 0x33, 0x4b, 0x13, 0xa1, 0xef, 0xcf, 0x6e, 0xda, 0x39, 0xf6, 0x7f, 0xdb, 0x3c, 
-0x17, 0xc3, 0x68, 0x96, 0xce, 0x09, 0x7e, 0x58, 0x3a, 0x28, 0x6b, 0x0d, 0xbe, 0x77, 0xd4, 0x8b, 
-0x92, 0xbe, 0x5c, 0x36, 0xda, 0x53, 0xc9, 0xff, 0x13, 0xcf, 0x05, 0x9d, 0x63, 0xc8, 0x08, 0xd9, 
-0x9f, 0x86, 0xf1, 0x08, 0x79, 0xa9, 0x1f, 0x38, 0xe5, 0x4c, 0x27, 0xfb, 0xad, 0x69, 0x86, 0xec, 
-0xb3, 0x6f, 0x1a, 0xcc, 0x91, 0x33, 0xe7, 0xcf, 0x13, 0x4d, 0x9b, 0xe0, 0x0c, 0xf5, 0x2d, 0x4c, 
-0xce, 0x9b, 0x56, 0x0a, 0x6b, 0x98, 0x41, 0xea, 0xc3, 0x6d, 0x8e, 0x2a, 0x3f, 0xb4, 0xde, 0xc5, 
-0x10, 0xf0, 0x55, 0x05, 0x75, 0x3a, 0xdb, 0x83, 0x5b, 0xd2, 0x17, 0x2a, 0xdc, 0xcd, 0x33, 0x52, 
-0x80, 0x9e, 0x48, 0x8a, 0xc1, 0xf6, 0x97, 0x27, 0xbc, 0x64, 0x7d, 0xa8, 0x41, 0x9c, 0x1c, 0x88, 
-0xdb, 0x74, 0x33, 0xf4, 0x84, 0x23, 0xeb, 0x8c, 0x6d, 0x9e, 0x81, 0x0f, 0x29, 0xe0, 0xa2, 0xf6, 
-0x49, 0x84, 0x26, 0x35, 0xaf, 0xed, 0x3d, 0x5f, 0xb7, 0xe5, 0x12, 0x84, 0x3f, 0xaa, 0xd7, 0x54, 
-0x20, 0x7d, 0xa8, 0xc1, 0x6e, 0xf5, 0xdd, 0xb3, 0x47, 0xd0, 0x8b, 0xa8, 0xc3, 0xf7, 0x83, 0x4e, 
-0xe5, 0x9c, 0xf4, 0x68, 0x7e, 0xe1, 0x94, 0x44, 0x84, 0xdc, 0x60, 0x40, 0x2e, 0xc9, 0xad, 0x36, 
-0x70, 0xbd, 0x96, 0x12, 0x55, 0x23, 0x34, 0xbe, 0x9c, 0x17, 0xc5, 0x7e, 0xf8, 0x64, 0xbf, 0x37, 
-0x8e, 0x0c, 0xa8, 0x1b, 0x63, 0xb2, 0x99, 0x5e, 0xe6, 0x82, 0x2d, 0x4e, 0xeb, 0x9f, 0x1b, 0xe4, 
-0xd4, 0x96, 0x4d, 0xac, 0xe2, 0x26, 0x65, 0x4a, 0x73, 0x42, 0xf1, 0x86, 0xc2, 0x09, 0xa4, 0x32, 
-0x65, 0x80, 0x4e, 0xf5, 0x1e, 0x34, 0xe9, 0x49, 0x2a, 0xb2, 0x51, 0xbe, 0x98, 0xdd, 0xcd, 0x72, 
-0x05, 0x84, 0xa3, 0x3d, 0x76, 0x0f, 0xd9, 0xa0, 0x5f, 0xff, 0x29, 0x77, 0x9d, 0x66, 0x43, 0xa3, 
-0x87, 0x28, 0xb4, 0x3d, 0x20, 0x8f, 0xbd, 0x6f, 0xad, 0xf2, 0x7e, 0x20, 0xcc, 0xb2, 0x5f, 0x06, 
-0xad, 0x4a, 0xdf, 0xd2, 0xf1, 0x09, 0x68, 0x49, 0xa9, 0x7e, 0x32, 0xbf, 0xae, 0x8f, 0x11, 0xa4, 
-0x46, 0xb3, 0xf6, 0x3f, 0x58, 0x99, 0x76, 0x08, 0xc5, 0x15, 0xdc, 0xf0, 0x69, 0x39, 0x5c, 0xda, 
-0x1a, 0x32, 0xf8, 0x08, 0x14, 0xde, 0x66, 0xbc, 0x04, 0xa0, 0x17, 0xb8, 0x5f, 0x0c, 0xd6, 0x4c, 
-0x14, 0xce, 0x60, 0xaa, 0xc1, 0x40, 0xd2, 0x5a, 0x03, 0xe7, 0xb9, 0xde, 0x72, 0x1c, 0x9c, 0xfe, 
-0x04, 0x79, 0x35, 0x67, 0x97, 0x15, 0x72, 0xb4, 0xf1, 0x68, 0x37, 0xea, 0x8c, 0x1d, 0x3d, 0xa2, 
-0x71, 0xff, 0x5e, 0x27, 0x75, 0x18, 0xaf, 0x35, 0x70, 0x0d, 0x5b, 0xb2, 0xc4, 0x22, 0xfd, 0x6c, 
-0xd1, 0x1c, 0xbf, 0x09, 0x9c, 0x57, 0x0d, 0xd8, 0x8c, 0xeb, 0x5d, 0xc7, 0x9f, 0xdd, 0x63, 0x78, 
-0x45, 0xf1, 0x59, 0x8b, 0x06, 0x41, 0xe1, 0x27, 0x5c, 0xfe, 0x45, 0x79, 0xc4, 0x05, 0x50, 0x23, 
-0xa1, 0xfd, 0x02, 0x8c, 0x5e, 0xb1, 0x6e, 0x47, 0x86, 0xb7, 0xfe, 0x18, 0x8e, 0x36, 0xa6, 0xf7, 
-0xa9, 0x9a, 0x10, 0xaf, 0x28, 0x6f, 0x90, 0xe1, 0x45, 0xbf, 0x29, 0xd7, 0x8a, 0xa8, 0x69, 0x7d, 
-0x12, 0xe1, 0x6f, 0x19, 0x43, 0x29, 0x5d, 0x92, 0xf5, 0xbf, 0xdb, 0x19, 0xee, 0xc4, 0x4f, 0x36, 
-0x12, 0x44, 0xdc, 0x56, 0xb8, 0xf7, 0x08, 0xde, 0x6b, 0xfe, 0x5e, 0xd2, 0x81, 0x64, 0xe6, 0x36, 
-0x16, 0x61, 0xe3, 0xa2, 0x4a, 0xee, 0x77, 0x25, 0xfa, 0x34, 0x62, 0x7d, 0x20, 0x9f, 0x8a, 0xe9, 
-0x24, 0xd1, 0x9a, 0xfd, 0x25, 0xcd, 0xec, 0x2c, 0x72, 0x94, 0x65, 0x84, 0xbf, 0x11, 0xe2, 0xf7, 
-0xaa, 0x3f, 0x72, 0x00, 0xa8, 0x7f, 0x11, 0xb2, 0x73, 0x91, 0xc3, 0x56, 0xb1, 0xf2, 0x49, 0x37, 
-0xfe, 0x56, 0xe8, 0x44, 0xa6, 0x71, 0x96, 0xba, 0x2f, 0xe2, 0x45, 0xf3, 0x6b, 0x0b, 0x88, 0x2c, 
-0xc7, 0x6a, 0x42, 0x0e, 0x8d, 0x50, 0xc2, 0x2a, 0x4a, 0xd9, 0xb0, 0xf2, 0xbd, 0xe2, 0x4b, 0x06, 
-0xd0, 0x97, 0x10, 0x28, 0x4e, 0xca, 0x09, 0x91, 0xc1, 0x12, 0x37, 0xe1, 0x9b, 0x64, 0x01, 0xd0, 
-0xbe, 0x44, 0x2a, 0xdb, 0x3d, 0x52, 0xa8, 0x07, 0x37, 0xaf, 0x7b, 0xfa, 0xde, 0x68, 0xef, 0x41, 
-0x21, 0x4a, 0x03, 0xfd, 0x3d, 0x8a, 0xac, 0x11, 0x94, 0xe3, 0x26, 0xae, 0xd9, 0x9b, 0x72, 0xad, 
-0x81, 0xbc, 0x96, 0xeb, 0x2f, 0x8d, 0xf0, 0xce, 0x76, 0x45, 0xbd, 0xdb, 0x37, 0x25, 0xc4, 0xf2, 
-0x30, 0x03, 0x78, 0x59, 0xc8, 0xeb, 0x1d, 0xb6, 0x1e, 0x52, 0x67, 0xe4, 0x3e, 0xf6, 0x59, 0x1f, 
-0xae, 0xec, 0x98, 0x76, 0x14, 0xba, 0xfd, 0x99, 0xc3, 0x5e, 0xa4, 0xf9, 0x82, 0xe6, 0xb9, 0x10, 
-0x52, 0x2f, 0x66, 0xb5, 0x59, 0x26, 0x8f, 0xb9, 0xd0, 0x83, 0xa8, 0x0e, 0xc4, 0x1e, 0x4c, 0xaf, 
-0x37, 0x91, 0x05, 0xc3, 0x49, 0xa0, 0x09, 0xd6, 0x93, 0x29, 0x3d, 0xc2, 0x13, 0x33, 0xd9, 0x93, 
-0x82, 0xbc, 0x14, 0xa8, 0xc9, 0x53, 0x77, 0x38, 0xb8, 0x60, 0x18, 0x87, 0x4a, 0x68, 0x56, 0xbd, 
-0x0e, 0xde, 0x22, 0xeb, 0xa2, 0x6c, 0x48, 0x8e, 0x5d, 0xd4, 0x95, 0x24, 0xcf, 0x47, 0xe3, 0x9e, 
-0x4d, 0xee, 0x3c, 0x84, 0xd3, 0x76, 0x23, 0xad, 0xc9, 0x6a, 0x8c, 0x2a, 0xe1, 0xc7, 0x39, 0xf7, 
-0x7c, 0x05, 0x8f, 0x21, 0x9a, 0xe9, 0x76, 0xb2, 0x94, 0xf2, 0x7b, 0xa4, 0xce, 0xf4, 0x6c, 0xaa, 
-0x85, 0x19, 0x55, 0x26, 0x5d, 0x7f, 0x2e, 0xc3, 0x86, 0x59, 0xe2, 0xba, 0x7a, 0x5f, 0xf1, 0x2a, 
-0x53, 0xd8, 0x81, 0x4b, 0xba, 0xf1, 0x54, 0xe8, 0xa3, 0x85, 0xf8, 0x90, 0x17, 0x79, 0xbd, 0xe5, 
-0x59, 0x97, 0x4d, 0x28, 0x8b, 0x1a, 0xa2, 0x78, 0xce, 0xb6, 0x69, 0x7d, 0x1e, 0xe9, 0x4d, 0xcf, 
-0x2e, 0xb7, 0x69, 0x0f, 0xc9, 0x4e, 0x1b, 0xd2, 0x04, 0x51, 0x22, 0x6b, 0xde, 0x40, 0xba, 0x12, 
-0x33, 0xae, 0x6d, 0x14, 0xf7, 0x7a, 0x95, 0x12, 0x65, 0xa7, 0xda, 0x42, 0x70, 0x9c, 0x51, 0x86, 
-0xba, 0xfd, 0xcd, 0x18, 0x78, 0xd1, 0xb9, 0x82, 0x01, 0x6c, 0x39, 0x5b, 0xcc, 0x43, 0x56, 0x06, 
-0x3b, 0x8d, 0x30, 0xcb, 0x02, 0x6a, 0x3a, 0xa6, 0xd2, 0x7e, 0x95, 0x44, 0x9d, 0x7d, 0xe5, 0x1c, 
-0x71, 0x98, 0xe7, 0x31, 0x8b, 0x62, 0x80, 0xca, 0x73, 0x16, 0xeb, 0xa8, 0x2b, 0xf8, 0xb3, 0x55, 
-0x85, 0xfe, 0xb6, 0x72, 0x8c, 0x5a, 0xa6, 0x19, 0x52, 0xe6, 0x97, 0x41, 0xff, 0x2d, 0xdb, 0x02, 
-0xf5, 0x45, 0x71, 0xdf, 0xb4, 0x03, 0x80, 0xf8, 0x35, 0xc9, 0x4f, 0x04, 0x38, 0xd2, 0x1c, 0x28, 
-0xb7, 0x34, 0xeb, 0x57, 0xbc, 0x31, 0xfe, 0x07, 0xc9, 0x69, 0x1f, 0x9b, 0x2e, 0x5d, 0x92, 0x7f, 
-0x13, 0x9a, 0xd3, 0x7b, 0x01, 0x53, 0x1c, 0xa0, 0x59, 0xb1, 0xca, 0x50, 0x33, 0xb9, 0x1b, 0x52, 
-0x38, 0x12, 0xd8, 0x24, 0x5c, 0x32, 0x0c, 0x94, 0xd2, 0xeb, 0x9f, 0xcb, 0x0a, 0xf7, 0xa5, 0x3b, 
-0x1d, 0xfc, 0x41, 0xa0, 0xd5, 0xab, 0x84, 0xe4, 0x68, 0xae, 0x07, 0xc9, 0x1d, 0x3b, 0x91, 0x78, 
-0x21, 0x11, 0xad, 0x6b, 0xd1, 0xa0, 0x2d, 0x87, 0x11, 0xee, 0xcd, 0x70, 0xb6, 0x48, 0xc2, 0x2b, 
-0x86, 0xe4, 0xa5, 0x32, 0xc1, 0x6f, 0x06, 0xf7, 0x83, 0x53, 0x3c, 0x7a, 0xfb, 0x2f, 0x86, 0xf3, 
-0x3c, 0xe5, 0xca, 0x0d, 0xa5, 0x58, 0x7f, 0x66, 0xe0, 0x92, 0x55, 0xcb, 0xa3, 0x41, 0xd1, 0x54, 
-0xbb, 0xe9, 0x98, 0x29, 0x0c, 0xd5, 0x62, 0xc5, 0x7f, 0x34, 0x8a, 0xa3, 0x4a, 0x96, 0x12, 0xd9, 
-0x50, 0xa0, 0xf8, 0x0c, 0xde, 0x82, 0x26, 0xe4, 0xcf, 0xed, 0x1f, 0x4d, 0xb3, 0x8b, 0xf1, 0x48, 
-0x22, 0xe9, 0x14, 0xfd, 0x00, 0xca, 0x63, 0xf8, 0x4b, 0x05, 0x67, 0xf4, 0x3e, 0xd3, 0xee, 0x2b, 
-0x9c, 0xd6, 0x52, 0x7b, 0x69, 0x1b, 0x42, 0x76, 0xc9, 0x0d, 0x4f, 0xda, 0x03, 0xf7, 0xc6, 0x6a, 
-0xd0, 0x04, 0x73, 0x5c, 0x0e, 0xb6, 0x65, 0xa4, 0x94, 0xca, 0x0c, 0x39, 0xa0, 0xd7, 0x92, 0x41, 
-0xac, 0x9d, 0x78, 0xb8, 0xff, 0xac, 0x7d, 0xe6, 0x69, 0x84, 0x17, 0xa2, 0x77, 0x8f, 0x63, 0x87, 
-0x2a, 0xa9, 0xe2, 0x11, 0xb8, 0xe7, 0x0a, 0xef, 0x4f, 0x3d, 0x1e, 0xb1, 0xf3, 0x89, 0x66, 0xdc, 
-0x29, 0x70, 0xfa, 0x84, 0xdd, 0x63, 0xd0, 0xfe, 0x9d, 0x61, 0xb0, 0x4a, 0x83, 0xe6, 0xb5, 0x42, 
-0x62, 0x38, 0x74, 0x8f, 0x44, 0x6c, 0xd7, 0x93, 0x75, 0xaf, 0x64, 0x07, 0x19, 0x34, 0x45, 0xb9, 
-0x21, 0x9d, 0xf8, 0x8d, 0x6f, 0xa9, 0xdd, 0x2f, 0x61, 0xcc, 0x4f, 0xeb, 0x0a, 0x47, 0xf5, 0x66, 
-0xc3, 0x21, 0xa4, 0x3a, 0x04, 0xd3, 0xf7, 0x62, 0x0c, 0x50, 0x17, 0xdb, 0x90, 0xb2, 0x5f, 0xa0, 
-0x1a, 0xc5, 0xed, 0xa6, 0x60, 0x94, 0xba, 0x6a, 0x9f, 0x5e, 0xb1, 0x8a, 0xd3, 0x19, 0xf9, 0x9b, 
-0x09, 0xf2, 0x1e, 0x84, 0x62, 0x07, 0xe2, 0x89, 0x21, 0x39, 0x80, 0xc0, 0xf3, 0xae, 0x13, 0xfc, 
-0xdf, 0x5c, 0x03, 0xb5, 0x2b, 0x63, 0x37, 0xe8, 0x26, 0xc5, 0xb4, 0x8f, 0x31, 0xa4, 0xb6, 0x74, 
-0x67, 0xac, 0x7c, 0x5a, 0xd8, 0x19, 0x9d, 0x76, 0xc4, 0xac, 0x6d, 0x36, 0xd8, 0xa5, 0x2d, 0x3e, 
-0xaf, 0xc3, 0x25, 0x51, 0xb4, 0x95, 0x03, 0x5a, 0xbe, 0x20, 0x3e, 0xe0, 0x8e, 0xce, 0xed, 0x98, 
-0x21, 0xaa, 0x66, 0x9c, 0x7e, 0x41, 0xb7, 0x29, 0x39, 0xf2, 0xb1, 0xe1, 0x90, 0xc5, 0x83, 0x4c, 
-0x1e, 0x7b, 0xe8, 0x5a, 0xf3, 0x22, 0x62, 0x15, 0xe7, 0x6a, 0x89, 0x2b, 0x5e, 0x92, 0x51, 0xc2, 
-0x10, 0xfa, 0x4e, 0xc9, 0x0a, 0xd9, 0x1e, 0xba, 0x42, 0xd4, 0x50, 0x70, 0xc6, 0x44, 0xa2, 0xce, 
-0xba, 0xe0, 0x61, 0x32, 0xc0, 0x42, 0xe9, 0xad, 0x0b, 0xbf, 0x3c, 0x13, 0xa5, 0x00, 0x45, 0x80, 
-0x28, 0xe3, 0xc0, 0x06, 0x98, 0xc9, 0x15, 0x7c, 0xf9, 0x00, 0xc2, 0x20, 0xe5, 0xb7, 0x16, 0x52, 
-0xcb, 0x2a, 0xdc, 0x8e, 0x72, 0xf9, 0x97, 0x0c, 0x77, 0x3c, 0x60, 0x2b, 0xd5, 0x0e, 0x48, 0xfd, 
-0x9a, 0xb5, 0x7e, 0x33, 0x5e, 0x95, 0xda, 0x76, 0x41, 0x90, 0x5f, 0xe3, 0x81, 0x56, 0x93, 0x38, 
-0xb1, 0x98, 0xf4, 0x59, 0x25, 0x45, 0xd6, 0x38, 0x72, 0xdb, 0x8c, 0x01, 0x16, 0x43, 0xe9, 0x26, 
-0x10, 0x7d, 0x31, 0x45, 0x74, 0x2a, 0xb4, 0x3b, 0xc3, 0x4a, 0x2c, 0xb7, 0xee, 0x33, 0xac, 0x73, 
-0xfb, 0x60, 0x08, 0x50, 0x8b, 0x33, 0x46, 0x7a, 0x40, 0xc7, 0x6f, 0xdc, 0xf1, 0xc0, 0xa7, 0x8b, 
-0x74, 0x43, 0x60, 0x1e, 0xea, 0x4f, 0x94, 0x19, 0x45, 0x0a, 0xf6, 0x95, 0xbf, 0x33, 0x60, 0xdc, 
-0x06, 0x59, 0x8e, 0xc0, 0x52, 0x75, 0x13, 0x8c, 0xdd, 0x7a, 0xa0, 0xd8, 0x6e, 0x13, 0xaa, 0x48, 
-0xfa, 0x83, 0xaf, 0x0d, 0xb9, 0x34, 0x01, 0x60, 0xdf, 0x39, 0xf0, 0x2f, 0x1f, 0xe9, 0x95, 0x4d, 
-0x88, 0x9e, 0x21, 0x48, 0x33, 0x18, 0xed, 0xd7, 0x29, 0xbf, 0xab, 0x89, 0x2f, 0xc5, 0x79, 0xcf, 
-0x54, 0x0a, 0xda, 0x1a, 0xcb, 0x40, 0x09, 0xd8, 0x9b, 0x3d, 0xb0, 0x6c, 0xf3, 0x37, 0xad, 0x59, 
-0xf0, 0x7d, 0x01, 0xfc, 0x8a, 0x36, 0x67, 0x25, 0x74, 0x07, 0xfb, 0x9e, 0x6f, 0x10, 0x93, 0x7e, 
-0x4a, 0xd4, 0x97, 0x5b, 0x78, 0xc4, 0xeb, 0xac, 0x15, 0x8b, 0x73, 0x3e, 0xfb, 0x6a, 0x52, 0xe0, 
-0x28, 0xaf, 0x4f, 0xa2, 0x83, 0x32, 0x61, 0xeb, 0x03, 0x81, 0xf0, 0x50, 0xbf, 0xcd, 0x59, 0xda, 
-0xea, 0xc6, 0x4f, 0xee, 0xb4, 0x5a, 0x84, 0xbe, 0x04, 0x40, 0xe1, 0x1c, 0xc7, 0xb7, 0x24, 0x00, 
-0xaf, 0xd7, 0x16, 0xff, 0x2d, 0xab, 0x12, 0xea, 0x73, 0xd0, 0x3d, 0x81, 0xc6, 0xf1, 0x0a, 0x94, 
-0xbc, 0x24, 0x4a, 0xb1, 0xe0, 0xcb, 0x56, 0xaa, 0xd9, 0xc2, 0xfc, 0x98, 0xe8, 0x50, 0xd9, 0x89, 
-0x60, 0xa7, 0xd4, 0x70, 0x99, 0x51, 0xc2, 0x10, 0x48, 0xb2, 0xcc, 0xe6, 0x67, 0xa5, 0xe1, 0x57, 
-0x1a, 0x9d, 0x4f, 0x21, 0x7e, 0x09, 0x55, 0xfe, 0xcb, 0x0e, 0x7f, 0xd1, 0x6c, 0x02, 0xfa, 0xd5, 
-0xbc, 0x9f, 0x28, 0x3d, 0x72, 0x0e, 0xf9, 0x86, 0x2b, 0x41, 0xe4, 0x1f, 0x82, 0xf5, 0xb8, 0x5d, 
-0xee, 0x18, 0x37, 0x85, 0x1e, 0xe5, 0x7c, 0x36, 0xdb, 0x63, 0x97, 0xf6, 0x59, 0x74, 0xa6, 0xc0, 
-0x49, 0x83, 0xb9, 0xcb, 0x5c, 0xab, 0x0a, 0x79, 0xdc, 0x61, 0xca, 0x80, 0x6e, 0xad, 0x59, 0x3c, 
-0xfb, 0x68, 0x50, 0x17, 0xb9, 0x4a, 0x9b, 0xfc, 0x32, 0xbe, 0x48, 0xf4, 0x9f, 0xe9, 0x76, 0x62, 
-0x2f, 0x8b, 0xe0, 0x24, 0x47, 0x99, 0xe5, 0x71, 0x15, 0x96, 0xa4, 0x5c, 0xb1, 0x18, 0xf6, 0x57, 
-0x8e, 0xaa, 0x82, 0x4c, 0xd8, 0x26, 0xce, 0x35, 0x62, 0xee, 0x23, 0xe4, 0x2e, 0x8f, 0x6e, 0x39, 
-0x57, 0xca, 0xee, 0x2c, 0xa8, 0x1d, 0xbb, 0x9d, 0x8b, 0xda, 0x69, 0xce, 0x0c, 0xfa, 0xa9, 0x99, 
-0x49, 0xb6, 0x39, 0x9c, 0x1e, 0x2d, 0x6b, 0x15, 0xa8, 0x89, 0x02, 0x7d, 0x9f, 0x17, 0xd1, 0x69, 
-0x27, 0xef, 0x72, 0x8b, 0xa5, 0xfc, 0x3a, 0x57, 0xf0, 0x7d, 0x4a, 0xbb, 0x9c, 0x67, 0xd9, 0x24, 
-0xbe, 0x01, 0x6a, 0x9f, 0x14, 0x74, 0xa9, 0x55, 0xff, 0x66, 0x32, 0x9c, 0x6c, 0x1f, 0x7b, 0x36, 
-0x90, 0x4e, 0x1e, 0x02, 0xbc, 0x6c, 0x0c, 0x23, 0x79, 0xe9, 0x00, 0x3f, 0x19, 0xdd, 0x28, 0x90, 
-0xa1, 0xd7, 0x18, 0x74, 0x24, 0xbb, 0x01, 0x83, 0xd4, 0xaf, 0xf7, 0x90, 0x3f, 0xd2, 0x6b, 0x1a, 
-0x32, 0x9e, 0xf1, 0xab, 0x3e, 0xc1, 0x5c, 0x36, 0x88, 0x62, 0xdd, 0xc7, 0xe5, 0xa4, 0x4b, 0xb8, 
-0xcc, 0xf2, 0x9c, 0xb1, 0x0b, 0x47, 0xd2, 0x9a, 0x09, 0x55, 0xca, 0xfc, 0xb8, 0x5f, 0xc8, 0xa1, 
-0x0a, 0x71, 0x2f, 0x19, 0x4c, 0xd7, 0x89, 0x2b, 0xf5, 0x17, 0x74, 0x10, 0xe2, 0x6b, 0xd1, 0xfd, 
-0x16, 0xbe, 0x0c, 0xf5, 0xd4, 0x99, 0x05, 0x76, 0xa1, 0x0e, 0x96, 0xd6, 0x72, 0x07, 0xa9, 0x1c, 
-0x7e, 0xb0, 0x8f, 0x71, 0x36, 0x17, 0xa9, 0xb9, 0xf0, 0x02, 0x7a, 0xc3, 0x5e, 0x81, 0x0d, 0xc1, 
-0x3c, 0xce, 0x31, 0x24, 0xdd, 0x79, 0x98, 0xd6, 0x30, 0x43, 0xc8, 0x13, 0x5a, 0xf1, 0xba, 0xa3, 
-0x1a, 0x86, 0xb6, 0xa9, 0x4e, 0xf9, 0x1d, 0xbb, 0xdf, 0x0b, 0x4e, 0x63, 0x8f, 0xd0, 0x35, 0x5e, 
-0x44, 0x19, 0xf1, 0x3c, 0x58, 0x78, 0xdb, 0x26, 0xc4, 0x6f, 0x0e, 0x60, 0xe3, 0xb2, 0x80, 0x49, 
-0x35, 0xbd, 0x24, 0xdf, 0x43, 0x34, 0xf5, 0xa7, 0x52, 0x92, 0xd4, 0x08, 0x4a, 0x6b, 0x84, 0x9a, 
-0xcc, 0x30, 0x6e, 0x08, 0xc9, 0x41, 0x7b, 0x89, 0x48, 0xfc, 0x2c, 0xb6, 0xe9, 0x33, 0x87, 0xe0, 
-0x11, 0x7f, 0xd0, 0xeb, 0x85, 0xbd, 0xf8, 0x06, 0x71, 0xeb, 0x66, 0xcc, 0x83, 0xab, 0xf7, 0x9e, 
-0xc7, 0x54, 0x8e, 0xff, 0x81, 0xca, 0x65, 0xf4, 0x3d, 0x83, 0x2f, 0x9c, 0xf9, 0x90, 0x3c, 0xc3, 
-0x76, 0x06, 0x31, 0x60, 0xea, 0xb2, 0x99, 0x49, 0xb9, 0xdb, 0x53, 0x2a, 0x8c, 0xe3, 0x7b, 0x23, 
-0xeb, 0x4b, 0x15, 0x83, 0x56, 0x23, 0x92, 0x6b, 0x19, 0x79, 0x61, 0x30, 0xe0, 0x69, 0x39, 0x27, 
-0x71, 0xad, 0x91, 0x44, 0x29, 0x4e, 0xf0, 0x8c, 0x25, 0xbd, 0xed, 0xca, 0x9f, 0xe7, 0x1f, 0x6c, 
-0xd0, 0x93, 0xa3, 0x50, 0x8e, 0x33, 0x45, 0x26, 0x58, 0xa5, 0x40, 0x2d, 0x4f, 0xe5, 0xba, 0x8a, 
-0xcd, 0x31, 0xe2, 0x40, 0xef, 0x64, 0xdf, 0x3c, 0x5a, 0xec, 0x24, 0x64, 0xc5, 0x83, 0x4c, 0x23, 
-0xce, 0x58, 0x9f, 0x18, 0xd4, 0xa8, 0x2a, 0x53, 0xf8, 0x86, 0x66, 0xea, 0x4c, 0xc7, 0x04, 0xb5, 
-0xed, 0x1d, 0xe3, 0xb3, 0x8c, 0x75, 0x08, 0x52, 0xfe, 0x69, 0x04, 0x3f, 0xcb, 0x0c, 0xa0, 0x65, 
-0x94, 0x7d, 0xb2, 0xd9, 0x03, 0x80, 0xf6, 0x0e, 0xc5, 0x75, 0x98, 0x2b, 0xbd, 0x8f, 0x41, 0x11, 
-0x89, 0xd5, 0xfd, 0xa6, 0x43, 0x8b, 0xf4, 0xd3, 0x94, 0xfc, 0x71, 0x63, 0xcb, 0x96, 0x74, 0x1d, 
-0xc4, 0x37, 0xaf, 0x5a, 0x2d, 0xdd, 0x0d, 0xbe, 0x1d, 0xa7, 0x8e, 0x54, 0xf2, 0x1b, 0xe4, 0x5b, 
-0xa8, 0x91, 0x53, 0xd6, 0x61, 0x4a, 0xcc, 0x20, 0x41, 0xb4, 0x59, 0x08, 0x3c, 0x4c, 0x9a, 0xd5, 
-0xb4, 0x3e, 0xa3, 0x28, 0x59, 0x43, 0x36, 0xe3, 0x12, 0x30, 0xbb, 0xaf, 0x5b, 0xa3, 0x78, 0x04, 
-0xe8, 0x59, 0xc4, 0x4b, 0x0f, 0x5d, 0xdb, 0x6c, 0xe6, 0x85, 0xc1, 0xa4, 0x15, 0x2c, 0x7a, 0xe5, 
-0x63, 0x91, 0x0a, 0x75, 0x17, 0xaf, 0x9a, 0x0f, 0xcc, 0xa8, 0x6a, 0xb4, 0x01, 0xed, 0xd4, 0x39, 
-0xa7, 0x08, 0x4e, 0x91, 0xca, 0xa8, 0x86, 0xc0, 0xe7, 0xd6, 0x66, 0x01, 0x9c, 0x74, 0x12, 0x3f, 
-0xd2, 0x54, 0x86, 0x43, 0x7a, 0x0f, 0x3b, 0xb3, 0x57, 0x08, 0x3c, 0xf8, 0xc2, 0x81, 0xb2, 0x98, 
-0x71, 0xed, 0xb5, 0x92, 0x65, 0x13, 0x27, 0x45, 0xf1, 0x5d, 0xb0, 0x7f, 0x25, 0xc7, 0x86, 0x95, 
-0xd4, 0x00, 0xa2, 0xe1, 0x10, 0xd5, 0xfb, 0x94, 0x6e, 0x42, 0xb3, 0xf9, 0x34, 0xe9, 0x8e, 0xb4, 
-0xda, 0x1c, 0xab, 0xbe, 0x3f, 0x12, 0x83, 0x51, 0x6c, 0x9f, 0x62, 0x2c, 0x3a, 0x9b, 0xe6, 0x42, 
-0xc7, 0x91, 0xd9, 0x74, 0x5c, 0x81, 0xd5, 0x43, 0x2f, 0xf1, 0x21, 0xa0, 0x47, 0xe2, 0x70, 0xab, 
-0xeb, 0x87, 0x05, 0xd6, 0xad, 0x1b, 0xe8, 0x66, 0x53, 0x30, 0x7c, 0x18, 0xc9, 0x05, 0x26, 0x61, 
-0x0c, 0x53, 0xa2, 0x11, 0xe7, 0xba, 0x06, 0x87, 0xe4, 0x65, 0x16, 0xf8, 0xb9, 0x77, 0xec, 0x45, 
-0x61, 0xe8, 0xd6, 0x25, 0xb0, 0x96, 0x34, 0xcf, 0x13, 0xc5, 0x1e, 0x7e, 0x07, 0x96, 0xbd, 0x6a, 
-0x9f, 0xef, 0x29, 0xaa, 0xdc, 0x64, 0x2c, 0x18, 0x5c, 0xe1, 0x8c, 0xf3, 0x14, 0xd0, 0x93, 0x62, 
-0x74, 0x48, 0xd5, 0x23, 0x0d, 0x37, 0x4c, 0xba, 0x21, 0x6b, 0xe1, 0xb0, 0x7d, 0xcf, 0xa9, 0x29, 
-0x54, 0x1e, 0x48, 0x70, 0xdd, 0xc8, 0x00, 0x84, 0x1e, 0xc4, 0x3a, 0xfc, 0xd3, 0x45, 0x55, 0xf6, 
-0x73, 0x91, 0x2b, 0xfe, 0x44, 0x7b, 0xb0, 0x5b, 0xfb, 0xd7, 0xba, 0xe9, 0x21, 0x0f, 0xff, 0x50, 
-0x1c, 0x31, 0x81, 0xf5, 0xdb, 0xc1, 0xae, 0xe1, 0x66, 0xa5, 0x03, 0xb0, 0x61, 0xc5, 0xfb, 0x9b, 
-0xd9, 0x65, 0xe5, 0xaf, 0x21, 0x05, 0xdf, 0xc6, 0x37, 0x86, 0x07, 0x7a, 0xfc, 0xca, 0xa9, 0x6b, 
-0x1b, 0xc0, 0x02, 0x91, 0x56, 0x11, 0xf5, 0x2d, 0x6b, 0xc1, 0x40, 0x51, 0xb3, 0x5d, 0x06, 0x38, 
-0xe4, 0x89, 0x0c, 0x4f, 0x76, 0x68, 0x04, 0x45, 0x5f, 0x78, 0x08, 0x90, 0x6e, 0xa1, 0xf4, 0x39, 
-0xbe, 0x7c, 0x0a, 0xf5, 0xcd, 0x68, 0x1c, 0xac, 0x7c, 0x31, 0x15, 0xed, 0xbe, 0x26, 0xf4, 0xaa, 
-0x12, 0xc5, 0x75, 0x3b, 0xb8, 0x58, 0x23, 0x2f, 0x50, 0xb9, 0x60, 0xff, 0x4c, 0x70, 0xc8, 0xf6, 
-0x9d, 0xbc, 0xe0, 0x94, 0x57, 0xe9, 0x73, 0xa9, 0xc7, 0x3e, 0xb3, 0x83, 0x2a, 0x4e, 0x5e, 0xd6, 
-0x44, 0xa0, 0x7f, 0xc8, 0x97, 0x20, 0xab, 0xd1, 0x12, 0x75, 0x39, 0x84, 0xbf, 0x64, 0x0d, 0xf7, 
-0x71, 0x3f, 0xef, 0xae, 0xe2, 0x28, 0xfa, 0x0e, 0x8c, 0xc7, 0x77, 0x1b, 0xf5, 0x89, 0xa7, 0xcd, 
-0x80, 0x0b, 0x32, 0xb2, 0x79, 0xdd, 0xc0, 0x1e, 0xaa, 0xeb, 0x7e, 0x69, 0xe0, 0xf1, 0xcf, 0xa9, 
-0x98, 0x89, 0x09, 0x41, 0xf4, 0x33, 0x19, 0x96, 0x99, 0xce, 0xfd, 0x8e, 0x3b, 0x59, 0xf8, 0x44, 
-0xa9, 0xe9, 0x5a, 0xa1, 0xbc, 0x68, 0x2d, 0xb3, 0x08, 0x3c, 0xd8, 0xbe, 0x9a, 0x31, 0x13, 0x8d, 
-0x28, 0x45, 0x7f, 0x6e, 0x3d, 0x5b, 0x79, 0x93, 0xb5, 0x41, 0xa6, 0x10, 0x57, 0x34, 0x7f, 0x1f, 
-0x92, 0xfe, 0x36, 0xda, 0x28, 0x90, 0x4d, 0x80, 0x30, 0x1b, 0xc9, 0x48, 0x7a, 0x62, 0xf3, 0x18, 
-0x4c, 0xd6, 0x1e, 0xc1, 0x59, 0x36, 0x86, 0xdb, 0x7b, 0x4c, 0xfe, 0xa7, 0x36, 0xbc, 0x49, 0xaf, 
-0x15, 0x7a, 0xf7, 0x89, 0x99, 0x29, 0x7b, 0xa7, 0xc6, 0x1e, 0xdc, 0xbe, 0x96, 0x22, 0xc6, 0x9f, 
-0xef, 0x37, 0xcc, 0xff, 0x57, 0xd3, 0x1a, 0xe4, 0x28, 0x94, 0xdc, 0xa7, 0x49, 0x83, 0xd8, 0x28, 
-0x59, 0xe2, 0xb1, 0x9a, 0x38, 0x8d, 0x51, 0x6f, 0xe6, 0x5d, 0x8a, 0xfd, 0x15, 0x94, 0xcb, 0xa4, 
-0xdd, 0x3e, 0x20, 0x7d, 0xa2, 0x0b, 0x38, 0xb0, 0x20, 0x01, 0x47, 0x6c, 0x36, 0xba, 0x9b, 0x30, 
-0xec, 0xd7, 0x1f, 0xf3, 0x91, 0x39, 0xff, 0xb1, 0x26, 0xea, 0x0f, 0x51, 0x3d, 0x67, 0x89, 0x32, 
-0x94, 0x4e, 0xfb, 0x02, 0xde, 0x78, 0x4d, 0x9d, 0xb5, 0x86, 0x66, 0x35, 0xa2, 0x76, 0x57, 0x39, 
-0xdd, 0x4c, 0x60, 0x95, 0xc1, 0x0e, 0x72, 0xfd, 0x49, 0xc4, 0x9c, 0x51, 0x68, 0x07, 0x4b, 0x88, 
-0xf5, 0x05, 0xa0, 0x40, 0x95, 0x85, 0x2e, 0x12, 0xfd, 0xd4, 0x28, 0xbd, 0x9f, 0x6a, 0x52, 0xea, 
-0x31, 0x0a, 0x5e, 0xad, 0x0f, 0xb9, 0x9d, 0x30, 0xd0, 0x6f, 0x25, 0x81, 0x03, 0xdd, 0x89, 0xc4, 
-0xe2, 0x5b, 0x1a, 0x87, 0x62, 0xd0, 0x72, 0xe3, 0xc4, 0x9c, 0x15, 0xf6, 0xa3, 0xc7, 0xd9, 0x05, 
-0xed, 0x60, 0xd0, 0xbc, 0x6c, 0x97, 0xf3, 0x09, 0x4b, 0x72, 0xba, 0x14, 0xeb, 0x6e, 0x0b, 0xbf, 
-0xed, 0x71, 0x8a, 0x9e, 0x2b, 0x54, 0x90, 0xa3, 0x6a, 0xe9, 0xae, 0x44, 0xe1, 0xa1, 0x08, 0xec, 
-0x98, 0x2c, 0x69, 0xd5, 0xe8, 0x75, 0x9d, 0xde, 0x57, 0xd0, 0x32, 0x1a, 0xe6, 0xc2, 0x67, 0xf0, 
-0x55, 0x2f, 0x63, 0xab, 0x3e, 0xf4, 0xd2, 0x82, 0x11, 0x4f, 0x9a, 0x20, 0x2d, 0xaf, 0x8b, 0x5e, 
-0xcb, 0x44, 0x14, 0x57, 0xbf, 0x00, 0xfa, 0x96, 0xc2, 0x0c, 0x4c, 0x66, 0x1c, 0xcf, 0x02, 0xb5, 
-0x99, 0x49, 0x08, 0xd1, 0x66, 0xe8, 0x84, 0x07, 0x69, 0x9c, 0xcd, 0x33, 0xe4, 0x59, 0x93, 0x81, 
-0xd2, 0x5e, 0xf1, 0xac, 0x1e, 0xd9, 0x4c, 0x86, 0x14, 0x7b, 0x5a, 0x6c, 0xc6, 0xa7, 0x7c, 0x0b, 
-0x95, 0x72, 0x30, 0xdc, 0xf0, 0x05, 0x56, 0xf5, 0xb5, 0xc7, 0x9e, 0x5b, 0x40, 0xa7, 0x20, 0xe9, 
-0x2b, 0x03, 0xdb, 0x50, 0x19, 0xb8, 0xd0, 0x84, 0xaf, 0x00, 0x33, 0xd4, 0x41, 0x54, 0xb7, 0x37, 
-0x1d, 0x6d, 0xec, 0x23, 0xfb, 0xa5, 0x2c, 0xb6, 0x39, 0x5c, 0xc9, 0x1b, 0xc0, 0x54, 0x73, 0x63, 
-0x3b, 0x50, 0x77, 0x5e, 0x14, 0x8d, 0xdd, 0xbf, 0x43, 0x81, 0xd7, 0x27, 0x78, 0xec, 0x69, 0x8c, 
-0x08, 0xb4, 0x4c, 0x95, 0xf3, 0x37, 0x1e, 0x4e, 0x9d, 0x7f, 0xf1, 0x49, 0x0a, 0xea, 0xb6, 0x51, 
-0x03, 0x66, 0x35, 0x8c, 0xb4, 0x2c, 0x48, 0x9d, 0x72, 0x26, 0x8b, 0x1a, 0xe9, 0x47, 0x28, 0xc4, 
-0x5e, 0xe5, 0x98, 0x83, 0x58, 0xce, 0xa2, 0x23, 0x43, 0xa9, 0x01, 0xff, 0xd8, 0xbb, 0x0d, 0xcb, 
-0x2f, 0x5d, 0x96, 0x28, 0x73, 0x17, 0x50, 0xb1, 0x3d, 0xce, 0x0c, 0x87, 0x1e, 0x5f, 0x05, 0x83, 
-0x26, 0xa5, 0xb8, 0x70, 0x4a, 0x3c, 0xd7, 0x16, 0x9d, 0x85, 0xfe, 0x79, 0x16, 0x57, 0x30, 0x6f, 
-0xa9, 0xe6, 0xb7, 0x80, 0xdf, 0x46, 0x76, 0x05, 0xa9, 0xfd, 0x73, 0x8d, 0x32, 0xb4, 0x61, 0x39, 
-0x71, 0xef, 0x83, 0xa6, 0xfd, 0x77, 0xe1, 0x35, 0x22, 0xd9, 0xa6, 0x2b, 0xbe, 0x37, 0x4a, 0xf9, 
-0x79, 0x18, 0xee, 0x89, 0xbc, 0x27, 0xdc, 0x43, 0x75, 0x2c, 0x8a, 0xc8, 0x7a, 0xfb, 0x07, 0x67, 
-0xbf, 0x44, 0x9f, 0x00, 0xdf, 0x16, 0x66, 0xc0, 0x54, 0xce, 0xb5, 0x8d, 0xa5, 0xbf, 0xd3, 0x7d, 
-0x23, 0x10, 0x6b, 0x2b, 0xed, 0xc6, 0x81, 0xd6, 0x59, 0xbd, 0x9a, 0xf7, 0x8e, 0x42, 0xeb, 0x1f, 
-0x6f, 0xf1, 0xa2, 0xe5, 0x7f, 0x25, 0xe9, 0xa0, 0xdb, 0x91, 0xb9, 0x3f, 0xc7, 0x82, 0xe1, 0x6f, 
-0xd2, 0x8f, 0x28, 0xfb, 0xb3, 0x08, 0xea, 0xc5, 0xae, 0x93, 0xe4, 0xcb, 0xf0, 0xac, 0x24, 0x3f, 
-0xa6, 0xbd, 0xf2, 0x96, 0x4b, 0xd4, 0x1c, 0x54, 0xdc, 0xef, 0x18, 0xcb, 0x61, 0x79, 0xa7, 0xea, 
-0x6a, 0x26, 0xad, 0xc3, 0xa0, 0x24, 0x3c, 0x82, 0xa5, 0xef, 0xd1, 0x57, 0x0c, 0xe3, 0x67, 0x16, 
-0xc2, 0xf8, 0x51, 0x3c, 0xa1, 0xd8, 0x87, 0xb1, 0xd1, 0x19, 0x2c, 0x44, 0xab, 0x39, 0xf6, 0x60, 
-0xdc, 0xb7, 0x59, 0x38, 0x6c, 0xe7, 0x40, 0x77, 0xfa, 0x02, 0x80, 0xcf, 0xf7, 0x8e, 0x63, 0xc4, 
-0x20, 0x59, 0xb7, 0xa2, 0x44, 0xc9, 0xfa, 0x3b, 0xef, 0x90, 0x61, 0x03, 0xfc, 0xa9, 0x8f, 0x09, 
-0xba, 0x43, 0xd0, 0x01, 0xe3, 0x8b, 0xb5, 0xdc, 0x26, 0x41, 0x60, 0x17, 0x68, 0xc2, 0xec, 0x32, 
-0xb8, 0x66, 0x1d, 0xd2, 0xea, 0x7d, 0x12, 0xa3, 0x45, 0xd0, 0x25, 0xbb, 0x3f, 0x57, 0xc3, 0x87, 
-0x68, 0xf7, 0x80, 0x54, 0x74, 0xaf, 0x10, 0xc3, 0x5a, 0xb1, 0x46, 0x03, 0x64, 0xa8, 0xf2, 0x0d, 
-0xb6, 0xe7, 0xa2, 0x0b, 0x3f, 0x5b, 0xb3, 0x92, 0xf5, 0xe4, 0x29, 0xd0, 0x4c, 0x31, 0xef, 0x41, 
-0x1c, 0xf9, 0x6a, 0x46, 0x18, 0x2b, 0x71, 0x40, 0xe6, 0xad, 0xda, 0x8f, 0xb8, 0x09, 0x36, 0x91, 
-0x6c, 0x47, 0x13, 0xc7, 0x6e, 0x07, 0x62, 0x9c, 0x2e, 0xbe, 0x15, 0x67, 0xb0, 0x08, 0x8b, 0x65, 
-0x58, 0x06, 0x7c, 0x12, 0x5e, 0x97, 0x17, 0x56, 0x0e, 0xe5, 0x79, 0x67, 0x47, 0x9d, 0x17, 0xd9, 
-0x7f, 0x1e, 0x00, 0x35, 0x48, 0x7d, 0x0c, 0xb4, 0x72, 0x04, 0x38, 0x66, 0x13, 0xa4, 0xc2, 0x3c, 
-0x7d, 0x9b, 0x2d, 0x42, 0xba, 0x0e, 0xd3, 0x3f, 0x04, 0xce, 0x35, 0x75, 0x57, 0xf8, 0x6c, 0x1a, 
-0xdd, 0x49, 0xbd, 0x1f, 0x7c, 0xf3, 0x86, 0x37, 0xa9, 0xde, 0x7d, 0xb7, 0x06, 0x73, 0x55, 0x34, 
-0xa3, 0x7a, 0xf7, 0xc2, 0xe2, 0x06, 0x78, 0x96, 0x10, 0x84, 0xce, 0x16, 0x94, 0xae, 0x24, 0x88, 
-0xa8, 0xbe, 0x4b, 0x11, 0xb8, 0x30, 0xd8, 0xf2, 0x83, 0x6f, 0xf7, 0xe1, 0x2e, 0x95, 0x6c, 0xc0, 
-0x4e, 0x11, 0xe0, 0xc7, 0x82, 0x23, 0x76, 0x50, 0xe8, 0x6c, 0x26, 0x99, 0xc0, 0x48, 0x65, 0x0b, 
-0x94, 0xc4, 0xf8, 0x8d, 0xd1, 0x10, 0x9d, 0x52, 0x83, 0xe2, 0x3d, 0x9e, 0x24, 0x4e, 0xca, 0xe3, 
-0x8e, 0x08, 0x5d, 0xdc, 0x16, 0x94, 0x0a, 0xab, 0x42, 0xc8, 0x1a, 0x96, 0xef, 0x20, 0x8d, 0xd6, 
-0x28, 0x95, 0xde, 0xc8, 0x74, 0x15, 0x4d, 0xcc, 0x69, 0x1b, 0x51, 0x96, 0xe3, 0x28, 0xd0, 0x1c, 
-0x37, 0xad, 0x88, 0x74, 0xb4, 0x9a, 0x8b, 0xd3, 0x7f, 0xa1, 0x02, 0x5b, 0x83, 0xe3, 0x99, 0x09, 
-0x61, 0x85, 0x48, 0x19, 0x73, 0x53, 0xfe, 0x1a, 0xaa, 0xd1, 0x7e, 0x30, 0xe3, 0xab, 0xc3, 0x49, 
-0xfe, 0x7c, 0x59, 0x8f, 0xcf, 0x48, 0xc8, 0xf2, 0x2b, 0xac, 0xd5, 0xe7, 0x34, 0xce, 0x42, 0xf8, 
-0xa1, 0x4c, 0xac, 0x35, 0xdd, 0x8a, 0x5b, 0x2d, 0x45, 0xf8, 0xb7, 0x9d, 0x70, 0xd6, 0x58, 0xe9, 
-0xe9, 0x8f, 0x57, 0xc8, 0xe1, 0x86, 0x25, 0xff, 0x5d, 0xaa, 0x74, 0xe3, 0x8e, 0xfc, 0x58, 0x97, 
-0xb6, 0xf5, 0x8e, 0x16, 0xd6, 0x95, 0xc9, 0xaf, 0x8f, 0x29, 0x74, 0x99, 0x42, 0xae, 0xd5, 0x4e, 
-0x93, 0x0c, 0x2f, 0x5e, 0xcc, 0xfc, 0x13, 0xde, 0x64, 0x00, 0x4e, 0x6b, 0x1f, 0x8b, 0xbc, 0x32, 
-0x4c, 0xf2, 0x28, 0x7c, 0x4a, 0xd3, 0x12, 0x53, 0xda, 0x39, 0xe4, 0x69, 0xa3, 0x41, 0x78, 0x04, 
-0x9b, 0x35, 0x10, 0x51, 0x7b, 0x13, 0xb2, 0x20, 0xd6, 0x78, 0x9c, 0x37, 0x59, 0xb4, 0xf2, 0x31, 
-0xc9, 0xac, 0x5c, 0x37, 0xee, 0xa4, 0x1e, 0xf2, 0x7b, 0x51, 0x32, 0x01, 0xa6, 0x3e, 0xf7, 0x25, 
-0x94, 0x11, 0xc2, 0x5b, 0xac, 0xf7, 0x6a, 0x1b, 0xb3, 0xf5, 0x32, 0x9d, 0x7f, 0xe6, 0x2b, 0xf2, 
-0x5c, 0x0f, 0xb5, 0x3a, 0xda, 0x64, 0xa5, 0x3f, 0xf5, 0x6d, 0x35, 0x53, 0xf9, 0x8f, 0x9d, 0x39, 
-0x87, 0xfe, 0x32, 0xbf, 0x64, 0x82, 0xa5, 0x71, 0x54, 0x0c, 0x60, 0xfb, 0x21, 0x58, 0xe2, 0xad, 
-0x29, 0x39, 0xc3, 0xd6, 0xf4, 0xaa, 0x4e, 0xcb, 0xfa, 0x2e, 0xa1, 0xf1, 0xcf, 0x62, 0x9c, 0xdf, 
-0x3d, 0xf0, 0x5f, 0x21, 0x87, 0x3a, 0xd5, 0x10, 0x93, 0xda, 0x3d, 0x21, 0xf8, 0x32, 0x77, 0x14, 
-0xbd, 0x43, 0x52, 0x8c, 0x72, 0xa9, 0xba, 0x22, 0x80, 0xc1, 0x03, 0xcf, 0x21, 0xf6, 0xbf, 0xa6, 
-0x6c, 0x8c, 0x60, 0xc7, 0x29, 0xfc, 0x8a, 0x98, 0x22, 0xb6, 0xfb, 0x2c, 0xaf, 0x46, 0x70, 0xb6, 
-0x0c, 0xc8, 0x14, 0x52, 0xaf, 0x24, 0x6f, 0x13, 0x7d, 0x50, 0x64, 0xe2, 0x0c, 0x46, 0x32, 0x5d, 
-0x09, 0xfc, 0x62, 0xe8, 0xc6, 0x02, 0x5d, 0x23, 0xca, 0x6a, 0xe5, 0x8e, 0xad, 0x22, 0x99, 0x41, 
-0xef, 0x90, 0xb0, 0xcf, 0x9d, 0x54, 0xd6, 0x68, 0xe5, 0x9c, 0xc1, 0x5f, 0xed, 0x9f, 0x65, 0xf4, 
-0x71, 0x1c, 0x99, 0x5a, 0xed, 0x23, 0xaa, 0x4b, 0xd3, 0xaf, 0x8e, 0xbf, 0xd8, 0xec, 0x58, 0x89, 
-0xaa, 0x44, 0x2a, 0xeb, 0x0b, 0xce, 0x65, 0x97, 0x1a, 0x7e, 0xda, 0x0f, 0x71, 0x83, 0xcc, 0x3d, 
-0xab, 0xd5, 0x6d, 0xeb, 0x7c, 0x57, 0xbd, 0x72, 0xd9, 0x4a, 0xf1, 0x76, 0x06, 0x95, 0x35, 0x84, 
-0x54, 0x76, 0xc8, 0x69, 0xb1, 0x4e, 0x70, 0xd0, 0x9f, 0x7a, 0xe3, 0x4d, 0x00, 0xcc, 0x55, 0x7e, 
-0x09, 0xac, 0x84, 0x1d, 0xb3, 0x2b, 0xc4, 0x5c, 0xd9, 0xaa, 0x72, 0xd4, 0x17, 0xf3, 0x46, 0xc2, 
-0xdd, 0x99, 0xcc, 0x3b, 0xbf, 0x06, 0x6f, 0x14, 0x62, 0xe6, 0x92, 0x75, 0x22, 0x35, 0x67, 0xbc, 
-0x1c, 0x57, 0xb3, 0x39, 0x7e, 0x13, 0xc0, 0x26, 0x76, 0x04, 0xb5, 0xa1, 0xfa, 0x57, 0x79, 0x25, 
-0x52, 0xaf, 0x0a, 0xe8, 0x98, 0x50, 0xa8, 0xe1, 0x6b, 0x9c, 0xff, 0x25, 0x03, 0xee, 0x65, 0x91, 
-0x30, 0xf2, 0x5f, 0x98, 0x6e, 0x7c, 0x39, 0x07, 0xd1, 0xeb, 0x11, 0x51, 0xa8, 0x08, 0x43, 0x1b, 
-0x85, 0x6a, 0x0e, 0x7c, 0x9a, 0x02, 0xe5, 0x33, 0x93, 0xf5, 0x69, 0xd4, 0x35, 0x86, 0xc6, 0xdd, 
-0x2c, 0xc1, 0x41, 0xa8, 0x84, 0xb8, 0xf0, 0x7a, 0xd4, 0x3b, 0xb5, 0x12, 0x32, 0xa3, 0x71, 0xfb, 
-0xb9, 0x1a, 0x48, 0xf2, 0x39, 0x80, 0x6d, 0xc7, 0xb9, 0x24, 0x7f, 0x3c, 0x12, 0xfd, 0x27, 0xae, 
-0x1a, 0x71, 0x3d, 0xb3, 0x06, 0x33, 0xc8, 0xb8, 0x2b, 0x8b, 0xca, 0x0b, 0x82, 0xdd, 0xc1, 0x1a, 
-0x60, 0xe9, 0x41, 0x22, 0x66, 0xa4, 0x34, 0x07, 0xe5, 0x63, 0xbe, 0x8c, 0xa3, 0x41, 0xdf, 0x0e, 
-0x4b, 0xfa, 0x8f, 0xb5, 0x4e, 0x2d, 0xdf, 0x06, 0x5b, 0xba, 0x23, 0x95, 0xb3, 0x1a, 0xcd, 0x62, 
-0x03, 0xaf, 0x2f, 0x89, 0xdf, 0x43, 0xd5, 0xc2, 0x28, 0xa9, 0x46, 0x03, 0xfb, 0x39, 0xbd, 0x1e, 
-0x8f, 0x30, 0x6c, 0xff, 0x86, 0x9c, 0x2f, 0xe4, 0xbe, 0x16, 0xd2, 0xe7, 0x41, 0x7b, 0xeb, 0x02, 
-0x24, 0x47, 0x0f, 0xb4, 0x3b, 0x8e, 0x02, 0xec, 0x30, 0x7b, 0x12, 0xea, 0x83, 0x47, 0xc7, 0xf1, 
-0x4f, 0xb9, 0x0e, 0x43, 0xb4, 0x13, 0x8b, 0xdc, 0x76, 0x96, 0xc5, 0x01, 0xe5, 0x46, 0xaf, 0x86, 
-0x50, 0xca, 0x8e, 0x4b, 0x0b, 0xba, 0xea, 0xa3, 0xcd, 0x71, 0x85, 0xb7, 0x69, 0xc3, 0x05, 0x84, 
-0x39, 0x19, 0xc4, 0x7f, 0xdc, 0x49, 0x14, 0xd8, 0x73, 0x3f, 0xe0, 0x14, 0x4e, 0xb7, 0xe3, 0x55, 
-0x25, 0x9a, 0x3f, 0x82, 0xe1, 0xbb, 0x63, 0xd1, 0x19, 0x4c, 0xd7, 0x3c, 0xed, 0x63, 0xcd, 0x4c, 
-0x81, 0x20, 0x40, 0x9f, 0x01, 0xeb, 0x4a, 0xa6, 0xee, 0x99, 0x1e, 0xff, 0x2a, 0x68, 0x9d, 0x18, 
-0x4d, 0x82, 0x94, 0xdf, 0x52, 0x8c, 0xdb, 0x3f, 0x99, 0x78, 0xa6, 0x04, 0xc2, 0x4f, 0xe2, 0x0a, 
-0x5a, 0x32, 0xd9, 0xe8, 0x5e, 0x85, 0x43, 0xc7, 0x0a, 0x8c, 0xfb, 0x1f, 0xdd, 0x90, 0x7f, 0x0e, 
-0x48, 0xb0, 0xfe, 0x33, 0x51, 0x92, 0x6c, 0xfb, 0x2c, 0xcb, 0x74, 0x01, 0x98, 0x47, 0xff, 0xcc, 
-0x73, 0x17, 0xf2, 0x50, 0x1d, 0x71, 0x87, 0xbf, 0xa2, 0x3b, 0x23, 0xc8, 0xf5, 0x61, 0x9c, 0x8d, 
-0xfa, 0x13, 0x39, 0xe1, 0x47, 0x2b, 0x8b, 0xe7, 0x3a, 0x9a, 0xc7, 0x67, 0x19, 0xb6, 0x5e, 0x0d, 
-0xee, 0xda, 0x92, 0x22, 0xd3, 0x86, 0x0e, 0xeb, 0x45, 0xd5, 0xa8, 0x26, 0xbb, 0x14, 0xf3, 0x69, 
-0x49, 0x98, 0x59, 0xa2, 0x65, 0x11, 0xba, 0x6c, 0xf1, 0x95, 0x7c, 0xe6, 0x55, 0x9f, 0x69, 0x23, 
-0xaa, 0x4c, 0xb8, 0x64, 0xa4, 0x93, 0x34, 0x7b, 0x9e, 0x86, 0xfe, 0x58, 0xc9, 0xee, 0xa4, 0x07, 
-0x3c, 0xe9, 0x25, 0x6c, 0x8e, 0xd8, 0x30, 0xf9, 0x69, 0xe6, 0x34, 0xdc, 0x6d, 0x97, 0x1a, 0x65, 
-0x34, 0xe2, 0x46, 0x2b, 0x19, 0xd6, 0x5a, 0xf5, 0x95, 0xd1, 0x60, 0xaf, 0x32, 0x9e, 0x58, 0xc8, 
-0xad, 0x1d, 0x89, 0xa5, 0xcb, 0x0c, 0x86, 0xf3, 0xb0, 0x75, 0xcc, 0x33, 0x1e, 0xf4, 0x7b, 0x9e, 
-0xe2, 0xab, 0x92, 0xbe, 0x55, 0x1a, 0xa1, 0xba, 0xdb, 0x5a, 0xe7, 0xbe, 0x7a, 0x60, 0x1a, 0x3a, 
-0x6a, 0x05, 0x77, 0xd1, 0x51, 0xc8, 0x00, 0xe4, 0xc0, 0xa6, 0x22, 0x6b, 0xf4, 0x7d, 0x15, 0x2d, 
-0xed, 0x57, 0x87, 0xd9, 0x66, 0x2b, 0x9f, 0x8a, 0xfa, 0x75, 0x0d, 0xa6, 0xb8, 0x6e, 0xef, 0xa2, 
-0x5a, 0xd4, 0x4f, 0xa8, 0x75, 0x41, 0x58, 0xea, 0x9d, 0x61, 0x77, 0xd4, 0xbc, 0x3d, 0x07, 0x80, 
-0x53, 0xa5, 0x88, 0xf2, 0xc7, 0x29, 0x82, 0xb5, 0x3b, 0x98, 0x7e, 0xd1, 0xb2, 0xf9, 0x2b, 0x5d, 
-0xea, 0x75, 0x57, 0x04, 0xa9, 0x17, 0xc0, 0x44, 0x70, 0xa2, 0x84, 0xc4, 0x5f, 0xfe, 0xa8, 0x16, 
-0x7e, 0xf6, 0x55, 0x26, 0xa3, 0xff, 0x7e, 0x9d, 0x3e, 0x16, 0x63, 0xe4, 0x52, 0x9c, 0x64, 0xad, 
-0x56, 0x07, 0xc2, 0x5f, 0x41, 0x78, 0xb1, 0xc7, 0x23, 0x76, 0xfd, 0x32, 0xcb, 0xdf, 0x4c, 0x83, 
-0xa4, 0xcb, 0x60, 0x2a, 0xc5, 0xf8, 0x80, 0xd6, 0x5b, 0x8d, 0xdf, 0x29, 0x17, 0xf7, 0xd7, 0x22, 
-0x09, 0xdd, 0x2c, 0x6c, 0x9a, 0x7d, 0x49, 0x5e, 0xd1, 0x82, 0x51, 0xf7, 0xa4, 0x5a, 0x0c, 0x98, 
-0x1d, 0xa4, 0x12, 0xc0, 0x29, 0x83, 0x41, 0xf6, 0x01, 0xc1, 0x9a, 0xfc, 0x7d, 0xa4, 0x34, 0x22, 
-0xb6, 0x46, 0x0d, 0xf0, 0x6c, 0xbe, 0x85, 0x0d, 0xe9, 0x52, 0xbc, 0xfe, 0x2a, 0x43, 0x95, 0x66, 
-0x1a, 0xdd, 0xb8, 0x93, 0x6e, 0x55, 0xae, 0x02, 0x61, 0x32, 0x70, 0x25, 0xf9, 0x8a, 0x76, 0x2a, 
-0x08, 0xad, 0x8b, 0x2c, 0xf4, 0xb2, 0x93, 0xce, 0x88, 0xbb, 0x5d, 0xe0, 0x3c, 0xae, 0x8d, 0x58, 
-0xed, 0x2e, 0xcf, 0x07, 0x47, 0xb2, 0xc9, 0xa8, 0x0e, 0xd0, 0x35, 0x1f, 0xb3, 0xec, 0x17, 0xae, 
-0x47, 0xca, 0x98, 0x4d, 0x2c, 0x02, 0x94, 0x38, 0xe2, 0x80, 0x2f, 0x67, 0xcb, 0xf7, 0x18, 0xc1, 
-0xda, 0x00, 0x24, 0xa2, 0x15, 0xf3, 0xb5, 0x99, 0xe3, 0x0e, 0x38, 0xb0, 0x5c, 0xe1, 0x6b, 0x0d, 
-0x54, 0xdb, 0x28, 0x01, 0x67, 0x39, 0xd7, 0x07, 0xb0, 0xd0, 0x85, 0xe6, 0x6c, 0x37, 0x7d, 0x21, 
-0xe4, 0x50, 0xd2, 0x0d, 0x76, 0x9c, 0xd4, 0x4d, 0x6d, 0xb5, 0x0b, 0xe4, 0xcd, 0x4b, 0x2e, 0x6e, 
-0xbd, 0x88, 0xa5, 0x79, 0xb8, 0x29, 0xcb, 0x7c, 0xf5, 0x8a, 0x1a, 0xdc, 0x95, 0x52, 0x05, 0x8d, 
-0x3b, 0xdb, 0x0b, 0x88, 0x25, 0x92, 0xac, 0x34, 0x1a, 0x3e, 0xda, 0x06, 0xae, 0x14, 0x37, 0xba, 
-0x0a, 0xff, 0x40, 0x77, 0xce, 0x56, 0xb3, 0x41, 0x60, 0xa8, 0xcd, 0x1b, 0x39, 0xe3, 0x27, 0xfb, 
-0xb6, 0x15, 0xac, 0x40, 0x1c, 0x78, 0xd2, 0xbd, 0x5f, 0x7f, 0x3f, 0xee, 0x5c, 0xd8, 0xc9, 0xb1, 
-0x8c, 0x57, 0x13, 0x61, 0xea, 0x4b, 0x8d, 0x6e, 0xe8, 0x7a, 0x54, 0x91, 0x1d, 0x3d, 0xf9, 0x29, 
-0x99, 0x69, 0x35, 0x79, 0x60, 0xd9, 0xac, 0x31, 0x4c, 0x03, 0x5b, 0xef, 0x0e, 0xd7, 0x3b, 0x4a, 
-0x0f, 0x9e, 0xca, 0x06, 0xb1, 0xd5, 0x41, 0xe9, 0x6c, 0x99, 0x13, 0x4f, 0x6e, 0xd9, 0x0c, 0x56, 
-0xf7, 0x30, 0xa0, 0x11, 0x7f, 0x26, 0x6f, 0x1a, 0x3f, 0x75, 0x5f, 0xbc, 0x98, 0x20, 0x5b, 0x68, 
-0x44, 0xbd, 0x70, 0xff, 0x95, 0x5b, 0x7b, 0xd5, 0x36, 0x1c, 0x66, 0xf6, 0xc1, 0xda, 0x7a, 0x20, 
-0xb5, 0x15, 0xbe, 0x03, 0x9a, 0x27, 0xab, 0x6d, 0x3b, 0x84, 0xef, 0x46, 0x70, 0x59, 0x26, 0xd7, 
-0x44, 0x6d, 0xbc, 0x1e, 0x4e, 0x13, 0x93, 0xc3, 0xa2, 0xf6, 0x46, 0xa9, 0xc6, 0x92, 0x7c, 0x9a, 
-0x1c, 0x30, 0x45, 0xbd, 0x94, 0xd6, 0xf0, 0xc9, 0xac, 0x2f, 0x65, 0xf2, 0x21, 0x3f, 0x08, 0xc1, 
-0x30, 0xd8, 0x84, 0x3d, 0x73, 0x90, 0x01, 0xe0, 0x57, 0xf8, 0x33, 0x09, 0xed, 0x40, 0x14, 0xe1, 
-0x36, 0xa1, 0x6f, 0xf8, 0x32, 0xeb, 0xcf, 0x61, 0xef, 0xa8, 0x4e, 0xb6, 0x72, 0x05, 0xf4, 0x59, 
-0xbd, 0xfc, 0x8a, 0x4f, 0x73, 0x94, 0x47, 0xcb, 0x70, 0x1d, 0x98, 0xac, 0x04, 0x6c, 0x8b, 0xe6, 
-0xc2, 0x73, 0x4a, 0x8f, 0xb0, 0x11, 0xc2, 0x70, 0x32, 0x93, 0xcc, 0x67, 0xdf, 0xb5, 0x37, 0x48, 
-0xf2, 0xce, 0xaf, 0x74, 0x9c, 0x09, 0x4d, 0x76, 0x22, 0xdd, 0xaa, 0x3a, 0xbb, 0x0f, 0xc8, 0xdb, 
-0x00, 0xa7, 0x2b, 0xd5, 0xe3, 0xa8, 0x75, 0xd0, 0x47, 0x01, 0xe2, 0x9f, 0x15, 0xed, 0x71, 0xc7, 
-0xfb, 0x8d, 0x40, 0xa5, 0x2b, 0xc5, 0x96, 0xfe, 0xd1, 0x53, 0xe4, 0x80, 0x37, 0x5f, 0x15, 0xc0, 
-0xfb, 0x35, 0xd2, 0xc6, 0x1d, 0x42, 0xa7, 0x25, 0xdc, 0x4c, 0xb4, 0xe9, 0x96, 0xf8, 0xce, 0xb7, 
-0x9b, 0xfd, 0x86, 0xe2, 0x39, 0xd7, 0xf7, 0x83, 0xe8, 0x91, 0x0a, 0x4d, 0xc6, 0x3f, 0x02, 0x6c, 
-0xbc, 0xe2, 0x7f, 0x8d, 0x14, 0x58, 0xcd, 0x4b, 0x6b, 0xe9, 0x90, 0xf1, 0x48, 0x86, 0xe5, 0x30, 
-0x95, 0x52, 0xb2, 0xc6, 0x8d, 0xe7, 0xab, 0x63, 0x16, 0xcf, 0xfa, 0x7c, 0xd6, 0xac, 0xf0, 0x32, 
-0x1e, 0x61, 0x87, 0xe6, 0x58, 0x16, 0xee, 0x4e, 0x6a, 0xfe, 0xa4, 0x0e, 0x28, 0x4b, 0x59, 0x14, 
-0x8b, 0x07, 0xbc, 0x93, 0xb1, 0x57, 0x89, 0xf0, 0x5e, 0x20, 0x97, 0xab, 0x15, 0xf1, 0xc5, 0xae, 
-0x22, 0xd1, 0x4a, 0xc7, 0x5e, 0x8e, 0x73, 0xb4, 0x4e, 0x24, 0xc8, 0x80, 0xad, 0x19, 0x9f, 0x2b, 
-0x7d, 0x14, 0xc1, 0x5d, 0xe4, 0x44, 0xd3, 0x78, 0x0e, 0x68, 0xa0, 0x31, 0xef, 0xdd, 0x63, 0x9e, 
-0xe6, 0x31, 0xc3, 0xed, 0x4d, 0x2d, 0xa1, 0x10, 0x37, 0xf3, 0x00, 0xeb, 0xd6, 0x65, 0x87, 0xa0, 
-0x4e, 0x04, 0xf0, 0x2a, 0x87, 0x08, 0xe8, 0x91, 0x28, 0x02, 0x54, 0x1f, 0xff, 0x37, 0xa7, 0xeb, 
-0x30, 0x6b, 0xcc, 0x93, 0x77, 0x28, 0xaf, 0x5f, 0x40, 0xf7, 0xc2, 0x82, 0x4b, 0x07, 0x60, 0x8f, 
-0xf3, 0xb1, 0x82, 0xc2, 0x23, 0x53, 0x0a, 0x9c, 0x7b, 0xc0, 0x69, 0xe4, 0x84, 0x75, 0x21, 0x66, 
-0x3d, 0x8b, 0x1d, 0x4a, 0xf2, 0xa8, 0x92, 0x53, 0x7f, 0x46, 0x63, 0xa0, 0x85, 0xfd, 0x73, 0xc2, 
-0x7e, 0x08, 0x6c, 0x1f, 0x47, 0x60, 0x32, 0xdb, 0x4b, 0x0c, 0xaa, 0x17, 0x54, 0x77, 0x03, 0x9e, 
-0x25, 0xde, 0xab, 0x80, 0x2e, 0xe6, 0xa3, 0xf8, 0x52, 0x25, 0xaa, 0x41, 0xe8, 0x34, 0xa0, 0xfc, 
-0xab, 0x40, 0x60, 0xd0, 0x56, 0x13, 0xb8, 0x5f, 0xcf, 0x1c, 0xde, 0x2e, 0x09, 0x7a, 0x36, 0xc4, 
-0x84, 0x92, 0x30, 0x9d, 0x66, 0x3f, 0x8a, 0x70, 0xd0, 0xbb, 0x76, 0x10, 0x2f, 0xb9, 0x40, 0xdd, 
-0xc9, 0x8c, 0x5f, 0xde, 0x74, 0xb5, 0x9f, 0x69, 0xfd, 0x77, 0x4a, 0xe9, 0x36, 0xcc, 0xde, 0xa3, 
-0x79, 0x45, 0xfa, 0xbf, 0x51, 0x61, 0x39, 0x84, 0x11, 0x98, 0x70, 0xac, 0x1c, 0xfe, 0x99, 0x01, 
-0xd7, 0x67, 0x40, 0x0a, 0x5c, 0x48, 0xbc, 0x6f, 0xd6, 0x93, 0xf6, 0x35, 0xa0, 0xc4, 0x29, 0x9a, 
-0xe7, 0x21, 0xb0, 0xd0, 0x83, 0x19, 0x25, 0xb1, 0x50, 0x87, 0x5d, 0x7f, 0xd4, 0xbf, 0xfc, 0x82, 
-0x97, 0x5b, 0xb8, 0x7a, 0x53, 0x3f, 0x0b, 0xda, 0xe9, 0x7c, 0x5f, 0xc0, 0x9c, 0x50, 0x71, 0xaa, 
-0x66, 0x84, 0xe1, 0xb9, 0x88, 0x65, 0xc4, 0x16, 0x81, 0xf4, 0x43, 0x0a, 0xd6, 0xfa, 0x52, 0x84, 
-0x98, 0x20, 0x68, 0xa0, 0x15, 0xc9, 0xb5, 0x38, 0x1f, 0x59, 0xd5, 0x42, 0x8e, 0xb4, 0xd1, 0x3b, 
-0x28, 0x1c, 0xb3, 0x13, 0x4e, 0xd2, 0xba, 0x0a, 0xf9, 0x63, 0xc4, 0x9b, 0x72, 0x28, 0xcd, 0x02, 
-0xb1, 0xdb, 0x0e, 0xe5, 0xba, 0x34, 0x5d, 0x99, 0x3e, 0xf1, 0x8f, 0xd4, 0xc3, 0xa7, 0x04, 0x82, 
-0x69, 0xca, 0x29, 0xeb, 0x8f, 0xc4, 0x32, 0xb6, 0x50, 0x3a, 0x60, 0x18, 0xda, 0xb6, 0x8c, 0x10, 
-0x99, 0xcc, 0x5f, 0x08, 0xb3, 0x65, 0x19, 0x86, 0x29, 0x0f, 0x7b, 0x34, 0x9e, 0xdb, 0x74, 0x07, 
-0xf5, 0x7d, 0x9c, 0x65, 0xfb, 0xa5, 0x1c, 0x4e, 0xf0, 0x05, 0x48, 0xeb, 0x26, 0x0a, 0xe3, 0x52, 
-0x05, 0x3b, 0xda, 0x9c, 0xfa, 0x70, 0xa5, 0x24, 0xb3, 0x14, 0x3c, 0xf3, 0x83, 0x00, 0xe8, 0x33, 
-0x40, 0xd8, 0xa3, 0x19, 0x7f, 0x6c, 0x29, 0x13, 0xb7, 0x06, 0x66, 0xdb, 0x28, 0xa5, 0xe7, 0x69, 
-0x41, 0xf4, 0x7d, 0x2b, 0xd9, 0xc1, 0x30, 0x59, 0xef, 0xbb, 0x93, 0xe8, 0xd3, 0x89, 0xe2, 0x0c, 
-0x54, 0x42, 0x20, 0x6c, 0x82, 0x17, 0x63, 0x8d, 0x4e, 0xc8, 0x42, 0x0b, 0x57, 0xbf, 0x3f, 0xf5, 
-0x01, 0xd8, 0x11, 0x3b, 0x21, 0x65, 0x17, 0x46, 0xda, 0x28, 0x1d, 0xa3, 0x2f, 0xf9, 0xad, 0x23, 
-0xc6, 0x44, 0xa8, 0x39, 0xf6, 0x21, 0xc9, 0x11, 0xfa, 0x9a, 0x31, 0x46, 0x12, 0xd5, 0x93, 0x5a, 
-0xa1, 0xb7, 0x51, 0x1f, 0x64, 0x9e, 0x32, 0xe1, 0x12, 0xb9, 0x36, 0x58, 0xfe, 0x2f, 0xe9, 0x7d, 
-0xa3, 0x10, 0x6f, 0x2d, 0xf7, 0x63, 0x80, 0xea, 0xd9, 0x56, 0xf7, 0x9e, 0x35, 0xf2, 0x5b, 0x8e, 
-0xac, 0x08, 0xeb, 0xba, 0x10, 0xdf, 0x66, 0xf5, 0x21, 0x8f, 0x76, 0x29, 0x51, 0x03, 0xe9, 0x15, 
-0xcd, 0xac, 0x58, 0x36, 0x75, 0x16, 0xee, 0x92, 0x3b, 0xb3, 0x5b, 0x70, 0x42, 0xa6, 0xd5, 0x13, 
-0x6e, 0xf8, 0xc9, 0x9c, 0x74, 0x22, 0x63, 0x45, 0x79, 0x32, 0xf3, 0xd6, 0x92, 0x74, 0xbe, 0xe1, 
-0x98, 0xd8, 0xc5, 0xae, 0x20, 0xff, 0x3d, 0xa5, 0x49, 0xbc, 0x0f, 0x3f, 0x56, 0xcd, 0xdb, 0x97, 
-0xb4, 0x5e, 0x75, 0xa6, 0xca, 0xb9, 0x7e, 0xfd, 0xb1, 0x8f, 0x23, 0x45, 0xc5, 0x60, 0x89, 0x0b, 
-0x79, 0x55, 0xc0, 0x2f, 0xd1, 0x1e, 0xc5, 0x96, 0xae, 0x25, 0xc7, 0x60, 0x02, 0xfb, 0x4c, 0x91, 
-0xe9, 0xca, 0x8a, 0x35, 0x7e, 0x0a, 0x91, 0xc8, 0xb5, 0xde, 0x04, 0x51, 0x87, 0x67, 0x45, 0xa8, 
-0x84, 0x14, 0xa3, 0x2d, 0x76, 0x21, 0x38, 0xfe, 0xb4, 0xa4, 0xcd, 0x09, 0xe9, 0xad, 0xfb, 0x39, 
-0xdc, 0x7e, 0x6f, 0xf9, 0x99, 0xe2, 0x78, 0x8e, 0x68, 0xa6, 0xf9, 0x93, 0xb5, 0xe2, 0x78, 0xab, 
-0xc8, 0x6e, 0x8a, 0xd1, 0xbf, 0x96, 0x75, 0x5a, 0x8d, 0x1a, 0x6f, 0x0f, 0xd4, 0x7f, 0x5a, 0xb6, 
-0x3d, 0xd8, 0xc2, 0x71, 0xaa, 0xe8, 0x29, 0x3e, 0x03, 0xda, 0x8b, 0xe8, 0x7d, 0xbd, 0x07, 0x6f, 
-0xca, 0xf1, 0x78, 0xd4, 0x8d, 0x6e, 0x51, 0xbe, 0xdd, 0xef, 0x96, 0xc9, 0x05, 0xa6, 0x49, 0x10, 
-0x6d, 0x88, 0xcb, 0x62, 0x01, 0xab, 0x3d, 0x1b, 0x92, 0x7c, 0x30, 0x59, 0x45, 0x84, 0x32, 0x9e, 
-0x3d, 0x59, 0xef, 0xaa, 0x95, 0xd8, 0xb5, 0x87, 0x67, 0x2b, 0x0e, 0xe3, 0x8a, 0xb8, 0x52, 0xdf, 
-0x1f, 0xf4, 0x9a, 0xdb, 0x0e, 0xfb, 0x62, 0x7e, 0xbe, 0x8b, 0x08, 0xf0, 0x53, 0x38, 0xd3, 0xee, 
-0xba, 0x18, 0x82, 0x4d, 0x23, 0xf7, 0x46, 0x04, 0x55, 0x70, 0xeb, 0x0b, 0x68, 0x82, 0xc7, 0x8e, 
-0x23, 0x6e, 0xeb, 0xb0, 0x8b, 0x25, 0x6a, 0x3d, 0x10, 0xc2, 0xdf, 0x1b, 0x58, 0x95, 0x45, 0x2b, 
-0x9f, 0x5a, 0xf1, 0x82, 0x07, 0xd5, 0x37, 0xf5, 0xe4, 0x9e, 0x68, 0x8f, 0xa8, 0x4c, 0x5c, 0x7f, 
-0x0e, 0x55, 0xe2, 0x87, 0x9b, 0xc0, 0xad, 0x39, 0x71, 0x55, 0x1a, 0xb1, 0xcf, 0xf0, 0x1c, 0x4b, 
-0x2f, 0x5c, 0xa3, 0xeb, 0xb9, 0x0f, 0xe4, 0xcc, 0x20, 0x71, 0x52, 0xf9, 0xc5, 0xb0, 0x97, 0x66, 
-0x80, 0x2e, 0xde, 0x8c, 0x47, 0x56, 0xba, 0x01, 0xa6, 0x15, 0xb8, 0x2d, 0x65, 0xaa, 0x14, 0xcd, 
-0x29, 0xbc, 0x73, 0x47, 0x9f, 0x57, 0x32, 0x06, 0xe9, 0x4e, 0xf6, 0x08, 0x62, 0x14, 0xe2, 0x36, 
-0xb3, 0xfe, 0xdc, 0x94, 0xb0, 0x45, 0xee, 0x2d, 0x7a, 0x18, 0x5e, 0xf5, 0x07, 0x50, 0x7b, 0xce, 
-0xfc, 0x71, 0x2d, 0xc5, 0xa8, 0x3e, 0xee, 0x91, 0x4e, 0xa6, 0x43, 0x09, 0xaf, 0x9b, 0x25, 0x05, 
-0x66, 0x3d, 0x4f, 0x7a, 0xe5, 0x34, 0xbe, 0x93, 0xad, 0x41, 0x2d, 0x97, 0x78, 0xde, 0xc3, 0x81, 
-0x42, 0x1a, 0xd7, 0xb0, 0x95, 0xc7, 0xe8, 0xb7, 0x6e, 0xc3, 0xce, 0x19, 0x65, 0x79, 0x47, 0x23, 
-0xf9, 0xbc, 0x9c, 0x44, 0xf4, 0x5f, 0x28, 0xa4, 0x79, 0x08, 0xbd, 0x30, 0x88, 0x21, 0x4a, 0x99, 
-0xe5, 0x29, 0x45, 0xaf, 0x83, 0xc2, 0x06, 0xa9, 0x6a, 0xe0, 0x9d, 0xc5, 0xa7, 0x38, 0xcc, 0x7f, 
-0xb7, 0x2f, 0x4b, 0x90, 0xbf, 0x51, 0x2d, 0xe8, 0x5c, 0xd2, 0x34, 0xc3, 0x75, 0x03, 0xe5, 0x7f, 
-0xfd, 0x2d, 0x8a, 0x3b, 0xd4, 0x10, 0x65, 0xdd, 0x15, 0xcd, 0x6b, 0xa9, 0x52, 0xb6, 0x95, 0x4a, 
-0x28, 0xcf, 0x06, 0x43, 0xeb, 0x71, 0xd6, 0xf8, 0xbb, 0x6f, 0xf3, 0x2e, 0x3f, 0xd5, 0x5b, 0x1f, 
-0xdf, 0xa0, 0xf5, 0x43, 0x6b, 0x58, 0x9e, 0x77, 0xd4, 0x16, 0x8d, 0x3d, 0x23, 0x9c, 0x79, 0x37, 
-0xf3, 0xc0, 0x3d, 0x03, 0x5f, 0x4a, 0x15, 0xeb, 0x05, 0x5c, 0xbb, 0x71, 0x26, 0xd3, 0x77, 0x2f, 
-0x5d, 0xeb, 0x93, 0xd7, 0x05, 0x39, 0x4b, 0xea, 0x58, 0x35, 0x18, 0xc9, 0x0c, 0xf2, 0x8c, 0xbc, 
-0x60, 0x9e, 0x34, 0x41, 0x82, 0xee, 0x4a, 0xcc, 0x05, 0x80, 0x51, 0x30, 0x64, 0x00, 0x8b, 0xdf, 
-0xa4, 0x4e, 0x90, 0x23, 0x9d, 0xbd, 0x67, 0xae, 0x1c, 0x99, 0x5e, 0x0d, 0x4c, 0xd3, 0x27, 0x5d, 
-0x1a, 0x88, 0x2a, 0xe7, 0x17, 0xda, 0x46, 0xcf, 0x89, 0x15, 0xba, 0xa0, 0x1b, 0x5a, 0xfb, 0x22, 
-0xdc, 0x0b, 0xba, 0xe8, 0x48, 0x23, 0x69, 0xfc, 0xa8, 0x6a, 0xfc, 0x23, 0x75, 0x05, 0x4e, 0x17, 
-0x81, 0x09, 0x4a, 0x2f, 0xf6, 0x39, 0xa6, 0xd3, 0x52, 0x72, 0xda, 0x81, 0x07, 0xc8, 0x3e, 0xd3, 
-0x64, 0x46, 0x80, 0x52, 0xce, 0xb3, 0xee, 0x36, 0x1b, 0x5b, 0xd5, 0x68, 0x14, 0xe8, 0x91, 0x57, 
-0x28, 0x3f, 0x01, 0x5b, 0x6e, 0x11, 0xe9, 0x61, 0x21, 0xfa, 0xa5, 0x3f, 0xf0, 0x15, 0xd9, 0x01, 
-0xaa, 0x95, 0x14, 0x4c, 0xf3, 0x9a, 0xba, 0x55, 0xa1, 0x66, 0xb0, 0xf6, 0x72, 0xab, 0xee, 0xbc, 
-0x78, 0x38, 0xe6, 0x1c, 0x2d, 0xeb, 0x15, 0x71, 0xac, 0x80, 0xf9, 0x18, 0xb7, 0x2a, 0x08, 0x39, 
-0x91, 0x47, 0x1a, 0xb3, 0x75, 0x0c, 0xf2, 0x7f, 0xc4, 0x2d, 0x01, 0x93, 0xdd, 0xba, 0x27, 0xfd, 
-0xab, 0x65, 0xc3, 0xf8, 0x6e, 0xd6, 0x4d, 0x08, 0x8e, 0x63, 0xd9, 0xab, 0xe1, 0x85, 0xd1, 0xa1, 
-0xc3, 0x4c, 0xf8, 0x97, 0x0f, 0xef, 0x9c, 0xc7, 0x88, 0x43, 0x23, 0x53, 0xc9, 0x87, 0xb6, 0x9d, 
-0x7f, 0xdb, 0xef, 0x84, 0x6a, 0xd6, 0x40, 0x23, 0x7d, 0x10, 0xb4, 0xdc, 0xab, 0x6e, 0x2a, 0x9d, 
-0x67, 0xbe, 0x25, 0xe7, 0xcf, 0x9d, 0xbc, 0x68, 0x0d, 0xd2, 0xc6, 0x81, 0xec, 0x32, 0xdf, 0x87, 
-0x48, 0x38, 0xb2, 0xf7, 0x18, 0x77, 0x9b, 0xb6, 0xdf, 0xce, 0x66, 0xc0, 0x82, 0x5d, 0xf4, 0x75, 
-0xab, 0xfd, 0x27, 0xd8, 0x6c, 0x87, 0xce, 0x76, 0x50, 0xf4, 0x81, 0x18, 0xcf, 0x8d, 0xa1, 0x2f, 
-0x01, 0xc5, 0x8b, 0x3b, 0xee, 0xd2, 0x5d, 0xa6, 0xff, 0xdf, 0x9c, 0x88, 0xbf, 0xe4, 0x06, 0x93, 
-0x19, 0x34, 0xa8, 0x20, 0x6a, 0xaf, 0x97, 0x18, 0xff, 0xc5, 0xa9, 0xe6, 0x69, 0x00, 0xa1, 0x72, 
-0xcb, 0x8f, 0xa6, 0xf5, 0x31, 0x9b, 0x48, 0x7b, 0xfd, 0x88, 0xb1, 0xf1, 0x2e, 0x8d, 0xad, 0x9b, 
-0xd4, 0x89, 0x06, 0x64, 0xb0, 0x9a, 0x71, 0x7c, 0x43, 0xf7, 0x85, 0x62, 0xd7, 0x2e, 0x46, 0x17, 
-0xd0, 0x22, 0x4b, 0x03, 0x83, 0x33, 0x20, 0x8a, 0x4c, 0x00, 0xc7, 0x91, 0x7b, 0xc1, 0x58, 0xde, 
-0x3c, 0xc5, 0x60, 0x98, 0xdf, 0x87, 0xa5, 0x66, 0x23, 0xcd, 0xa1, 0xdc, 0x52, 0x8c, 0x15, 0x97, 
-0x65, 0x4a, 0xac, 0x7a, 0x14, 0x3a, 0x85, 0x07, 0xe5, 0x34, 0x80, 0x10, 0xae, 0x5b, 0xe8, 0xb4, 
-0xa0, 0x29, 0x7d, 0x96, 0x1f, 0x6d, 0x40, 0x2a, 0x79, 0x1a, 0x34, 0xab, 0x64, 0x3e, 0x1c, 0xdf, 
-0x6a, 0xf7, 0xaf, 0x79, 0xe4, 0x6b, 0xfe, 0x21, 0x06, 0x62, 0xab, 0x4f, 0x2c, 0xb0, 0x97, 0xfe, 
-0xcc, 0xe3, 0x91, 0x56, 0xc7, 0x1d, 0x8f, 0xd7, 0x3e, 0xf3, 0xa4, 0x78, 0x3b, 0x19, 0x54, 0xfc, 
-0x28, 0xae, 0x38, 0x6d, 0x45, 0x14, 0x58, 0x0c, 0xe7, 0xca, 0x7f, 0xdc, 0x8d, 0x64, 0xf2, 0x02, 
-0x39, 0x73, 0xfb, 0x50, 0x37, 0xb3, 0x95, 0x2e, 0xc4, 0x55, 0x91, 0x3a, 0xb1, 0x44, 0x13, 0x9f, 
-0x32, 0x5e, 0xa5, 0x70, 0x55, 0xee, 0x10, 0x5f, 0x31, 0x56, 0x9e, 0x0f, 0x65, 0xad, 0x2d, 0x8e, 
-0x20, 0x3a, 0x69, 0xae, 0x11, 0x5a, 0x83, 0xc4, 0x62, 0xec, 0xcc, 0x4d, 0xf8, 0x2f, 0xe6, 0x71, 
-0x8d, 0x36, 0x0f, 0x26, 0x94, 0x40, 0x56, 0xde, 0xb8, 0x06, 0x3d, 0x78, 0x21, 0xca, 0xdd, 0x0c, 
-0xbd, 0xd5, 0x1e, 0xc9, 0x78, 0xdc, 0x4f, 0x15, 0x3a, 0x73, 0xc8, 0xde, 0x27, 0x5a, 0xcf, 0xb5, 
-0x31, 0xdf, 0x21, 0xa7, 0x0f, 0xaf, 0x8f, 0xec, 0x79, 0xc4, 0x97, 0xe3, 0x54, 0xc8, 0xa3, 0x5e, 
-0xf7, 0x9c, 0xb0, 0x43, 0x63, 0xfe, 0x9f, 0x0f, 0x8d, 0x20, 0x4e, 0x35, 0x76, 0x54, 0xc3, 0xdb, 
-0xf0, 0x81, 0x04, 0x61, 0xec, 0xab, 0xcf, 0x35, 0xb9, 0xff, 0xd1, 0x5f, 0xec, 0xc1, 0x49, 0x6e, 
-0x98, 0x54, 0xd1, 0x47, 0x94, 0x2e, 0x82, 0x17, 0xd3, 0x56, 0xf7, 0x0f, 0x34, 0xe9, 0xb2, 0xf5, 
-0x92, 0xd7, 0xe4, 0x83, 0xce, 0xb4, 0x7e, 0x4d, 0x07, 0xc0, 0x18, 0x9f, 0x3e, 0x0f, 0x30, 0xcf, 
-0x92, 0x42, 0xc1, 0x1e, 0xe6, 0x02, 0x74, 0x52, 0x17, 0x67, 0x2b, 0x77, 0x0c, 0xfa, 0x50, 0xb6, 
-0x11, 0x5a, 0x8a, 0x09, 0xc4, 0xeb, 0x85, 0x41, 0x76, 0xe4, 0x03, 0xf8, 0xb3, 0xd6, 0x93, 0xa4, 
-0xbf, 0x6b, 0x23, 0x54, 0xa4, 0x32, 0xc5, 0x48, 0xaa, 0x93, 0x21, 0xa1, 0x04, 0xed, 0x1c, 0x41, 
-0x0e, 0x63, 0xe1, 0x00, 0xf2, 0xc6, 0x65, 0xed, 0xb4, 0xd4, 0x04, 0xc2, 0x34, 0xaf, 0x44, 0xbf, 
-0xf7, 0xdd, 0x48, 0xbc, 0x82, 0xe3, 0x43, 0xc2, 0x7a, 0xd4, 0x51, 0xf2, 0x26, 0x70, 0x41, 0xfc, 
-0x9a, 0x78, 0x0c, 0x8e, 0xbe, 0x7d, 0x54, 0x03, 0xb9, 0x5a, 0xd6, 0xf2, 0x77, 0xc6, 0xf8, 0x12, 
-0x81, 0x4d, 0xe2, 0xc0, 0x5f, 0xb2, 0x6d, 0x38, 0xa0, 0x61, 0x4e, 0x97, 0x43, 0x09, 0xf5, 0xc1, 
-0x5b, 0xe6, 0x1d, 0x7e, 0x37, 0xfc, 0x4b, 0x1a, 0xbf, 0x69, 0x54, 0xcb, 0x72, 0x3a, 0xdd, 0x5d, 
-0x07, 0xf3, 0x40, 0xb5, 0x69, 0xdb, 0x0a, 0x3e, 0xd6, 0x6d, 0x22, 0xda, 0x0b, 0x35, 0xb4, 0x6b, 
-0xd5, 0xed, 0xb9, 0xa2, 0x0c, 0xff, 0x41, 0x11, 0x98, 0x4c, 0xb8, 0x38, 0x28, 0x6c, 0x46, 0xe3, 
-0x22, 0x73, 0x0d, 0x8c, 0x2b, 0xa4, 0xe0, 0xcb, 0x19, 0xb2, 0x26, 0xec, 0x00, 0xbf, 0xfe, 0x40, 
-0x6b, 0xc3, 0x47, 0xb7, 0xcd, 0x8a, 0x4f, 0x09, 0x59, 0x6c, 0x43, 0x02, 0x54, 0xfe, 0x2a, 0x94, 
-0xa5, 0x35, 0x59, 0xf1, 0x8e, 0xbe, 0x4e, 0xae, 0x70, 0xf3, 0xa1, 0x88, 0xd1, 0x5c, 0xbe, 0x37, 
-0xa9, 0x46, 0xf2, 0xbc, 0x3c, 0xa4, 0x84, 0xea, 0x74, 0x20, 0xdd, 0x4a, 0xab, 0x6f, 0x20, 0xd8, 
-0x96, 0x59, 0xa0, 0x8a, 0x62, 0x20, 0x77, 0xfb, 0x2d, 0x00, 0xec, 0x40, 0xbb, 0x0c, 0x80, 0xe6, 
-0x59, 0x12, 0xba, 0xd5, 0x7c, 0x6c, 0xcc, 0x85, 0xea, 0xa5, 0x72, 0x81, 0x2e, 0x99, 0x0b, 0x8b, 
-0x26, 0x3f, 0x92, 0xff, 0x20, 0x83, 0xdb, 0x74, 0x92, 0xb1, 0x1b, 0xf2, 0x26, 0x97, 0x09, 0xef, 
-0x61, 0xb9, 0x01, 0x91, 0xd0, 0xdf, 0xb2, 0x2c, 0x13, 0xb8, 0x3b, 0x5d, 0xdc, 0x1b, 0x41, 0xa2, 
-0xe2, 0x82, 0x48, 0xa4, 0x19, 0x8a, 0x31, 0x65, 0x27, 0x99, 0xfc, 0x0e, 0x8a, 0x50, 0x19, 0xf6, 
-0x2b, 0x74, 0x11, 0xea, 0xb8, 0x67, 0x82, 0x29, 0xb1, 0x46, 0x9e, 0xbc, 0x93, 0x0c, 0x87, 0xa3, 
-0xee, 0x05, 0x9d, 0xfd, 0x82, 0xc1, 0x23, 0x6c, 0xa6, 0x31, 0x8c, 0x14, 0x28, 0xff, 0x90, 0xc1, 
-0x2d, 0x81, 0x56, 0xf1, 0x87, 0xce, 0x26, 0x47, 0x7c, 0x01, 0x64, 0xe3, 0xcf, 0x1e, 0xad, 0x5d, 
-0x30, 0x79, 0xca, 0xfc, 0x9d, 0xbf, 0x06, 0x85, 0x58, 0x9e, 0x3f, 0xd8, 0x51, 0x1e, 0x62, 0x8e, 
-0x3f, 0xf5, 0x77, 0xa3, 0x64, 0xcd, 0x74, 0xa8, 0x22, 0x07, 0xe4, 0x76, 0x5c, 0xa4, 0x17, 0xc9, 
-0xbb, 0xa8, 0x24, 0x9e, 0xc3, 0x14, 0x60, 0xe5, 0xcf, 0x75, 0xdb, 0x27, 0x62, 0xd5, 0x7c, 0xe9, 
-0x59, 0x38, 0x16, 0x78, 0x32, 0x9c, 0xee, 0x8a, 0xd8, 0x7f, 0x9d, 0x1f, 0xd2, 0x5f, 0x01, 0x31, 
-0xca, 0x98, 0xb8, 0xfb, 0x5f, 0x93, 0x33, 0xb4, 0xc1, 0x15, 0x4a, 0x2c, 0xca, 0xbb, 0x3b, 0x4c, 
-0x5f, 0x90, 0x9e, 0x73, 0xd2, 0xff, 0x28, 0x6c, 0xd9, 0x86, 0x2f, 0x45, 0xe1, 0x56, 0x9e, 0xb9, 
-0x4c, 0xd2, 0x22, 0xbe, 0x49, 0xde, 0x53, 0x7d, 0xe7, 0x6c, 0x4b, 0xe0, 0x63, 0x9a, 0x0d, 0xf8, 
-0x3d, 0x69, 0x7b, 0x5b, 0xcd, 0x72, 0x53, 0xd9, 0x16, 0x32, 0xa7, 0x46, 0x7b, 0x1c, 0xa1, 0x54, 
-0xd7, 0x49, 0xe8, 0x9e, 0x28, 0xac, 0xf2, 0xc8, 0x12, 0x6c, 0x2d, 0xb5, 0x5f, 0xe9, 0xbe, 0xa7, 
-0xda, 0xb1, 0x6f, 0x2d, 0xa3, 0xec, 0xce, 0x8d, 0xae, 0xe4, 0x83, 0x26, 0xa4, 0x36, 0xce, 0x91, 
-0x6b, 0xf9, 0x10, 0x52, 0xeb, 0x67, 0xdb, 0x3a, 0x77, 0x90, 0x2b, 0x40, 0x0a, 0xe6, 0x4c, 0xb8, 
-0x86, 0x56, 0xd6, 0x74, 0x9e, 0x47, 0x7a, 0x19, 0xb6, 0xe8, 0x14, 0xa8, 0x74, 0x50, 0x95, 0xf8, 
-0xab, 0x32, 0x90, 0x27, 0x80, 0x6c, 0x8c, 0xbe, 0xe8, 0x69, 0x0e, 0x88, 0x1c, 0x76, 0xe9, 0xa7, 
-0xca, 0x19, 0xb6, 0xf1, 0x7e, 0xb1, 0xfb, 0x04, 0xbd, 0x5d, 0xda, 0x8b, 0x1c, 0x38, 0x52, 0x92, 
-0xf0, 0x85, 0x9c, 0x3b, 0x27, 0xfb, 0x68, 0x80, 0x31, 0xf2, 0x8b, 0xe8, 0x74, 0x33, 0x87, 0xb6, 
-0x45, 0x12, 0x83, 0xac, 0x00, 0x9c, 0x18, 0x28, 0xdf, 0x08, 0xc9, 0xfc, 0x4a, 0x6b, 0x24, 0x13, 
-0xc7, 0x06, 0x58, 0xea, 0x94, 0x6c, 0xe0, 0xad, 0x46, 0x67, 0x39, 0x29, 0x0e, 0xcd, 0xf1, 0x08, 
-0x66, 0xe8, 0xd1, 0x7e, 0xf3, 0x08, 0xaa, 0xe3, 0x83, 0xd7, 0x1d, 0xae, 0x13, 0x50, 0x97, 0xb2, 
-0x3e, 0xf2, 0xc6, 0x61, 0xab, 0x27, 0x13, 0xf5, 0x32, 0x08, 0x93, 0x5e, 0xf7, 0xaa, 0x1f, 0xba, 
-0xca, 0x16, 0xa4, 0x7a, 0xb8, 0x3b, 0xcb, 0x4d, 0x05, 0x2c, 0xd8, 0xa7, 0x11, 0x36, 0xb2, 0x9f, 
-0x87, 0x6f, 0xe6, 0xc7, 0x5e, 0x38, 0x8c, 0xf4, 0x6c, 0x81, 0x01, 0xcd, 0x70, 0x85, 0x62, 0x92, 
-0x23, 0xfa, 0x9a, 0xd0, 0x05, 0x3d, 0x51, 0x79, 0x18, 0x44, 0x5b, 0xd3, 0x3c, 0x7b, 0x05, 0x45, 
-0x58, 0xc2, 0x3e, 0xd3, 0xff, 0x55, 0x1c, 0xa9, 0x00, 0xd6, 0x78, 0x2e, 0xa7, 0xcd, 0x25, 0x5d, 
-0xc6, 0x4f, 0xda, 0xb5, 0x60, 0x95, 0x18, 0xfa, 0xcd, 0x0d, 0xe4, 0xbd, 0x5f, 0xea, 0xac, 0x51, 
-0x66, 0xcb, 0x99, 0x3a, 0xba, 0x05, 0xe0, 0x1a, 0xc0, 0x55, 0xf2, 0xc7, 0x4c, 0x3b, 0xee, 0x9e, 
-0x25, 0xd5, 0xae, 0x57, 0x3c, 0xd1, 0x4f, 0x2e, 0xf8, 0x66, 0x92, 0x33, 0x0b, 0x70, 0x9c, 0x35, 
-0x83, 0x11, 0x2e, 0x4b, 0xe3, 0xb6, 0x0b, 0xdd, 0x31, 0xb1, 0x65, 0xd6, 0x01, 0x93, 0xdf, 0x3f, 
-0xd3, 0x0f, 0x62, 0x4a, 0xda, 0xac, 0xf2, 0x09, 0x6e, 0xfa, 0xc3, 0x51, 0xed, 0x41, 0x89, 0xb9, 
-0xa5, 0x65, 0x93, 0xb1, 0x0d, 0xdb, 0xb6, 0x43, 0xfa, 0x6f, 0xb1, 0x34, 0x4a, 0xc1, 0x19, 0x7b, 
-0xf3, 0x13, 0xd4, 0x80, 0xa5, 0x54, 0x88, 0x46, 0x7a, 0x39, 0xa6, 0x1c, 0x54, 0x96, 0x6f, 0x12, 
-0xc8, 0x37, 0xf5, 0x47, 0x67, 0x88, 0xca, 0x1e, 0x07, 0x73, 0x98, 0x0d, 0xfd, 0x8d, 0x3b, 0x66, 
-0x77, 0xb1, 0xe5, 0x3d, 0x15, 0x75, 0xd3, 0x36, 0x5b, 0xf0, 0x2d, 0x09, 0xd2, 0x1c, 0x5c, 0xad, 
-0x8d, 0xc5, 0xfe, 0x42, 0x91, 0xc0, 0xf4, 0x49, 0x24, 0xf8, 0x98, 0x10, 0xb5, 0xeb, 0x07, 0xca, 
-0x24, 0x96, 0xaf, 0xfd, 0x35, 0x0f, 0xd6, 0x4e, 0x3b, 0xc0, 0x54, 0x75, 0xdd, 0x21, 0x97, 0xcc, 
-0xf2, 0x02, 0x92, 0xe9, 0x1d, 0xbb, 0x67, 0x98, 0xd8, 0x0d, 0x6b, 0x8f, 0x07, 0x79, 0xdf, 0xee, 
-0x39, 0x5a, 0xc6, 0x8b, 0x42, 0xb4, 0x07, 0xe9, 0xae, 0x11, 0xf3, 0x6e, 0xd2, 0xa1, 0x34, 0x7a, 
-0x44, 0x27, 0xa9, 0x3b, 0x1f, 0x02, 0xd3, 0x32, 0x8b, 0x0c, 0x4a, 0x29, 0xea, 0xc8, 0x65, 0x82, 
-0x3d, 0x73, 0x9b, 0x15, 0xb5, 0xd6, 0x03, 0x55, 0x16, 0x47, 0xe2, 0x92, 0xf2, 0x64, 0x97, 0x13, 
-0x79, 0x44, 0xe0, 0xc2, 0x5a, 0xcd, 0x46, 0xe4, 0xd5, 0xad, 0x71, 0xc7, 0x97, 0xf9, 0x7d, 0x5e, 
-0xd0, 0x4a, 0x1b, 0xee, 0xa9, 0xc2, 0x4b, 0x1f, 0x9b, 0x78, 0xb3, 0x1c, 0x3b, 0x97, 0x57, 0x23, 
-0x9f, 0x3b, 0x92, 0x2f, 0x6a, 0xc8, 0xfa, 0x4c, 0x72, 0xd8, 0x3f, 0x54, 0xe8, 0xa2, 0x7c, 0x63, 
-0x91, 0x2b, 0xe4, 0x0f, 0x8b, 0xff, 0x28, 0xa0, 0x54, 0x8c, 0xbd, 0xe9, 0x6b, 0x1c, 0xde, 0xae, 
-0x26, 0xfd, 0x8d, 0x6b, 0xdd, 0x41, 0xee, 0x28, 0xb5, 0x57, 0x7b, 0xc1, 0xe9, 0x32, 0xde, 0x5d, 
-0xa7, 0x4d, 0xe7, 0x20, 0x7b, 0xcf, 0xc1, 0x99, 0xd6, 0x50, 0x84, 0xc6, 0xa0, 0x63, 0x8d, 0x03, 
-0x9b, 0xaf, 0x87, 0x53, 0xf6, 0x72, 0x8c, 0xef, 0x5f, 0x15, 0x50, 0x81, 0xe9, 0x04, 0x62, 0x7c, 
-0xcb, 0x40, 0x58, 0x2b, 0x84, 0x68, 0xa9, 0x3f, 0xbd, 0x60, 0x1a, 0x57, 0x47, 0xb7, 0xe9, 0x78, 
-0xb0, 0xe0, 0x0b, 0x8e, 0xac, 0xfd, 0x69, 0x87, 0x36, 0xb7, 0xc5, 0x82, 0x54, 0xa8, 0xf5, 0x31, 
-0x23, 0xf0, 0xa0, 0x4c, 0xbf, 0x62, 0x9b, 0x45, 0x85, 0xb8, 0x21, 0xf4, 0x14, 0x70, 0x81, 0x9b, 
-0x45, 0x8a, 0x1d, 0x7f, 0x28, 0x54, 0xeb, 0xb0, 0x91, 0x6a, 0xf6, 0x7e, 0x95, 0xc4, 0x6e, 0xf4, 
-0xa3, 0xd7, 0xfa, 0x70, 0x8d, 0x59, 0xa1, 0x2b, 0xd5, 0xe5, 0x09, 0x5f, 0xa6, 0x2f, 0x72, 0xf5, 
-0x85, 0xa4, 0x33, 0x05, 0xb3, 0x23, 0xdc, 0xbd, 0xad, 0x02, 0x87, 0x27, 0xa8, 0xee, 0x20, 0x69, 
-0x50, 0x9f, 0xf3, 0x05, 0x40, 0x6a, 0x29, 0xa3, 0x11, 0xbd, 0x78, 0x55, 0x83, 0x2f, 0x71, 0xb8, 
-0xe3, 0x54, 0xfc, 0xcc, 0x07, 0x6b, 0xd2, 0xe0, 0xba, 0x5f, 0xe7, 0x1f, 0xb3, 0x78, 0x0a, 0x31, 
-0x1d, 0xbf, 0x80, 0x2a, 0x8b, 0x1c, 0x36, 0xc1, 0x52, 0xa7, 0xcb, 0x79, 0x5c, 0xb6, 0x3c, 0xc8, 
-0xdd, 0x08, 0x9b, 0x4c, 0x3e, 0xf8, 0xc5, 0x9a, 0x5b, 0xbf, 0x01, 0xb3, 0x32, 0xc3, 0x87, 0xa0, 
-0x65, 0x0e, 0x93, 0x25, 0x04, 0xa0, 0x77, 0xfa, 0xc2, 0x8a, 0x37, 0xb9, 0x54, 0x44, 0x01, 0xef, 
-0x1b, 0x28, 0xfa, 0x0b, 0x2f, 0xdb, 0x46, 0xfb, 0x71, 0x3d, 0xe4, 0xc2, 0x97, 0x33, 0xd7, 0x16, 
-0x36, 0xaf, 0x9f, 0x1f, 0x6c, 0x2f, 0xdf, 0x1a, 0xad, 0x08, 0xbd, 0xdd, 0xfd, 0x16, 0x4f, 0x76, 
-0xe7, 0x31, 0xd4, 0x8a, 0xc4, 0x9d, 0x06, 0x2b, 0x87, 0x16, 0x65, 0x42, 0x30, 0xc2, 0x0d, 0x4a, 
-0xe1, 0x62, 0x74, 0x28, 0xdc, 0x11, 0xca, 0x73, 0xb8, 0x80, 0x17, 0xb2, 0x33, 0x25, 0xc7, 0x12, 
-0x6f, 0xe5, 0xa1, 0x61, 0xde, 0x51, 0xfe, 0x31, 0x68, 0xce, 0x38, 0xaa, 0xc3, 0x00, 0xd7, 0x12, 
-0x5c, 0xca, 0x07, 0x53, 0xee, 0x45, 0x85, 0x24, 0x3d, 0x5d, 0x7e, 0xb1, 0x13, 0x44, 0xf4, 0x0d, 
-0xae, 0x49, 0x89, 0xfd, 0x7c, 0xe1, 0x94, 0xc3, 0x62, 0xce, 0x7c, 0x6d, 0xc5, 0x4a, 0x80, 0x39, 
-0x5b, 0xeb, 0xd3, 0x4d, 0x77, 0x11, 0x94, 0xc1, 0x2a, 0x16, 0x5a, 0x84, 0xb0, 0x1d, 0xc4, 0x8b, 
-0xf3, 0x39, 0x98, 0xcc, 0x0c, 0xe7, 0x5d, 0x8e, 0x04, 0x2d, 0xa4, 0x88, 0xbe, 0x7d, 0x2c, 0x4b, 
-0x16, 0x81, 0xce, 0x0e, 0xdc, 0xa0, 0x5a, 0xe3, 0x97, 0xf6, 0x04, 0xc7, 0x5c, 0xd0, 0xf4, 0x01, 
-0xdd, 0x17, 0x3f, 0x9e, 0xd8, 0x04, 0x84, 0x6f, 0x61, 0x33, 0x22, 0x77, 0xb4, 0x04, 0x30, 0x71, 
-0x14, 0xda, 0x4d, 0xeb, 0x5f, 0x15, 0xd5, 0x4a, 0xfd, 0xe0, 0xa8, 0xd2, 0x55, 0xba, 0x3c, 0x12, 
-0x2a, 0xd7, 0x66, 0xa0, 0xdd, 0x6d, 0xaf, 0x88, 0x5d, 0xa8, 0x6b, 0xb9, 0x7b, 0xea, 0xb2, 0x27, 
-0xc7, 0x0e, 0x64, 0x21, 0x47, 0xb2, 0x67, 0xbe, 0xcb, 0x76, 0xe5, 0xd2, 0xb6, 0x55, 0x89, 0xa3, 
-0xd5, 0x6d, 0x8f, 0x79, 0x36, 0xce, 0x93, 0xda, 0x0b, 0xa0, 0xf5, 0x79, 0x23, 0xf0, 0x6a, 0x59, 
-0xcb, 0xf7, 0xa4, 0xe5, 0x80, 0x57, 0xd3, 0xa1, 0x1f, 0xab, 0x0a, 0xfe, 0x37, 0x90, 0x5f, 0x4a, 
-0xdd, 0x3b, 0x5a, 0xe7, 0xd0, 0xf3, 0x8a, 0xad, 0x2c, 0x4b, 0x06, 0x94, 0x38, 0xc1, 0xd4, 0x1a, 
-0xbb, 0xe0, 0x59, 0xf9, 0x47, 0x8b, 0x73, 0x3c, 0xe1, 0xbb, 0xa2, 0x2f, 0xd9, 0xb0, 0x11, 0xbb, 
-0xe3, 0x07, 0xc3, 0x20, 0xde, 0x36, 0xb8, 0x93, 0x6c, 0xc9, 0x24, 0xbc, 0x43, 0x1b, 0x4e, 0x29, 
-0xb6, 0x3e, 0xfb, 0x15, 0xea, 0x8e, 0x0e, 0xfe, 0x9f, 0x6a, 0x1a, 0x99, 0xb7, 0x3e, 0x87, 0xfa, 
-0x7a, 0xb9, 0xd1, 0x33, 0xed, 0xd9, 0x57, 0x44, 0xe4, 0x6d, 0x26, 0xff, 0x43, 0xaf, 0x14, 0xf5, 
-0xc5, 0x68, 0x44, 0x21, 0x5c, 0xef, 0xa6, 0x8f, 0xf5, 0x74, 0xa9, 0x53, 0x8c, 0x39, 0xcb, 0x84, 
-0xaa, 0x63, 0x3a, 0xec, 0x6d, 0xac, 0x4a, 0x97, 0x83, 0xef, 0x22, 0x66, 0xf5, 0x4e, 0x1c, 0xe9, 
-0xb0, 0xf7, 0xc3, 0xd7, 0x86, 0x63, 0x92, 0xd3, 0x3b, 0x83, 0x9d, 0x75, 0x25, 0xad, 0x7b, 0x07, 
-0x34, 0x70, 0x42, 0x82, 0xf2, 0x6b, 0x92, 0x4a, 0x7e, 0xae, 0x06, 0xf7, 0x2d, 0x11, 0xe8, 0x35, 
-0x48, 0xe0, 0x91, 0x40, 0x57, 0x11, 0x94, 0x4e, 0x82, 0xd9, 0xa4, 0x7b, 0x01, 0xeb, 0x29, 0x51, 
-0x4b, 0x00, 0x2b, 0x3f, 0x96, 0xc5, 0xfb, 0x39, 0x50, 0xef, 0x1f, 0x47, 0xa2, 0x5d, 0xb7, 0x29, 
-0x84, 0x49, 0x64, 0x14, 0x3d, 0x90, 0xaa, 0xda, 0x37, 0x97, 0x4d, 0x25, 0xb5, 0x18, 0x75, 0xf6, 
-0x2d, 0x95, 0x51, 0xb3, 0x45, 0xa0, 0x86, 0x03, 0xf8, 0x92, 0xa7, 0x6f, 0x7c, 0x03, 0x53, 0xd9, 
-0xfb, 0x7e, 0xd1, 0xaf, 0x76, 0x26, 0x8c, 0xa5, 0x04, 0x78, 0x93, 0x0e, 0x64, 0xb7, 0xf0, 0x9c, 
-0x1a, 0x4a, 0x87, 0x72, 0x19, 0x58, 0x65, 0x9c, 0x76, 0x52, 0x91, 0xa6, 0x67, 0xcc, 0x78, 0xe9, 
-0x17, 0x5b, 0x9e, 0x37, 0x6a, 0xcf, 0xa9, 0x09, 0xdf, 0x1f, 0x9d, 0x5d, 0x2e, 0xa9, 0x73, 0xcf, 
-0x29, 0xc4, 0x35, 0xf4, 0xe2, 0x61, 0xd7, 0x01, 0x3a, 0xe7, 0x65, 0x8f, 0x4a, 0x9c, 0x0e, 0x7b, 
-0xaa, 0x06, 0xb8, 0x88, 0x67, 0xd9, 0x9d, 0x3a, 0x7e, 0xd4, 0xec, 0x93, 0xdd, 0x10, 0x3d, 0xc5, 
-0x02, 0x30, 0x43, 0xff, 0x27, 0x65, 0xf1, 0x13, 0x50, 0x24, 0xb8, 0x9d, 0x0f, 0x78, 0x27, 0xb7, 
-0x5a, 0x72, 0xbc, 0x8d, 0x31, 0xa9, 0xcf, 0x95, 0x45, 0x11, 0xa6, 0x51, 0xe5, 0x17, 0xee, 0x49, 
-0xac, 0xf5, 0x0f, 0xcc, 0x8f, 0xf7, 0x56, 0x99, 0xcc, 0xbe, 0x19, 0x2c, 0xb1, 0x0b, 0xe2, 0xcb, 
-0xee, 0x19, 0x5b, 0x84, 0x94, 0xc7, 0x7d, 0x9f, 0xbf, 0x07, 0xcc, 0xee, 0x20, 0xa5, 0xd1, 0x68, 
-0x1b, 0xb9, 0x54, 0xfd, 0xcd, 0x85, 0xa0, 0x70, 0xc0, 0x8c, 0xf8, 0x60, 0x0a, 0x74, 0x14, 0x27, 
-0x99, 0x60, 0xc6, 0xaf, 0x01, 0xf3, 0x1d, 0x6f, 0xeb, 0xaa, 0xba, 0xcc, 0xe2, 0x52, 0x11, 0xbe, 
-0x7d, 0x1d, 0x71, 0xc6, 0xf0, 0x93, 0x3f, 0xbd, 0x85, 0xe6, 0xce, 0x66, 0xee, 0xd4, 0x1b, 0xb0, 
-0x2b, 0xc3, 0x11, 0x21, 0x43, 0x98, 0x65, 0x37, 0xbd, 0x1c, 0x57, 0xf1, 0x0b, 0x47, 0x63, 0xef, 
-0x52, 0x2c, 0xe7, 0xa1, 0xca, 0x30, 0x22, 0x80, 0x67, 0xfe, 0x25, 0xe8, 0x97, 0xcd, 0xfb, 0x34, 
-0xc8, 0xee, 0x2c, 0x47, 0xfc, 0x04, 0x87, 0x50, 0x2f, 0xf8, 0xda, 0x00, 0xe8, 0x8c, 0xf7, 0x5b, 
-0x75, 0x90, 0x4d, 0xd3, 0xba, 0x41, 0xe5, 0x51, 0x07, 0x83, 0x56, 0x72, 0x0a, 0x2b, 0xad, 0x55, 
-0x97, 0xa6, 0x23, 0x09, 0x73, 0xbf, 0xf9, 0x31, 0xd6, 0x5e, 0xc7, 0x35, 0x1c, 0x52, 0x76, 0x26, 
-0xaa, 0x4f, 0x0a, 0x34, 0x74, 0xb0, 0x54, 0x68, 0xd4, 0x9c, 0xb5, 0x6f, 0xc0, 0x04, 0xaf, 0x45, 
-0xd6, 0x7b, 0x90, 0xe0, 0x43, 0xd5, 0xfb, 0x13, 0x34, 0xcf, 0x46, 0xe6, 0x10, 0xc2, 0x7a, 0x26, 
-0x59, 0x8c, 0x71, 0x39, 0x28, 0xa0, 0xc8, 0x7c, 0x21, 0x65, 0x2e, 0x46, 0xbb, 0x3b, 0xe3, 0x21, 
-0x61, 0xea, 0x90, 0x4d, 0xd7, 0x61, 0x22, 0x9a, 0x70, 0xbe, 0x41, 0xd3, 0x1e, 0x4e, 0x61, 0xfb, 
-0x15, 0x74, 0x31, 0x83, 0x62, 0xc1, 0x38, 0xe3, 0xf4, 0x2d, 0x93, 0x37, 0x5e, 0x19, 0xdd, 0x92, 
-0x68, 0xab, 0x7f, 0xda, 0xa4, 0x49, 0xe3, 0x83, 0xbb, 0x0a, 0xd8, 0x2f, 0x88, 0xdf, 0x42, 0xc8, 
-0x57, 0x38, 0x03, 0x97, 0x73, 0x2f, 0xfb, 0x48, 0x00, 0xec, 0xae, 0x5e, 0x0b, 0xd7, 0x68, 0x04, 
-0x5c, 0x3b, 0x7b, 0x0e, 0x24, 0xbc, 0x79, 0xe4, 0x68, 0x51, 0xd3, 0xfc, 0xb6, 0xe0, 0xa5, 0x0e, 
-0x91, 0x40, 0x6a, 0xc8, 0x9d, 0xb6, 0xdd, 0x80, 0x3d, 0xb2, 0x1e, 0x70, 0x41, 0xdc, 0x55, 0xae, 
-0xd3, 0x38, 0xa7, 0xbe, 0x3f, 0x0d, 0x8b, 0x4b, 0xa9, 0x19, 0x83, 0xd6, 0x99, 0x60, 0x26, 0xa9, 
-0xc0, 0x72, 0x82, 0xb0, 0x54, 0x12, 0x7f, 0xc0, 0x33, 0xb1, 0xe4, 0x02, 0x86, 0x1c, 0x63, 0x92, 
-0xb5, 0xde, 0xab, 0x8e, 0xc1, 0x4b, 0xcb, 0x70, 0xf1, 0x46, 0xc5, 0xe1, 0xad, 0x1b, 0x63, 0x93, 
-0x22, 0x4c, 0xa1, 0xf0, 0x95, 0xd0, 0xeb, 0xbe, 0x19, 0x86, 0xba, 0xa1, 0xcc, 0xfc, 0x1a, 0x85, 
-0xeb, 0x5a, 0xdf, 0x1b, 0x95, 0xda, 0x75, 0x2c, 0xc2, 0xfd, 0x1b, 0x56, 0x30, 0x89, 0xa3, 0x68, 
-0xe1, 0xac, 0x09, 0x9c, 0x56, 0x6c, 0x38, 0xfc, 0xe2, 0x00, 0xd1, 0xf2, 0x5e, 0xb2, 0x0c, 0x55, 
-0xbc, 0xe6, 0xa2, 0xde, 0x6c, 0x0a, 0xa7, 0x85, 0xb5, 0x03, 0x76, 0xa2, 0xf8, 0x87, 0x38, 0xa9, 
-0x52, 0x2f, 0xe3, 0xa1, 0xb4, 0x39, 0xd8, 0x27, 0xb1, 0x55, 0xdb, 0x9e, 0xff, 0x03, 0x78, 0x8a, 
-0x45, 0x13, 0x73, 0xe5, 0xaa, 0xc2, 0x42, 0x06, 0xe0, 0x0f, 0x51, 0x1e, 0xb5, 0xce, 0x65, 0xf3, 
-0x43, 0x71, 0xe8, 0x53, 0x68, 0x7a, 0x9c, 0x12, 0x8d, 0xfe, 0x26, 0xdc, 0x5d, 0xb6, 0x86, 0xa0, 
-0x63, 0xd3, 0x3d, 0x89, 0x32, 0xa2, 0x4d, 0xdf, 0xad, 0x18, 0xc2, 0x99, 0x70, 0x33, 0x58, 0x40, 
-0x9c, 0x7f, 0x35, 0x8b, 0x5c, 0x29, 0xc6, 0x75, 0xea, 0xaa, 0x87, 0x24, 0xe5, 0x34, 0x17, 0xcc, 
-0x9a, 0xfc, 0xbf, 0x84, 0x14, 0xf7, 0x8d, 0x09, 0xc4, 0x15, 0x5e, 0x7a, 0xdb, 0x6d, 0x29, 0xdf, 
-0x01, 0x6c, 0xb3, 0x39, 0x12, 0xb9, 0xe1, 0x3d, 0xd2, 0x10, 0x46, 0x97, 0xc7, 0x2a, 0xa0, 0x43, 
-0xec, 0x11, 0x66, 0x7a, 0xf9, 0xc3, 0xa4, 0x39, 0x15, 0xf7, 0x43, 0x20, 0x9d, 0xfd, 0x83, 0x1e, 
-0x12, 0x8a, 0x2f, 0x57, 0x80, 0x3d, 0xcb, 0xb4, 0x85, 0xe0, 0x13, 0x7d, 0xb5, 0x00, 0x45, 0x61, 
-0xfa, 0xdb, 0x5c, 0x6c, 0x28, 0x47, 0x98, 0xbf, 0x25, 0x0a, 0x3b, 0x81, 0x4d, 0xee, 0xa2, 0x8b, 
-0x6a, 0x0b, 0xa6, 0x65, 0xbc, 0x07, 0xc8, 0x4e, 0x91, 0x7d, 0x2b, 0xf3, 0x85, 0xda, 0x16, 0xb7, 
-0xa2, 0x80, 0xbd, 0x1b, 0x96, 0x78, 0x41, 0xff, 0x90, 0x04, 0x85, 0x59, 0x18, 0xc6, 0x4e, 0x2e, 
-0xf1, 0x3d, 0x59, 0xc8, 0x10, 0x46, 0xc2, 0x01, 0xf4, 0x8f, 0x66, 0x78, 0x08, 0xed, 0x72, 0x98, 
-0x8a, 0xc6, 0x1a, 0x49, 0xb5, 0x28, 0x53, 0xad, 0x9d, 0xcc, 0xb5, 0x08, 0x4b, 0x27, 0x79, 0x62, 
-0xb9, 0x94, 0xf2, 0x3b, 0x2e, 0x8b, 0x0e, 0xad, 0x34, 0xa1, 0x92, 0x10, 0xf9, 0xbf, 0x33, 0xb2, 
-0xd3, 0x67, 0x7c, 0xa5, 0x40, 0xe8, 0x1f, 0xca, 0x2a, 0x92, 0xe1, 0x13, 0xfb, 0x7f, 0xca, 0x28, 
-0xed, 0x88, 0xfb, 0x48, 0xdb, 0xa9, 0xf4, 0xc9, 0x0c, 0xec, 0xa4, 0x07, 0x6d, 0xf1, 0x17, 0x4d, 
-0xd4, 0x2f, 0xf9, 0x11, 0x4e, 0x92, 0x73, 0x59, 0x0b, 0x67, 0x4a, 0xd4, 0x5c, 0xa4, 0x74, 0xe3, 
-0x4e, 0x93, 0xed, 0x04, 0x4f, 0xa4, 0xb7, 0x7e, 0xf3, 0xd0, 0x55, 0xe9, 0x7a, 0x4b, 0xf6, 0x8d, 
-0xa0, 0x66, 0x21, 0xf2, 0x3c, 0x63, 0xd8, 0x6f, 0x21, 0xc9, 0xa8, 0x36, 0x56, 0x26, 0xef, 0xd2, 
-0x7c, 0x69, 0x2f, 0xd6, 0x0f, 0x65, 0x36, 0xb7, 0xde, 0xcf, 0x67, 0xfc, 0xa1, 0xe9, 0x50, 0x03, 
-0xf4, 0x72, 0x3f, 0x59, 0x2b, 0x6e, 0x8c, 0x31, 0x9a, 0x0f, 0x3e, 0xf1, 0x03, 0xdf, 0x78, 0x36, 
-0xad, 0x91, 0xf8, 0xc9, 0x60, 0x0e, 0x36, 0x57, 0xe3, 0x3e, 0xce, 0xe7, 0x80, 0xf1, 0x22, 0x3b, 
-0xea, 0x1a, 0x60, 0xc5, 0xaf, 0x4a, 0x98, 0x62, 0x42, 0x30, 0x68, 0x4b, 0xcb, 0xe1, 0x2d, 0x6d, 
-0xd7, 0x38, 0xce, 0x74, 0xfb, 0x98, 0x7c, 0xd2, 0x6b, 0x95, 0xdd, 0x26, 0xb7, 0x6a, 0xe6, 0x81, 
-0xd1, 0x13, 0x25, 0xf8, 0x57, 0xbd, 0x45, 0x0e, 0x67, 0xf2, 0x3b, 0x6f, 0x92, 0xd6, 0xea, 0x0c, 
-0x5f, 0xe0, 0x84, 0x6b, 0xec, 0x9a, 0xf7, 0xd6, 0x25, 0x6d, 0xc2, 0x7b, 0xeb, 0x9a, 0x55, 0xc5, 
-0x1b, 0x7d, 0xd1, 0x29, 0xa7, 0x1a, 0x5f, 0xe9, 0x08, 0x47, 0xc4, 0x19, 0x8f, 0x0c, 0x6c, 0xf2, 
-0x78, 0x54, 0xba, 0x49, 0x6f, 0xb3, 0x1b, 0x97, 0x6d, 0x35, 0xa4, 0x5a, 0x00, 0x83, 0x17, 0x8f, 
-0x25, 0xd7, 0x48, 0xbe, 0xce, 0x3d, 0x83, 0x9b, 0x04, 0x5b, 0xb4, 0x7c, 0x64, 0xc2, 0xf6, 0xa9, 
-0x22, 0xdb, 0x31, 0x91, 0x02, 0xb9, 0x2a, 0x40, 0x6b, 0xb5, 0x31, 0xca, 0x8e, 0xf6, 0x1c, 0x5c, 
-0x42, 0x90, 0x22, 0xa0, 0xc9, 0x6c, 0x1e, 0x06, 0x57, 0xe7, 0xb5, 0x76, 0xe0, 0x18, 0xb7, 0xfd, 
-0x96, 0x87, 0x47, 0xdd, 0x99, 0x70, 0x0d, 0x4d, 0x9b, 0xbb, 0x5c, 0xed, 0x7a, 0xa6, 0xe6, 0x5a, 
-0x99, 0x78, 0x08, 0xba, 0x27, 0x10, 0xd8, 0x68, 0x34, 0xa8, 0xd1, 0xfc, 0xc3, 0xe6, 0xa7, 0xcd, 
-0x78, 0x4d, 0xb5, 0x90, 0x80, 0xc7, 0x51, 0xe8, 0x64, 0x72, 0x46, 0xa7, 0x29, 0xbc, 0xd1, 0x1e, 
-0xb4, 0x92, 0x27, 0x4a, 0xaf, 0x70, 0x5b, 0x9b, 0xb5, 0x74, 0xd7, 0x3d, 0x06, 0x23, 0xe7, 0xca, 
-0x0b, 0xdc, 0xa7, 0xf8, 0x06, 0x89, 0xb9, 0xa5, 0x16, 0x4d, 0xaf, 0x1f, 0xb6, 0x40, 0xe6, 0x0e, 
-0xad, 0x1a, 0xfc, 0x35, 0x7b, 0x99, 0x1e, 0x5c, 0xb2, 0x4b, 0xc5, 0xaa, 0x88, 0x1c, 0xce, 0xe5, 
-0x2c, 0xa4, 0xe1, 0x80, 0x10, 0x33, 0x6a, 0xc2, 0x3e, 0x20, 0x30, 0x57, 0xbf, 0x8c, 0x1c, 0x52, 
-0x36, 0xd1, 0x05, 0x5d, 0xd6, 0x6f, 0x26, 0xdf, 0xff, 0x5b, 0xb8, 0x4c, 0x3e, 0xd8, 0x96, 0x50, 
-0x82, 0xf3, 0x2d, 0xb9, 0xd5, 0x4d, 0xad, 0x38, 0xc1, 0x07, 0xa5, 0x24, 0xe6, 0x5c, 0x40, 0xc0, 
-0x52, 0x0c, 0xcf, 0x25, 0xe7, 0xc5, 0x4c, 0x6c, 0xb6, 0x5e, 0x76, 0x1a, 0x94, 0x56, 0xae, 0xe2, 
-0x70, 0x42, 0xcc, 0x9e, 0xd9, 0x02, 0x3b, 0x88, 0xe7, 0x7c, 0xaf, 0xf1, 0x3a, 0xc9, 0xeb, 0x1d, 
-0x9d, 0xf9, 0x81, 0x23, 0x66, 0x3a, 0xc4, 0x9b, 0x2f, 0xbe, 0x64, 0x08, 0x32, 0xdd, 0xb0, 0x7d, 
-0xc6, 0x34, 0x87, 0x09, 0xa6, 0x8f, 0x4d, 0x04, 0x58, 0x2d, 0xf2, 0x08, 0xcf, 0xb7, 0x8c, 0x2b, 
-0xe8, 0x01, 0xcc, 0x8b, 0x49, 0xc5, 0x05, 0x42, 0x22, 0xb0, 0x4d, 0x39, 0x8f, 0x75, 0x98, 0xc0, 
-0x24, 0x8a, 0x09, 0x96, 0x1e, 0x51, 0x0a, 0xdf, 0x22, 0xc4, 0xe7, 0x2e, 0xa9, 0x17, 0x9c, 0x0d, 
-0xd2, 0xb8, 0x15, 0xdc, 0x78, 0x98, 0xf9, 0x84, 0x70, 0xf3, 0x04, 0x99, 0x35, 0x12, 0xd9, 0xc1, 
-0x02, 0xfe, 0x52, 0xa4, 0x6d, 0xf7, 0x77, 0x87, 0x57, 0x90, 0x25, 0x73, 0x3c, 0x57, 0x20, 0xf2, 
-0x63, 0x99, 0xed, 0x2f, 0x8d, 0x65, 0x25, 0x56, 0xc2, 0x46, 0x8a, 0xa7, 0x52, 0xee, 0xd8, 0x31, 
-0x74, 0x96, 0x3d, 0xdc, 0x32, 0x9d, 0x7c, 0xae, 0x51, 0x00, 0x5e, 0xba, 0xce, 0xa1, 0xf9, 0x7e, 
-0x94, 0xf3, 0xd1, 0xa4, 0x0e, 0x39, 0xcb, 0x69, 0xf7, 0x4c, 0x9e, 0x17, 0x40, 0xbb, 0x08, 0x84, 
-0x3a, 0x6c, 0x04, 0xf0, 0x86, 0xc4, 0x6e, 0x21, 0xad, 0x9c, 0x71, 0x59, 0xfa, 0x84, 0x9a, 0x5f, 
-0x17, 0xdd, 0x82, 0x98, 0xce, 0x02, 0x8f, 0xf7, 0xd7, 0xaf, 0x75, 0x93, 0x62, 0xb3, 0x39, 0xff, 
-0xe0, 0x2d, 0xac, 0xf6, 0xda, 0x32, 0x21, 0xfd, 0xc2, 0x8a, 0x19, 0x28, 0xe9, 0x47, 0xb8, 0x2d, 
-0x54, 0xc6, 0x16, 0x6d, 0x9a, 0x7a, 0x53, 0x88, 0xd6, 0x13, 0x48, 0xaa, 0xe9, 0x09, 0xd6, 0x74, 
-0x12, 0xec, 0xa9, 0xff, 0x8a, 0x5a, 0x97, 0x29, 0xd6, 0x4f, 0xfb, 0x5c, 0xcb, 0x30, 0x80, 0xd4, 
-0xc3, 0x6b, 0xb3, 0x7c, 0x18, 0x62, 0x40, 0xdb, 0xad, 0x73, 0x3a, 0x17, 0xb0, 0x29, 0x71, 0xf6, 
-0xda, 0x85, 0xef, 0xc4, 0xe4, 0x59, 0x44, 0xaf, 0xed, 0x5f, 0x47, 0xb2, 0x7f, 0x66, 0x37, 0xb0, 
-0x85, 0x6d, 0x1a, 0x62, 0xd8, 0x3c, 0x5d, 0xf6, 0x22, 0x32, 0x8c, 0xec, 0x00, 0x66, 0x44, 0x12, 
-0x4e, 0xc3, 0x5d, 0x7b, 0xca, 0xf9, 0x89, 0x44, 0x28, 0x83, 0x32, 0xd0, 0x8e, 0xbc, 0x2e, 0x1b, 
-0xee, 0xb2, 0xc2, 0xe4, 0x9d, 0xd5, 0x7c, 0xc7, 0x09, 0x82, 0x57, 0xda, 0x02, 0xcb, 0xf3, 0x9d, 
-0x81, 0xd5, 0x62, 0x12, 0xcb, 0x06, 0x41, 0xa4, 0xfd, 0x0c, 0xe8, 0x6d, 0x04, 0x60, 0xfb, 0x3a, 
-0xc3, 0x94, 0xf5, 0x23, 0x42, 0x58, 0x17, 0x4b, 0xb8, 0x04, 0x75, 0x47, 0xfd, 0xb3, 0x80, 0x18, 
-0xac, 0x7f, 0xed, 0xb0, 0x89, 0xf4, 0xa7, 0x48, 0xcd, 0xac, 0x91, 0xdc, 0x77, 0x0a, 0xe4, 0x35, 
-0xcf, 0x0f, 0xe0, 0x3c, 0x02, 0x22, 0xe6, 0xd2, 0x46, 0xff, 0x68, 0x39, 0xf1, 0x78, 0x2d, 0x65, 
-0x16, 0x81, 0x44, 0xf4, 0x2f, 0x9e, 0x7b, 0x09, 0x97, 0x86, 0x3f, 0x02, 0x67, 0x7b, 0xb8, 0x11, 
-0x62, 0x35, 0xf4, 0xac, 0x57, 0x6d, 0x9a, 0xd2, 0x08, 0xa2, 0x42, 0x5e, 0x24, 0xe0, 0x0b, 0xad, 
-0xc1, 0x5b, 0x76, 0xcf, 0x95, 0x54, 0x85, 0xb0, 0xdf, 0x50, 0x7f, 0x3c, 0xc3, 0x16, 0xf4, 0x41, 
-0xa3, 0x0f, 0xbd, 0x25, 0x6b, 0xf4, 0x40, 0xab, 0x10, 0xe8, 0x3d, 0xa1, 0x51, 0xff, 0xc4, 0x81, 
-0x59, 0x21, 0x96, 0xfb, 0x54, 0xd3, 0x91, 0xa0, 0x31, 0x61, 0x16, 0x6d, 0xa0, 0x1d, 0xfa, 0x15, 
-0x78, 0xc8, 0xdc, 0x2e, 0xeb, 0x9e, 0xf6, 0x42, 0x58, 0xee, 0xa4, 0x49, 0xfd, 0x74, 0xb0, 0xc1, 
-0x7f, 0x4e, 0xa1, 0x58, 0x3a, 0xb2, 0xe2, 0xa9, 0x31, 0xd8, 0xa1, 0xeb, 0x1c, 0x53, 0xa7, 0x69, 
-0xe6, 0xb1, 0x98, 0x0d, 0x5b, 0x45, 0xad, 0xd3, 0x39, 0x4e, 0x0d, 0x61, 0x18, 0xae, 0x49, 0x2c, 
-0xde, 0x3c, 0xc3, 0x76, 0x4a, 0xa6, 0x39, 0x6f, 0x0a, 0x30, 0xe5, 0x73, 0xbb, 0x90, 0x67, 0xb6, 
-0x1b, 0x58, 0x85, 0xbb, 0x4e, 0xd3, 0x24, 0x6f, 0x85, 0x19, 0xd8, 0x77, 0xaf, 0x8c, 0xe4, 0x29, 
-0xa9, 0x62, 0xdc, 0x8a, 0x27, 0x5d, 0xe4, 0xaa, 0x2d, 0x67, 0x20, 0xd9, 0x51, 0x2b, 0x62, 0x97, 
-0xe6, 0x15, 0x30, 0x62, 0x24, 0xb1, 0x58, 0xef, 0x44, 0x8e, 0x63, 0xa4, 0xc8, 0x7b, 0x31, 0xb7, 
-0x8c, 0x29, 0xb1, 0x56, 0x1d, 0xbb, 0xdc, 0x9f, 0x39, 0xe6, 0xb9, 0x1c, 0xdc, 0x11, 0x56, 0xce, 
-0x1f, 0x50, 0xc9, 0x9f, 0xe4, 0x8c, 0x44, 0xa5, 0x51, 0xdc, 0x76, 0x92, 0x0e, 0x83, 0x1e, 0xfe, 
-0x75, 0x8d, 0xf5, 0xb5, 0xcf, 0x49, 0xfd, 0x65, 0x38, 0x03, 0xe2, 0x2c, 0xbc, 0x15, 0xfb, 0x46, 
-0x24, 0x6d, 0x0c, 0xd4, 0x49, 0x76, 0xb5, 0x67, 0xed, 0x73, 0x92, 0x47, 0x9c, 0xe5, 0x1d, 0x77, 
-0x9a, 0x5d, 0x1a, 0x8e, 0xe0, 0x32, 0xa6, 0x13, 0xf1, 0x47, 0xb9, 0xde, 0x83, 0x67, 0x0e, 0xbe, 
-0x4a, 0xaa, 0x00, 0xd3, 0x2e, 0x80, 0xcf, 0x38, 0xa2, 0x52, 0x0e, 0x6f, 0xbb, 0x13, 0x8d, 0xd5, 
-0x10, 0x96, 0x08, 0xcc, 0x89, 0x26, 0x04, 0x91, 0x68, 0xf1, 0xd6, 0xc3, 0x87, 0x1f, 0xcb, 0x77, 
-0x8d, 0x23, 0x68, 0x40, 0xbb, 0x2c, 0x95, 0x0b, 0x60, 0xc8, 0x20, 0xf1, 0xe0, 0x14, 0x66, 0x9e, 
-0x7f, 0x6d, 0xf4, 0x85, 0x36, 0xfc, 0x90, 0x6c, 0xb4, 0x9f, 0xfa, 0x19, 0xb9, 0x85, 0xde, 0x1d, 
-0xbe, 0xef, 0xaf, 0x23, 0x4c, 0xf6, 0x2c, 0x78, 0xd4, 0xc8, 0x29, 0xa7, 0xef, 0x91, 0x14, 0xb8, 
-0xec, 0x49, 0x32, 0x66, 0xc4, 0x06, 0xd2, 0x6e, 0xee, 0x37, 0x1a, 0x9f, 0xc4, 0x70, 0x00, 0x33, 
-0xcd, 0x97, 0x39, 0x72, 0xc8, 0x13, 0x7a, 0xc4, 0x21, 0x56, 0xf8, 0xbe, 0x48, 0x93, 0xa3, 0x13, 
-0xbb, 0x76, 0x28, 0xf0, 0xb0, 0x54, 0x6a, 0x10, 0xa3, 0x75, 0x09, 0xc7, 0x44, 0xa7, 0x86, 0x50, 
-0xc7, 0x05, 0x59, 0x6d, 0x8b, 0xc0, 0xf0, 0xab, 0x63, 0xec, 0xba, 0x16, 0x59, 0x29, 0xd2, 0xef, 
-0x99, 0x05, 0xba, 0x40, 0xd6, 0xec, 0xc0, 0x61, 0x4a, 0xdd, 0x33, 0x0d, 0x86, 0xa6, 0x2d, 0x7e, 
-0x97, 0xed, 0xa2, 0x42, 0x71, 0x63, 0x35, 0xa1, 0xcc, 0x92, 0xb9, 0x9d, 0x26, 0xe2, 0x01, 0x88, 
-0x37, 0x19, 0xd0, 0xb0, 0x06, 0xbf, 0x53, 0xdd, 0x29, 0xf9, 0xb8, 0xd1, 0x24, 0x76, 0x04, 0x90, 
-0x6a, 0xc8, 0xa2, 0x06, 0x33, 0xf0, 0x1f, 0x7c, 0xca, 0xff, 0x8e, 0x54, 0xe0, 0xb1, 0x66, 0x05, 
-0x88, 0xe4, 0x93, 0x3f, 0xcf, 0x25, 0x60, 0xc3, 0x2f, 0xb4, 0x7b, 0x37, 0xbd, 0x57, 0xe6, 0xcf, 
-0x3f, 0x1a, 0x0c, 0x6f, 0x2c, 0xf3, 0x5e, 0x08, 0xfc, 0xb7, 0x10, 0x87, 0xe1, 0x73, 0xd3, 0xf6, 
-0x7c, 0x3e, 0x4e, 0x71, 0x81, 0xc0, 0xfd, 0x04, 0xdd, 0x29, 0x97, 0xbb, 0xd0, 0x01, 0x5b, 0xe8, 
-0x23, 0x0d, 0x66, 0x93, 0x2b, 0x5e, 0xf7, 0x4f, 0x8e, 0x42, 0x5c, 0x98, 0xdf, 0x14, 0x86, 0xea, 
-0x47, 0x93, 0x64, 0x0f, 0x7d, 0x3c, 0xa1, 0xe1, 0x5a, 0xab, 0x9b, 0x13, 0xfb, 0x3b, 0x82, 0x97, 
-0xbf, 0x53, 0x7d, 0xea, 0x40, 0xd5, 0x50, 0x9c, 0xfe, 0x56, 0xbd, 0x01, 0xe9, 0x9d, 0xfb, 0x38, 
-0x70, 0x87, 0xa0, 0xcf, 0x39, 0xf3, 0x6a, 0x80, 0xcb, 0x50, 0xd8, 0x1b, 0x42, 0x92, 0xf8, 0xcd, 
-0x50, 0xef, 0xd6, 0x91, 0xe9, 0x70, 0x0b, 0x26, 0xfd, 0x92, 0xa8, 0xd3, 0x4a, 0x3b, 0x73, 0x2a, 
-0xd9, 0x7e, 0x34, 0x71, 0xfb, 0xc0, 0x0c, 0x6d, 0x82, 0x20, 0xca, 0x67, 0x29, 0x9f, 0x38, 0x11, 
-0xad, 0x22, 0xc1, 0xe9, 0x72, 0x13, 0xbc, 0xdc, 0x21, 0x4f, 0x8a, 0x1a, 0xd9, 0xab, 0xef, 0x02, 
-0x5d, 0xe8, 0x31, 0xf2, 0x63, 0xa6, 0x51, 0xc1, 0xda, 0x5e, 0x7b, 0xf1, 0x38, 0x86, 0x65, 0x92, 
-0xc8, 0x35, 0x81, 0x4a, 0x67, 0xbc, 0xec, 0x39, 0xd7, 0x2a, 0x78, 0x61, 0x43, 0xb4, 0xe5, 0x58, 
-0x3c, 0x19, 0x74, 0xbb, 0x40, 0x94, 0x4d, 0xf5, 0xba, 0x1e, 0x5c, 0xfe, 0x7c, 0xab, 0x49, 0x73, 
-0xfa, 0xe1, 0x67, 0x1e, 0xf1, 0xa2, 0x4b, 0x2d, 0xac, 0x98, 0xb7, 0x47, 0xdd, 0xa4, 0x4f, 0x97, 
-0x36, 0xe5, 0x57, 0xac, 0x01, 0x4c, 0x38, 0xae, 0x15, 0xdc, 0xb8, 0xa6, 0x34, 0x92, 0x54, 0x40, 
-0xab, 0xc8, 0x4a, 0x1f, 0x75, 0x42, 0xa6, 0xcb, 0x87, 0x52, 0xe2, 0x43, 0xd0, 0x07, 0xb0, 0x78, 
-0xcc, 0xa3, 0x00, 0x7f, 0x3b, 0xc4, 0x55, 0x9f, 0x03, 0x38, 0xf3, 0xdd, 0x49, 0xc5, 0x67, 0x0c, 
-0x29, 0xce, 0x7f, 0xdc, 0x4f, 0xa4, 0x5c, 0x21, 0x10, 0xce, 0xb3, 0x08, 0x94, 0x21, 0xf6, 0x7a, 
-0x0d, 0xa3, 0xe2, 0x8c, 0x45, 0x5b, 0xae, 0x07, 0xe0, 0xb7, 0x11, 0x7b, 0x00, 0xd7, 0x1d, 0x2f, 
-0xfe, 0x05, 0x9a, 0x83, 0xc0, 0x08, 0xe0, 0x37, 0x1f, 0x85, 0x62, 0x2f, 0x16, 0x5b, 0xe2, 0xb1, 
-0x63, 0x7b, 0x33, 0x22, 0xf9, 0xa2, 0x02, 0x8e, 0x44, 0x9a, 0x0a, 0x4b, 0xa9, 0x93, 0x3c, 0x5e, 
-0xe6, 0x32, 0xf8, 0x4f, 0x7d, 0xb2, 0x56, 0xce, 0x97, 0x81, 0x66, 0x4f, 0x9e, 0x59, 0x40, 0xcd, 
-0x6c, 0xb3, 0xfa, 0xc9, 0x7a, 0x27, 0x8e, 0xc2, 0x81, 0x1c, 0x54, 0x7a, 0x10, 0xce, 0x94, 0x1f, 
-0xe9, 0xab, 0x2b, 0x55, 0xd7, 0x13, 0xb2, 0x46, 0x00, 0x70, 0xaa, 0x0c, 0xe5, 0x9a, 0x57, 0xb2, 
-0x4d, 0xfa, 0x1c, 0x8b, 0xcf, 0xa7, 0x94, 0x6e, 0xd6, 0x9d, 0x2c, 0xf3, 0x21, 0x0d, 0xc6, 0x72, 
-0x2a, 0xd4, 0xa7, 0x33, 0x01, 0xea, 0x88, 0x1f, 0x9f, 0x52, 0x41, 0xd3, 0x95, 0x13, 0x81, 0xdc, 
-0x75, 0x5c, 0xff, 0x7b, 0x8f, 0x15, 0xbe, 0x6c, 0xd2, 0x46, 0x7a, 0xcc, 0xf2, 0x9e, 0xc1, 0x25, 
-0x90, 0x5b, 0x05, 0xed, 0x25, 0xd7, 0x19, 0x76, 0xeb, 0x10, 0x5d, 0xe3, 0xb3, 0xee, 0x16, 0x79, 
-0x37, 0xbc, 0xab, 0x6e, 0xeb, 0x9c, 0x14, 0x35, 0x68, 0x28, 0xff, 0xd2, 0xaa, 0x62, 0xdb, 0x21, 
-0xc0, 0xac, 0x74, 0x1e, 0xb1, 0x2d, 0xff, 0x77, 0x8e, 0x40, 0x08, 0x6b, 0xba, 0x2d, 0xe0, 0xf2, 
-0x48, 0x6c, 0xfb, 0x2e, 0x67, 0xac, 0xba, 0x11, 0x6e, 0x29, 0x7c, 0x1d, 0xb6, 0x2f, 0xd6, 0x91, 
-0x4f, 0x41, 0x64, 0xe8, 0x53, 0x89, 0xb5, 0x60, 0xaa, 0x3a, 0xe7, 0x68, 0x2d, 0x5c, 0xa0, 0x71, 
-0xbb, 0x40, 0xac, 0xc2, 0xf8, 0x9b, 0x3b, 0xd0, 0x47, 0xed, 0x10, 0xc3, 0x82, 0x67, 0xe9, 0xbd, 
-0x1a, 0xf5, 0xb4, 0xdc, 0x84, 0x1c, 0xcd, 0xb5, 0x49, 0xad, 0xa2, 0x16, 0xdf, 0x00, 0xf3, 0x6e, 
-0xe7, 0x3f, 0x07, 0xd4, 0xef, 0x1d, 0x8f, 0xf2, 0x0f, 0x5f, 0x3b, 0x07, 0x55, 0xe5, 0x49, 0x6a, 
-0x3c, 0xb1, 0xdb, 0x8d, 0x40, 0xfa, 0x32, 0x80, 0x45, 0x0b, 0x8e, 0xa0, 0x6f, 0xfe, 0x27, 0xeb, 
-0xd3, 0x58, 0xf5, 0x8a, 0x41, 0x17, 0xcb, 0x7f, 0x0a, 0x97, 0xc0, 0xe2, 0x11, 0x4f, 0x28, 0x07, 
-0xeb, 0xb0, 0x63, 0x83, 0xe5, 0x5b, 0x9c, 0xea, 0x46, 0x81, 0x68, 0x99, 0xc6, 0x56, 0xdc, 0x0d, 
-0xbe, 0x90, 0x03, 0xb0, 0x70, 0x5f, 0xba, 0x07, 0xec, 0x20, 0x34, 0xc7, 0x03, 0x3f, 0xea, 0x83, 
-0x27, 0xa6, 0x15, 0x91, 0x61, 0x1b, 0x6c, 0x85, 0xe8, 0xcf, 0x9c, 0x68, 0x48, 0xca, 0xb2, 0x63, 
-0x87, 0x35, 0xa2, 0x8c, 0x69, 0x2e, 0x96, 0x4a, 0xf7, 0xd9, 0x1d, 0x30, 0x81, 0xc5, 0x57, 0xd7, 
-0xe8, 0xb9, 0x19, 0x71, 0x30, 0x0d, 0xb4, 0x6d, 0xfb, 0x51, 0x8a, 0xd0, 0x59, 0x96, 0xd7, 0x50, 
-0xc0, 0xf3, 0xb0, 0xe7, 0x1b, 0x8f, 0x74, 0xad, 0x34, 0xa1, 0x8b, 0x58, 0xe6, 0x49, 0x87, 0x31, 
-0xc4, 0x4d, 0xd4, 0x64, 0xf0, 0x82, 0x6a, 0x25, 0xee, 0xc8, 0xab, 0x28, 0x99, 0xc1, 0xeb, 0x49, 
-0x94, 0x73, 0xc7, 0xb2, 0xf4, 0x7c, 0xca, 0x12, 0x98, 0xe6, 0x00, 0x79, 0x4c, 0x81, 0xbe, 0x1c, 
-0x72, 0x99, 0xb3, 0xdf, 0x5b, 0x14, 0xae, 0x4f, 0xca, 0x5c, 0x26, 0x66, 0xf1, 0x2f, 0x76, 0xd9, 
-0x12, 0x88, 0x72, 0xc2, 0x94, 0x44, 0x8c, 0x1a, 0x2c, 0xb9, 0xa8, 0x8b, 0x35, 0xc3, 0xab, 0x7b, 
-0x30, 0xa4, 0x85, 0xc1, 0x9b, 0xb4, 0x0f, 0xd5, 0xfd, 0xa2, 0x07, 0xc5, 0x6f, 0xae, 0x5b, 0xbd, 
-0x6c, 0xf7, 0xca, 0x1d, 0x3f, 0xc3, 0x7a, 0xa5, 0x96, 0x16, 0xbe, 0xd9, 0x2f, 0x61, 0xf6, 0x25, 
-0xa7, 0x6c, 0x5a, 0x3a, 0xf2, 0x7e, 0xc7, 0x37, 0x89, 0x14, 0x46, 0xcb, 0xa6, 0x7a, 0x16, 0x34, 
-0xad, 0x0b, 0xf0, 0x1a, 0x42, 0xb1, 0x6d, 0x39, 0xf3, 0x29, 0x7f, 0xea, 0x30, 0xfb, 0x3c, 0x8d, 
-0xc4, 0x52, 0x9d, 0xe2, 0x63, 0xcf, 0xb0, 0x1c, 0xf7, 0x64, 0xbd, 0x3c, 0x2e, 0xd8, 0xff, 0x41, 
-0x50, 0x30, 0x78, 0x12, 0x8b, 0xf9, 0x9a, 0x28, 0xbe, 0xf4, 0xd1, 0x06, 0x54, 0xdc, 0xc5, 0x0b, 
-0x63, 0x9b, 0x03, 0x8f, 0xfc, 0x49, 0x21, 0x7d, 0x95, 0x44, 0x87, 0x53, 0xf3, 0x91, 0x7c, 0x40, 
-0x99, 0x0a, 0x32, 0xe9, 0x15, 0x81, 0x01, 0xa6, 0x1e, 0x36, 0x5f, 0x87, 0x45, 0xcb, 0x01, 0xd6, 
-0x81, 0x0c, 0xc9, 0x18, 0xd9, 0x75, 0x09, 0xc8, 0x99, 0xf8, 0xa9, 0x10, 0x3d, 0xce, 0x0b, 0xa2, 
-0x77, 0x1a, 0x34, 0xd3, 0x6c, 0x3e, 0x0c, 0x26, 0xe1, 0x15, 0x56, 0x0b, 0x47, 0x22, 0xaa, 0x4d, 
-0xf7, 0x5a, 0x23, 0xdc, 0xa4, 0x0f, 0x2a, 0x8d, 0xdb, 0x03, 0x52, 0x3f, 0x90, 0x2b, 0xd3, 0x36, 
-0x77, 0x88, 0xa4, 0x3d, 0xc2, 0x54, 0x03, 0x9d, 0xff, 0x28, 0x58, 0xed, 0x35, 0x60, 0xc7, 0x79, 
-0xda, 0x5b, 0xf7, 0x25, 0x77, 0x63, 0x01, 0x4a, 0xe2, 0xd3, 0x20, 0x6f, 0xf6, 0x34, 0x94, 0x1f, 
-0x76, 0x2c, 0x4c, 0xee, 0x17, 0x28, 0xe5, 0x05, 0x99, 0x4f, 0xb7, 0xe1, 0x5f, 0x8b, 0x08, 0x51, 
-0x3c, 0x69, 0x24, 0x9f, 0x79, 0xaf, 0x8d, 0xe0, 0x44, 0xd4, 0x2d, 0xb8, 0x71, 0x9e, 0x63, 0xf8, 
-0xbc, 0x55, 0xdb, 0x03, 0x38, 0xb7, 0xd9, 0x89, 0xcc, 0x51, 0xb9, 0xe0, 0x8e, 0x2c, 0xcd, 0xa5, 
-0x64, 0xd8, 0x57, 0xc4, 0x49, 0xa8, 0x23, 0xd6, 0x69, 0x0e, 0x84, 0xab, 0x4b, 0x77, 0x31, 0x58, 
-0x9c, 0x05, 0xe0, 0xed, 0x53, 0x7f, 0xb0, 0x08, 0xba, 0xa5, 0xf5, 0xc2, 0x37, 0x58, 0x00, 0xde, 
-0x4f, 0x1d, 0x7a, 0x3e, 0xff, 0x22, 0x80, 0xaf, 0xd0, 0x57, 0x76, 0x3e, 0xbf, 0x65, 0xa1, 0xf1, 
-0x0a, 0x5f, 0xa7, 0xe1, 0xc6, 0x49, 0xed, 0x2a, 0xde, 0x5f, 0xc4, 0xa1, 0x6a, 0xbb, 0x44, 0xeb, 
-0x71, 0x99, 0xd4, 0x28, 0xfc, 0x9d, 0x65, 0x53, 0xb7, 0xe3, 0x41, 0x99, 0xbe, 0x39, 0xfa, 0x59, 
-0x19, 0x33, 0x8f, 0x55, 0xc2, 0x96, 0xf8, 0x59, 0xbf, 0x8d, 0xf4, 0x82, 0x14, 0xfa, 0x78, 0xa1, 
-0xcd, 0x85, 0x32, 0x91, 0xd2, 0xea, 0x87, 0x30, 0x6d, 0xd0, 0x92, 0x35, 0x66, 0xca, 0xf0, 0xad, 
-0x5e, 0x31, 0xcd, 0xf6, 0x79, 0x9e, 0xe3, 0x6b, 0xfa, 0x05, 0xd6, 0x13, 0x99, 0xe4, 0x80, 0x62, 
-0xc6, 0x41, 0x09, 0xd6, 0xb7, 0x22, 0xfc, 0xa3, 0x4a, 0x9b, 0x14, 0xc9, 0x44, 0xd8, 0xff, 0x95, 
-0xb9, 0x58, 0xeb, 0x43, 0x14, 0x61, 0xcb, 0x51, 0x89, 0xc0, 0x67, 0x98, 0xd8, 0x83, 0xa1, 0xcd, 
-0x39, 0x78, 0x2d, 0x0f, 0xac, 0xe8, 0x30, 0xb9, 0xde, 0x85, 0xf1, 0x46, 0xc7, 0x03, 0x38, 0x71, 
-0x0e, 0xec, 0x89, 0xac, 0x01, 0x21, 0xd2, 0x43, 0xa3, 0x75, 0x95, 0xfc, 0x6c, 0x4f, 0x23, 0x63, 
-0xf8, 0x70, 0x27, 0x5e, 0x78, 0xfa, 0x11, 0x84, 0x45, 0xb6, 0x13, 0x98, 0x09, 0xe1, 0x7a, 0xa0, 
-0x43, 0xb4, 0xf8, 0x27, 0x18, 0xf2, 0x8e, 0xba, 0xd4, 0x71, 0x85, 0xab, 0x0d, 0x99, 0xc9, 0x72, 
-0x19, 0x60, 0x22, 0xdd, 0xac, 0x70, 0x82, 0x42, 0xa7, 0x6b, 0x95, 0xb2, 0xc1, 0xa1, 0x6e, 0x34, 
-0xf1, 0x25, 0xe7, 0xa8, 0xd5, 0x0e, 0xb2, 0x3a, 0xdd, 0xc0, 0x2c, 0x04, 0x9c, 0x1e, 0xbb, 0x11, 
-0xcd, 0x80, 0x46, 0x25, 0xf9, 0x38, 0xdb, 0x63, 0xc8, 0x0a, 0x55, 0x7b, 0x10, 0xc3, 0x3c, 0x1d, 
-0xf7, 0x29, 0x7a, 0x64, 0x23, 0xa7, 0x8d, 0xb3, 0x83, 0x03, 0xe6, 0x78, 0xb1, 0x16, 0x31, 0x45, 
-0xdf, 0x06, 0x50, 0x9e, 0x5c, 0xaf, 0xda, 0x4f, 0x62, 0xb6, 0xfb, 0xa4, 0x66, 0x16, 0xdb, 0xb4, 
-0x0c, 0x45, 0x75, 0xb8, 0xfb, 0x56, 0x3f, 0x6d, 0xe8, 0x85, 0xa3, 0x21, 0xb9, 0x08, 0x46, 0x1f, 
-0x96, 0xb6, 0x4b, 0xed, 0x6e, 0x20, 0xaf, 0x32, 0xe0, 0x8c, 0x6c, 0x9b, 0x7f, 0x10, 0xaf, 0x34, 
-0x04, 0x6a, 0x7f, 0xe4, 0x55, 0xb3, 0x1b, 0x6e, 0x2a, 0x0d, 0x8c, 0xae, 0xdc, 0x7f, 0xa6, 0xf1, 
-0xe2, 0x0e, 0x37, 0xb7, 0x54, 0x44, 0x61, 0x14, 0xed, 0xd9, 0x66, 0x82, 0x47, 0xd1, 0x6d, 0xf8, 
-0x0d, 0xab, 0x5c, 0x1b, 0xe9, 0x51, 0xd1, 0xa1, 0xbe, 0x55, 0x18, 0xfb, 0x4c, 0xdd, 0x83, 0x0d, 
-0x30, 0x1d, 0xc4, 0x2a, 0x8c, 0xed, 0xc1, 0x06, 0x93, 0x3b, 0xa2, 0xc5, 0x04, 0x4e, 0x9b, 0xe9, 
-0x1b, 0x77, 0xe4, 0x69, 0x88, 0xcc, 0x51, 0x16, 0xee, 0x2f, 0xcc, 0x6d, 0x98, 0xd9, 0x3a, 0x11, 
-0x4e, 0x2c, 0x41, 0xc6, 0x23, 0x66, 0x36, 0xd6, 0xe6, 0x96, 0x7f, 0x45, 0x0b, 0xd0, 0xec, 0x17, 
-0xc8, 0xe5, 0x30, 0x0f, 0x60, 0x4c, 0x17, 0x8e, 0x44, 0xb7, 0x85, 0x18, 0x53, 0x2d, 0x73, 0x8b, 
-0x1b, 0x6d, 0xd2, 0x3d, 0x75, 0x5b, 0x8b, 0x69, 0xa4, 0xf2, 0xb0, 0x75, 0x8b, 0x0f, 0xac, 0x29, 
-0x84, 0xa3, 0xee, 0xb6, 0x4d, 0xaa, 0xe9, 0x72, 0x93, 0x5b, 0xac, 0xf2, 0x03, 0x50, 0xd5, 0x2b, 
-0xac, 0xda, 0x6a, 0x26, 0x4b, 0xd9, 0x72, 0xb8, 0x65, 0xaa, 0x3c, 0xe6, 0xc8, 0x2c, 0x8d, 0x07, 
-0xee, 0x1b, 0x42, 0xc1, 0x77, 0x3a, 0x97, 0x5f, 0xc4, 0xed, 0xa8, 0x07, 0x87, 0x1e, 0x9e, 0x09, 
-0xbd, 0x4a, 0x13, 0x70, 0x60, 0xef, 0xc3, 0xaa, 0x58, 0x30, 0x7b, 0xbd, 0x8b, 0x43, 0xf3, 0x4f, 
-0xb9, 0x1c, 0xaa, 0x4b, 0xe8, 0x67, 0x53, 0xd1, 0xef, 0xc1, 0x3a, 0x92, 0x09, 0xa2, 0x86, 0x3e, 
-0xcf, 0x9f, 0x77, 0x4f, 0x26, 0xba, 0x00, 0x3e, 0x5c, 0xad, 0xd2, 0x7c, 0x20, 0xff, 0xc0, 0x88, 
-0xa9, 0x21, 0x95, 0xfa, 0x9e, 0x1c, 0x59, 0x90, 0x28, 0xcb, 0x73, 0x98, 0xb8, 0x66, 0xfe, 0x1f, 
-0x95, 0x7b, 0x67, 0x3d, 0xc2, 0x96, 0x58, 0xb3, 0xe0, 0xeb, 0x60, 0xaf, 0x0f, 0xa0, 0x44, 0xdf, 
-0xaa, 0x14, 0xea, 0x81, 0xda, 0x37, 0xbe, 0x5c, 0xd0, 0x35, 0xab, 0x21, 0xf4, 0x2d, 0x60, 0xc0, 
-0x92, 0x7d, 0x55, 0x07, 0xbf, 0x5d, 0x80, 0xe7, 0xa9, 0xfd, 0x92, 0x5a, 0xdc, 0xf8, 0x4a, 0x8d, 
-0x2b, 0x55, 0xf1, 0xbd, 0x65, 0x9d, 0x2a, 0xb5, 0x8a, 0x59, 0xf6, 0xd4, 0x83, 0xe1, 0xec, 0xc9, 
-0xa3, 0x0d, 0x68, 0xde, 0x95, 0xeb, 0xc8, 0xf7, 0x4a, 0xad, 0x81, 0xfb, 0xe7, 0xb1, 0xd6, 0x36, 
-0x54, 0x1c, 0x04, 0xe0, 0x53, 0xcb, 0x94, 0x4a, 0xf7, 0x17, 0x33, 0xdf, 0x67, 0x8b, 0x30, 0xcc, 
-0x11, 0x4a, 0xde, 0xc6, 0x83, 0xeb, 0x73, 0x0f, 0x5c, 0x44, 0xc5, 0xfe, 0xa5, 0x89, 0xeb, 0x20, 
-0x80, 0xd0, 0x11, 0x74, 0x1e, 0x46, 0xbe, 0x37, 0x80, 0x70, 0x26, 0xde, 0x03, 0x53, 0xf8, 0x25, 
-0x7e, 0x1a, 0xe0, 0x2e, 0x4b, 0xe5, 0xd0, 0x7d, 0x27, 0xff, 0xc8, 0xdb, 0x38, 0x8c, 0x7e, 0x12, 
-0xcb, 0xe1, 0x24, 0x5e, 0x07, 0xcd, 0xa2, 0x0e, 0x79, 0xd1, 0xf6, 0x38, 0x28, 0xdc, 0x96, 0x73, 
-0x8a, 0x1d, 0xb5, 0xf8, 0x67, 0x31, 0xea, 0xbf, 0x60, 0xf7, 0x36, 0xc6, 0xf3, 0x6a, 0x30, 0x9d, 
-0x72, 0x17, 0xf3, 0x8e, 0x03, 0xdf, 0x31, 0x70, 0x41, 0x58, 0xc5, 0x01, 0x34, 0xb4, 0xc4, 0x7d, 
-0x4c, 0xdb, 0x34, 0x0f, 0x7e, 0x2b, 0x87, 0x49, 0x33, 0xe0, 0xca, 0xa4, 0x29, 0x76, 0xf6, 0x69, 
-0x8b, 0x4c, 0x7d, 0x3b, 0xd2, 0x56, 0x80, 0x2f, 0x77, 0xd0, 0x49, 0x20, 0x91, 0xb0, 0x6e, 0x27, 
-0x8c, 0xff, 0x54, 0x41, 0xbb, 0xa2, 0x73, 0x01, 0xde, 0x3b, 0xa9, 0xe9, 0x45, 0xa3, 0x0a, 0xc5, 
-0x66, 0x1e, 0x7a, 0xbb, 0x13, 0xa4, 0x7c, 0x05, 0xc3, 0xa9, 0x14, 0x32, 0x8c, 0x50, 0xfa, 0x3b, 
-0x75, 0x09, 0x48, 0x25, 0x92, 0x39, 0x01, 0x74, 0x5d, 0xfd, 0x32, 0xc1, 0x43, 0x7b, 0x01, 0x59, 
-0x9d, 0x24, 0x62, 0x13, 0x4e, 0x2d, 0x09, 0xe4, 0x93, 0x3f, 0xbf, 0x9c, 0x62, 0x1f, 0xe7, 0x76, 
-0x5c, 0xc0, 0x42, 0x96, 0x21, 0x05, 0xd9, 0x80, 0xa4, 0xbc, 0x36, 0x1b, 0x69, 0x3f, 0xa2, 0xe1, 
-0x8d, 0x1b, 0x97, 0x0f, 0x5f, 0x3a, 0x01, 0x9c, 0xf9, 0x2b, 0x93, 0xb4, 0xf0, 0x68, 0x9a, 0xd6, 
-0xaa, 0xe6, 0x5c, 0x9c, 0x83, 0xb1, 0xc9, 0x41, 0xa1, 0x8d, 0x57, 0xc0, 0x96, 0x73, 0xb1, 0x39, 
-0x8f, 0x5a, 0xab, 0x95, 0x2a, 0x50, 0xe6, 0x66, 0x40, 0x90, 0xfd, 0xac, 0x37, 0xdb, 0x69, 0x2b, 
-0x94, 0x5a, 0x02, 0xc8, 0x86, 0xbd, 0x0a, 0x42, 0x2c, 0xdf, 0x50, 0xa9, 0x23, 0xd9, 0x7c, 0x4b, 
-0x05, 0xdf, 0x1d, 0x91, 0x0b, 0xd4, 0x86, 0xe9, 0xc5, 0x4a, 0x2b, 0xa3, 0x69, 0xb3, 0x94, 0x0a, 
-0xf2, 0xb0, 0xd6, 0x50, 0x73, 0xec, 0x3e, 0x07, 0x9b, 0xf6, 0xb2, 0x41, 0xe0, 0xc4, 0xa8, 0x13, 
-0xef, 0xb1, 0x0a, 0x8c, 0xe7, 0x06, 0x37, 0x17, 0xcc, 0xa7, 0x04, 0xf4, 0x6f, 0xba, 0x1d, 0xfb, 
-0x5c, 0xb4, 0x6a, 0xf6, 0x57, 0x10, 0xf1, 0xa6, 0x05, 0xc4, 0x97, 0x7f, 0x0b, 0xd3, 0x4a, 0xfa, 
-0x20, 0x63, 0xd4, 0x8a, 0x23, 0xf4, 0x75, 0x2a, 0x99, 0xd2, 0x00, 0xe8, 0x6c, 0x3d, 0xb4, 0xef, 
-0x61, 0x42, 0xd1, 0x77, 0xae, 0xd8, 0x12, 0x62, 0x9a, 0xbc, 0xa4, 0xc7, 0x66, 0xab, 0xbb, 0x2a, 
-0xd9, 0x4c, 0x82, 0x9e, 0x22, 0x61, 0xb9, 0x35, 0xe3, 0xce, 0xbb, 0x99, 0x86, 0xc9, 0xa8, 0x7c, 
-0xfd, 0x6e, 0xd2, 0x30, 0xf0, 0xb8, 0x3c, 0x03, 0xaf, 0xd3, 0x7f, 0x6f, 0xbd, 0xed, 0x44, 0x5e, 
-0xff, 0x08, 0x8a, 0x9b, 0x28, 0xce, 0x5b, 0x8a, 0xee, 0xb9, 0x36, 0x7e, 0xd0, 0xb5, 0x52, 0xc6, 
-0x43, 0x5e, 0xde, 0x52, 0x85, 0x02, 0xff, 0x54, 0x0f, 0xbb, 0x49, 0xd1, 0x2f, 0xe4, 0x14, 0x70, 
-0xf0, 0x37, 0x69, 0xd6, 0x13, 0x61, 0xf3, 0x0d, 0xe0, 0x69, 0x42, 0x01, 0xf5, 0xb3, 0x0a, 0xd4, 
-0xa3, 0x16, 0x6b, 0xc4, 0x9a, 0x55, 0x82, 0xf9, 0xe3, 0x3f, 0x73, 0xa1, 0x60, 0x19, 0xfa, 0xa7, 
-0xc9, 0x62, 0x11, 0x77, 0x43, 0xc5, 0x16, 0x9a, 0xab, 0x6f, 0xb6, 0x5b, 0xa4, 0x43, 0x55, 0x20, 
-0x93, 0xda, 0x78, 0x3d, 0x58, 0xd0, 0x4c, 0xe3, 0x29, 0x7b, 0x18, 0x8d, 0xde, 0x60, 0xa7, 0xd2, 
-0x19, 0x69, 0x58, 0x8c, 0xf3, 0x06, 0x53, 0xd4, 0x6f, 0x58, 0x22, 0x62, 0x48, 0xd0, 0xb8, 0x99, 
-0x41, 0x27, 0xda, 0x91, 0x13, 0xe7, 0x98, 0xc8, 0x3f, 0x09, 0x9a, 0x2c, 0xc3, 0x41, 0xd4, 0x7b, 
-0x4a, 0x17, 0xdb, 0x67, 0xef, 0x37, 0xae, 0x85, 0x9b, 0xb8, 0x15, 0x6f, 0x35, 0xb5, 0x54, 0xdd, 
-0x46, 0xb1, 0x33, 0x4f, 0x9d, 0x28, 0xce, 0x1a, 0x86, 0x99, 0xfd, 0x07, 0xe6, 0x22, 0x80, 0xc9, 
-0xe3, 0x33, 0xee, 0x1b, 0x7c, 0xf9, 0x55, 0x98, 0x19, 0xcf, 0xb0, 0x0a, 0xf5, 0xd4, 0xa9, 0x16, 
-0x8e, 0x41, 0x08, 0xef, 0x6d, 0x1f, 0x46, 0x5f, 0xb6, 0x27, 0x86, 0x4d, 0x14, 0x6b, 0xa0, 0x87, 
-0xdd, 0x2c, 0x0c, 0xfa, 0x51, 0xae, 0x9d, 0x26, 0x6e, 0xd3, 0x56, 0xb7, 0xf5, 0xac, 0x07, 0xfb, 
-0xe1, 0x4d, 0xa0, 0xf1, 0x22, 0x6c, 0xe6, 0x8f, 0x79, 0x0a, 0xc1, 0x36, 0xa7, 0xcd, 0x29, 0x7a, 
-0x92, 0x19, 0xf5, 0x8b, 0x0d, 0x63, 0xa6, 0x4d, 0xd3, 0x01, 0xb3, 0xfc, 0x42, 0x23, 0xc2, 0x4f, 
-0xa3, 0x1a, 0xd4, 0x80, 0xc1, 0x9c, 0x75, 0x33, 0xf3, 0x83, 0x4b, 0x0b, 0xea, 0x1e, 0xbc, 0x14, 
-0xae, 0xc1, 0x21, 0xf1, 0x49, 0xb3, 0x7b, 0x58, 0xea, 0x83, 0x97, 0xd1, 0xee, 0x8e, 0x5d, 0xfb, 
-0x27, 0x88, 0x3c, 0xeb, 0x7b, 0xc0, 0xfd, 0xb0, 0x06, 0x61, 0xb8, 0xf7, 0xc6, 0x0e, 0x7f, 0x9d, 
-0x5c, 0xbd, 0x3c, 0xa2, 0x11, 0x26, 0xfd, 0x88, 0x30, 0xbe, 0xa5, 0x23, 0x75, 0x62, 0x9c, 0xba, 
-0x3c, 0x93, 0xd8, 0xf7, 0x84, 0xa6, 0x54, 0xf2, 0xc1, 0x74, 0x5c, 0xb4, 0x47, 0x29, 0x67, 0x89, 
-0x17, 0xd7, 0x83, 0xe2, 0xa2, 0x63, 0x88, 0x32, 0xe5, 0x5d, 0xb3, 0x29, 0x8f, 0x11, 0x58, 0xe7, 
-0x2d, 0xc9, 0x4e, 0xfe, 0x95, 0xcf, 0x18, 0x87, 0xed, 0x5f, 0x8e, 0xf6, 0x81, 0xe2, 0x57, 0x73, 
-0xdc, 0x24, 0x6c, 0x39, 0xbf, 0x47, 0xa6, 0x56, 0x02, 0x87, 0x6e, 0x4f, 0x0d, 0xdc, 0x41, 0x89, 
-0xea, 0x79, 0x3c, 0x6b, 0xe4, 0x86, 0x4d, 0x71, 0xf9, 0x7c, 0x54, 0x33, 0xda, 0xc0, 0xea, 0x14, 
-0x9b, 0x07, 0xdf, 0xac, 0x7d, 0xd0, 0xfe, 0x23, 0x49, 0x64, 0x9a, 0xca, 0x15, 0x34, 0x78, 0xc5, 
-0x1a, 0x40, 0xea, 0x76, 0x49, 0x16, 0x7c, 0x3b, 0x24, 0x64, 0x75, 0x0b, 0xdc, 0xab, 0x30, 0x17, 
-0xd6, 0xaf, 0x6d, 0x1c, 0xea, 0x43, 0x62, 0xc3, 0x34, 0x6a, 0x3e, 0xb4, 0x75, 0xfd, 0x90, 0x20, 
-0xbe, 0x81, 0x29, 0x9c, 0x86, 0xa9, 0x7a, 0x2f, 0xec, 0xb9, 0x71, 0x24, 0x57, 0x44, 0x1d, 0x5f, 
-0xbb, 0x27, 0xce, 0x75, 0x41, 0x92, 0x33, 0x63, 0x4c, 0x89, 0xd9, 0x30, 0x92, 0xe0, 0x3a, 0x24, 
-0x9f, 0x01, 0x37, 0xb8, 0x6c, 0x0b, 0x34, 0xba, 0xd0, 0x52, 0x0e, 0xda, 0x2b, 0x12, 0x70, 0x37, 
-0xe4, 0x82, 0x15, 0x23, 0xeb, 0x36, 0xac, 0x1d, 0xfb, 0x6a, 0xce, 0xe8, 0x80, 0xb8, 0x45, 0x70, 
-0x51, 0xe5, 0x0b, 0xd9, 0xcb, 0x36, 0x1b, 0xfa, 0x79, 0x2c, 0xbe, 0x0f, 0x72, 0x2f, 0x1e, 0x66, 
-0x0b, 0x85, 0xff, 0x34, 0xa1, 0xd0, 0x51, 0xae, 0xef, 0xbe, 0x4d, 0x70, 0x03, 0x1c, 0xec, 0xba, 
-0x9e, 0x73, 0x3c, 0xca, 0xe2, 0x78, 0xc1, 0x6a, 0x41, 0x0e, 0x7f, 0xe0, 0x03, 0x62, 0xa2, 0x3b, 
-0x0d, 0x71, 0xcb, 0x15, 0xc1, 0x0b, 0xaa, 0x34, 0xb9, 0x4d, 0xa3, 0x5b, 0x90, 0x72, 0xf2, 0x2b, 
-0xd5, 0x42, 0xb0, 0xcf, 0x9f, 0x2e, 0xb3, 0x08, 0x61, 0x25, 0xc6, 0x57, 0x13, 0x2e, 0x98, 0xc4, 
-0x28, 0xd5, 0xb1, 0x61, 0x8f, 0x9f, 0x3a, 0x76, 0xca, 0x58, 0xf3, 0x40, 0x96, 0x0c, 0x56, 0xc5, 
-0xe5, 0xa8, 0x3a, 0x86, 0x5a, 0xe3, 0x8e, 0xf4, 0xb2, 0x98, 0x2d, 0x65, 0xe3, 0x92, 0xc5, 0x54, 
-0xa5, 0xcf, 0xbf, 0x41, 0x89, 0x5b, 0x49, 0xfc, 0x9f, 0x26, 0xf3, 0x95, 0x7c, 0x10, 0xa0, 0xdc, 
-0xe9, 0xa7, 0xcb, 0x23, 0x51, 0xc5, 0x34, 0xdd, 0x5d, 0x74, 0xe9, 0x52, 0x09, 0xda, 0xcb, 0x5b, 
-0x97, 0x89, 0x36, 0xfa, 0xc9, 0xe8, 0x8f, 0xab, 0xe0, 0x54, 0xa0, 0xf1, 0xb1, 0xe4, 0x7d, 0xd4, 
-0x06, 0x9d, 0x68, 0x0c, 0xcc, 0x6f, 0x13, 0xd3, 0xbe, 0x48, 0xfe, 0x1e, 0x53, 0xa6, 0xe3, 0x45, 
-0x78, 0xf1, 0x99, 0x65, 0xcb, 0x8a, 0x9e, 0x48, 0xcd, 0xa8, 0x52, 0x9a, 0x8a, 0x71, 0x45, 0xd7, 
-0x8e, 0x05, 0x4b, 0x32, 0x65, 0x98, 0x03, 0xc9, 0xf0, 0x7b, 0x3f, 0x94, 0x4c, 0xe8, 0xad, 0x8a, 
-0x00, 0xe3, 0xa0, 0x40, 0xb0, 0xed, 0xd4, 0x92, 0xe2, 0x4e, 0x1c, 0xc3, 0x7b, 0xde, 0x00, 0x39, 
-0x76, 0x22, 0x32, 0xfd, 0xb4, 0xcd, 0x51, 0x25, 0x0f, 0xf9, 0xa9, 0x50, 0x1b, 0xa0, 0x24, 0x94, 
-0xf1, 0xb1, 0x5b, 0xa6, 0x44, 0xc3, 0x79, 0xf8, 0xba, 0x23, 0xa8, 0x40, 0x64, 0x94, 0x46, 0xf5, 
-0x02, 0xc9, 0xed, 0x18, 0xde, 0x0e, 0xb6, 0x97, 0x64, 0xfe, 0x24, 0x90, 0x5e, 0xf3, 0x70, 0xc0, 
-0x9c, 0xf8, 0x8e, 0xa6, 0xb7, 0x42, 0xec, 0x05, 0x67, 0xa2, 0x10, 0xf3, 0x26, 0x00, 0x52, 0xf8, 
-0x8c, 0x32, 0xc2, 0x1f, 0x61, 0xbb, 0x36, 0x8f, 0x72, 0x19, 0xf0, 0xb5, 0xd6, 0x00, 0x48, 0x60, 
-0x0e, 0xdc, 0x87, 0x04, 0xbc, 0x21, 0xd8, 0xf1, 0x30, 0x06, 0x55, 0xf7, 0x9a, 0xc3, 0x10, 0x84, 
-0x63, 0x3f, 0x4f, 0xe1, 0xb9, 0x56, 0x89, 0x20, 0x4c, 0x08, 0x7f, 0xed, 0x9f, 0x04, 0x45, 0xae, 
-0x97, 0x0e, 0xc7, 0x3b, 0x67, 0xf7, 0x1b, 0x46, 0x05, 0xd8, 0x14, 0xa0, 0x67, 0x0c, 0xd6, 0x7c, 
-0x3c, 0x02, 0x8a, 0x14, 0x2a, 0x5a, 0xc5, 0xa6, 0xfe, 0x3b, 0xeb, 0x81, 0xa8, 0x53, 0xf7, 0x8c, 
-0x64, 0x75, 0xab, 0xd9, 0x2c, 0x7f, 0x96, 0x63, 0x02, 0x21, 0xbe, 0x42, 0xae, 0x1d, 0x5b, 0xf2, 
-0x0e, 0x6b, 0xd8, 0x30, 0xbf, 0x60, 0xe5, 0xb5, 0x2d, 0x78, 0xf1, 0xaa, 0xc3, 0x55, 0xdc, 0x1e, 
-0xac, 0x9d, 0x15, 0xb8, 0x83, 0x28, 0x6c, 0x46, 0xce, 0x51, 0x67, 0xc8, 0x17, 0x5c, 0x7c, 0x3a, 
-0xac, 0x9d, 0xec, 0x10, 0x6c, 0x8e, 0xe9, 0x60, 0x97, 0xa6, 0x5a, 0x8f, 0x3e, 0x7a, 0x95, 0x6b, 
-0xd6, 0x8c, 0x00, 0x81, 0xf4, 0x44, 0xd0, 0x05, 0xd9, 0x73, 0x32, 0x8c, 0x20, 0xe5, 0x2d, 0x93, 
-0xd5, 0x56, 0xdf, 0x2f, 0x78, 0xea, 0xd3, 0x5f, 0x89, 0x79, 0xb0, 0x2f, 0xcf, 0x85, 0x3b, 0x1c, 
-0xc2, 0x79, 0x12, 0xe1, 0x3a, 0x82, 0x1f, 0xd5, 0x47, 0x35, 0x02, 0xdf, 0x73, 0xd2, 0x5d, 0xad, 
-0x3b, 0x89, 0xde, 0x47, 0xb8, 0x81, 0xaa, 0xd2, 0x18, 0x68, 0xa0, 0x78, 0xd9, 0xec, 0x29, 0xb2, 
-0x08, 0x50, 0x7b, 0x22, 0x6c, 0xa4, 0x2b, 0xcf, 0x7f, 0x50, 0xab, 0x39, 0x9f, 0x5c, 0x44, 0x2e, 
-0xd5, 0x8f, 0xaf, 0x1b, 0x29, 0x71, 0xe9, 0xce, 0xb6, 0x77, 0xc8, 0x04, 0x2c, 0xd4, 0xf4, 0x71, 
-0xb8, 0x99, 0x5a, 0xd8, 0x65, 0x87, 0xe5, 0x1a, 0xf2, 0x2f, 0xa5, 0xe0, 0xb9, 0x8e, 0x72, 0xb4, 
-0xf3, 0x62, 0x3f, 0xad, 0x85, 0x2e, 0x4b, 0x19, 0xf9, 0xc6, 0x60, 0xd7, 0x70, 0x48, 0x0f, 0x24, 
-0x75, 0x55, 0x18, 0xbb, 0x28, 0x44, 0xb0, 0x09, 0x30, 0xe5, 0x5b, 0x88, 0xc3, 0xf5, 0x1a, 0xca, 
-0xab, 0xe5, 0x81, 0x31, 0xf7, 0xde, 0x76, 0xbb, 0x26, 0x8d, 0x41, 0xfe, 0x01, 0x19, 0x9f, 0x55, 
-0x10, 0xcb, 0x93, 0x20, 0x0e, 0xf7, 0x8a, 0x38, 0x5e, 0x2b, 0x68, 0xfe, 0x57, 0xc4, 0x0e, 0xf2, 
-0x99, 0x20, 0x80, 0xfd, 0x8f, 0x4a, 0xb9, 0x02, 0xcd, 0x2c, 0x60, 0xb0, 0x40, 0x24, 0xb9, 0x0e, 
-0xf4, 0xda, 0xc1, 0x11, 0xde, 0xad, 0xf2, 0x36, 0x46, 0xc6, 0x5a, 0x2f, 0xbb, 0x64, 0xab, 0x54, 
-0x84, 0x19, 0xcc, 0xf3, 0xb6, 0x52, 0x6c, 0x08, 0x48, 0x83, 0x9b, 0xfe, 0xb5, 0x18, 0x29, 0xa0, 
-0x11, 0x3e, 0x95, 0x66, 0x51, 0xf8, 0x6f, 0x4b, 0xe5, 0xa2, 0x57, 0xb5, 0xc9, 0x0f, 0xe7, 0x56, 
-0xac, 0x7f, 0xee, 0x4f, 0x1a, 0x81, 0x24, 0xfb, 0xc9, 0x52, 0x1b, 0x74, 0xc6, 0x65, 0xe0, 0x2b, 
-0x49, 0xe5, 0xb0, 0x12, 0x4e, 0x84, 0x6a, 0x9e, 0xf8, 0xcf, 0xbd, 0x42, 0x94, 0xfa, 0xbb, 0x70, 
-0xef, 0x23, 0xc2, 0xfc, 0xd0, 0x6f, 0x8f, 0xb3, 0x6c, 0xe7, 0x38, 0x81, 0xda, 0x3c, 0xa5, 0x08, 
-0x34, 0x1a, 0x8f, 0xa6, 0x6b, 0x37, 0xac, 0x14, 0x40, 0xfb, 0x2e, 0x16, 0x3a, 0xbc, 0x7a, 0x56, 
-0x6a, 0x8a, 0x49, 0x13, 0x58, 0x25, 0x35, 0xa6, 0x7e, 0xc5, 0xe4, 0x52, 0xbd, 0xf0, 0x9a, 0xb4, 
-0x6d, 0x95, 0x35, 0xba, 0xf7, 0x9a, 0x87, 0xe0, 0xb7, 0x90, 0xca, 0x61, 0xe3, 0x98, 0x7a, 0xef, 
-0xc6, 0x95, 0x14, 0x42, 0x08, 0x70, 0xdf, 0x3b, 0x8d, 0x56, 0x6d, 0xa4, 0x06, 0x4e, 0x93, 0x35, 
-0xe9, 0xc9, 0x59, 0xaf, 0x7e, 0xce, 0xf2, 0x86, 0x40, 0xbb, 0x5a, 0xda, 0x6e, 0x42, 0xb2, 0x76, 
-0xe3, 0xc0, 0xd2, 0x08, 0xa1, 0x75, 0xda, 0xb5, 0x5c, 0x38, 0xaa, 0x07, 0x2d, 0xe7, 0xda, 0x23, 
-0x6f, 0x46, 0x81, 0xd8, 0xf6, 0x57, 0xc8, 0x7f, 0x44, 0x1b, 0x85, 0x68, 0x29, 0x08, 0x5e, 0xbe, 
-0x13, 0x9c, 0xdc, 0x6e, 0xeb, 0x8e, 0x37, 0xfc, 0x2a, 0xbc, 0x67, 0x3c, 0x99, 0x15, 0xd0, 0xb0, 
-0xed, 0x1a, 0x69, 0x03, 0x4e, 0x84, 0xbf, 0x6e, 0xe0, 0xfc, 0x22, 0xba, 0x0a, 0x9c, 0xc7, 0xae, 
-0x07, 0x88, 0x31, 0x73, 0x4c, 0xa3, 0x93, 0x69, 0x15, 0xca, 0x2b, 0x66, 0xa2, 0xc0, 0x8d, 0x12, 
-0x6d, 0xe9, 0x30, 0x98, 0xff, 0x3e, 0x11, 0x72, 0xbb, 0x85, 0x3a, 0xfc, 0xcc, 0x01, 0x43, 0xdd, 
-0x5d, 0x89, 0x2f, 0xea, 0x0b, 0x56, 0x37, 0x12, 0x9a, 0x3f, 0x68, 0x16, 0x7b, 0x0c, 0xf5, 0x1c, 
-0x20, 0xc5, 0x5d, 0xef, 0xb9, 0x65, 0x8c, 0x54, 0xf0, 0xda, 0x5b, 0xfd, 0x48, 0x83, 0xcc, 0x60, 
-0xdf, 0x7a, 0x8f, 0xd0, 0xa8, 0xf7, 0x26, 0xc9, 0xd5, 0xb2, 0xfe, 0x7c, 0xd0, 0x96, 0xef, 0x4f, 
-0x0e, 0x2b, 0x6f, 0x20, 0x07, 0x74, 0xcd, 0x5a, 0x25, 0xe3, 0x7b, 0x1e, 0xa8, 0x3c, 0xcc, 0x69, 
-0x30, 0x45, 0xf3, 0x01, 0x37, 0xd6, 0x1c, 0x69, 0x3d, 0x26, 0xd1, 0xa1, 0xb9, 0x5f, 0x4d, 0xb3, 
-0x28, 0xfe, 0x18, 0xcd, 0x61, 0xc4, 0x15, 0xb4, 0x7b, 0x0a, 0xa0, 0xe3, 0x6e, 0x3a, 0x23, 0x68, 
-0xa5, 0xe8, 0x36, 0x83, 0xa1, 0x29, 0xcf, 0x18, 0x92, 0x4a, 0x86, 0x34, 0xe5, 0x42, 0x19, 0x2e, 
-0x8b, 0xe9, 0xbc, 0xd2, 0x76, 0x9c, 0x64, 0x87, 0xfb, 0xbe, 0x94, 0x08, 0x31, 0x99, 0xa8, 0x6f, 
-0x2e, 0x54, 0xcc, 0xf8, 0x4b, 0xa1, 0xe6, 0x86, 0x77, 0xfe, 0x22, 0xb3, 0x0b, 0x18, 0x7a, 0xde, 
-0x9d, 0x48, 0xe8, 0x04, 0x7c, 0xfc, 0x88, 0x5f, 0xc7, 0x35, 0xab, 0xd9, 0x92, 0x3b, 0xcd, 0x56, 
-0xad, 0x4a, 0xd5, 0x75, 0xe9, 0x35, 0x26, 0x60, 0xef, 0x40, 0xd8, 0xf8, 0x00, 0xbe, 0x2d, 0x40, 
-0xfe, 0xb9, 0x96, 0xd9, 0x38, 0xe5, 0x49, 0x9b, 0xba, 0x7d, 0xd3, 0xae, 0x08, 0x57, 0xa4, 0x92, 
-0xf1, 0x0a, 0x5f, 0x27, 0x91, 0xa8, 0xc0, 0x1e, 0x3b, 0x14, 0xaa, 0x62, 0xdb, 0x85, 0xcb, 0xae, 
-0xde, 0x8d, 0xeb, 0x53, 0x32, 0xe3, 0xa4, 0x4c, 0x43, 0x9e, 0x75, 0x17, 0x00, 0x47, 0xd2, 0x23, 
-0x9a, 0x7e, 0xbe, 0x22, 0xe6, 0x0c, 0x92, 0x28, 0xc0, 0x02, 0x50, 0xb4, 0x6f, 0x0e, 0x4e, 0x9e, 
-0x07, 0x3f, 0x20, 0xa1, 0x6c, 0x02, 0xbf, 0xe2, 0x88, 0x9c, 0xd3, 0xfc, 0x91, 0x38, 0xde, 0x11, 
-0x43, 0xae, 0x4f, 0x0c, 0xe7, 0x53, 0x04, 0xed, 0x1a, 0xaf, 0xa0, 0x73, 0x8a, 0xc0, 0x57, 0xa2, 
-0xb5, 0x50, 0xf8, 0x7a, 0xec, 0x31, 0x9c, 0x0e, 0x79, 0xd5, 0x46, 0x98, 0x85, 0xee, 0x3e, 0xa5, 
-0x64, 0x4b, 0x1d, 0x2b, 0x93, 0x50, 0xc3, 0xd8, 0x14, 0x75, 0x02, 0xff, 0x4d, 0xbe, 0xed, 0x58, 
-0x04, 0xf4, 0xae, 0x1e, 0x62, 0x93, 0xa9, 0x7a, 0xd5, 0x69, 0x15, 0x55, 0x3d, 0xb3, 0x0e, 0x4f, 
-0xa5, 0x13, 0xea, 0x77, 0xd2, 0x4b, 0x17, 0xe5, 0xd5, 0x9f, 0xb2, 0x75, 0x8d, 0xd3, 0x30, 0x1d, 
-0xab, 0x4c, 0x3a, 0x94, 0xd2, 0x4e, 0xc5, 0x5f, 0x0d, 0x8f, 0xa9, 0x5a, 0xdb, 0x30, 0xa6, 0x40, 
-0x23, 0x7b, 0xbe, 0x5a, 0xf1, 0x20, 0xe8, 0x07, 0x31, 0x8e, 0x19, 0x5b, 0xa6, 0xd1, 0x7e, 0x92, 
-0x19, 0xcb, 0x98, 0x21, 0x64, 0xeb, 0xdc, 0x8a, 0x71, 0x0c, 0x5a, 0x7b, 0x09, 0xf3, 0x2a, 0x59, 
-0x03, 0x42, 0x24, 0x5f, 0x87, 0xe7, 0xcd, 0x21, 0x54, 0xc5, 0x9c, 0xe1, 0x71, 0x55, 0xee, 0x7a, 
-0x99, 0xe5, 0xc4, 0x73, 0xa0, 0x47, 0x20, 0x77, 0x5c, 0x03, 0xa7, 0xb7, 0x84, 0xc5, 0x3c, 0xdd, 
-0x2a, 0xff, 0x4f, 0x95, 0xab, 0xc1, 0xfa, 0x6b, 0xb1, 0x3e, 0x12, 0x73, 0x9d, 0xb6, 0x53, 0xf1, 
-0xa0, 0x68, 0xe8, 0x21, 0x41, 0x93, 0xe2, 0x31, 0x85, 0x62, 0xeb, 0xc3, 0x2c, 0xd8, 0x61, 0x3d, 
-0x1a, 0xb6, 0x58, 0x44, 0xaa, 0x61, 0x83, 0xc2, 0x9d, 0xff, 0x89, 0xd1, 0x63, 0x81, 0xbc, 0x94, 
-0x5b, 0x7e, 0xd3, 0x4f, 0x24, 0xfa, 0x0d, 0x82, 0xdd, 0x06, 0x8d, 0x66, 0x1e, 0xd8, 0x85, 0xf1, 
-0xbd, 0xa8, 0x35, 0x0d, 0xdb, 0x28, 0x70, 0xfc, 0xd4, 0x87, 0xf4, 0xdb, 0xb6, 0x07, 0xf8, 0x98, 
-0x4a, 0xb0, 0xcd, 0x60, 0x97, 0x0c, 0x7c, 0xa7, 0x3b, 0x6e, 0xd9, 0x7e, 0xc9, 0xec, 0x53, 0xfb, 
-0x0c, 0x49, 0xa3, 0xf4, 0x21, 0xec, 0xc5, 0x2f, 0xe3, 0x3d, 0x5a, 0x20, 0xb5, 0x66, 0xfe, 0x05, 
-0x90, 0x38, 0x10, 0x21, 0x3f, 0xb7, 0x6f, 0x55, 0xd0, 0xea, 0x66, 0x7f, 0xa3, 0xe6, 0x23, 0xb6, 
-0x6d, 0xd4, 0x27, 0xc3, 0x71, 0x4d, 0x0c, 0xe7, 0x9d, 0xf9, 0x45, 0x12, 0x73, 0xa4, 0x64, 0x7c, 
-0x9d, 0xee, 0xc1, 0x84, 0x45, 0x02, 0xe0, 0x53, 0xb9, 0x69, 0x81, 0xaf, 0x54, 0x7c, 0x1a, 0xad, 
-0xce, 0x25, 0xa6, 0x43, 0xc5, 0xb2, 0x72, 0xa9, 0xdd, 0xf7, 0x8f, 0xc1, 0x19, 0x37, 0x79, 0xb3, 
-0x30, 0xd8, 0x7e, 0x40, 0x19, 0xb3, 0x2d, 0xcd, 0x68, 0x04, 0x50, 0x28, 0xf4, 0x15, 0xb9, 0xfd, 
-0x2f, 0x49, 0xd4, 0x1d, 0x96, 0x5b, 0x05, 0x6a, 0x09, 0xb4, 0xd2, 0x34, 0xe2, 0x7a, 0x2f, 0x0d, 
-0xe7, 0x4e, 0xc9, 0x31, 0x64, 0xd3, 0x3c, 0x1b, 0x80, 0x33, 0xc6, 0x86, 0xf3, 0x5e, 0xc2, 0xb6, 
-0x71, 0xdc, 0x11, 0x54, 0x86, 0x47, 0xaf, 0x77, 0xf6, 0x32, 0xc9, 0x7a, 0xea, 0x1c, 0x2d, 0xef, 
-0x04, 0x69, 0x33, 0xc0, 0x27, 0xa3, 0x37, 0xd8, 0xfc, 0x2a, 0x10, 0xe8, 0x67, 0xb1, 0x46, 0xeb, 
-0x70, 0xc8, 0x36, 0xaf, 0x45, 0x00, 0xca, 0x52, 0x20, 0x60, 0xec, 0x74, 0xb6, 0x58, 0x90, 0x02, 
-0x30, 0xbd, 0x5d, 0x3d, 0x75, 0x84, 0x5f, 0x33, 0xec, 0x27, 0x8e, 0x1d, 0xdb, 0x33, 0x66, 0xe6, 
-0xc5, 0x9c, 0x29, 0x47, 0xb5, 0x02, 0x3a, 0xbe, 0x27, 0xc7, 0x83, 0x70, 0x96, 0x5e, 0x8c, 0x7b, 
-0xcf, 0x6a, 0xac, 0x8d, 0xc6, 0x37, 0x83, 0xbc, 0x5b, 0xef, 0x64, 0xc1, 0xe2, 0x02, 0xf0, 0x96, 
-0x11, 0xc3, 0x07, 0x2d, 0x58, 0x41, 0x8a, 0xf5, 0x3b, 0x14, 0xf0, 0x85, 0x1c, 0xb5, 0xcc, 0x8f, 
-0x6e, 0x08, 0xd2, 0x87, 0x2e, 0xc7, 0xb8, 0x40, 0xdc, 0x0e, 0x69, 0x2a, 0xf5, 0xb5, 0x6f, 0x3a, 
-0xfc, 0x0c, 0x2e, 0x44, 0xd2, 0x9d, 0x38, 0x5f, 0x4b, 0xf2, 0xe3, 0x8c, 0x18, 0x62, 0x86, 0xcf, 
-0x36, 0x9f, 0x68, 0xed, 0x4f, 0xdb, 0x6b, 0xf9, 0x48, 0x05, 0x69, 0xbe, 0xf7, 0x0d, 0x89, 0x47, 
-0xfe, 0xb8, 0x80, 0x3f, 0xcf, 0x96, 0x67, 0x8b, 0xc6, 0xe8, 0x6e, 0x2b, 0xf9, 0x75, 0xd5, 0xb1, 
-0x8c, 0x69, 0x11, 0x86, 0x57, 0x1e, 0xa1, 0x88, 0x5f, 0x94, 0xde, 0xaa, 0xf6, 0x08, 0x76, 0xdc, 
-0xab, 0x47, 0xd5, 0x0a, 0xa4, 0x79, 0x1b, 0xfa, 0x48, 0xac, 0x99, 0x36, 0xf9, 0xa3, 0x0b, 0x90, 
-0xdb, 0x69, 0x14, 0x00, 0x99, 0xd5, 0xb8, 0x54, 0x78, 0xd9, 0x14, 0x93, 0xf5, 0x74, 0x12, 0x4b, 
-0x6d, 0xbe, 0x40, 0x96, 0xa6, 0xcf, 0x34, 0x27, 0x9a, 0x19, 0x56, 0xe7, 0xbf, 0x71, 0x95, 0x3c, 
-0x6c, 0x8f, 0xc5, 0x4d, 0xa2, 0x1a, 0xe5, 0x48, 0xac, 0x14, 0x97, 0xca, 0x10, 0xa9, 0xbd, 0x19, 
-0x7e, 0x69, 0xbf, 0x42, 0xf1, 0xb3, 0x87, 0x21, 0x52, 0x0f, 0xfa, 0x5d, 0x16, 0x88, 0x6f, 0x9b, 
-0x5f, 0xe1, 0x30, 0xcf, 0x45, 0x09, 0xde, 0x15, 0x99, 0x26, 0xf9, 0x03, 0x50, 0xde, 0x27, 0xa4, 
-0x47, 0x7c, 0xd8, 0x99, 0x4d, 0x80, 0x62, 0xa6, 0x44, 0x87, 0xb7, 0xdc, 0xfa, 0xad, 0x02, 0x74, 
-0xa0, 0x55, 0xaf, 0x43, 0x9a, 0xf6, 0x65, 0x2a, 0xdd, 0x55, 0xb1, 0x96, 0xe2, 0x4d, 0x1a, 0xfa, 
-0x59, 0xb2, 0x39, 0xca, 0x8b, 0x13, 0xa0, 0x24, 0xd9, 0xa7, 0xc5, 0xef, 0x10, 0xb8, 0xf9, 0x05, 
-0x82, 0xbf, 0x31, 0x55, 0xd5, 0xfd, 0x21, 0x4d, 0x15, 0x77, 0x0c, 0xb2, 0x2a, 0xa3, 0x95, 0x15, 
-0x89, 0xab, 0xe9, 0xa1, 0x35, 0x63, 0xdc, 0xa5, 0x23, 0x91, 0xd8, 0xae, 0x09, 0x55, 0xe0, 0x3b, 
-0x0c, 0x80, 0x9b, 0xbe, 0x42, 0x16, 0xa8, 0xe9, 0x9c, 0xe6, 0x41, 0xf5, 0x70, 0xc7, 0x44, 0xef, 
-0xd0, 0x02, 0x26, 0x83, 0x46, 0x8d, 0xbe, 0x59, 0xff, 0x15, 0x95, 0x54, 0x2c, 0xcf, 0x3b, 0x00, 
-0x90, 0x26, 0xcc, 0x7a, 0xbc, 0x1d, 0xe9, 0x28, 0x52, 0xa5, 0x85, 0xb2, 0x4b, 0x6d, 0x3c, 0x8d, 
-0xa7, 0x48, 0xb1, 0x5a, 0x3f, 0xea, 0xb4, 0x20, 0xa8, 0x88, 0xc9, 0x07, 0x5b, 0x16, 0x8d, 0xbe, 
-0x61, 0xfd, 0xa8, 0x7e, 0x28, 0xdd, 0xa4, 0xfb, 0x17, 0xe2, 0x04, 0x2d, 0xf6, 0x80, 0xc0, 0xcf, 
-0x6c, 0x7d, 0xee, 0x54, 0x29, 0xe4, 0x40, 0xcf, 0xa0, 0xe1, 0x55, 0x78, 0xa3, 0x15, 0x48, 0xd4, 
-0xba, 0x79, 0x91, 0xce, 0xa5, 0xdf, 0xf5, 0x1d, 0xb0, 0x8f, 0x04, 0xb8, 0xfe, 0xaa, 0x38, 0x56, 
-0xb2, 0x47, 0xd9, 0x7f, 0x9c, 0xeb, 0x72, 0x1b, 0xce, 0x0b, 0xaa, 0x28, 0xfd, 0x1a, 0xc6, 0x2e, 
-0xf7, 0x22, 0x6c, 0x9a, 0x19, 0x63, 0xc1, 0x2c, 0xe2, 0xc9, 0x7b, 0x32, 0xe4, 0x59, 0x13, 0xbd, 
-0x7f, 0x35, 0x1d, 0x61, 0xf6, 0x00, 0x82, 0x92, 0x24, 0x75, 0x99, 0xda, 0x4d, 0x5e, 0xe7, 0x7a, 
-0x49, 0x89, 0x5b, 0x73, 0x91, 0x28, 0x6e, 0xd8, 0x96, 0x1d, 0x75, 0x9e, 0x01, 0x3d, 0x97, 0xe4, 
-0xbe, 0x58, 0xca, 0x44, 0x81, 0x01, 0xc5, 0x3c, 0xd1, 0x5a, 0x1d, 0x4d, 0x92, 0xc7, 0x76, 0x57, 
-0x38, 0x11, 0x5d, 0xf1, 0x33, 0x79, 0xb2, 0x22, 0xa5, 0x51, 0x12, 0x63, 0xee, 0x8c, 0x4d, 0x25, 
-0x19, 0x5b, 0xb9, 0x26, 0xa8, 0xdb, 0x15, 0xb3, 0x34, 0x78, 0xbc, 0x56, 0xeb, 0x1e, 0x9b, 0x2b, 
-0x70, 0xb8, 0x64, 0xef, 0xae, 0x6a, 0xe8, 0x80, 0x58, 0xf0, 0x67, 0x08, 0xe0, 0x5d, 0x71, 0xc1, 
-0xce, 0x3e, 0xf2, 0xe4, 0x29, 0xc4, 0xf9, 0x18, 0xe9, 0x23, 0xc9, 0xde, 0x07, 0x8c, 0xce, 0x61, 
-0xe5, 0x31, 0xf4, 0x73, 0xdc, 0x7f, 0xe4, 0x4c, 0x77, 0xd5, 0x0b, 0x92, 0x4e, 0x11, 0x5d, 0x30, 
-0xb8, 0x77, 0x9c, 0xd7, 0x3f, 0x66, 0x25, 0x99, 0x39, 0xdf, 0x1f, 0xa4, 0x69, 0xfd, 0x8a, 0x50, 
-0x05, 0xf7, 0x37, 0x0e, 0xc9, 0x6e, 0xf9, 0x99, 0x30, 0xe2, 0x3f, 0x6c, 0x33, 0xc1, 0x4c, 0x7d, 
-0x40, 0xf1, 0x53, 0x19, 0x79, 0x66, 0xc3, 0xef, 0x72, 0xbd, 0x33, 0x17, 0x5e, 0x40, 0xb1, 0x8c, 
-0xf8, 0x33, 0x6d, 0x8a, 0x58, 0xb0, 0x3a, 0x8f, 0xe0, 0x79, 0x4a, 0xcc, 0x37, 0x7d, 0xd8, 0x96, 
-0x4b, 0x0d, 0x67, 0xd7, 0x01, 0x8b, 0x3d, 0xaa, 0x4b, 0xec, 0xc1, 0xa0, 0x3d, 0x6f, 0xaa, 0xd3, 
-0xc2, 0x46, 0x05, 0xfe, 0x1d, 0xac, 0xc7, 0x96, 0x06, 0xbd, 0x1c, 0xdf, 0x3c, 0x52, 0xe7, 0xa7, 
-0x40, 0x66, 0xec, 0xaf, 0xbc, 0x6b, 0x7e, 0xac, 0x2f, 0xf3, 0x94, 0xd6, 0xfd, 0x54, 0xe4, 0x64, 
-0xb7, 0xf5, 0x2a, 0x82, 0xd4, 0x06, 0x1c, 0xef, 0xe1, 0xc4, 0x6e, 0x88, 0xa1, 0xea, 0xc1, 0x5f, 
-0xf6, 0xd2, 0xe2, 0xb3, 0x34, 0xc8, 0x7a, 0x08, 0xf2, 0x7d, 0xcc, 0x8f, 0x06, 0x64, 0x99, 0x52, 
-0x6e, 0xfd, 0xa2, 0x15, 0x6a, 0x37, 0xcf, 0xe3, 0x03, 0x89, 0x3c, 0xda, 0x0f, 0x4b, 0x9b, 0xb8, 
-0xd9, 0x14, 0x42, 0xb3, 0x8d, 0x4b, 0x38, 0x99, 0x0f, 0x63, 0x1d, 0x92, 0x5c, 0x7f, 0x08, 0x9b, 
-0x62, 0x38, 0x83, 0x6b, 0xa0, 0x50, 0x7b, 0x0d, 0x9b, 0x55, 0x1c, 0x49, 0xb9, 0x3a, 0xf2, 0x03, 
-0xb2, 0x31, 0x41, 0xf1, 0xcc, 0x89, 0xea, 0xaa, 0xd2, 0x45, 0x58, 0x88, 0xb2, 0x0a, 0xeb, 0x51, 
-0x0e, 0xb5, 0x8e, 0x47, 0xd5, 0x0c, 0x73, 0xb7, 0x23, 0x93, 0xaf, 0xd6, 0x2c, 0x8f, 0x59, 0x0b, 
-0x62, 0xaf, 0x05, 0xeb, 0x57, 0x26, 0x0c, 0xd5, 0x68, 0xa4, 0x36, 0xe6, 0x9a, 0x2a, 0x84, 0x1e, 
-0x0b, 0x8a, 0xf3, 0xa6, 0xd4, 0x0f, 0x67, 0xc0, 0x54, 0xde, 0x43, 0xc9, 0x10, 0xe5, 0x68, 0xd2, 
-0x05, 0x5a, 0xab, 0xe8, 0x0c, 0x53, 0xee, 0x1e, 0x84, 0xfc, 0xbc, 0x25, 0xa4, 0x73, 0xd1, 0xff, 
-0x91, 0x06, 0x75, 0xcd, 0x28, 0xdb, 0x54, 0x32, 0x63, 0xec, 0xa4, 0x7f, 0x6c, 0x2d, 0x3f, 0xed, 
-0x66, 0x33, 0xf8, 0xa4, 0xcb, 0x85, 0x0c, 0xc2, 0x2c, 0xd0, 0x13, 0x4b, 0xe0, 0x26, 0xef, 0x0f, 
-0x64, 0x88, 0x1f, 0x38, 0x70, 0xa9, 0x26, 0x7b, 0x0d, 0x97, 0x6f, 0xdf, 0xaa, 0x3f, 0xb6, 0x98, 
-0x7c, 0xa9, 0x45, 0x1b, 0x29, 0x4b, 0x01, 0x91, 0x75, 0x45, 0x27, 0x84, 0x0e, 0x58, 0xdc, 0x9e, 
-0x46, 0x0d, 0xe0, 0x50, 0x3b, 0xf7, 0x81, 0xc4, 0x21, 0x41, 0xe3, 0x91, 0xc6, 0xae, 0x79, 0x44, 
-0xa6, 0xc8, 0x24, 0x7c, 0xc1, 0x8d, 0x1c, 0x2a, 0xc4, 0xa5, 0x76, 0xd3, 0x2d, 0xee, 0x7e, 0xb1, 
-0xfe, 0x76, 0xbb, 0xd9, 0x36, 0xaa, 0xe0, 0xce, 0x75, 0xbd, 0xf6, 0x1a, 0x2d, 0xc1, 0xfa, 0x38, 
-0xd9, 0x81, 0xae, 0x94, 0x25, 0x6a, 0xa4, 0x96, 0x20, 0xc4, 0x6c, 0xa1, 0x1b, 0x3a, 0x68, 0x06, 
-0x81, 0x26, 0xf9, 0x15, 0xc8, 0x73, 0xa6, 0xd4, 0x60, 0x77, 0xf3, 0x35, 0xc0, 0x9c, 0x2f, 0x5d, 
-0xdd, 0x47, 0x82, 0x5f, 0xe6, 0xb8, 0x3d, 0xed, 0xc6, 0x81, 0x1f, 0xa1, 0x86, 0xdb, 0x98, 0xb4, 
-0x15, 0xcb, 0x87, 0x5c, 0xd7, 0x4b, 0xcc, 0xa2, 0xe4, 0x52, 0x69, 0xc8, 0x7a, 0x2e, 0xf1, 0x07, 
-0x9b, 0x20, 0xb7, 0xec, 0x9e, 0x76, 0x48, 0xb9, 0x18, 0x95, 0xbf, 0x2a, 0x8c, 0xa4, 0xb7, 0x3d, 
-0x60, 0xac, 0x91, 0x47, 0xf2, 0xc5, 0x1a, 0x69, 0x24, 0xe1, 0x58, 0x85, 0x10, 0xb5, 0xf0, 0x0a, 
-0x8b, 0x15, 0xce, 0x50, 0xbd, 0x8f, 0x12, 0xce, 0x75, 0x9b, 0x4d, 0x11, 0x64, 0x22, 0xb4, 0x59, 
-0x7b, 0xf4, 0x86, 0x36, 0x8e, 0x57, 0xc7, 0x43, 0xda, 0xa3, 0x07, 0x5f, 0xbb, 0x18, 0x8d, 0xf0, 
-0x37, 0x46, 0xbf, 0x13, 0x58, 0xfb, 0x6b, 0x4e, 0x2e, 0x0b, 0xf8, 0xd6, 0xc8, 0x6b, 0xdd, 0x18, 
-0x36, 0xcb, 0x69, 0xaa, 0x95, 0xff, 0xbb, 0x2c, 0x99, 0x31, 0xa4, 0x74, 0xb6, 0x2a, 0xe5, 0x0b, 
-0xa9, 0xd8, 0x60, 0x05, 0x4b, 0xf9, 0x0e, 0x61, 0xea, 0x50, 0xfa, 0xa0, 0x35, 0xe2, 0x72, 0x61, 
-0xfe, 0x33, 0x50, 0x96, 0x19, 0xc5, 0x03, 0xda, 0x23, 0x50, 0xa1, 0x0d, 0x47, 0x6b, 0x25, 0x4d, 
-0x10, 0x55, 0x94, 0xab, 0xe3, 0x46, 0x21, 0xb6, 0x69, 0x00, 0xd2, 0xff, 0xc7, 0x0e, 0x53, 0xd7, 
-0x5f, 0x83, 0xe1, 0x54, 0x7a, 0xb0, 0xc5, 0x4c, 0x94, 0xbc, 0xdf, 0x62, 0x33, 0x8e, 0x44, 0xff, 
-0x2c, 0xc5, 0x00, 0x57, 0x84, 0x1a, 0xed, 0xa8, 0xc6, 0x6d, 0x1c, 0x9d, 0x01, 0x7d, 0x24, 0xa4, 
-0x70, 0xd2, 0x50, 0xff, 0xbb, 0x74, 0x5e, 0xee, 0x2c, 0x72, 0xbc, 0x21, 0xaf, 0x05, 0xf6, 0x60, 
-0x3c, 0x97, 0x24, 0x45, 0xb4, 0x91, 0xe3, 0x3a, 0x81, 0x73, 0x60, 0x01, 0x31, 0x84, 0x23, 0xa2, 
-0xee, 0x71, 0x40, 0xff, 0x65, 0xd4, 0x71, 0x04, 0xcd, 0x30, 0x15, 0x5a, 0x7e, 0x36, 0x52, 0x9f, 
-0xb9, 0x42, 0xad, 0xf4, 0x93, 0x49, 0x7c, 0xa0, 0xe3, 0xb6, 0x23, 0x36, 0xde, 0xf2, 0xb2, 0x57, 
-0x25, 0xda, 0xaf, 0x7d, 0xe9, 0x94, 0xff, 0x45, 0x9d, 0x06, 0x5f, 0xa6, 0xd4, 0x08, 0x9c, 0x72, 
-0xb5, 0x4f, 0xec, 0xc8, 0x9a, 0xe0, 0x4c, 0xb0, 0xcd, 0x9f, 0xea, 0x7d, 0x32, 0x8c, 0x24, 0xd2, 
-0xbf, 0x63, 0x92, 0xb2, 0x58, 0x9a, 0xfc, 0x83, 0xbc, 0x9d, 0x05, 0xe8, 0x3e, 0x1d, 0x6f, 0xd2, 
-0xc9, 0x65, 0xfd, 0x1c, 0xd6, 0x96, 0x48, 0x5c, 0x8c, 0x31, 0x7f, 0xb8, 0x29, 0xd6, 0x83, 0x96, 
-0x31, 0x17, 0x6e, 0x5d, 0x04, 0xf1, 0xb1, 0x3f, 0x89, 0x05, 0xe2, 0x64, 0xf7, 0xa1, 0x6b, 0x43, 
-0x8e, 0x31, 0xd2, 0x82, 0xee, 0xc1, 0x8c, 0xfd, 0xb6, 0x30, 0xd6, 0x03, 0x5f, 0x76, 0x8f, 0xa3, 
-0xee, 0x41, 0x59, 0x2f, 0x79, 0xe8, 0x8a, 0x34, 0xf8, 0x14, 0xb7, 0x2b, 0xfa, 0xd8, 0x24, 0xf0, 
-0x6f, 0x0c, 0x3b, 0x9f, 0xf1, 0x21, 0xba, 0x81, 0x19, 0x9f, 0xe6, 0xaf, 0x64, 0xd2, 0x7a, 0x3b, 
-0x08, 0xf3, 0xbb, 0x40, 0xfc, 0x51, 0xdd, 0x15, 0x47, 0x2e, 0x92, 0x16, 0x43, 0x35, 0x00, 0x8c, 
-0x4a, 0xe1, 0x0d, 0xfa, 0x42, 0x8e, 0x76, 0x2f, 0xb9, 0xd2, 0x00, 0xff, 0x1a, 0x58, 0xa3, 0x49, 
-0xcd, 0xac, 0xf6, 0x93, 0xd3, 0xc3, 0xfa, 0x54, 0x35, 0xdc, 0x0f, 0x80, 0x1a, 0x49, 0x27, 0xf6, 
-0x9c, 0xe5, 0x6d, 0xd9, 0xb0, 0xeb, 0x0b, 0x84, 0xd5, 0x2e, 0x15, 0x66, 0x37, 0xbe, 0x1e, 0x6b, 
-0x3b, 0x57, 0x77, 0x89, 0x60, 0x08, 0x46, 0x81, 0xf6, 0x02, 0xbc, 0x40, 0x2e, 0xd3, 0x6b, 0x1a, 
-0xde, 0xc9, 0xb8, 0x20, 0xfc, 0x7b, 0x32, 0x1a, 0xf8, 0x28, 0x83, 0x40, 0x77, 0x2f, 0x08, 0x5c, 
-0x6b, 0x22, 0x05, 0x63, 0xca, 0xe4, 0xa3, 0x02, 0xec, 0x82, 0x39, 0x13, 0x7a, 0x40, 0x2e, 0xac, 
-0x53, 0xf1, 0x5d, 0xd7, 0x78, 0x4d, 0xa7, 0x04, 0x0a, 0x56, 0xae, 0x86, 0x01, 0x6a, 0xbc, 0xed, 
-0xcf, 0x1a, 0xf1, 0x70, 0x9a, 0x59, 0x1e, 0xc2, 0xb1, 0xd3, 0x91, 0xbb, 0x46, 0xcf, 0x14, 0x54, 
-0xa0, 0xc9, 0x7c, 0xaf, 0x26, 0x57, 0x85, 0xe6, 0xac, 0x5b, 0xf8, 0x19, 0xb1, 0x02, 0x3d, 0x9e, 
-0x7e, 0xed, 0x42, 0x86, 0xcd, 0xf2, 0x52, 0x16, 0xc4, 0x87, 0x12, 0xa2, 0x63, 0xb7, 0x43, 0xa9, 
-0xca, 0x49, 0x9a, 0x01, 0x8d, 0x60, 0x12, 0x9d, 0xdb, 0x54, 0xae, 0x7b, 0xcf, 0x04, 0x5a, 0xdd, 
-0x93, 0x6a, 0x3e, 0x25, 0xf7, 0x48, 0x94, 0xe0, 0x55, 0x8c, 0x30, 0xcd, 0x66, 0xab, 0xc0, 0x88, 
-0xf3, 0xb4, 0xe4, 0x67, 0xcb, 0xad, 0xf8, 0xc4, 0x9f, 0x3b, 0x7f, 0x97, 0x6a, 0xc1, 0x12, 0xe0, 
-0x82, 0xac, 0x71, 0xde, 0x85, 0xc3, 0x6b, 0x12, 0xda, 0x2b, 0x1a, 0x4f, 0x3e, 0x65, 0x0a, 0xb0, 
-0x8a, 0x60, 0xc7, 0xb4, 0xe4, 0x92, 0xc3, 0x7a, 0x43, 0x87, 0xbf, 0x07, 0x97, 0x2a, 0xc2, 0x60, 
-0xf7, 0x73, 0x9a, 0xc9, 0xde, 0x5d, 0xfd, 0xc8, 0x95, 0xd6, 0xf8, 0xaa, 0x19, 0x98, 0xd2, 0xa6, 
-0x39, 0x8e, 0x6e, 0x5a, 0xc4, 0x09, 0xa5, 0x35, 0x8c, 0x4c, 0x72, 0x3e, 0x66, 0xe5, 0xc0, 0x92, 
-0xcf, 0x6a, 0xad, 0x14, 0xd3, 0xf6, 0xc0, 0x86, 0xdc, 0xff, 0x91, 0x4d, 0xaf, 0x19, 0x71, 0x46, 
-0x9a, 0x52, 0xdf, 0x24, 0xef, 0xba, 0x07, 0xd8, 0x20, 0x7e, 0x16, 0x32, 0xbe, 0x8a, 0xef, 0x62, 
-0x7a, 0x23, 0xdd, 0x40, 0xc6, 0x35, 0x79, 0x11, 0x9f, 0x51, 0xc7, 0x39, 0xaa, 0xde, 0x3d, 0xf0, 
-0x75, 0x0a, 0xe0, 0x21, 0x82, 0xa8, 0x77, 0xde, 0x24, 0xec, 0x10, 0x46, 0xbf, 0x39, 0x14, 0xce, 
-0x0b, 0xc4, 0x66, 0x95, 0x73, 0x57, 0xdd, 0x63, 0x1d, 0xa6, 0x6d, 0x27, 0xb9, 0x0d, 0xdc, 0x33, 
-0x72, 0xe6, 0xbb, 0x91, 0x1e, 0xdc, 0x05, 0x26, 0x76, 0x66, 0xeb, 0x3d, 0xd1, 0x74, 0x32, 0x43, 
-0xc2, 0x8b, 0x2b, 0xe4, 0x4b, 0x6e, 0xab, 0x37, 0x4d, 0xd0, 0xbe, 0x8c, 0x15, 0xc9, 0x0e, 0x29, 
-0xa4, 0x76, 0xda, 0x12, 0x92, 0x74, 0x36, 0x06, 0x9b, 0x58, 0x79, 0x09, 0xdd, 0x7e, 0x55, 0x22, 
-0x67, 0xcf, 0x53, 0xec, 0x32, 0xa4, 0x55, 0xee, 0x18, 0x48, 0x5c, 0x9d, 0x37, 0x26, 0xf7, 0xb6, 
-0x8c, 0x5c, 0xe5, 0x7c, 0xa8, 0xde, 0x75, 0x1b, 0xd0, 0x4b, 0x9c, 0x30, 0x57, 0xa6, 0x0a, 0xdd, 
-0x55, 0x1d, 0xef, 0x3c, 0x4e, 0x76, 0xdf, 0x8f, 0x11, 0x47, 0xe7, 0x81, 0x03, 0x2b, 0xa9, 0x14, 
-0x47, 0x05, 0x2c, 0xc3, 0xe4, 0x72, 0x20, 0x66, 0xc5, 0xe3, 0x1d, 0xed, 0x84, 0x4f, 0xb2, 0x77, 
-0xf2, 0x28, 0xea, 0x98, 0x0c, 0xb0, 0x4a, 0x5c, 0x39, 0x02, 0xe5, 0x55, 0x65, 0x92, 0x3b, 0x1a, 
-0xa5, 0x2e, 0xb9, 0xd7, 0x38, 0x86, 0xf7, 0xb6, 0x11, 0xc4, 0x6e, 0xa7, 0xcf, 0x63, 0x8e, 0x70, 
-0x46, 0xc8, 0x91, 0xad, 0x0a, 0xce, 0x22, 0x9a, 0xc0, 0x93, 0xec, 0x60, 0xa1, 0xf3, 0x20, 0xb1, 
-0x3e, 0x68, 0x88, 0x09, 0xf7, 0x13, 0x67, 0x49, 0x8b, 0x56, 0x39, 0xf6, 0x98, 0x2d, 0x65, 0xc0, 
-0x90, 0x37, 0x6f, 0xd4, 0x8c, 0xa7, 0xf1, 0x77, 0x2b, 0x9d, 0x3f, 0x21, 0xe5, 0xc8, 0x2a, 0xd0, 
-0x0e, 0xe5, 0x57, 0x93, 0x3a, 0xa8, 0x66, 0x98, 0x25, 0x4c, 0xd6, 0x37, 0xf8, 0x50, 0x81, 0xf2, 
-0x93, 0x0d, 0xc0, 0xad, 0x52, 0xa3, 0xb9, 0x7f, 0xfd, 0x1d, 0x68, 0x0f, 0x95, 0xc0, 0xe9, 0x15, 
-0xf8, 0x08, 0x77, 0xa9, 0x54, 0x6e, 0xb5, 0xfe, 0x63, 0x1e, 0xb0, 0x48, 0xec, 0x28, 0xca, 0x62, 
-0xd5, 0x20, 0x3c, 0xa5, 0x2b, 0x94, 0x10, 0xe8, 0xa8, 0x1a, 0xb6, 0x06, 0xdc, 0xc9, 0x23, 0x67, 
-0x94, 0x2c, 0xcb, 0x0f, 0xe9, 0x4e, 0x79, 0x04, 0x35, 0xc1, 0x9c, 0x0d, 0xba, 0x2e, 0xeb, 0x97, 
-0x28, 0xf8, 0x00, 0x77, 0xf2, 0x3a, 0x6a, 0xaf, 0x2c, 0xb6, 0x63, 0xa3, 0xcf, 0x20, 0xad, 0x3a, 
-0x57, 0xa5, 0x21, 0xb3, 0x50, 0x8e, 0x75, 0xe6, 0x82, 0xa1, 0x69, 0x4d, 0x3d, 0xb5, 0xf9, 0x2f, 
-0x51, 0x0d, 0xab, 0x98, 0x26, 0xf6, 0xd9, 0x5e, 0x00, 0xbf, 0xa8, 0x52, 0xd2, 0x15, 0x80, 0xf4, 
-0xa6, 0x8a, 0xbe, 0x9c, 0x24, 0xb4, 0xe8, 0x7e, 0x56, 0x43, 0x76, 0x12, 0x9d, 0x5b, 0x2a, 0xd9, 
-0x60, 0x32, 0xfe, 0x88, 0x0e, 0x4e, 0xe9, 0xa2, 0xf4, 0x3b, 0xdf, 0x6a, 0xf7, 0x58, 0x42, 0xb7, 
-0x69, 0x2f, 0x10, 0x4a, 0x82, 0xd2, 0x57, 0x91, 0xff, 0xdb, 0x25, 0xb9, 0x79, 0x90, 0xbe, 0xa3, 
-0x27, 0xc8, 0xae, 0x6a, 0x4f, 0xd6, 0x09, 0xf8, 0x4b, 0xb8, 0x5b, 0xfc, 0x1c, 0xdd, 0x5f, 0x48, 
-0xb4, 0xec, 0x7e, 0x4e, 0xa7, 0x38, 0x8e, 0x7a, 0x4c, 0xb0, 0xc5, 0xf6, 0x1b, 0x7d, 0xc9, 0xfc, 
-0xb1, 0x5f, 0x0b, 0x75, 0xc5, 0x68, 0xae, 0xd0, 0x59, 0xde, 0x2f, 0x83, 0x19, 0xe9, 0xdf, 0x05, 
-0x5c, 0xd2, 0xb2, 0xf5, 0x40, 0x25, 0x7c, 0xa2, 0x89, 0x60, 0xe3, 0x2e, 0xf0, 0x9f, 0x85, 0x42, 
-0xc1, 0xe8, 0x7f, 0x59, 0x0b, 0xa3, 0xfa, 0x43, 0x81, 0xe9, 0xc5, 0xf5, 0x4b, 0xbd, 0x70, 0x42, 
-0x86, 0xd8, 0x2b, 0x61, 0x7b, 0x46, 0x88, 0xb3, 0xd6, 0xfa, 0x77, 0xbc, 0x8d, 0xd2, 0xa8, 0xec, 
-0x43, 0x6a, 0xfe, 0x20, 0x8b, 0x46, 0x59, 0xc1, 0x7f, 0x6b, 0xab, 0x1d, 0xd2, 0x89, 0x13, 0xcb, 
-0xfd, 0x7e, 0x0f, 0x8c, 0xf9, 0x6c, 0x00, 0xf2, 0xbd, 0xd1, 0x69, 0xf9, 0x3f, 0xd8, 0xb9, 0x35, 
-0x59, 0xce, 0xf0, 0x12, 0x7f, 0x59, 0x8c, 0x9f, 0xd9, 0x7b, 0x61, 0xcd, 0x46, 0x10, 0x91, 0x3c, 
-0xcf, 0x18, 0x7a, 0x31, 0x8c, 0xe1, 0x2c, 0x1e, 0x72, 0xdb, 0x43, 0xfa, 0x0a, 0x4b, 0x6e, 0xd1, 
-0x00, 0xc3, 0xf1, 0x6a, 0xe7, 0xc8, 0x41, 0x7c, 0x93, 0xae, 0x1b, 0x44, 0x9d, 0x29, 0xc1, 0x0b, 
-0x5e, 0xb5, 0x25, 0x4c, 0xa0, 0x81, 0x2d, 0xd7, 0x88, 0xcd, 0xa8, 0xb9, 0x09, 0x2c, 0xe6, 0x71, 
-0x0d, 0xa8, 0x47, 0xe8, 0x55, 0x30, 0xd1, 0x06, 0xfd, 0x7f, 0x19, 0xe6, 0x10, 0xb4, 0x3d, 0x84, 
-0x1b, 0x9b, 0x07, 0x7f, 0x31, 0x98, 0x70, 0x01, 0x8c, 0xd7, 0x10, 0xbe, 0xf3, 0x08, 0xb8, 0xf9, 
-0x9a, 0x31, 0x05, 0x73, 0xda, 0x4f, 0x42, 0x03, 0x84, 0xea, 0xa6, 0x44, 0x9a, 0x2a, 0x12, 0x3c, 
-0xa0, 0x1e, 0x70, 0xfa, 0x47, 0x68, 0x27, 0x91, 0x38, 0x4e, 0xa1, 0x86, 0xca, 0x5d, 0xd8, 0x32, 
-0xb7, 0x21, 0x45, 0xd6, 0x0a, 0x36, 0xd2, 0x51, 0x02, 0x31, 0x9c, 0xd2, 0xb7, 0x8a, 0x52, 0x17, 
-0xac, 0x6c, 0x0c, 0x89, 0x5e, 0x9e, 0xf1, 0x33, 0xc2, 0x74, 0xfe, 0x92, 0xaf, 0x10, 0xf5, 0x3c, 
-0x05, 0x52, 0xa3, 0x3e, 0x66, 0x1e, 0x5d, 0x99, 0x85, 0xd6, 0x52, 0xc9, 0x70, 0xf1, 0xa4, 0x08, 
-0x3b, 0xdb, 0xb9, 0x45, 0xeb, 0x5e, 0xa0, 0x4d, 0x95, 0x37, 0xd5, 0x57, 0xc4, 0x45, 0x85, 0x9b, 
-0x2e, 0x7c, 0x0a, 0x96, 0xc6, 0x12, 0x63, 0xf6, 0x1f, 0xae, 0x8f, 0xdd, 0xbe, 0x00, 0xe9, 0x16, 
-0x44, 0xb9, 0xfc, 0x37, 0x74, 0xbd, 0x68, 0x9f, 0x83, 0xe2, 0x5b, 0xf6, 0x6c, 0x9f, 0xc4, 0xb3, 
-0x53, 0x11, 0x30, 0x7a, 0xcb, 0xa9, 0x2c, 0xf5, 0x97, 0xad, 0x25, 0x83, 0x08, 0xbb, 0x1e, 0xf0, 
-0x05, 0xcb, 0xe4, 0x5a, 0x7d, 0xd6, 0x36, 0x83, 0x19, 0x99, 0x75, 0x10, 0xe4, 0xc1, 0x15, 0xfb, 
-0x3f, 0x1a, 0x74, 0xfb, 0x66, 0x9a, 0xc2, 0x4d, 0x32, 0x80, 0xd4, 0x61, 0x9e, 0x1d, 0xec, 0x70, 
-0x5e, 0xdb, 0x42, 0x9e, 0x77, 0xf1, 0xcc, 0x60, 0xa6, 0xea, 0xce, 0xb2, 0x52, 0xc1, 0x25, 0xf6, 
-0xc7, 0x56, 0x32, 0x6d, 0x87, 0x5a, 0x1a, 0x65, 0xd6, 0x45, 0x88, 0x61, 0x9f, 0xee, 0xbc, 0x1f, 
-0x91, 0x30, 0xce, 0x18, 0xed, 0x8a, 0xbd, 0xe6, 0x4b, 0xb6, 0x8d, 0xc8, 0x0f, 0x98, 0xc4, 0xab, 
-0x6e, 0xeb, 0x08, 0x2f, 0x73, 0x12, 0xef, 0x51, 0x6b, 0xc8, 0x98, 0x80, 0xbb, 0x66, 0x1c, 0xe1, 
-0x95, 0x6f, 0xf4, 0x3b, 0x1f, 0x6d, 0xe5, 0xbf, 0x96, 0x33, 0xb7, 0x25, 0xd1, 0x16, 0xdb, 0x04, 
-0x59, 0x9c, 0x15, 0x37, 0x51, 0xe4, 0x70, 0x9e, 0xc0, 0x85, 0x27, 0x0b, 0xb0, 0xe0, 0x30, 0x15, 
-0xb4, 0x0a, 0x29, 0xad, 0x39, 0x16, 0xd5, 0x66, 0xe8, 0x90, 0x55, 0x2d, 0x81, 0xbe, 0x26, 0xe1, 
-0x03, 0x68, 0xe8, 0x1a, 0x30, 0xb1, 0xe4, 0x60, 0x17, 0xe9, 0x37, 0x56, 0x71, 0x28, 0x9c, 0x88, 
-0x09, 0x42, 0x73, 0x27, 0x36, 0xa6, 0xce, 0x6c, 0x87, 0x2c, 0x04, 0xa5, 0xdd, 0x1b, 0xe9, 0x51, 
-0x25, 0xaf, 0x44, 0xba, 0x06, 0x3e, 0x61, 0xea, 0x93, 0xd1, 0x68, 0x87, 0xe3, 0x5b, 0x10, 0x85, 
-0x62, 0x37, 0xe0, 0x58, 0x4a, 0x96, 0xa9, 0x65, 0x50, 0x74, 0x3a, 0xb9, 0xf6, 0x65, 0xb0, 0xe2, 
-0xc6, 0xfc, 0x89, 0xd2, 0x38, 0x60, 0xa8, 0x6d, 0x9d, 0xd8, 0x54, 0x37, 0xe0, 0x1e, 0x8a, 0xb5, 
-0xcc, 0x1a, 0x93, 0x00, 0xc5, 0x40, 0x85, 0xab, 0x33, 0x92, 0xc2, 0x2a, 0x59, 0x8d, 0x31, 0x71, 
-0xde, 0x28, 0x40, 0x68, 0x14, 0xe6, 0xa2, 0x3a, 0x64, 0xad, 0x1d, 0xdc, 0x9c, 0xcb, 0x3e, 0x75, 
-0xe7, 0x22, 0xb7, 0xce, 0x12, 0x2c, 0x5b, 0xe2, 0x6c, 0x51, 0xb7, 0x7b, 0xd8, 0x54, 0x6f, 0x02, 
-0x7e, 0xef, 0x5f, 0x38, 0xd9, 0x56, 0xf6, 0x15, 0x7b, 0xb7, 0xdd, 0x48, 0xbd, 0x9d, 0x8b, 0x01, 
-0xae, 0xfb, 0x10, 0x5a, 0xeb, 0x90, 0x77, 0xaa, 0xca, 0x17, 0xbd, 0x62, 0xdc, 0x2f, 0x7b, 0x01, 
-0xd7, 0x4e, 0xfe, 0x77, 0x3f, 0xab, 0x66, 0x8f, 0xb2, 0x49, 0xec, 0xc5, 0xa2, 0xce, 0x1e, 0x32, 
-0x5d, 0xdc, 0xf0, 0xc5, 0x73, 0xfc, 0x49, 0xce, 0x75, 0xf3, 0x61, 0xe4, 0x81, 0x94, 0xb4, 0x4f, 
-0x23, 0x0f, 0xa2, 0xca, 0x16, 0x6f, 0xf3, 0x3f, 0x78, 0xa9, 0xba, 0x98, 0x7c, 0x0e, 0xd3, 0x4d, 
-0xc3, 0x8c, 0xb1, 0xf0, 0xa7, 0xe0, 0x4b, 0xbe, 0xe9, 0xcb, 0x54, 0x99, 0xff, 0x62, 0x49, 0x20, 
-0xc6, 0xe5, 0x95, 0x59, 0x81, 0xb3, 0x30, 0xc7, 0xfb, 0x10, 0x92, 0xcd, 0x20, 0xd8, 0x85, 0x0b, 
-0x48, 0xf1, 0xb8, 0x18, 0x39, 0xa1, 0xbd, 0xd8, 0x46, 0x19, 0xcb, 0xa2, 0xfd, 0x31, 0xd1, 0x85, 
-0xde, 0x26, 0xa4, 0x8c, 0x00, 0x1e, 0x73, 0x52, 0x42, 0x2e, 0x56, 0xba, 0x04, 0xf1, 0x92, 0x21, 
-0xc1, 0xf1, 0x8f, 0xae, 0x7d, 0x43, 0x04, 0x5e, 0xed, 0x3b, 0xf9, 0x76, 0xb2, 0xdd, 0x4d, 0x10, 
-0xb9, 0x52, 0x02, 0xd2, 0xac, 0x1e, 0xc4, 0x04, 0x50, 0x93, 0x78, 0xf5, 0x8a, 0xd0, 0x46, 0x81, 
-0x0c, 0x93, 0xfe, 0x47, 0x28, 0xea, 0xae, 0x8f, 0x0f, 0xa2, 0xfe, 0x37, 0x82, 0xae, 0x9a, 0x78, 
-0xc3, 0xf8, 0x08, 0x61, 0x22, 0xfc, 0x33, 0xaa, 0xd4, 0x26, 0x0a, 0x9f, 0xb2, 0x2d, 0x86, 0x44, 
-0xd0, 0x21, 0x96, 0x67, 0xfe, 0x20, 0xcd, 0x43, 0xe0, 0x74, 0x3b, 0xa8, 0x4b, 0x24, 0xf8, 0x3f, 
-0x57, 0x89, 0x08, 0x4d, 0x92, 0xa6, 0xf1, 0x40, 0x65, 0x1d, 0x90, 0x56, 0xea, 0x81, 0x2e, 0xf9, 
-0xcd, 0x25, 0x6c, 0x81, 0x01, 0x64, 0x8f, 0xea, 0x7c, 0x16, 0x44, 0x8f, 0x55, 0x9c, 0x81, 0xbc, 
-0x3c, 0x8e, 0xa2, 0x47, 0x05, 0xf7, 0x30, 0xcd, 0x86, 0xfe, 0x75, 0xe0, 0x96, 0x09, 0xb0, 0x8b, 
-0xd9, 0x52, 0x24, 0x41, 0xef, 0x6a, 0xa4, 0x25, 0x74, 0xdb, 0x47, 0x1d, 0x82, 0x02, 0xd1, 0x7a, 
-0x2d, 0x67, 0xb5, 0x19, 0xd6, 0x7b, 0x93, 0xef, 0xa9, 0x51, 0x13, 0x6e, 0xf4, 0x48, 0x06, 0x8c, 
-0x6b, 0x36, 0x75, 0xa3, 0x50, 0xff, 0x79, 0x34, 0xac, 0x26, 0x9d, 0xc7, 0x4c, 0xfd, 0x20, 0x71, 
-0xeb, 0xb6, 0x8d, 0x79, 0x13, 0x6d, 0x3c, 0x0c, 0xbd, 0xfa, 0x13, 0xc7, 0x4b, 0xed, 0xa7, 0x95, 
-0x09, 0xd9, 0x66, 0x9e, 0x78, 0x49, 0xc8, 0x54, 0x00, 0x48, 0x12, 0x25, 0xc4, 0xf5, 0xda, 0x9d, 
-0x6e, 0xa7, 0x52, 0x29, 0x69, 0xf3, 0x98, 0x24, 0xe3, 0xf9, 0x6f, 0x84, 0xed, 0x4a, 0x9d, 0xff, 
-0xb0, 0x11, 0xc0, 0x34, 0xaa, 0x05, 0x72, 0xb6, 0xe1, 0xcc, 0x77, 0xa6, 0x80, 0x02, 0x50, 0x2f, 
-0xc8, 0x58, 0x6c, 0x4c, 0xe0, 0x06, 0x40, 0xd5, 0x13, 0x37, 0x95, 0xa3, 0x41, 0xc5, 0x8e, 0x64, 
-0x97, 0x44, 0xcd, 0x7b, 0x6b, 0xe2, 0x04, 0x61, 0xf2, 0x36, 0x59, 0x16, 0x81, 0xa8, 0x35, 0x63, 
-0x93, 0x1b, 0x2c, 0xc3, 0xdb, 0x05, 0xb5, 0x2f, 0xea, 0x7c, 0xae, 0xf8, 0xcc, 0x0f, 0x58, 0xc4, 
-0x9c, 0xe2, 0xcb, 0xa4, 0x06, 0xbc, 0x1c, 0x51, 0x7b, 0x0e, 0xdb, 0x42, 0xb9, 0x2a, 0xd7, 0x4a, 
-0xb7, 0x6d, 0xa5, 0xd2, 0x2b, 0x1b, 0x08, 0xe8, 0x58, 0x1f, 0xdd, 0xbd, 0x78, 0x5a, 0xa0, 0x6e, 
-0x40, 0xbd, 0x60, 0x34, 0x49, 0xd4, 0x58, 0x31, 0xc5, 0x0d, 0xf7, 0x88, 0xc0, 0x58, 0x37, 0xff, 
-0x04, 0x9f, 0x65, 0xcc, 0x32, 0xfc, 0x5d, 0x3c, 0xa5, 0x8b, 0xee, 0x0c, 0x3d, 0xaf, 0x07, 0x31, 
-0x76, 0x3e, 0xd5, 0xc2, 0x22, 0x9b, 0xd2, 0x57, 0xaa, 0xdd, 0xed, 0x5f, 0x2c, 0xc0, 0x99, 0xe0, 
-0x59, 0x75, 0x01, 0x63, 0x8e, 0x79, 0x32, 0x95, 0x51, 0x0b, 0x65, 0x2a, 0xd7, 0xed, 0xb4, 0x90, 
-0x46, 0x5e, 0x99, 0x6c, 0x35, 0xcf, 0x29, 0x7d, 0xf1, 0xac, 0x1c, 0xe8, 0x28, 0xae, 0x86, 0x3a, 
-0x87, 0x6c, 0xd4, 0x60, 0xa4, 0x72, 0x55, 0x2a, 0x10, 0xe3, 0xbb, 0x8b, 0x0b, 0x35, 0xcc, 0x66, 
-0x7b, 0xa0, 0x38, 0x17, 0xdc, 0x68, 0x3f, 0x7e, 0xd7, 0x59, 0xe2, 0x20, 0x4c, 0x5e, 0xf9, 0x2e, 
-0x21, 0x52, 0x39, 0x15, 0x60, 0xd5, 0xf8, 0xba, 0x7d, 0xda, 0x16, 0x95, 0xc4, 0x63, 0xf3, 0x26, 
-0xa8, 0x4b, 0xeb, 0x85, 0xb1, 0x0d, 0xe0, 0x1a, 0xf2, 0x58, 0xbd, 0xfe, 0x1e, 0x4d, 0xc0, 0xa1, 
-0x8c, 0xc6, 0xae, 0xe5, 0xd2, 0x4e, 0xec, 0xc0, 0x7e, 0xd2, 0xf2, 0x8a, 0x6c, 0x9d, 0xcf, 0x63, 
-0x19, 0xd9, 0x27, 0x43, 0x75, 0x22, 0x86, 0xb2, 0x2a, 0x7d, 0x10, 0x36, 0x6f, 0xe0, 0xc7, 0x9f, 
-0x38, 0xe7, 0xa7, 0x8a, 0xfb, 0x58, 0xab, 0x0e, 0x98, 0xf9, 0x03, 0x37, 0xed, 0x6b, 0xa9, 0xc8, 
-0x32, 0x6f, 0x10, 0xd3, 0x26, 0xc6, 0x1b, 0xed, 0x03, 0xac, 0x1d, 0xf0, 0xa5, 0x69, 0xfb, 0x1a, 
-0x9f, 0x63, 0x73, 0xd0, 0x06, 0xdf, 0x90, 0xb7, 0x80, 0x3e, 0x11, 0xbc, 0x91, 0x6d, 0xb3, 0x0e, 
-0x1c, 0xd9, 0x4b, 0x7f, 0xc5, 0x57, 0xe0, 0xbd, 0x5f, 0xfa, 0xaf, 0x89, 0x39, 0x65, 0xf0, 0x7c, 
-0xbd, 0x1e, 0x02, 0x87, 0xb0, 0x0d, 0x68, 0x1b, 0xcf, 0xf9, 0x40, 0xdb, 0xea, 0xb2, 0x07, 0xd3, 
-0xa7, 0xf7, 0x40, 0xc4, 0xac, 0x53, 0x1f, 0xe7, 0x77, 0x2f, 0xda, 0x83, 0xb3, 0xe5, 0x5f, 0x17, 
-0xc0, 0x6e, 0x8e, 0x3f, 0xce, 0x14, 0xdc, 0xfd, 0xfe, 0xbb, 0x98, 0xec, 0x33, 0x15, 0xb4, 0x86, 
-0xc5, 0x48, 0x1f, 0xd4, 0xa4, 0x58, 0x83, 0x19, 0xc0, 0x46, 0xb2, 0x5e, 0x94, 0x0d, 0xbc, 0x23, 
-0x37, 0x88, 0x66, 0x9d, 0xee, 0xd4, 0x8d, 0x9b, 0xbf, 0x6b, 0xef, 0xb2, 0xc4, 0x95, 0x6f, 0x0c, 
-0x40, 0xaa, 0x26, 0xea, 0x74, 0xb4, 0x8d, 0x57, 0x7e, 0xde, 0x69, 0x2a, 0xd2, 0x74, 0x4e, 0xb5, 
-0x2c, 0x73, 0x12, 0x3b, 0x91, 0xad, 0xe9, 0x71, 0x28, 0x0f, 0x79, 0x3e, 0x06, 0x6f, 0x28, 0x11, 
-0x55, 0xa0, 0x46, 0x5e, 0x15, 0x7f, 0x50, 0x8f, 0xa3, 0xc3, 0x69, 0x9a, 0xba, 0xe6, 0x3a, 0xf9, 
-0x6c, 0x49, 0xef, 0xb5, 0x60, 0x43, 0x8b, 0xf4, 0x68, 0x5b, 0xbf, 0x31, 0x19, 0x76, 0xee, 0x3c, 
-0x24, 0xc1, 0x5b, 0x7f, 0xb5, 0xdb, 0x5f, 0x93, 0xf6, 0xb2, 0x9a, 0x3f, 0x66, 0x8b, 0x4b, 0xdf, 
-0x92, 0x7e, 0x53, 0xc4, 0x87, 0x25, 0xb8, 0x7f, 0xe0, 0x39, 0xb1, 0x4a, 0x2d, 0xaa, 0x1c, 0x4f, 
-0xcf, 0xf4, 0x5a, 0xe7, 0x25, 0x50, 0xdf, 0x98, 0xf2, 0xbd, 0x24, 0xa0, 0x6e, 0xf6, 0x1d, 0x86, 
-0x10, 0x98, 0x27, 0x08, 0xdd, 0xa4, 0x16, 0x2b, 0x41, 0x97, 0x4b, 0xd6, 0x39, 0xea, 0x45, 0x8c, 
-0xb9, 0xa6, 0x84, 0x2c, 0x16, 0x56, 0xc8, 0x67, 0x82, 0x1b, 0xe3, 0x96, 0x08, 0x82, 0x62, 0x9f, 
-0xce, 0x19, 0xf4, 0x53, 0x0c, 0x9e, 0x8a, 0x47, 0xd3, 0x32, 0x50, 0xf6, 0x80, 0x5d, 0x6e, 0x2b, 
-0x2c, 0x3e, 0x0b, 0x4f, 0x8c, 0xcc, 0x40, 0xfd, 0x96, 0x62, 0x7b, 0xf7, 0x3f, 0xdb, 0xaf, 0xee, 
-0x2f, 0x08, 0xf3, 0xc6, 0x29, 0xe9, 0xa4, 0x70, 0xf2, 0xcd, 0x0a, 0xb7, 0x7d, 0x0f, 0x3e, 0x18, 
-0xe8, 0x82, 0x05, 0xda, 0x30, 0x44, 0x22, 0x9f, 0x62, 0xf5, 0x87, 0x47, 0x0f, 0x34, 0x1d, 0xcf, 
-0xb9, 0x00, 0xc2, 0x1b, 0x5a, 0xf4, 0x38, 0xa1, 0x87, 0xe9, 0xa8, 0xde, 0x82, 0x31, 0x13, 0x42, 
-0xd8, 0x53, 0xf8, 0xa2, 0xb8, 0x88, 0x99, 0xfa, 0xb5, 0x04, 0xe3, 0xbb, 0x26, 0xff, 0xe4, 0x0b, 
-0x45, 0xee, 0x36, 0x56, 0x14, 0xd5, 0x61, 0x05, 0xa9, 0x18, 0xd9, 0x86, 0x9a, 0x0a, 0x24, 0xaf, 
-0x14, 0x98, 0x08, 0xd1, 0x4f, 0x9e, 0xca, 0x85, 0x67, 0xdd, 0x4d, 0xcc, 0x8c, 0x41, 0x21, 0x4a, 
-0x03, 0x83, 0x51, 0xe8, 0xfd, 0xa4, 0xb9, 0x38, 0xd1, 0x2b, 0xe4, 0x10, 0x3d, 0xce, 0x01, 0x46, 
-0x8e, 0xed, 0x20, 0x99, 0x7b, 0x60, 0xec, 0x6c, 0x2e, 0x8d, 0xad, 0x73, 0xa2, 0xc6, 0x43, 0x83, 
-0x73, 0x60, 0x37, 0xe7, 0x90, 0x2b, 0x45, 0xa2, 0xcd, 0x6a, 0xeb, 0x46, 0x76, 0xbb, 0x50, 0xe5, 
-0xce, 0x68, 0xf9, 0xc2, 0x71, 0x9f, 0xca, 0x2a, 0x51, 0x0f, 0x6e, 0xc0, 0x97, 0x44, 0xf3, 0x23, 
-0x3a, 0xba, 0x5b, 0x73, 0x48, 0xf2, 0x35, 0xbf, 0x03, 0xaa, 0x40, 0xc3, 0x23, 0x69, 0x39, 0xff, 
-0xb5, 0x03, 0xa2, 0xc2, 0x0c, 0xb8, 0x99, 0x46, 0xce, 0xa1, 0x7c, 0xd9, 0x22, 0xe5, 0x79, 0x0c, 
-0x35, 0xce, 0x04, 0x9a, 0x6f, 0x11, 0x4b, 0x91, 0x62, 0xd5, 0x8a, 0x54, 0x79, 0xd0, 0x4c, 0x8e, 
-0x18, 0xa8, 0x42, 0x2b, 0x6c, 0xc5, 0x56, 0xad, 0x62, 0x48, 0xa1, 0x8d, 0x57, 0xf1, 0x84, 0xe5, 
-0xce, 0x32, 0xbd, 0x9c, 0xd4, 0xfb, 0xa4, 0x43, 0x71, 0x91, 0xff, 0x3e, 0x9a, 0x81, 0x07, 0xc8, 
-0xd5, 0x47, 0x03, 0x65, 0x52, 0xd1, 0xf6, 0x97, 0xbb, 0x68, 0x93, 0x2f, 0xdb, 0x5c, 0xca, 0x40, 
-0x6b, 0x30, 0x78, 0xab, 0x3e, 0xc9, 0x32, 0xaf, 0x74, 0x83, 0x02, 0xfb, 0x8c, 0xa2, 0x4d, 0xcd, 
-0x8f, 0xc2, 0x55, 0x2c, 0xfc, 0xd3, 0x4f, 0x73, 0xd7, 0x47, 0x7f, 0xf1, 0x6e, 0xb5, 0x07, 0xe4, 
-0x93, 0x2f, 0xac, 0x18, 0x0c, 0xff, 0x7b, 0xa3, 0xe2, 0xbb, 0x1a, 0x7a, 0x33, 0x0b, 0x18, 0x69, 
-0x5a, 0xb2, 0x9e, 0x6f, 0x95, 0xe7, 0x75, 0xaa, 0x5d, 0x0f, 0xd3, 0xba, 0xfb, 0x13, 0xc6, 0x9b, 
-0x0b, 0xe1, 0x1e, 0x39, 0x08, 0xf7, 0x17, 0x2e, 0xce, 0x53, 0xad, 0x01, 0xd3, 0x66, 0xb6, 0xdc, 
-0x35, 0x4f, 0x81, 0xc8, 0x5d, 0xfe, 0x0c, 0x88, 0xa8, 0x11, 0x81, 0x23, 0x55, 0x18, 0xf1, 0x7e, 
-0xe5, 0x3a, 0xd7, 0x5f, 0xe3, 0xae, 0x7d, 0x9f, 0xdb, 0x8c, 0x2e, 0xd0, 0xa2, 0x25, 0xde, 0x89, 
-0x71, 0x5a, 0x92, 0x7b, 0xee, 0xd9, 0xaa, 0x11, 0x5a, 0x75, 0xdc, 0x65, 0x21, 0xe4, 0x35, 0xf3, 
-0x61, 0x18, 0xf3, 0xae, 0x5a, 0xbc, 0x66, 0xa7, 0xee, 0x56, 0xb1, 0x31, 0xbd, 0xea, 0x27, 0xc8, 
-0xa9, 0x72, 0x1f, 0x9e, 0x34, 0xb1, 0x04, 0x61, 0xc3, 0x55, 0xfb, 0x95, 0xe5, 0xa2, 0xde, 0x32, 
-0xcf, 0xfb, 0x26, 0x75, 0x11, 0xbd, 0xae, 0x51, 0x1a, 0x72, 0x02, 0x5d, 0x50, 0x80, 0x65, 0xe2, 
-0x14, 0x30, 0x60, 0xa9, 0xe7, 0xbc, 0x16, 0x6b, 0x5c, 0x25, 0xba, 0x9d, 0xc6, 0x23, 0x5d, 0x7e, 
-0x00, 0xe2, 0x1f, 0x4b, 0x0d, 0xe9, 0x19, 0xa7, 0xd9, 0x8e, 0xf0, 0x0b, 0x94, 0x70, 0x5d, 0xbf, 
-0x23, 0xe0, 0xca, 0xb0, 0x20, 0x7c, 0x30, 0xe2, 0x74, 0x3e, 0x1e, 0xa5, 0x78, 0xbc, 0x35, 0xea, 
-0xb8, 0x2b, 0xdf, 0x8f, 0x21, 0x36, 0x5e, 0x47, 0x14, 0x78, 0xe7, 0x9d, 0x71, 0xc1, 0x35, 0xd0, 
-0x68, 0x2c, 0xca, 0x5f, 0xae, 0xd5, 0x85, 0xf5, 0x79, 0x08, 0x46, 0xf9, 0x5f, 0x2c, 0x50, 0xf6, 
-0xc0, 0x30, 0x6d, 0x54, 0x87, 0x3b, 0xda, 0x47, 0xbf, 0x7d, 0x54, 0xd2, 0x88, 0xb0, 0x64, 0x9e, 
-0x0d, 0xfd, 0x8a, 0x16, 0xc1, 0x51, 0x7c, 0x08, 0xf7, 0xb1, 0x1b, 0xa0, 0x2f, 0x91, 0xb3, 0x6e, 
-0x36, 0x5b, 0xe3, 0xb7, 0x8e, 0xac, 0x61, 0x04, 0xb3, 0x9c, 0x21, 0x89, 0x05, 0x33, 0x6f, 0x0e, 
-0x4e, 0xeb, 0x01, 0xfa, 0xb4, 0x6a, 0x13, 0x4d, 0xfc, 0xe4, 0x2a, 0xb9, 0x06, 0x4c, 0xc8, 0x82, 
-0x98, 0xed, 0x2a, 0x92, 0x4a, 0xa8, 0x88, 0xc7, 0x90, 0xc2, 0x6c, 0x36, 0x02, 0x99, 0x48, 0x1b, 
-0xd8, 0x8f, 0x23, 0xe1, 0x88, 0x5b, 0x7d, 0x01, 0xfe, 0x3e, 0xe4, 0x0c, 0xf7, 0x43, 0xdd, 0xed, 
-0x30, 0x77, 0xd7, 0x00, 0x4b, 0x22, 0x78, 0x89, 0x13, 0xb6, 0x3f, 0xc9, 0xdd, 0x68, 0x08, 0x3a, 
-0x97, 0xe0, 0xb1, 0xe8, 0x22, 0xc8, 0x08, 0xf0, 0x9c, 0x4d, 0xd8, 0x77, 0x23, 0x53, 0xdf, 0x96, 
-0xfb, 0x79, 0x8f, 0xf2, 0x0e, 0x74, 0xb5, 0xa3, 0x38, 0xcc, 0x85, 0xc2, 0x75, 0x36, 0x81, 0x4d, 
-0x23, 0x60, 0xcd, 0x53, 0xdf, 0xa1, 0x14, 0xf4, 0x4e, 0x96, 0x60, 0x40, 0x6e, 0xeb, 0xb7, 0x0d, 
-0x98, 0xf2, 0x67, 0xe5, 0x11, 0x5b, 0x92, 0x83, 0x1c, 0xa4, 0x62, 0x3f, 0xc2, 0xfe, 0xa9, 0xd3, 
-0xbe, 0xf6, 0x3e, 0x61, 0x2a, 0xeb, 0x92, 0x59, 0x11, 0xf4, 0x8f, 0x45, 0xe4, 0x98, 0x4e, 0xc2, 
-0xe8, 0x21, 0xbd, 0xd7, 0x16, 0xc7, 0xa1, 0x1d, 0xd8, 0x96, 0x41, 0xe4, 0x03, 0xa7, 0x74, 0x22, 
-0xb2, 0x63, 0x96, 0xee, 0x49, 0x78, 0xd5, 0xea, 0xb6, 0x46, 0x77, 0xe1, 0x3e, 0xf1, 0x95, 0x25, 
-0x5c, 0x8f, 0xe5, 0x01, 0xda, 0x3f, 0x20, 0xca, 0xf2, 0x9d, 0x2e, 0x43, 0x0b, 0xdb, 0x32, 0x77, 
-0xf6, 0x58, 0xc6, 0xef, 0x4b, 0xbb, 0xff, 0xcb, 0x63, 0xac, 0x78, 0x19, 0x3e, 0xca, 0x93, 0xae, 
-0x3a, 0x1d, 0xd1, 0x5f, 0x9c, 0x72, 0x2e, 0xe4, 0x1d, 0x42, 0xc9, 0x7d, 0xfb, 0x57, 0x19, 0x09, 
-0x0d, 0xe5, 0x46, 0x82, 0xca, 0xf8, 0x2b, 0x70, 0x7f, 0xc1, 0x4f, 0x68, 0x16, 0xd2, 0xa0, 0x34, 
-0x50, 0xbb, 0x83, 0x5d, 0xc1, 0x6a, 0x80, 0x99, 0x20, 0xba, 0x87, 0x64, 0x39, 0xed, 0xbf, 0x07, 
-0x6d, 0x96, 0xe4, 0x5e, 0x1f, 0xa4, 0xfd, 0x7d, 0xc7, 0x8b, 0x41, 0x6c, 0xa8, 0x92, 0x3b, 0xba, 
-0x86, 0xb0, 0xca, 0x09, 0x8e, 0x45, 0xad, 0x2e, 0x3c, 0x1a, 0xdd, 0x42, 0x32, 0xea, 0x49, 0x1b, 
-0xfd, 0x58, 0xa9, 0xf0, 0x64, 0xb2, 0xf7, 0x95, 0xc0, 0x13, 0x38, 0x84, 0x1f, 0x47, 0xd5, 0x8a, 
-0x0d, 0xa7, 0x2b, 0xda, 0x10, 0xc3, 0x46, 0x5d, 0x27, 0xb3, 0x81, 0xc4, 0x44, 0xcf, 0x01, 0x6a, 
-0xfa, 0x55, 0xca, 0x05, 0x7a, 0x98, 0x10, 0x6c, 0x82, 0x23, 0xb4, 0x52, 0xd8, 0xa8, 0x07, 0xb6, 
-0x3d, 0x74, 0xa1, 0x20, 0x01, 0x70, 0x2a, 0x3e, 0x91, 0xa8, 0x35, 0x8a, 0x7c, 0xb3, 0x3a, 0x87, 
-0x08, 0x7d, 0xaf, 0xc8, 0x2a, 0x93, 0x5a, 0xe6, 0x34, 0xfc, 0x00, 0xc3, 0x2c, 0x20, 0x57, 0x38, 
-0x8f, 0xc5, 0x28, 0x63, 0x9e, 0x19, 0xab, 0x6e, 0xd3, 0x3a, 0x74, 0xc2, 0x67, 0xed, 0x7e, 0x49, 
-0x05, 0xd8, 0x77, 0xc6, 0xfd, 0x9b, 0x4b, 0xd1, 0x92, 0x41, 0x12, 0x75, 0xa1, 0x28, 0x91, 0x16, 
-0x40, 0xc2, 0x9a, 0x55, 0x86, 0x5f, 0xda, 0x09, 0xc4, 0xa2, 0x85, 0x44, 0xf7, 0x16, 0x8f, 0x67, 
-0x52, 0xb8, 0x13, 0x3a, 0xb1, 0xd0, 0x74, 0x98, 0x2f, 0x9c, 0xaa, 0x25, 0xde, 0x8c, 0xb1, 0xe9, 
-0x10, 0x40, 0xf7, 0xaa, 0x39, 0xf3, 0xb7, 0x6e, 0x97, 0xdd, 0x14, 0xa6, 0x91, 0x26, 0x10, 0xad, 
-0x40, 0xcf, 0x12, 0xa5, 0xb3, 0x8f, 0x5a, 0xf3, 0x4e, 0xa8, 0x35, 0x81, 0x91, 0x49, 0x2d, 0xd4, 
-0x56, 0x27, 0xf6, 0x10, 0x30, 0xdb, 0x74, 0x5a, 0x2a, 0x1d, 0xea, 0x37, 0x65, 0xf6, 0xcf, 0x80, 
-0xc3, 0xb2, 0x57, 0x69, 0x86, 0xab, 0xdb, 0x90, 0x6e, 0x0a, 0x44, 0x26, 0x9c, 0xd2, 0x03, 0x6e, 
-0xe4, 0xae, 0xfc, 0x67, 0xb9, 0xea, 0x77, 0x35, 0x69, 0xbb, 0x7e, 0xf1, 0x56, 0x9a, 0x85, 0xfe, 
-0xd2, 0x04, 0x4e, 0x2f, 0x9d, 0xf3, 0xaf, 0x3e, 0x9a, 0x13, 0xe3, 0xad, 0x4d, 0xe8, 0x2e, 0x55, 
-0xa3, 0x00, 0xcb, 0x8a, 0x1a, 0x6d, 0x49, 0xe0, 0x85, 0xd3, 0xbe, 0x55, 0xfb, 0xb3, 0xce, 0x0d, 
-0x58, 0xdc, 0x66, 0x4b, 0x05, 0xf2, 0x6c, 0xde, 0x61, 0x4d, 0xf9, 0x18, 0x65, 0xee, 0xcb, 0x85, 
-0x16, 0xa0, 0x41, 0x6e, 0xb7, 0xe5, 0x98, 0x04, 0x6d, 0x1c, 0xa7, 0xd0, 0x84, 0x30, 0xbf, 0xe7, 
-0x0d, 0xb9, 0x4c, 0x27, 0xaa, 0x54, 0x97, 0xbc, 0x62, 0xab, 0x19, 0x52, 0x69, 0x83, 0xbe, 0x1e, 
-0x6c, 0x2d, 0xaa, 0xcf, 0x62, 0xde, 0x54, 0x83, 0xd6, 0x23, 0x35, 0xe8, 0xbc, 0x2b, 0xf6, 0x7d, 
-0x53, 0x6d, 0x0d, 0xe1, 0xb6, 0x38, 0xd4, 0xab, 0xf9, 0x9e, 0xda, 0x6c, 0x00, 0x30, 0xea, 0xde, 
-0xd7, 0xfd, 0x5e, 0x75, 0x14, 0x4e, 0x38, 0x5c, 0xd3, 0x9c, 0x06, 0x77, 0x92, 0x48, 0x0b, 0xe8, 
-0x22, 0x66, 0x2e, 0xcf, 0x4e, 0xd8, 0xfd, 0x5a, 0x70, 0xe6, 0x51, 0xf9, 0x72, 0x17, 0xcb, 0x2f, 
-0xd8, 0x19, 0xf8, 0x0b, 0xc5, 0xe8, 0x70, 0xb5, 0x17, 0x65, 0xbf, 0x7b, 0xec, 0x4e, 0xc3, 0x15, 
-0xf9, 0x6c, 0x7f, 0xbd, 0xa5, 0x12, 0x6e, 0x04, 0xea, 0xa1, 0x10, 0xd3, 0xbe, 0x06, 0x61, 0xc6, 
-0x2e, 0xe6, 0xb6, 0x8c, 0x14, 0x3f, 0x55, 0x2b, 0x7c, 0x45, 0x9c, 0xc6, 0x00, 0x2a, 0xad, 0xce, 
-0xfd, 0x44, 0x06, 0xcc, 0x37, 0xab, 0x1a, 0x6c, 0x3b, 0xa6, 0xda, 0x8b, 0x16, 0x72, 0x28, 0xdb, 
-0xbd, 0x31, 0x89, 0x72, 0xd6, 0x19, 0x8d, 0xf2, 0xdc, 0x45, 0x97, 0xfa, 0x34, 0x7e, 0xf2, 0x23, 
-0xab, 0x14, 0x2f, 0xda, 0x7f, 0x62, 0x9d, 0xf1, 0x74, 0x13, 0xfd, 0x9e, 0xd0, 0x57, 0x29, 0xba, 
-0xe8, 0x24, 0xa0, 0x72, 0xb9, 0x49, 0x0d, 0xac, 0x51, 0xd0, 0xde, 0x8e, 0x12, 0xa7, 0x81, 0xd8, 
-0xf5, 0x5c, 0xe8, 0x4e, 0x05, 0xfb, 0x55, 0x41, 0x7f, 0x9c, 0xfa, 0x8a, 0x18, 0xcd, 0x10, 0xfb, 
-0x29, 0x87, 0x93, 0xee, 0x25, 0x3a, 0xea, 0x0e, 0xe0, 0xb9, 0xfa, 0x81, 0x1c, 0x3a, 0xed, 0xa5, 
-0x6f, 0xf7, 0x8f, 0xcf, 0x06, 0x70, 0x45, 0x20, 0x98, 0xed, 0x30, 0xa6, 0x79, 0x58, 0xc2, 0x26, 
-0x0a, 0x84, 0x5e, 0xf2, 0x90, 0xa2, 0x47, 0x5b, 0x84, 0x3b, 0x06, 0xd1, 0xb9, 0x6a, 0xa3, 0xc6, 
-0x87, 0x29, 0xba, 0xe5, 0x1d, 0xcc, 0x58, 0x8a, 0xc5, 0xae, 0x44, 0xec, 0x74, 0x37, 0x9e, 0xc8, 
-0x06, 0x93, 0x34, 0x26, 0xd9, 0x45, 0x9f, 0x81, 0x61, 0xb9, 0x76, 0x55, 0xaf, 0x3d, 0x9b, 0x04, 
-0xdf, 0xa3, 0x47, 0x96, 0xb3, 0x06, 0x8c, 0xa4, 0xdf, 0x48, 0x94, 0x56, 0xd5, 0x28, 0x9b, 0x5c, 
-0x46, 0x75, 0x2d, 0x95, 0xf8, 0x25, 0x3c, 0x81, 0x9a, 0xd1, 0x78, 0x5d, 0xdc, 0xbe, 0xee, 0xa5, 
-0xcf, 0x0c, 0x31, 0x74, 0x8e, 0x5e, 0x99, 0x1a, 0x53, 0xe3, 0xa1, 0x8e, 0x75, 0x29, 0xe7, 0xca, 
-0x94, 0x76, 0xf0, 0x62, 0xe3, 0x54, 0xc9, 0x7d, 0x49, 0x66, 0xed, 0x24, 0x3c, 0xc0, 0x5f, 0xb6, 
-0x38, 0x76, 0x65, 0x10, 0xd5, 0xbc, 0x9d, 0x62, 0x50, 0xf6, 0x6a, 0x8d, 0x41, 0x19, 0x36, 0xba, 
-0x84, 0xc6, 0x2d, 0xb0, 0x19, 0x8f, 0x44, 0x9a, 0x0c, 0xcd, 0x8b, 0x3d, 0xd9, 0x2f, 0x7a, 0xf7, 
-0x69, 0x26, 0x7e, 0x5e, 0xf1, 0x4d, 0x3f, 0xbb, 0x2e, 0x7c, 0xb2, 0x39, 0xdb, 0x68, 0x8d, 0xc9, 
-0x1f, 0x61, 0x31, 0xd8, 0x78, 0xe8, 0x36, 0x71, 0xdd, 0x3d, 0xb8, 0xcd, 0x00, 0xb1, 0x5e, 0x9e, 
-0x8a, 0x55, 0x03, 0x47, 0x98, 0xc1, 0x08, 0xb3, 0x11, 0x47, 0x66, 0x1d, 0x9e, 0xaa, 0xea, 0xb4, 
-0xd4, 0x62, 0xc0, 0x22, 0x8a, 0x04, 0xf1, 0x48, 0x75, 0x34, 0xbd, 0x4e, 0x24, 0xc2, 0x81, 0x0d, 
-0xb5, 0xc4, 0x52, 0x92, 0xf0, 0xe3, 0x0b, 0x1f, 0xff, 0x6d, 0x54, 0xd7, 0x64, 0xa4, 0x2b, 0x7a, 
-0x0f, 0xf4, 0x7f, 0x04, 0xb5, 0x1b, 0x88, 0x49, 0xf2, 0xb5, 0x62, 0x83, 0xbd, 0x05, 0xe9, 0x23, 
-0x3f, 0x9a, 0xd0, 0x2a, 0xf0, 0x1b, 0x5d, 0x82, 0xfa, 0x36, 0xcb, 0x1d, 0x5e, 0xd7, 0x3e, 0x63, 
-0xc9, 0x2f, 0x02, 0xf1, 0x3e, 0xe5, 0x88, 0xcc, 0xfd, 0x1f, 0xe1, 0x4c, 0x7a, 0xa3, 0x55, 0xf4, 
-0x12, 0x4a, 0x20, 0xfb, 0x33, 0x7e, 0x68, 0x17, 0x89, 0x5b, 0xf3, 0xd7, 0x4e, 0xee, 0x3d, 0xb7, 
-0x86, 0x25, 0x5f, 0x16, 0xf5, 0xbc, 0x4c, 0x0b, 0x58, 0x24, 0x10, 0xba, 0x38, 0xaa, 0x1d, 0x8e, 
-0xf4, 0x0f, 0xb4, 0x57, 0xa2, 0x80, 0xcf, 0x09, 0x27, 0xea, 0xc4, 0xae, 0x5a, 0x41, 0x04, 0xca, 
-0x92, 0x39, 0x0a, 0xc7, 0xec, 0xab, 0xdf, 0x25, 0x4f, 0x97, 0x3f, 0xe4, 0x6f, 0xed, 0xc4, 0x79, 
-0x34, 0xab, 0x59, 0xf3, 0x07, 0x9b, 0xc3, 0x3a, 0x94, 0xbd, 0x0b, 0x34, 0xc8, 0x1d, 0x67, 0xcd, 
-0x0d, 0x9d, 0x15, 0x93, 0x76, 0xb7, 0x0f, 0xa2, 0xdf, 0xee, 0x04, 0xa7, 0x44, 0x5e, 0xb4, 0xa1, 
-0x4d, 0x09, 0x5b, 0x74, 0xa4, 0xd8, 0x7b, 0x43, 0xcb, 0x34, 0x73, 0xe4, 0xd2, 0x69, 0x30, 0x7b, 
-0xdc, 0x58, 0xb7, 0x80, 0xe1, 0x4f, 0x35, 0x8c, 0x16, 0x40, 0xfe, 0x4d, 0xda, 0x6a, 0x9b, 0xe8, 
-0x8d, 0xd1, 0x10, 0xe5, 0x78, 0xd4, 0x1a, 0x68, 0x27, 0xa0, 0x7b, 0x1d, 0x43, 0x2f, 0x7d, 0x97, 
-0x48, 0xaf, 0x32, 0x83, 0x3f, 0xb4, 0xfc, 0xd9, 0x38, 0x50, 0xa1, 0x8f, 0x62, 0xdf, 0xbe, 0x2c, 
-0x7b, 0x1c, 0xe1, 0x98, 0x56, 0xa9, 0x69, 0xc7, 0x8d, 0xe1, 0x01, 0x68, 0x8b, 0xd7, 0xc3, 0x4c, 
-0x8f, 0x0d, 0x72, 0xf0, 0x85, 0x25, 0xf4, 0x79, 0x0f, 0x9c, 0xb4, 0x73, 0x1c, 0xad, 0x4f, 0x33, 
-0xba, 0x8f, 0xac, 0x66, 0xcf, 0x16, 0xbc, 0xdf, 0xaa, 0x67, 0xc3, 0xa1, 0x07, 0x94, 0xb1, 0x4b, 
-0xe2, 0xbc, 0x1f, 0xab, 0x10, 0xdd, 0x7c, 0x08, 0xc4, 0x71, 0xd7, 0xb3, 0x3f, 0x67, 0x88, 0xe1, 
-0xad, 0xc4, 0x47, 0x83, 0x97, 0xfb, 0x06, 0x5e, 0xa5, 0xd3, 0x94, 0x02, 0xfc, 0x6a, 0x46, 0x99, 
-0xaa, 0x87, 0x4d, 0x1e, 0x8f, 0xee, 0x2a, 0x71, 0xe6, 0xb3, 0xa0, 0x76, 0x53, 0x07, 0x90, 0x6c, 
-0xd5, 0x03, 0x61, 0x7f, 0x23, 0xa8, 0x13, 0x64, 0xff, 0x4a, 0x14, 0x80, 0xb4, 0x61, 0xdf, 0x1d, 
-0xe8, 0x46, 0xab, 0xfe, 0x9b, 0x74, 0xec, 0x8c, 0x54, 0xfa, 0x49, 0xcb, 0x20, 0xf3, 0x2b, 0x4a, 
-0x71, 0xb1, 0x52, 0x90, 0xc8, 0x0b, 0x84, 0x1f, 0xc3, 0xf4, 0xe6, 0x2d, 0x48, 0xfa, 0x13, 0x27, 
-0xf4, 0xb4, 0xa4, 0x23, 0x5a, 0x8c, 0xfb, 0x41, 0x9c, 0xca, 0x2c, 0xf4, 0x0f, 0x5e, 0x7b, 0xc8, 
-0x03, 0x75, 0x94, 0xad, 0x11, 0xcb, 0x3d, 0x59, 0xb3, 0x1f, 0xa8, 0x40, 0x60, 0xb0, 0xf0, 0x3b, 
-0xe7, 0x35, 0xdc, 0xb1, 0x61, 0xa9, 0xcd, 0x59, 0xde, 0x00, 0xf0, 0x16, 0xc8, 0x08, 0x70, 0x9b, 
-0x5f, 0xbc, 0xcc, 0x23, 0xf9, 0x54, 0x0c, 0x6b, 0xa7, 0x3f, 0xd0, 0x0f, 0xef, 0x37, 0x7b, 0xfb, 
-0x11, 0xad, 0x4d, 0x38, 0xa5, 0x78, 0x27, 0xe6, 0x69, 0xa8, 0xd2, 0x53, 0x9f, 0x34, 0xac, 0xbc, 
-0x54, 0xfe, 0xcf, 0x83, 0x60, 0xc4, 0x14, 0x7c, 0x0c, 0x5e, 0x39, 0x01, 0xea, 0x44, 0x8d, 0x73, 
-0x09, 0x39, 0x87, 0x52, 0xec, 0xca, 0x25, 0xf8, 0x38, 0x95, 0x66, 0x41, 0xa0, 0x27, 0x6a, 0xf6, 
-0x9d, 0x34, 0xed, 0x4f, 0x01, 0xd1, 0x9f, 0x2e, 0x7d, 0xf8, 0xd3, 0x2c, 0x6b, 0xd7, 0x44, 0xc4, 
-0x25, 0x3a, 0x78, 0xc9, 0x32, 0xe3, 0x15, 0xf5, 0x6f, 0x0e, 0xe0, 0x32, 0x78, 0xa6, 0xdb, 0x83, 
-0x1d, 0x4a, 0xd7, 0x2a, 0xbd, 0x5f, 0xf9, 0x43, 0xa7, 0xf0, 0xbf, 0xda, 0x51, 0x37, 0xd2, 0x88, 
-0xdc, 0xbd, 0x6a, 0xd0, 0x29, 0x8c, 0x54, 0x10, 0x77, 0xd4, 0x56, 0x85, 0x29, 0xb5, 0x06, 0xab, 
-0x35, 0xdf, 0xbc, 0x61, 0x3f, 0xa9, 0xd6, 0x86, 0x38, 0x13, 0xbf, 0x6b, 0x28, 0xf8, 0x95, 0xd6, 
-0x66, 0x80, 0x9a, 0x17, 0x8e, 0x6b, 0xc3, 0x95, 0x63, 0x0f, 0x83, 0xef, 0x0a, 0xbb, 0xac, 0x1a, 
-0xe7, 0x02, 0x8e, 0x3c, 0xc0, 0xd6, 0x24, 0xf2, 0xa2, 0x56, 0xdf, 0x35, 0x82, 0xba, 0x2c, 0x14, 
-0xde, 0x68, 0x99, 0xfc, 0x06, 0x92, 0x27, 0xdd, 0xcd, 0x15, 0x6b, 0xf7, 0x04, 0x86, 0xf3, 0x3b, 
-0x71, 0xc2, 0x8e, 0x9f, 0xe9, 0x4d, 0x90, 0x1c, 0xe7, 0x12, 0x30, 0x6d, 0x3f, 0xac, 0xd2, 0xe8, 
-0x8e, 0xc3, 0x4d, 0x73, 0x2a, 0xc2, 0x4a, 0x1e, 0x5a, 0x73, 0xea, 0xbe, 0xff, 0x08, 0x43, 0xb2, 
-0x16, 0x2c, 0xbb, 0x41, 0x00, 0xe9, 0x6b, 0x19, 0x8d, 0x39, 0x22, 0x45, 0xdd, 0x90, 0xef, 0xa5, 
-0xd9, 0xf4, 0xc7, 0x87, 0xb6, 0x30, 0x5b, 0x22, 0xf0, 0xb4, 0xd6, 0x6e, 0x18, 0x42, 0x5e, 0x77, 
-0x03, 0xd4, 0x7d, 0xca, 0xb9, 0x89, 0x56, 0xd0, 0x47, 0x14, 0x90, 0xa9, 0x79, 0xfc, 0x1d, 0x3c, 
-0x5f, 0x05, 0xa1, 0x51, 0x12, 0xb4, 0x7b, 0xea, 0x6d, 0x50, 0xde, 0x1c, 0x87, 0xaf, 0x52, 0x2d, 
-0xd5, 0x5c, 0xba, 0xfc, 0xc9, 0x51, 0x11, 0xc0, 0x5d, 0xfe, 0x0f, 0x88, 0xe3, 0x1e, 0x7e, 0xcb, 
-0x15, 0x32, 0x8b, 0x0c, 0xb6, 0xf7, 0x5b, 0x00, 0x2b, 0x96, 0x1e, 0xec, 0x43, 0xa9, 0xf2, 0x6b, 
-0xb7, 0x9e, 0x02, 0x65, 0xe2, 0x3d, 0xda, 0x5e, 0x24, 0x85, 0x6f, 0xed, 0x01, 0x7a, 0x59, 0x98, 
-0xfc, 0xce, 0x80, 0xeb, 0x3c, 0xde, 0x55, 0x32, 0x0e, 0x41, 0xae, 0xd2, 0x53, 0x36, 0xad, 0xe9, 
-0x4c, 0xd4, 0x3c, 0xc6, 0x4a, 0x2a, 0x72, 0x52, 0x85, 0x65, 0xb0, 0x73, 0x48, 0x96, 0x6a, 0xb9, 
-0x2d, 0xce, 0x65, 0x1f, 0xf4, 0x71, 0xa4, 0xf9, 0x7c, 0x4f, 0xc6, 0x35, 0x83, 0x53, 0xc7, 0x49, 
-0x09, 0x58, 0x96, 0xc1, 0x4c, 0x26, 0xbb, 0x10, 0xa4, 0x21, 0x7a, 0x5a, 0x68, 0x27, 0xd2, 0x41, 
-0xb1, 0x77, 0xda, 0xee, 0x99, 0x83, 0x16, 0x38, 0x5a, 0x01, 0xfd, 0xb1, 0x87, 0xde, 0x94, 0xb4, 
-0xce, 0x2e, 0x86, 0x20, 0x96, 0x56, 0xd0, 0x9c, 0xf1, 0x5a, 0xdc, 0x7b, 0x91, 0xc5, 0xd5, 0x4b, 
-0xe1, 0xa5, 0x6e, 0xea, 0x05, 0x2c, 0x68, 0x3d, 0x71, 0x4d, 0x27, 0x9d, 0x6b, 0xff, 0xd8, 0x94, 
-0xc8, 0x47, 0x29, 0xe6, 0x8f, 0xb9, 0xdb, 0x9d, 0xae, 0x2a, 0x55, 0x15, 0xfa, 0x35, 0xe2, 0x1f, 
-0xaf, 0x65, 0xe6, 0x28, 0x5b, 0xc5, 0x95, 0xb6, 0xec, 0x71, 0x8f, 0xbf, 0xee, 0x21, 0x8a, 0x30, 
-0x9e, 0xb7, 0xf2, 0x42, 0x5e, 0xbd, 0x93, 0xc6, 0x7c, 0xa1, 0x43, 0x02, 0x9a, 0x69, 0x3b, 0xad, 
-0x30, 0x98, 0x68, 0x40, 0xa5, 0x36, 0x94, 0xb4, 0x57, 0x78, 0x9e, 0x49, 0x71, 0x91, 0xa3, 0x41, 
-0xb1, 0x72, 0xe2, 0x9f, 0x04, 0xc8, 0x33, 0x83, 0x22, 0x3f, 0xeb, 0xc0, 0x17, 0x4f, 0x95, 0x78, 
-0xc6, 0x0f, 0xa0, 0x30, 0x8f, 0xe3, 0xc5, 0x0d, 0x65, 0x1e, 0x47, 0x9a, 0x17, 0x79, 0xa6, 0xbd, 
-0x72, 0xe3, 0x24, 0xba, 0x7a, 0xdf, 0x05, 0x86, 0x1d, 0x76, 0x9d, 0x68, 0xe0, 0x93, 0xf3, 0xc2, 
-0x37, 0xd4, 0xfe, 0x1e, 0xa5, 0xdd, 0x0a, 0x85, 0x45, 0xb2, 0xea, 0x09, 0x8f, 0x46, 0x5e, 0xcd, 
-0x02, 0x8a, 0x2a, 0xb8, 0x71, 0xed, 0xa1, 0x12, 0xa6, 0x82, 0x3e, 0xd3, 0x77, 0xe3, 0x90, 0x65, 
-0xd7, 0x47, 0xfb, 0x38, 0xbc, 0xa9, 0x7f, 0xf8, 0x54, 0x8a, 0xa7, 0x03, 0x4c, 0xc7, 0x75, 0xf4, 
-0x9a, 0x24, 0x69, 0xa2, 0x17, 0x60, 0x04, 0xf1, 0x9f, 0x43, 0xd9, 0x62, 0x13, 0x71, 0xb9, 0x7e, 
-0x3b, 0x8a, 0x1f, 0xf7, 0x13, 0x5f, 0x2a, 0x81, 0x09, 0x5c, 0xbe, 0x97, 0xaf, 0x54, 0xbf, 0x9b, 
-0x1c, 0xb3, 0xe7, 0x0f, 0x7d, 0x19, 0xa3, 0x37, 0x7a, 0x63, 0x02, 0xa7, 0x7c, 0x32, 0x12, 0x6c, 
-0xf2, 0x86, 0xe9, 0x49, 0x71, 0x04, 0x91, 0xbe, 0x80, 0x09, 0xca, 0x84, 0x37, 0x11, 0x6d, 0xd7, 
-0x46, 0x19, 0xe0, 0x37, 0x64, 0xa6, 0x57, 0xda, 0x16, 0x0c, 0x8f, 0xa7, 0x71, 0x07, 0x22, 0xf0, 
-0x39, 0x1a, 0x8d, 0x62, 0x25, 0xf3, 0x8a, 0xe9, 0xd3, 0x7a, 0xb6, 0xcc, 0xf2, 0x71, 0x0c, 0xdc, 
-0x26, 0xfe, 0xc8, 0x1f, 0xe1, 0x11, 0xc6, 0x7f, 0xf2, 0x52, 0x38, 0x5f, 0x7b, 0x4f, 0xd9, 0x97, 
-0xf7, 0xca, 0x2d, 0x8e, 0x6f, 0xd1, 0xa5, 0xf8, 0x44, 0xb6, 0xd4, 0x1b, 0xb0, 0x50, 0x26, 0xb9, 
-0x33, 0xd8, 0xaa, 0x5c, 0xb6, 0x04, 0xd0, 0x4b, 0xfd, 0x89, 0x5f, 0x0a, 0xf3, 0xa1, 0x2b, 0x5c, 
-0xbb, 0xdc, 0x2e, 0xb1, 0x14, 0x5f, 0xa5, 0x0c, 0x24, 0x9e, 0x5a, 0x10, 0xec, 0x33, 0x53, 0xf9, 
-0x19, 0x9a, 0x7b, 0x50, 0xc3, 0xe5, 0x97, 0x21, 0x42, 0xec, 0xd5, 0x0e, 0xe0, 0x1e, 0x6a, 0x33, 
-0x70, 0xea, 0x1a, 0x2e, 0xa2, 0x14, 0x54, 0xec, 0x2d, 0xb2, 0xca, 0x17, 0xdd, 0x05, 0x34, 0xc3, 
-0x0d, 0x63, 0x3a, 0xbd, 0x1e, 0x61, 0x2b, 0xb4, 0xd6, 0x7d, 0xe4, 0x32, 0x47, 0xd4, 0x3a, 0x6c, 
-0x80, 0x0a, 0xc3, 0xac, 0xed, 0xdd, 0x2f, 0x0f, 0x66, 0xc7, 0xaf, 0x6e, 0xa4, 0x46, 0x96, 0xb1, 
-0xee, 0xca, 0x30, 0x14, 0x7f, 0xd8, 0xfb, 0x0a, 0xd1, 0x83, 0x58, 0x45, 0xc1, 0xcf, 0x51, 0x0d, 
-0xaf, 0xf6, 0x98, 0x57, 0xce, 0xfe, 0x4e, 0xc2, 0x3b, 0x1d, 0xb4, 0x9a, 0xda, 0xa8, 0x5e, 0x3e, 
-0xff, 0x4e, 0xdc, 0x99, 0xb9, 0xf1, 0x52, 0x88, 0x27, 0xb0, 0x7a, 0xcc, 0x43, 0x00, 0xff, 0xc0, 
-0x7f, 0x66, 0xc7, 0x27, 0xf8, 0xe0, 0x4b, 0x67, 0xad, 0xe8, 0xd9, 0xb5, 0xcd, 0x75, 0x0c, 0x46, 
-0x17, 0x56, 0x23, 0x00, 0x50, 0xc1, 0xeb, 0x46, 0x6a, 0xad, 0x3b, 0x5f, 0xec, 0x30, 0x68, 0x24, 
-0xcd, 0x17, 0xbc, 0x90, 0xf9, 0x15, 0xaf, 0x09, 0x48, 0x5d, 0x7b, 0xae, 0xf4, 0x0c, 0x30, 0x1d, 
-0xe8, 0x56, 0x66, 0xfe, 0x43, 0x6e, 0xec, 0x9f, 0x8b, 0x70, 0xe5, 0x2c, 0xf6, 0x69, 0x8c, 0x19, 
-0x2b, 0xa0, 0xc5, 0x3b, 0x69, 0x46, 0xc8, 0xff, 0x92, 0x54, 0x01, 0xf7, 0x89, 0x3a, 0xd8, 0x7c, 
-0xe4, 0x4c, 0xc8, 0x83, 0xbd, 0x64, 0x90, 0xc6, 0x6f, 0x3a, 0xd8, 0x29, 0xab, 0x0f, 0x37, 0xbd, 
-0xad, 0x64, 0x9e, 0x58, 0xaa, 0x45, 0xd2, 0xf6, 0x4d, 0xdd, 0xae, 0xfb, 0x68, 0xb7, 0x39, 0x9c, 
-0x82, 0x0c, 0x52, 0x93, 0x86, 0xee, 0x72, 0x9b, 0xe0, 0x27, 0xcf, 0x93, 0xfe, 0xe1, 0xa3, 0x45, 
-0x0d, 0x52, 0xcb, 0xb9, 0x8b, 0xf8, 0xaa, 0x25, 0xe6, 0x57, 0x8d, 0x3c, 0x25, 0x4c, 0x8f, 0xf8, 
-0xe2, 0x07, 0x50, 0x35, 0xe4, 0xc0, 0xfc, 0x38, 0x1d, 0x72, 0x4f, 0xf5, 0x65, 0x22, 0x49, 0x79, 
-0x33, 0x95, 0xda, 0xa7, 0x2b, 0x62, 0xe9, 0x8a, 0xde, 0x19, 0xc0, 0x3f, 0x21, 0x89, 0x06, 0xa5, 
-0x5a, 0xdf, 0x65, 0x0d, 0xc4, 0x29, 0xeb, 0x77, 0xa0, 0x2e, 0x6f, 0x1d, 0x44, 0xa4, 0x0a, 0xe7, 
-0xc7, 0x5a, 0x0d, 0xf5, 0x9a, 0x6f, 0xaf, 0x39, 0x49, 0xe8, 0x55, 0x34, 0x81, 0x9c, 0xd1, 0x76, 
-0x12, 0x56, 0x80, 0x35, 0x4d, 0xe2, 0xa8, 0xbe, 0x92, 0xf7, 0xe1, 0x83, 0x9c, 0x2c, 0x5e, 0x88, 
-0x99, 0x03, 0xd6, 0x85, 0xa6, 0xb8, 0x47, 0xde, 0x8a, 0x0b, 0xd7, 0xa7, 0x2e, 0xc2, 0x66, 0x73, 
-0xe0, 0xa2, 0x1b, 0x53, 0x3a, 0xbc, 0x69, 0x80, 0x90, 0x07, 0x37, 0x99, 0x84, 0xcd, 0x06, 0x3d, 
-0xf4, 0x4e, 0x0b, 0x84, 0xc2, 0x44, 0xe0, 0xb1, 0x58, 0xec, 0x16, 0x95, 0xd9, 0x82, 0x0e, 0x70, 
-0xab, 0x40, 0xe7, 0x7a, 0x22, 0xca, 0x46, 0xb6, 0x66, 0x90, 0x2b, 0x41, 0x78, 0xb1, 0x26, 0xde, 
-0xa5, 0x01, 0xf2, 0x61, 0x87, 0x6e, 0xdc, 0x7f, 0xf4, 0x74, 0x18, 0x3a, 0x8d, 0x7a, 0xbf, 0x94, 
-0x92, 0x01, 0x5a, 0x43, 0x87, 0xc7, 0x05, 0xd1, 0x73, 0xf5, 0x69, 0xa2, 0x43, 0x5f, 0x21, 0x4f, 
-0xb3, 0xeb, 0x6c, 0x7d, 0x56, 0x08, 0x87, 0x6e, 0xed, 0x93, 0x1e, 0x64, 0x0c, 0x77, 0xc7, 0x4e, 
-0xbc, 0x19, 0xfb, 0xa0, 0x7b, 0xcb, 0x5d, 0xa5, 0x43, 0x98, 0xd4, 0x77, 0x23, 0x04, 0x66, 0x7b, 
-0xdc, 0x8f, 0xa0, 0xd0, 0x3c, 0x8c, 0xa9, 0xc7, 0x5f, 0xf1, 0x07, 0x70, 0xf9, 0x3b, 0xb5, 0x73, 
-0x4a, 0x32, 0x6a, 0xed, 0xb1, 0x72, 0xe8, 0x95, 0xca, 0x2f, 0x8e, 0x42, 0x81, 0x50, 0x19, 0xcf, 
-0x10, 0xb3, 0x60, 0xf7, 0xcc, 0x7d, 0x30, 0x67, 0x91, 0xa1, 0x32, 0x85, 0x25, 0xe1, 0x90, 0x1b, 
-0xd0, 0x99, 0x04, 0xd7, 0xb7, 0x3d, 0x0d, 0x91, 0xbf, 0x2c, 0xf5, 0x08, 0x9d, 0x1e, 0x5e, 0x2d, 
-0x6e, 0xa3, 0x37, 0x65, 0xaf, 0x14, 0xd2, 0xba, 0x1b, 0xf3, 0x72, 0x52, 0x09, 0x95, 0xf6, 0x57, 
-0x9d, 0x76, 0x64, 0x48, 0x1d, 0xeb, 0x8c, 0x37, 0xba, 0x0f, 0xd6, 0xea, 0x86, 0x9c, 0x4b, 0xcb, 
-0xaf, 0xd9, 0x77, 0xbf, 0x13, 0xdf, 0x60, 0x7c, 0xb4, 0x18, 0xc8, 0xa3, 0x38, 0x1f, 0x97, 0x7c, 
-0x35, 0xd4, 0x78, 0x4e, 0xb5, 0x21, 0xec, 0x34, 0x1b, 0xd0, 0x6b, 0xbe, 0xa1, 0x59, 0x17, 0xed, 
-0x06, 0xae, 0xf7, 0xd1, 0x08, 0xe6, 0x16, 0x43, 0x81, 0x59, 0xb8, 0xc9, 0x19, 0xfd, 0x56, 0x2e, 
-0x0c, 0x4c, 0xe6, 0xcc, 0xfc, 0x05, 0x2b, 0x60, 0x27, 0x74, 0xce, 0x98, 0x21, 0xf1, 0x5d, 0x4a, 
-0xab, 0x1f, 0xe5, 0x2b, 0xcd, 0xae, 0xd6, 0x10, 0x82, 0x45, 0x19, 0x30, 0xaf, 0x3e, 0xd0, 0xc2, 
-0x34, 0xab, 0x40, 0xe9, 0x9d, 0x58, 0x16, 0x94, 0x33, 0x73, 0xd2, 0x67, 0x01, 0xb2, 0x1b, 0xbf, 
-0x82, 0x2a, 0xee, 0xb6, 0x8b, 0xcf, 0x54, 0xa8, 0x0e, 0x43, 0xb4, 0x02, 0xe3, 0xba, 0x0f, 0xe8, 
-0x25, 0x40, 0xbd, 0x1e, 0x85, 0x99, 0x04, 0x24, 0xa0, 0xd2, 0x81, 0x0b, 0xdb, 0x60, 0x27, 0x45, 
-0x7c, 0x13, 0xfa, 0xb8, 0xd6, 0x6c, 0x95, 0xf2, 0x3a, 0xc1, 0x8c, 0x02, 0x56, 0xdf, 0xac, 0x1e, 
-0xfa, 0x4a, 0xbb, 0xd5, 0x50, 0xc4, 0x5d, 0x2b, 0x74, 0xf9, 0xac, 0x6c, 0x1d, 0x5b, 0xc7, 0xfb, 
-0x45, 0xa4, 0xd2, 0x6f, 0x89, 0xc6, 0xf1, 0x7f, 0x07, 0xd0, 0xc4, 0x48, 0xfc, 0x77, 0x3e, 0xe8, 
-0x4f, 0x33, 0xc1, 0x29, 0xd0, 0x78, 0x1a, 0x36, 0xaf, 0xfd, 0x3c, 0xe5, 0x82, 0x57, 0xc9, 0x25, 
-0xff, 0x94, 0x65, 0x27, 0xc6, 0x00, 0xe3, 0x5b, 0x2a, 0xf3, 0x20, 0xaa, 0x52, 0x2e, 0xa6, 0x22, 
-0xd4, 0x95, 0x57, 0x75, 0xd8, 0x64, 0xf3, 0x0d, 0xbb, 0x6c, 0x03, 0xf9, 0xa8, 0x61, 0x8e, 0xc0, 
-0x9e, 0x4a, 0x0b, 0x91, 0x30, 0xfa, 0x75, 0x99, 0x35, 0x6f, 0x1c, 0xa2, 0x5f, 0x9a, 0x4f, 0xfb, 
-0xd2, 0x31, 0x92, 0x48, 0x9f, 0x3e, 0xd1, 0xa5, 0xb9, 0x95, 0x82, 0x22, 0x66, 0xb4, 0xe3, 0x50, 
-0xa1, 0xee, 0xbd, 0x0f, 0x7c, 0xe1, 0x2a, 0x90, 0xdb, 0x40, 0xb7, 0x01, 0x79, 0xfb, 0x3a, 0x8e, 
-0xf4, 0xa0, 0xc7, 0xda, 0x97, 0xf1, 0x24, 0x63, 0x15, 0xf9, 0x82, 0xbf, 0x2d, 0xd7, 0xf2, 0x84, 
-0xe2, 0xb5, 0x48, 0x2d, 0xef, 0xd7, 0x38, 0x70, 0x15, 0x55, 0x63, 0x10, 0x9f, 0x3d, 0xe8, 0xbc, 
-0x28, 0xf0, 0x60, 0x82, 0x2e, 0x70, 0x56, 0xa1, 0x6a, 0x8e, 0xae, 0xde, 0x54, 0xca, 0xef, 0xbc, 
-0x5b, 0xfa, 0xaa, 0x51, 0x91, 0x37, 0xbb, 0xd7, 0xf1, 0xa9, 0x74, 0x00, 0xe7, 0x31, 0xae, 0x58, 
-0x7f, 0xe2, 0x27, 0x9e, 0x75, 0x3b, 0xbe, 0xd0, 0x04, 0x73, 0xee, 0x14, 0x69, 0x08, 0xf3, 0x83, 
-0xba, 0x12, 0x43, 0x8c, 0xef, 0xa2, 0x30, 0x86, 0x65, 0x22, 0xb4, 0x5a, 0x42, 0xad, 0x38, 0xdb, 
-0x51, 0x20, 0x88, 0x0f, 0xda, 0x90, 0x25, 0xa1, 0x7e, 0xdf, 0x8e, 0xb1, 0x41, 0xe7, 0x61, 0xc3, 
-0x05, 0x27, 0xcb, 0xb6, 0x99, 0x01, 0xa5, 0x40, 0x50, 0x80, 0xb3, 0x45, 0x72, 0xf8, 0x15, 0x3b, 
-0xa2, 0x6c, 0x46, 0xe6, 0xc9, 0x93, 0xfa, 0x48, 0x69, 0xe9, 0x29, 0xff, 0x00, 0xac, 0x50, 0xe5, 
-0xa1, 0x42, 0xca, 0x29, 0x39, 0xe2, 0x52, 0xd6, 0x7e, 0xf3, 0x62, 0xe2, 0xad, 0x4c, 0xd4, 0xc2, 
-0x88, 0xdd, 0x55, 0xeb, 0x39, 0xc3, 0x8b, 0x68, 0xae, 0x0f, 0x22, 0xe8, 0x75, 0x06, 0x8c, 0x21, 
-0x5d, 0xda, 0xc3, 0x33, 0x4a, 0x9a, 0x14, 0x71, 0x12, 0x65, 0x33, 0x4f, 0xb3, 0x6d, 0xa5, 0xc1, 
-0x0e, 0x62, 0x89, 0xc3, 0x55, 0x15, 0x68, 0xbe, 0x5a, 0x06, 0x75, 0x60, 0x0f, 0x50, 0xbb, 0x90, 
-0x77, 0xd3, 0x55, 0x08, 0x6f, 0xae, 0x3e, 0x03, 0xa3, 0x5d, 0x0e, 0x93, 0x83, 0x50, 0x9b, 0xfd, 
-0xdd, 0xab, 0xc4, 0xf6, 0x4b, 0x81, 0x1a, 0x94, 0x6e, 0xcb, 0x4d, 0x1e, 0xff, 0x96, 0xd5, 0x18, 
-0xf7, 0x4e, 0x79, 0x31, 0x11, 0x68, 0x45, 0x7b, 0x13, 0x8b, 0x2c, 0x1b, 0xc9, 0x9f, 0x09, 0x69, 
-0x1e, 0x53, 0x37, 0x5f, 0x9f, 0x21, 0xc9, 0x08, 0x69, 0x43, 0xd2, 0xee, 0x15, 0x93, 0x48, 0x83, 
-0x61, 0x38, 0xa9, 0x7e, 0xb3, 0x98, 0x3d, 0xa5, 0x4e, 0xdd, 0x62, 0x2a, 0x7a, 0xe4, 0x4b, 0xda, 
-0x01, 0x96, 0xe2, 0x17, 0xff, 0x0b, 0x6a, 0x98, 0xea, 0xb1, 0x5e, 0x2f, 0xbd, 0x6b, 0x05, 0xad, 
-0x5c, 0x14, 0x67, 0xfc, 0x0e, 0xa1, 0x82, 0xda, 0x71, 0x8f, 0x51, 0x13, 0x6c, 0xf3, 0xd8, 0x76, 
-0xe4, 0x07, 0xd1, 0x34, 0xa8, 0x8b, 0xb7, 0x7c, 0xd1, 0x0c, 0x8b, 0x5f, 0x02, 0x72, 0x86, 0xc0, 
-0x0a, 0x3a, 0xbb, 0x8d, 0x47, 0xce, 0x83, 0x26, 0x5d, 0x8f, 0xe9, 0x84, 0x9d, 0x07, 0x74, 0x10, 
-0x29, 0xb4, 0x3b, 0x1d, 0x83, 0x04, 0x28, 0x5c, 0x12, 0x44, 0xb7, 0x85, 0x73, 0x2d, 0x0b, 0xbb, 
-0x78, 0xee, 0x63, 0xd7, 0xad, 0xc1, 0x67, 0xee, 0x41, 0x00, 0x6d, 0xa9, 0xf2, 0xc8, 0x85, 0xdc, 
-0x54, 0xde, 0x8c, 0xd3, 0x3e, 0xfd, 0x17, 0x35, 0x7a, 0xf7, 0x9c, 0x32, 0xe9, 0x96, 0xa8, 0x2b, 
-0xe4, 0x37, 0xb8, 0xfb, 0xa6, 0x83, 0xe5, 0x01, 0x48, 0xa4, 0x25, 0xe1, 0x8e, 0x4c, 0xc9, 0x68, 
-0x27, 0xf5, 0xc5, 0xaa, 0xe4, 0x21, 0x64, 0xc8, 0x06, 0x92, 0x39, 0x72, 0x2c, 0xd9, 0x5d, 0xfa, 
-0x34, 0x88, 0xd8, 0xac, 0xc2, 0x46, 0x37, 0x81, 0xca, 0x01, 0xc0, 0xe6, 0xa4, 0x90, 0xd9, 0x35, 
-0xe5, 0xc2, 0x43, 0x76, 0xdf, 0xfc, 0x4a, 0x88, 0xb3, 0x9b, 0xd3, 0xbf, 0x86, 0x4a, 0xfc, 0x90, 
-0xa8, 0x1b, 0x51, 0xb2, 0x6b, 0xfd, 0x29, 0xe4, 0x9e, 0xd9, 0x20, 0x45, 0xe6, 0x31, 0xc9, 0xe9, 
-0x21, 0x93, 0xcd, 0xbf, 0x09, 0xae, 0x15, 0x71, 0xba, 0xed, 0x32, 0x79, 0x91, 0xd7, 0x28, 0xb9, 
-0x44, 0x75, 0xf4, 0x9a, 0xe7, 0x55, 0xce, 0xf6, 0xc5, 0x45, 0x9b, 0x22, 0x56, 0xbd, 0x2e, 0x4d, 
-0xef, 0xa8, 0xe0, 0x7e, 0x35, 0x22, 0xb2, 0x61, 0x17, 0x9e, 0xf4, 0x59, 0x20, 0xdc, 0x63, 0x4f, 
-0xfb, 0x99, 0xbc, 0x33, 0xf0, 0x3e, 0x16, 0xe3, 0xac, 0x7d, 0x5e, 0xa0, 0x14, 0x70, 0x33, 0xc3, 
-0x11, 0xb0, 0x1c, 0x58, 0xbd, 0xcd, 0x44, 0xfb, 0x5b, 0x8b, 0xca, 0xda, 0x70, 0xeb, 0xb4, 0xa3, 
-0xfd, 0xcb, 0x23, 0x01, 0xd9, 0xf5, 0xcd, 0x1d, 0x3d, 0x9c, 0x86, 0x34, 0x53, 0x28, 0xe1, 0x7b, 
-0xb1, 0xfb, 0x16, 0x8f, 0x59, 0x3c, 0x07, 0xae, 0xa9, 0xf6, 0x24, 0x9f, 0x04, 0x59, 0x87, 0xe5, 
-0x53, 0xce, 0x23, 0x6e, 0x49, 0xd2, 0x7d, 0x1e, 0xcc, 0x4d, 0x8b, 0x1b, 0x42, 0x6b, 0x2e, 0xd8, 
-0x96, 0x5d, 0xb5, 0x38, 0xff, 0x1b, 0x99, 0x7d, 0xdb, 0x39, 0x76, 0x18, 0x41, 0xbb, 0x7a, 0x30, 
-0x47, 0x84, 0x1e, 0xe4, 0xa6, 0x09, 0xc7, 0xb0, 0x14, 0x9d, 0x06, 0x67, 0x7a, 0x0b, 0xe1, 0xb1, 
-0x2a, 0x9b, 0x3e, 0x5e, 0xfe, 0x26, 0xb1, 0x09, 0x97, 0x66, 0xf2, 0xb6, 0x5e, 0x7f, 0x14, 0xc4, 
-0xe8, 0x29, 0x41, 0xee, 0x11, 0xdf, 0x76, 0x35, 0xbe, 0xea, 0x82, 0x2e, 0xc8, 0x07, 0xb6, 0x59, 
-0x11, 0xc3, 0x8c, 0x55, 0xd1, 0x17, 0x78, 0x59, 0x02, 0x6f, 0x38, 0xf2, 0x56, 0x97, 0xd3, 0x5e, 
-0x3c, 0x82, 0x53, 0xc0, 0x47, 0xcb, 0x5c, 0x14, 0x8c, 0x02, 0x3c, 0xa8, 0x1a, 0x49, 0x85, 0x38, 
-0x0c, 0xd9, 0x7b, 0xee, 0x6f, 0xd6, 0x8a, 0x1d, 0x3f, 0x0d, 0xbe, 0x5e, 0xd1, 0x4a, 0x87, 0xc1, 
-0x2d, 0x8f, 0x6b, 0xbd, 0x0b, 0x96, 0x2e, 0xc3, 0x19, 0x27, 0xda, 0x81, 0xb4, 0xa3, 0xd6, 0x2b, 
-0x51, 0xcb, 0x1b, 0xdc, 0xed, 0xb4, 0x95, 0xfb, 0xde, 0x75, 0x4a, 0xf6, 0x68, 0x18, 0x91, 0xa9, 
-0xe8, 0x16, 0xa2, 0x54, 0x41, 0x95, 0x65, 0x38, 0x7a, 0x92, 0x6b, 0xac, 0x4c, 0x95, 0xa5, 0x5a, 
-0xe0, 0x4d, 0xc6, 0x0a, 0xf8, 0x96, 0x12, 0x4c, 0x9e, 0x30, 0x76, 0xe7, 0x1e, 0xd3, 0x7d, 0x31, 
-0x73, 0x15, 0x81, 0xc4, 0x67, 0xd9, 0x99, 0xb9, 0x44, 0xaa, 0x07, 0xde, 0xb3, 0x0b, 0x41, 0xef, 
-0x6e, 0xae, 0xdd, 0x27, 0xce, 0xed, 0xaf, 0x3c, 0xc8, 0xf0, 0x0f, 0x75, 0xc1, 0x60, 0xe9, 0x10, 
-0xb9, 0x52, 0x8e, 0xd5, 0x5b, 0xf4, 0x12, 0xae, 0xe9, 0x5a, 0xb8, 0xcf, 0x65, 0x8f, 0x76, 0x44, 
-0x55, 0xed, 0x3e, 0xe6, 0x26, 0xa4, 0x52, 0x64, 0xf0, 0x71, 0xd4, 0x1c, 0x80, 0x4d, 0x72, 0xcf, 
-0x56, 0xa5, 0x24, 0x01, 0x3a, 0xad, 0x30, 0x57, 0x70, 0x93, 0x19, 0x7d, 0x66, 0xb1, 0x27, 0x5d, 
-0xdc, 0x0a, 0x99, 0x60, 0xa5, 0x4c, 0x8a, 0x79, 0xf2, 0x2f, 0x6d, 0xfa, 0x94, 0x66, 0xb6, 0x89, 
-0xfe, 0xb0, 0x9e, 0x1b, 0x43, 0x87, 0xfc, 0x26, 0xc8, 0xa0, 0x0d, 0xab, 0x1f, 0x70, 0xa4, 0xf8, 
-0xde, 0xc8, 0x65, 0xd4, 0x7b, 0x28, 0xb8, 0x6d, 0x91, 0x2e, 0xba, 0xa8, 0x3a, 0x00, 0xf5, 0xb6, 
-0x9a, 0x69, 0x2b, 0xf8, 0x94, 0xa3, 0x08, 0xfb, 0x3e, 0xc9, 0x4b, 0xe6, 0x78, 0xf0, 0x47, 0xa5, 
-0x74, 0xea, 0x53, 0x68, 0x1f, 0x4b, 0x5e, 0x98, 0x70, 0xf6, 0x87, 0x27, 0x41, 0x56, 0x07, 0x63, 
-0x3c, 0xd4, 0xa4, 0x2e, 0x7e, 0xdb, 0xb8, 0x34, 0x6a, 0x7a, 0x2f, 0xbb, 0x0f, 0xc5, 0xf3, 0x09, 
-0x50, 0xe2, 0x30, 0xf0, 0x63, 0x40, 0x7f, 0x28, 0xff, 0x15, 0xa7, 0x6e, 0x7e, 0xba, 0x39, 0xcd, 
-0x88, 0xc5, 0x52, 0xb7, 0xa3, 0x69, 0xee, 0x5f, 0xb6, 0x5d, 0x46, 0xef, 0xb0, 0x1c, 0x2b, 0x73, 
-0x13, 0xf1, 0x80, 0x59, 0x8c, 0xff, 0x62, 0x9c, 0x84, 0x02, 0x5d, 0x94, 0x77, 0x54, 0x12, 0x7d, 
-0x1d, 0x6a, 0xdd, 0x9f, 0x85, 0x2e, 0xd0, 0x45, 0xa0, 0xfb, 0x09, 0x6c, 0x33, 0xa2, 0x93, 0xd1, 
-0x6d, 0xf8, 0x99, 0x0f, 0x4f, 0xf4, 0x26, 0xe0, 0xc1, 0x80, 0xb7, 0x59, 0x90, 0xf7, 0xcf, 0x89, 
-0x0f, 0x4a, 0x93, 0xb7, 0x0d, 0xc3, 0xf5, 0x3b, 0x19, 0x82, 0xd8, 0x6f, 0xec, 0x90, 0xd4, 0xe2, 
-0x05, 0xf4, 0xc8, 0x4f, 0x99, 0x04, 0xd1, 0xa1, 0x49, 0x71, 0xf7, 0x3c, 0xd7, 0xe8, 0x1d, 0xcd, 
-0x41, 0xaf, 0x06, 0xa5, 0x29, 0x0c, 0xdc, 0x40, 0x2c, 0xd4, 0x7d, 0xe3, 0x69, 0x32, 0xb6, 0x76, 
-0x1c, 0xf5, 0x67, 0xda, 0xf1, 0x86, 0x34, 0x4e, 0x7c, 0x2c, 0xb5, 0x0e, 0x8e, 0xfe, 0xdc, 0xa0, 
-0xeb, 0x61, 0x17, 0x4c, 0xce, 0x95, 0x64, 0x53, 0xcb, 0xe7, 0x85, 0x43, 0x19, 0xda, 0x59, 0x7b, 
-0xdf, 0xa9, 0x1a, 0x85, 0x39, 0xb0, 0xcb, 0x03, 0x88, 0x40, 0xae, 0x08, 0xfd, 0xcc, 0x8a, 0xed, 
-0x03, 0x35, 0xa8, 0x68, 0xbe, 0xd3, 0x7f, 0x9f, 0x21, 0x88, 0x02, 0xee, 0x3f, 0x9a, 0x21, 0x50, 
-0xd5, 0x00, 0xf8, 0x8f, 0xde, 0x26, 0x81, 0xd1, 0x1b, 0xbf, 0x9e, 0x14, 0xb8, 0x0d, 0xd6, 0x70, 
-0x8a, 0xb3, 0xd1, 0x42, 0xea, 0x5a, 0xd9, 0x1f, 0x62, 0x0e, 0xde, 0x44, 0x2b, 0x8a, 0x15, 0xcb, 
-0x02, 0xcf, 0x92, 0x2f, 0x79, 0x4c, 0xf9, 0xc8, 0x65, 0x3a, 0xa0, 0xc4, 0x27, 0x36, 0xb9, 0x18, 
-0xc7, 0x30, 0xf8, 0xa3, 0x0b, 0xc2, 0x9c, 0xf9, 0x8b, 0x2a, 0x4f, 0x41, 0x06, 0xb2, 0x57, 0x1f, 
-0x82, 0x2c, 0xb0, 0xca, 0xe7, 0x82, 0x03, 0x52, 0x29, 0x16, 0x3e, 0x7d, 0x33, 0xae, 0x00, 0x95, 
-0x6b, 0x1d, 0x2f, 0xc8, 0x72, 0x17, 0x35, 0xbb, 0x21, 0xac, 0xec, 0x30, 0xdd, 0x89, 0x61, 0xaa, 
-0xea, 0x48, 0xc5, 0x9d, 0x52, 0x1a, 0xa3, 0x44, 0x84, 0x5e, 0xa6, 0x2d, 0xf9, 0xbc, 0x3f, 0x8a, 
-0x13, 0xc5, 0x22, 0x90, 0x10, 0x6d, 0x35, 0x9b, 0x63, 0xdb, 0x81, 0xbd, 0x4b, 0xef, 0xc4, 0x99, 
-0x4f, 0x0e, 0x5d, 0xbb, 0xcb, 0x04, 0xa8, 0x4c, 0xdf, 0x8c, 0x40, 0x2e, 0x97, 0x05, 0xe2, 0xbe, 
-0x19, 0x9e, 0x56, 0xe5, 0x44, 0x5e, 0x03, 0x20, 0x52, 0xc9, 0x89, 0xe3, 0x27, 0x7c, 0x15, 0xa5, 
-0x33, 0x75, 0x04, 0xaa, 0xc4, 0x6d, 0x36, 0xb6, 0x0d, 0x66, 0x27, 0xd4, 0x56, 0x14, 0x6c, 0xdf, 
-0x5d, 0xd2, 0x94, 0xc0, 0x7a, 0x39, 0x12, 0xb7, 0xc4, 0x46, 0xe2, 0x0c, 0x90, 0x2e, 0xf3, 0x4d, 
-0xcb, 0x69, 0xc1, 0xb1, 0x12, 0x60, 0xe4, 0x87, 0xc5, 0xb0, 0x49, 0x63, 0x74, 0xa8, 0x59, 0xb0, 
-0x8a, 0x3e, 0x57, 0x75, 0xcb, 0xea, 0x35, 0xc0, 0x04, 0x60, 0x2f, 0x22, 0x91, 0x03, 0xa2, 0xf6, 
-0x71, 0xeb, 0x94, 0x08, 0xc1, 0xdb, 0x4e, 0x3e, 0xfb, 0xa3, 0x3a, 0x0c, 0xe3, 0xa6, 0x8b, 0x06, 
-0xd7, 0x90, 0xeb, 0x1a, 0x76, 0xa5, 0xdb, 0x55, 0xeb, 0x49, 0xbc, 0x3a, 0xe4, 0x65, 0x45, 0xb6, 
-0x59, 0xc4, 0xaa, 0xd4, 0xf5, 0x94, 0x71, 0xec, 0xd7, 0x61, 0x96, 0x4c, 0x22, 0xc0, 0x42, 0xde, 
-0x8b, 0xc4, 0xa3, 0xe7, 0xbc, 0x87, 0xd2, 0x39, 0xa1, 0xfd, 0x0e, 0xa9, 0xde, 0x43, 0x9d, 0x5c, 
-0xdc, 0x7a, 0x6a, 0x43, 0x57, 0x9e, 0x04, 0x2b, 0xbb, 0x8f, 0x0e, 0xf7, 0x29, 0xcc, 0x67, 0xbc, 
-0x22, 0xb4, 0x3a, 0xd5, 0x6e, 0x56, 0xe9, 0x7e, 0xf2, 0xac, 0x55, 0xba, 0x7c, 0xaa, 0xf4, 0xc0, 
-0x50, 0x16, 0xe9, 0x3a, 0x5f, 0x7c, 0x1a, 0x6b, 0xaa, 0xf3, 0x22, 0x48, 0x8f, 0x15, 0xe9, 0x9b, 
-0x5a, 0x09, 0xb2, 0xd0, 0x55, 0x62, 0xaf, 0x41, 0x91, 0x6a, 0xf1, 0x35, 0xa7, 0xc4, 0x76, 0xb3, 
-0x41, 0xf6, 0x07, 0x71, 0xb5, 0xec, 0x3f, 0xff, 0xd5, 0x22, 0xb8, 0x4f, 0xf2, 0x28, 0xea, 0x8e, 
-0x51, 0x9c, 0xf3, 0xb9, 0x92, 0xfc, 0x9d, 0x23, 0x36, 0xf6, 0x15, 0x2e, 0xa0, 0xe7, 0x6b, 0x25, 
-0x7c, 0x5b, 0x9b, 0xfd, 0x74, 0xb1, 0x10, 0xa8, 0xea, 0x35, 0x93, 0x56, 0xca, 0x77, 0xfd, 0x0f, 
-0x3b, 0x9b, 0x1e, 0xe5, 0x37, 0x14, 0x44, 0xe8, 0x29, 0xd8, 0xf9, 0x83, 0x24, 0x8f, 0x53, 0xa0, 
-0xf0, 0x4a, 0x98, 0xdd, 0x68, 0xb5, 0x49, 0x2d, 0xab, 0x3b, 0x80, 0x5a, 0xf9, 0x9c, 0x75, 0x04, 
-0x7b, 0xbd, 0x6c, 0xd4, 0x5f, 0xc2, 0x3e, 0x57, 0xb4, 0x2d, 0x4d, 0x6a, 0xcf, 0x45, 0x10, 0x93, 
-0x7c, 0x23, 0x6f, 0x89, 0xd2, 0x20, 0x2f, 0xdf, 0x03, 0xeb, 0x78, 0x14, 0x62, 0x35, 0xc2, 0xa5, 
-0x00, 0x3c, 0xf1, 0x14, 0x76, 0x5e, 0xff, 0xb4, 0x65, 0x75, 0xd5, 0x57, 0x20, 0x63, 0xef, 0x49, 
-0x5d, 0xd7, 0x86, 0x4e, 0xf1, 0x04, 0x82, 0xc2, 0xfc, 0x07, 0xa6, 0xcb, 0x24, 0xe7, 0x7b, 0xd5, 
-0x68, 0x34, 0x78, 0x5f, 0x3e, 0x7e, 0x0b, 0xff, 0x75, 0xdd, 0x09, 0x88, 0x14, 0x94, 0x1f, 0x32, 
-0x64, 0xd5, 0x2d, 0x43, 0xde, 0x5b, 0x28, 0x00, 0x92, 0x73, 0x22, 0x9e, 0xd6, 0xaf, 0x31, 0xe2, 
-0x84, 0xc1, 0x74, 0xa1, 0xf8, 0x80, 0xd2, 0x36, 0x6f, 0xc5, 0x7d, 0x1d, 0xea, 0x77, 0x12, 0xfd, 
-0xc9, 0x23, 0xd1, 0x86, 0x17, 0x97, 0x2d, 0xd2, 0x80, 0xaa, 0x33, 0x9e, 0x58, 0xc2, 0x88, 0x09, 
-0x5c, 0x8f, 0xe2, 0x65, 0x7f, 0x9a, 0x14, 0xcc, 0x74, 0xe3, 0x43, 0x05, 0x62, 0x2d, 0x7c, 0xbc, 
-0xab, 0x4f, 0x73, 0x61, 0xdc, 0x47, 0xaa, 0x91, 0xd9, 0x17, 0xce, 0x4f, 0x20, 0xde, 0x44, 0x5e, 
-0x17, 0x73, 0x24, 0xe0, 0x46, 0xa4, 0x2a, 0x6e, 0x5b, 0xed, 0x7c, 0xcf, 0xc0, 0x9f, 0xfe, 0x61, 
-0x98, 0x6c, 0x03, 0xa7, 0x47, 0xaf, 0x1a, 0x69, 0xe1, 0x7a, 0xc5, 0xf7, 0x12, 0x87, 0x7b, 0xc9, 
-0x17, 0xd4, 0xb4, 0x6c, 0x1e, 0x36, 0xb0, 0xe4, 0x12, 0x56, 0xec, 0x99, 0x17, 0x26, 0xf2, 0x7f, 
-0x1e, 0xe1, 0xac, 0x00, 0xf6, 0x88, 0xe6, 0x68, 0xd4, 0xab, 0x13, 0xf0, 0x50, 0x7e, 0xa9, 0x91, 
-0x6d, 0x39, 0x99, 0x24, 0x8a, 0xe2, 0x10, 0x4e, 0x7a, 0xbe, 0x89, 0xda, 0x9d, 0x37, 0xa7, 0x1a, 
-0x30, 0x07, 0x47, 0xfa, 0x0e, 0x72, 0xc5, 0x15, 0xb3, 0x78, 0x36, 0x94, 0x64, 0xb5, 0x6e, 0x2d, 
-0x4f, 0x3c, 0x8f, 0xf5, 0x11, 0xbf, 0x4b, 0x96, 0xfd, 0x1f, 0xde, 0xb2, 0xc0, 0xe7, 0x94, 0x33, 
-0x53, 0x9a, 0xee, 0x4a, 0xac, 0xe0, 0xca, 0xb6, 0x08, 0x77, 0x9b, 0xfc, 0x0b, 0xc7, 0x84, 0xe4, 
-0xb6, 0xff, 0xce, 0x8a, 0x07, 0xf8, 0x57, 0x93, 0x06, 0x3b, 0xd1, 0x2c, 0x56, 0x3f, 0x64, 0xba, 
-0x12, 0xf9, 0x48, 0xa1, 0xbd, 0x28, 0xd6, 0x81, 0x53, 0x03, 0x74, 0xaf, 0x4c, 0xf7, 0x69, 0xe9, 
-0x10, 0x94, 0x63, 0x46, 0xd8, 0x1f, 0x6c, 0xaf, 0x47, 0xc7, 0xa0, 0x3a, 0x0b, 0xd5, 0x48, 0xac, 
-0x1f, 0x31, 0x7f, 0xa6, 0xce, 0x4d, 0xe6, 0x0e, 0x8c, 0xeb, 0xc7, 0x21, 0x86, 0x0a, 0x56, 0xf9, 
-0x3d, 0xaf, 0x84, 0x32, 0x63, 0x8c, 0xc0, 0x7d, 0xd3, 0xb6, 0xf7, 0x82, 0x06, 0x90, 0xd2, 0xbd, 
-0xac, 0x08, 0x92, 0x2b, 0x53, 0x04, 0x7d, 0xc6, 0x11, 0xb6, 0x37, 0xe2, 0x5f, 0xf4, 0xd7, 0x2a, 
-0x3c, 0x17, 0xa7, 0x55, 0x37, 0xbe, 0xe7, 0x5e, 0x9b, 0x4f, 0x28, 0xee, 0xcc, 0x85, 0x61, 0x29
-};
\ No newline at end of file
@@ -1,2502 +0,0 @@
-const unsigned char MatCapSource[] PROGMEM = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x06, 0x06, 0x06, 
-0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x04, 0x02, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x03, 0x04, 0x06, 0x05, 
-0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x04, 0x04, 0x05, 0x04, 0x04, 0x04, 0x05, 
-0x06, 0x06, 0x05, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 
-0x03, 0x04, 0x05, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x03, 
-0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x0a, 0x08, 0x07, 0x09, 0x0e, 0x15, 0x19, 0x1e, 0x23, 0x27, 
-0x26, 0x21, 0x16, 0x0d, 0x09, 0x07, 0x05, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x06, 0x04, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x04, 0x05, 0x07, 0x07, 0x09, 0x07, 0x0e, 0x11, 0x10, 0x13, 0x18, 0x16, 0x13, 0x19, 
-0x2a, 0x44, 0x69, 0x8c, 0x94, 0x93, 0x94, 0x96, 0x94, 0x87, 0x6b, 0x53, 0x45, 0x37, 0x21, 0x12, 
-0x0a, 0x07, 0x05, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x03, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x08, 0x0b, 0x08, 0x0b, 0x0f, 0x10, 0x12, 0x17, 
-0x18, 0x17, 0x19, 0x1e, 0x1f, 0x1f, 0x37, 0x61, 0xa2, 0xdb, 0xf1, 0xed, 0xe8, 0xe3, 0xdf, 0xdd, 
-0xde, 0xd6, 0xc1, 0xb0, 0xa9, 0x9f, 0x7e, 0x64, 0x4f, 0x40, 0x29, 0x0e, 0x06, 0x04, 0x03, 0x02, 
-0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x06, 0x09, 0x0a, 
-0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 
-0x0c, 0x0d, 0x11, 0x12, 0x16, 0x17, 0x19, 0x1b, 0x1a, 0x20, 0x24, 0x28, 0x49, 0x90, 0xcb, 0xeb, 
-0xfc, 0xfa, 0xf9, 0xfa, 0xf6, 0xf9, 0xf9, 0xf4, 0xf9, 0xf7, 0xf2, 0xed, 0xea, 0xe4, 0xd5, 0xc9, 
-0xc1, 0xb8, 0xa7, 0x83, 0x5c, 0x35, 0x1c, 0x10, 0x0a, 0x07, 0x05, 0x04, 0x02, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x02, 0x02, 0x04, 0x08, 0x0b, 0x0a, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x06, 0x07, 0x09, 0x0a, 0x0c, 0x0e, 0x11, 0x11, 0x14, 0x17, 0x1a, 0x1d, 0x1e, 0x20, 
-0x23, 0x24, 0x2c, 0x54, 0xa3, 0xe7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xfb, 0xf8, 0xfb, 0xfb, 0xf7, 
-0xff, 0xff, 0xfd, 0xfa, 0xfc, 0xfb, 0xf4, 0xf2, 0xee, 0xe7, 0xe1, 0xce, 0xb9, 0xa1, 0x81, 0x60, 
-0x42, 0x1b, 0x0e, 0x08, 0x06, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x06, 0x08, 0x08, 0x07, 0x05, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x0d, 0x0f, 0x11, 
-0x13, 0x14, 0x16, 0x18, 0x1b, 0x1d, 0x1d, 0x1f, 0x25, 0x24, 0x29, 0x4d, 0x8c, 0xbe, 0xd9, 0xe6, 
-0xf1, 0xf8, 0xff, 0xfc, 0xf8, 0xfc, 0xfc, 0xfb, 0xff, 0xfc, 0xfa, 0xfc, 0xff, 0xfe, 0xf9, 0xfb, 
-0xfe, 0xfb, 0xf3, 0xf2, 0xea, 0xdf, 0xd3, 0xca, 0xb6, 0x86, 0x5a, 0x30, 0x14, 0x08, 0x06, 0x05, 
-0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x04, 0x07, 0x0b, 
-0x0a, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 
-0x04, 0x06, 0x09, 0x0b, 0x0b, 0x0c, 0x0d, 0x0f, 0x0f, 0x10, 0x10, 0x11, 0x12, 0x12, 0x12, 0x13, 
-0x17, 0x17, 0x17, 0x1d, 0x2a, 0x3c, 0x51, 0x64, 0x7c, 0x98, 0xba, 0xd9, 0xf1, 0xfe, 0xf8, 0xf5, 
-0xfa, 0xfb, 0xfe, 0xf8, 0xfa, 0xfb, 0xfc, 0xff, 0xfe, 0xf8, 0xfc, 0xfd, 0xf9, 0xf1, 0xee, 0xef, 
-0xec, 0xd7, 0xc9, 0xa6, 0x75, 0x3e, 0x14, 0x08, 0x06, 0x05, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x03, 0x06, 0x08, 0x0c, 0x0b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x05, 0x06, 0x04, 0x03, 0x02, 0x03, 
-0x05, 0x06, 0x06, 0x05, 0x04, 0x04, 0x04, 0x05, 0x06, 0x0b, 0x0f, 0x0e, 0x0d, 0x11, 0x11, 0x15, 
-0x19, 0x20, 0x30, 0x48, 0x65, 0x8c, 0xb5, 0xe2, 0xff, 0xfb, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xff, 
-0xff, 0xfe, 0xf2, 0xf7, 0xff, 0xfe, 0xfe, 0xfd, 0xf9, 0xf8, 0xeb, 0xe0, 0xd1, 0xb4, 0x7c, 0x43, 
-0x18, 0x07, 0x06, 0x07, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x0a, 0x0f, 0x12, 0x12, 0x08, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x06, 0x09, 0x0b, 0x0a, 0x0c, 0x14, 0x15, 0x19, 0x24, 0x33, 
-0x55, 0x7a, 0xa8, 0xd1, 0xe9, 0xf8, 0xfc, 0xf8, 0xf8, 0xfb, 0xfe, 0xfc, 0xfc, 0xfb, 0xf3, 0xf5, 
-0xff, 0xfb, 0xfd, 0xf8, 0xef, 0xeb, 0xe4, 0xcd, 0x9c, 0x5f, 0x28, 0x10, 0x0e, 0x0b, 0x08, 0x04, 
-0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x09, 
-0x0f, 0x16, 0x13, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 
-0x03, 0x04, 0x05, 0x08, 0x0c, 0x0e, 0x0e, 0x0e, 0x17, 0x23, 0x36, 0x59, 0x7d, 0xaf, 0xe2, 0xf7, 
-0xfe, 0xfe, 0xfe, 0xf6, 0xf7, 0xfc, 0xfb, 0xf7, 0xfc, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xf9, 0xf3, 
-0xe5, 0xd4, 0xa9, 0x67, 0x25, 0x10, 0x0e, 0x0c, 0x08, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x01, 0x06, 0x0e, 0x16, 0x16, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x07, 0x09, 0x0c, 
-0x11, 0x13, 0x15, 0x1c, 0x24, 0x3b, 0x70, 0xa3, 0xd1, 0xf2, 0xfa, 0xfa, 0xfb, 0xfc, 0xfb, 0xfb, 
-0xf8, 0xfe, 0xff, 0xfe, 0xfc, 0xff, 0xfb, 0xf6, 0xf3, 0xf3, 0xed, 0xdc, 0x94, 0x4d, 0x1e, 0x11, 
-0x10, 0x0a, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x09, 0x11, 0x18, 0x16, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x09, 0x0b, 0x0c, 0x0c, 0x10, 0x18, 0x1d, 0x2a, 
-0x53, 0x89, 0xc5, 0xe9, 0xfa, 0xfe, 0xfc, 0xfc, 0xfb, 0xfa, 0xf8, 0xfa, 0xfe, 0xfe, 0xfb, 0xfb, 
-0xfb, 0xfb, 0xf8, 0xf7, 0xea, 0xcd, 0x8d, 0x3c, 0x13, 0x10, 0x0c, 0x06, 0x03, 0x01, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x02, 0x07, 0x0f, 0x15, 0x18, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x02, 0x03, 0x04, 0x07, 0x0c, 0x0f, 0x0e, 0x11, 0x1a, 0x3a, 0x7f, 0xcc, 0xf5, 0xf6, 0xf7, 
-0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfb, 0xfc, 0xfb, 0xfb, 0xf5, 0xf3, 0xf5, 0xf2, 0xe9, 0xc0, 
-0x5b, 0x18, 0x13, 0x10, 0x0b, 0x06, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0a, 0x12, 0x20, 0x17, 0x07, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x0a, 
-0x0b, 0x08, 0x09, 0x17, 0x33, 0x75, 0xd9, 0xfe, 0xf3, 0xf8, 0xfb, 0xff, 0xff, 0xfe, 0xfc, 0xfa, 
-0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xfb, 0xf6, 0xf1, 0xe6, 0x76, 0x25, 0x15, 0x14, 0x0f, 0x09, 0x03, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0b, 
-0x12, 0x1c, 0x1f, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x06, 0x06, 0x1e, 0x5e, 
-0xab, 0xf1, 0xfa, 0xfa, 0xf6, 0xf8, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfb, 0xfb, 
-0xfc, 0xec, 0xb0, 0x5d, 0x2c, 0x1d, 0x14, 0x0d, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x0e, 0x1a, 0x22, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 
-0x00, 0x00, 0x02, 0x01, 0x03, 0x02, 0x00, 0x0f, 0x2b, 0x89, 0xd0, 0xf8, 0xfb, 0xf6, 0xfb, 0xfc, 
-0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xf7, 0xf6, 0xcf, 0x7e, 0x33, 0x21, 0x18, 
-0x11, 0x0a, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x08, 0x16, 0x1f, 0x24, 
-0x1c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 
-0x03, 0x1a, 0x51, 0xa9, 0xee, 0xfb, 0xf8, 0xfa, 0xfa, 0xfe, 0xfe, 0xfc, 0xfa, 0xfb, 0xfe, 0xfe, 
-0xfb, 0xf8, 0xf8, 0xf3, 0xe7, 0x9b, 0x49, 0x21, 0x1e, 0x16, 0x0e, 0x07, 0x02, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x05, 0x0b, 0x18, 0x29, 0x28, 0x1a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x1f, 0x6e, 0xd4, 0xfc, 0xfe, 
-0xfc, 0xf8, 0xf3, 0xf5, 0xf8, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfa, 0xf8, 0xf6, 0xf2, 0xc2, 0x4c, 
-0x27, 0x23, 0x1b, 0x11, 0x09, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x12, 0x21, 0x2d, 0x2a, 0x18, 0x06, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x00, 0x00, 0x0c, 0x42, 0xb8, 0xf1, 0xf8, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 
-0xf8, 0xfa, 0xfc, 0xfe, 0xfb, 0xfa, 0xfa, 0xad, 0x4e, 0x2b, 0x29, 0x1e, 0x18, 0x0c, 0x05, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 
-0x0b, 0x1a, 0x2d, 0x37, 0x2f, 0x15, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x16, 0x43, 
-0x6f, 0x8e, 0xa7, 0xae, 0xbd, 0xd1, 0xe1, 0xe9, 0xf1, 0xf6, 0xf8, 0xfa, 0xfb, 0xfb, 0xf7, 0xf6, 
-0xc6, 0x6a, 0x3b, 0x35, 0x27, 0x1e, 0x12, 0x07, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x0b, 0x19, 0x2d, 0x36, 0x2e, 0x1a, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01, 0x01, 0x00, 
-0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x24, 0x3d, 0x55, 0x69, 0x7c, 
-0x93, 0xab, 0xbd, 0xcf, 0xdd, 0xea, 0xf7, 0xfa, 0xfb, 0xd1, 0x74, 0x39, 0x39, 0x29, 0x1c, 0x10, 
-0x09, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x11, 0x1f, 
-0x2f, 0x38, 0x2f, 0x1a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x03, 0x05, 
-0x06, 0x05, 0x04, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x03, 0x01, 
-0x00, 0x00, 0x01, 0x08, 0x13, 0x1a, 0x25, 0x32, 0x3d, 0x49, 0x56, 0x68, 0x7c, 0x92, 0xb0, 0xd5, 
-0xe5, 0xf5, 0xd2, 0x6f, 0x36, 0x3a, 0x29, 0x1d, 0x15, 0x0c, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x07, 0x14, 0x2a, 0x37, 0x3a, 0x32, 0x1d, 0x07, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x06, 0x08, 0x0b, 0x0c, 0x0b, 0x09, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 
-0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 
-0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x03, 0x04, 0x05, 0x08, 0x0d, 0x12, 0x1a, 0x23, 
-0x2b, 0x35, 0x39, 0x3b, 0x3e, 0x41, 0x4d, 0x61, 0x82, 0xad, 0xc2, 0xbc, 0x60, 0x34, 0x36, 0x2d, 
-0x23, 0x1e, 0x0d, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x14, 0x2a, 0x40, 0x46, 
-0x32, 0x1f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x0b, 0x0c, 0x11, 0x0e, 0x0c, 0x0c, 
-0x0c, 0x0c, 0x0a, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x03, 0x04, 0x06, 0x08, 0x0a, 0x11, 0x17, 0x20, 0x2e, 0x36, 0x37, 0x36, 0x3e, 0x3b, 0x32, 
-0x34, 0x3c, 0x4d, 0x65, 0x62, 0x35, 0x2d, 0x37, 0x34, 0x29, 0x1c, 0x0d, 0x04, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x06, 0x14, 0x2c, 0x40, 0x49, 0x42, 0x24, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-0x0a, 0x10, 0x13, 0x13, 0x14, 0x11, 0x0f, 0x0d, 0x0d, 0x0c, 0x0c, 0x0a, 0x09, 0x07, 0x06, 0x05, 
-0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 
-0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x08, 0x09, 0x0b, 0x0f, 
-0x17, 0x24, 0x2c, 0x33, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x35, 0x2e, 0x2b, 0x29, 0x2a, 0x2b, 0x34, 
-0x39, 0x30, 0x24, 0x1a, 0x0d, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x1a, 0x32, 0x45, 0x48, 0x3e, 0x2b, 
-0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x0d, 0x14, 0x18, 0x19, 0x17, 0x17, 0x16, 0x14, 0x12, 0x11, 
-0x11, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x08, 0x06, 0x06, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x02, 0x05, 0x06, 0x08, 0x09, 0x0b, 0x0c, 0x11, 0x17, 0x1d, 0x27, 0x31, 0x35, 0x39, 0x39, 
-0x3a, 0x3c, 0x37, 0x2f, 0x26, 0x25, 0x24, 0x24, 0x37, 0x45, 0x32, 0x29, 0x1e, 0x11, 0x06, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x07, 0x14, 0x32, 0x44, 0x4a, 0x41, 0x32, 0x1d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x16, 0x1b, 0x1d, 
-0x1d, 0x1a, 0x18, 0x19, 0x17, 0x15, 0x15, 0x15, 0x13, 0x10, 0x0e, 0x0e, 0x0d, 0x0c, 0x0a, 0x09, 
-0x08, 0x05, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x06, 0x09, 0x0a, 0x0c, 0x0e, 
-0x11, 0x13, 0x16, 0x1d, 0x27, 0x32, 0x38, 0x37, 0x35, 0x39, 0x3d, 0x3a, 0x30, 0x29, 0x29, 0x21, 
-0x26, 0x3b, 0x3c, 0x34, 0x27, 0x1d, 0x11, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x14, 0x2e, 0x49, 0x4b, 0x44, 0x35, 0x23, 0x0f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x0b, 0x17, 0x1f, 0x24, 0x23, 0x21, 0x1e, 0x1c, 0x1c, 0x1d, 0x18, 0x17, 0x17, 0x17, 
-0x15, 0x11, 0x10, 0x10, 0x0f, 0x0e, 0x0c, 0x0b, 0x0a, 0x07, 0x05, 0x05, 0x04, 0x03, 0x01, 0x01, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x03, 0x06, 0x07, 0x09, 0x0a, 0x0c, 0x0d, 0x11, 0x11, 0x13, 0x18, 0x1d, 0x27, 0x32, 0x38, 
-0x37, 0x36, 0x38, 0x38, 0x33, 0x24, 0x29, 0x29, 0x24, 0x2e, 0x3d, 0x40, 0x33, 0x29, 0x20, 0x0f, 
-0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x15, 
-0x2d, 0x4c, 0x4f, 0x44, 0x37, 0x24, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x16, 0x23, 0x27, 0x24, 0x26, 0x24, 0x24, 
-0x22, 0x21, 0x20, 0x1f, 0x1c, 0x1a, 0x19, 0x19, 0x17, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0f, 0x0d, 
-0x0c, 0x0a, 0x07, 0x06, 0x05, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x06, 0x07, 0x0a, 0x0b, 0x0c, 0x0c, 
-0x0f, 0x11, 0x14, 0x16, 0x18, 0x20, 0x28, 0x30, 0x33, 0x34, 0x3d, 0x46, 0x54, 0x3a, 0x2a, 0x26, 
-0x27, 0x26, 0x30, 0x46, 0x48, 0x36, 0x2a, 0x21, 0x0d, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x14, 0x2c, 0x4c, 0x4e, 0x46, 0x3a, 0x2b, 0x17, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 
-0x32, 0x36, 0x2b, 0x24, 0x28, 0x25, 0x24, 0x25, 0x26, 0x26, 0x22, 0x1d, 0x1e, 0x1d, 0x1b, 0x1a, 
-0x19, 0x17, 0x15, 0x13, 0x12, 0x11, 0x0f, 0x0e, 0x0d, 0x0b, 0x08, 0x07, 0x06, 0x05, 0x03, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x03, 0x06, 0x07, 0x0a, 0x0b, 0x0f, 0x10, 0x10, 0x12, 0x15, 0x16, 0x15, 0x1b, 0x1d, 0x27, 
-0x2f, 0x34, 0x3e, 0x4f, 0x99, 0x97, 0x60, 0x34, 0x25, 0x23, 0x2b, 0x3d, 0x4b, 0x47, 0x32, 0x27, 
-0x1e, 0x0d, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x1b, 0x37, 0x4e, 
-0x56, 0x4e, 0x3c, 0x31, 0x1d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0b, 0x3a, 0x89, 0xbe, 0xd4, 0xa3, 0x77, 0x57, 0x3a, 0x2e, 0x28, 0x27, 
-0x28, 0x25, 0x24, 0x25, 0x22, 0x1f, 0x22, 0x1e, 0x1c, 0x1d, 0x1a, 0x17, 0x16, 0x13, 0x13, 0x11, 
-0x10, 0x0d, 0x0b, 0x0a, 0x07, 0x06, 0x03, 0x02, 0x04, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 
-0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x0c, 0x0c, 
-0x0f, 0x12, 0x14, 0x17, 0x19, 0x1d, 0x1c, 0x1f, 0x25, 0x2e, 0x33, 0x54, 0xb7, 0xf7, 0xeb, 0xb5, 
-0x68, 0x38, 0x27, 0x2a, 0x3f, 0x51, 0x4d, 0x3c, 0x30, 0x22, 0x10, 0x06, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x07, 0x13, 0x38, 0x53, 0x5c, 0x54, 0x42, 0x34, 0x22, 0x0f, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x73, 0xc6, 0xf1, 0xfe, 
-0xfe, 0xf3, 0xe4, 0xc2, 0x92, 0x6e, 0x47, 0x2f, 0x2b, 0x2b, 0x2a, 0x27, 0x23, 0x22, 0x25, 0x22, 
-0x1d, 0x1d, 0x1b, 0x19, 0x17, 0x15, 0x14, 0x11, 0x10, 0x0e, 0x0c, 0x0c, 0x09, 0x06, 0x05, 0x04, 
-0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x0c, 0x0d, 0x10, 0x12, 0x14, 0x17, 0x19, 0x1b, 0x1b, 0x1f, 
-0x22, 0x26, 0x2d, 0x54, 0xb3, 0xfa, 0xfa, 0xf7, 0xe1, 0xa3, 0x4e, 0x2f, 0x2d, 0x46, 0x5c, 0x4f, 
-0x3f, 0x33, 0x20, 0x11, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x15, 0x2f, 0x57, 0x64, 0x5a, 
-0x4a, 0x38, 0x2a, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x19, 0x98, 0xe9, 0xfc, 0xfc, 0xfb, 0xf8, 0xfa, 0xfb, 0xf8, 0xee, 0xd9, 0x9e, 0x69, 
-0x46, 0x33, 0x2b, 0x28, 0x2c, 0x24, 0x24, 0x21, 0x1f, 0x20, 0x1d, 0x1d, 0x1a, 0x17, 0x17, 0x14, 
-0x11, 0x10, 0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x06, 0x04, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x0d, 0x0f, 
-0x11, 0x13, 0x15, 0x17, 0x18, 0x1b, 0x1d, 0x22, 0x22, 0x22, 0x2a, 0x53, 0xb3, 0xfa, 0xf7, 0xf7, 
-0xfb, 0xf5, 0xc0, 0x71, 0x35, 0x33, 0x59, 0x64, 0x4d, 0x41, 0x34, 0x23, 0x10, 0x04, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x06, 0x14, 0x31, 0x50, 0x67, 0x61, 0x4f, 0x3f, 0x31, 0x1d, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xa0, 0xed, 0xf7, 0xfa, 0xfe, 0xfe, 
-0xfb, 0xfc, 0xfb, 0xf8, 0xf8, 0xf3, 0xf1, 0xd7, 0xa3, 0x69, 0x41, 0x2f, 0x28, 0x27, 0x2b, 0x25, 
-0x22, 0x23, 0x21, 0x1f, 0x1d, 0x1a, 0x18, 0x16, 0x14, 0x12, 0x11, 0x10, 0x0d, 0x0c, 0x0a, 0x08, 
-0x05, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x0d, 0x0f, 0x12, 0x14, 0x15, 0x17, 0x19, 0x1d, 0x1f, 0x23, 
-0x24, 0x23, 0x2a, 0x54, 0xb2, 0xf6, 0xfe, 0xfc, 0xf8, 0xf7, 0xf5, 0xd9, 0x93, 0x4d, 0x3e, 0x5e, 
-0x65, 0x54, 0x48, 0x38, 0x22, 0x0d, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x12, 0x2f, 0x55, 0x6a, 0x68, 0x56, 0x44, 
-0x37, 0x2a, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x47, 0xc2, 0xf7, 0xef, 0xf8, 0xfa, 0xfa, 0xf7, 0xf6, 0xfe, 0xfe, 0xfa, 0xf8, 0xfc, 0xf7, 0xf7, 
-0xf5, 0xdc, 0xa0, 0x6a, 0x3b, 0x2a, 0x27, 0x27, 0x2a, 0x26, 0x21, 0x22, 0x1f, 0x1d, 0x1b, 0x18, 
-0x17, 0x15, 0x14, 0x12, 0x10, 0x0e, 0x0c, 0x0b, 0x07, 0x05, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x0d, 0x0f, 
-0x12, 0x14, 0x16, 0x18, 0x1a, 0x1e, 0x1d, 0x21, 0x23, 0x24, 0x2b, 0x5a, 0xc6, 0xfa, 0xf7, 0xfa, 
-0xfe, 0xfc, 0xfa, 0xf8, 0xef, 0xab, 0x65, 0x57, 0x65, 0x60, 0x5a, 0x4d, 0x37, 0x1c, 0x0b, 0x02, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x0a, 0x22, 0x49, 0x70, 0x71, 0x5d, 0x4c, 0x3c, 0x2d, 0x1d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x4e, 0xcb, 0xfc, 0xf5, 0xfc, 0xfb, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfb, 0xf6, 0xf8, 0xfe, 0xff, 0xfc, 0xf8, 0xfa, 0xfc, 0xf6, 0xe9, 0x8e, 0x57, 0x35, 0x2b, 
-0x2d, 0x29, 0x23, 0x23, 0x20, 0x1e, 0x1d, 0x1c, 0x1a, 0x17, 0x16, 0x15, 0x11, 0x10, 0x0e, 0x0d, 
-0x0b, 0x07, 0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x0d, 0x0f, 0x12, 0x15, 0x17, 0x19, 0x1c, 0x1d, 0x1d, 0x22, 
-0x22, 0x24, 0x33, 0x6e, 0xc8, 0xfe, 0xfa, 0xfb, 0xff, 0xff, 0xfa, 0xf3, 0xfa, 0xfb, 0xd1, 0x8b, 
-0x67, 0x68, 0x65, 0x5d, 0x4e, 0x2c, 0x14, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x1e, 0x43, 0x68, 0x74, 0x65, 0x4f, 0x3e, 0x2e, 
-0x1d, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x74, 0xe0, 
-0xfe, 0xf6, 0xfa, 0xfc, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfe, 0xfc, 
-0xfa, 0xfc, 0xfc, 0xfa, 0xf1, 0xc8, 0x93, 0x5a, 0x37, 0x2b, 0x28, 0x24, 0x22, 0x21, 0x20, 0x1d, 
-0x1c, 0x1a, 0x17, 0x16, 0x13, 0x11, 0x0f, 0x0e, 0x0c, 0x09, 0x06, 0x06, 0x04, 0x02, 0x00, 0x00, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x0d, 0x0f, 
-0x12, 0x15, 0x17, 0x1a, 0x1d, 0x1d, 0x1e, 0x23, 0x23, 0x24, 0x3e, 0x87, 0xeb, 0xfe, 0xfe, 0xff, 
-0xfb, 0xf8, 0xfc, 0xfe, 0xfb, 0xfe, 0xfe, 0xe9, 0xab, 0x84, 0x6f, 0x67, 0x66, 0x47, 0x29, 0x13, 
-0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x1e, 
-0x3f, 0x5f, 0x71, 0x6c, 0x58, 0x45, 0x37, 0x26, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xe0, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfc, 0xfb, 0xfc, 0xfc, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xe7, 0xbc, 
-0x85, 0x48, 0x30, 0x2b, 0x2b, 0x25, 0x21, 0x20, 0x1d, 0x1c, 0x19, 0x17, 0x15, 0x13, 0x11, 0x0f, 
-0x0c, 0x0b, 0x07, 0x06, 0x05, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x03, 0x06, 0x07, 0x0a, 0x0c, 0x0d, 0x0f, 0x11, 0x14, 0x17, 0x1a, 0x1d, 0x1c, 0x20, 0x22, 
-0x24, 0x27, 0x4a, 0x9f, 0xf8, 0xfa, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfc, 0xfe, 0xfc, 
-0xeb, 0xc2, 0x91, 0x71, 0x69, 0x5e, 0x41, 0x26, 0x12, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x14, 0x3d, 0x61, 0x73, 0x73, 0x62, 0x4d, 0x3b, 0x2e, 0x1d, 
-0x10, 0x02, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x5c, 0xe6, 0xf7, 0xfb, 
-0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfc, 0xfb, 0xfb, 0xf8, 0xff, 0xfc, 0xf5, 0xe2, 0x99, 0x5b, 0x35, 0x2c, 0x26, 0x24, 0x24, 
-0x20, 0x1e, 0x1b, 0x19, 0x17, 0x16, 0x13, 0x11, 0x0f, 0x0c, 0x09, 0x08, 0x06, 0x03, 0x01, 0x00, 
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x07, 0x09, 0x0a, 0x0b, 0x0d, 0x0f, 
-0x12, 0x15, 0x17, 0x19, 0x1c, 0x1e, 0x20, 0x22, 0x23, 0x2a, 0x59, 0xba, 0xfa, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfc, 0xfc, 0xfc, 0xff, 0xfb, 0xfc, 0xff, 0xfb, 0xf2, 0xcf, 0x91, 0x70, 0x6c, 0x5e, 0x41, 
-0x25, 0x11, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0d, 0x29, 0x5c, 
-0x78, 0x78, 0x6c, 0x57, 0x42, 0x31, 0x24, 0x15, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x02, 0x5e, 0xd4, 0xf5, 0xfa, 0xf7, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xfb, 0xfb, 0xfa, 0xfc, 0xf7, 0xf7, 
-0xfe, 0xe5, 0xb7, 0x74, 0x3f, 0x2c, 0x2a, 0x22, 0x21, 0x22, 0x20, 0x1d, 0x1a, 0x17, 0x15, 0x13, 
-0x11, 0x0e, 0x0b, 0x08, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-0x01, 0x04, 0x06, 0x09, 0x0a, 0x0c, 0x0d, 0x0f, 0x12, 0x16, 0x17, 0x1a, 0x1d, 0x1f, 0x1e, 0x20, 
-0x21, 0x2e, 0x6c, 0xd9, 0xfc, 0xfc, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xfa, 0xf6, 0xfa, 
-0xf8, 0xf6, 0xf5, 0xd9, 0x93, 0x6f, 0x72, 0x60, 0x3e, 0x1f, 0x0a, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x08, 0x1d, 0x43, 0x6f, 0x7b, 0x71, 0x5e, 0x4e, 0x3c, 0x2b, 0x1d, 0x0e, 
-0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5a, 0xd1, 0xfc, 0xfa, 0xf5, 0xfb, 
-0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfc, 0xfb, 0xfb, 0xfa, 0xfc, 0xfc, 0xfa, 0xf7, 0xfa, 0xf8, 0xda, 0x92, 0x4e, 0x2d, 0x27, 
-0x29, 0x25, 0x21, 0x1e, 0x1c, 0x1a, 0x17, 0x15, 0x13, 0x11, 0x0d, 0x0b, 0x08, 0x05, 0x02, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x03, 0x05, 0x09, 0x0c, 0x0f, 0x11, 
-0x14, 0x17, 0x18, 0x1a, 0x1c, 0x1d, 0x1f, 0x23, 0x23, 0x38, 0x86, 0xef, 0xfc, 0xfc, 0xfe, 0xfe, 
-0xfc, 0xfc, 0xfb, 0xfb, 0xff, 0xfe, 0xfa, 0xfc, 0xfe, 0xfb, 0xfe, 0xfc, 0xde, 0x93, 0x73, 0x74, 
-0x5f, 0x2f, 0x16, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x1a, 0x3e, 0x66, 0x7c, 
-0x77, 0x66, 0x52, 0x44, 0x34, 0x24, 0x16, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x0b, 0x66, 0xe1, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfe, 
-0xfb, 0xfb, 0xfa, 0xf8, 0xee, 0xc0, 0x75, 0x34, 0x22, 0x1e, 0x1d, 0x1c, 0x1a, 0x19, 0x17, 0x16, 
-0x13, 0x11, 0x0d, 0x0b, 0x08, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x0c, 0x11, 0x14, 0x16, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1e, 
-0x27, 0x52, 0xad, 0xf6, 0xfb, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 
-0xfe, 0xfe, 0xfa, 0xf8, 0xfc, 0xd5, 0x9b, 0x7f, 0x73, 0x57, 0x2e, 0x10, 0x04, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0x11, 0x2f, 0x5a, 0x78, 0x7b, 0x6f, 0x5d, 0x4a, 0x3d, 0x2d, 0x1f, 0x11, 0x04, 
-0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0xfb, 0xfb, 0xfb, 0xf8, 0xfb, 0xfc, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfa, 0xfb, 0xfe, 0xfc, 0xfb, 0xfc, 0xff, 0xf7, 0xd1, 0x77, 
-0x3c, 0x24, 0x20, 0x1d, 0x19, 0x17, 0x13, 0x11, 0x0e, 0x0c, 0x08, 0x06, 0x04, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x0b, 
-0x0f, 0x13, 0x15, 0x17, 0x18, 0x1c, 0x1a, 0x1e, 0x31, 0x72, 0xd3, 0xf8, 0xfa, 0xfb, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfe, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xf7, 0xf5, 0xd8, 0xa2, 
-0x82, 0x72, 0x4c, 0x1e, 0x0b, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x24, 0x4a, 0x6f, 0x80, 0x74, 
-0x65, 0x54, 0x42, 0x36, 0x2b, 0x19, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 
-0xd4, 0xfa, 0xfb, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xfb, 0xfe, 0xfc, 0xfb, 
-0xfe, 0xfe, 0xfc, 0xfa, 0xfe, 0xfc, 0xf7, 0xd8, 0x8e, 0x45, 0x27, 0x1c, 0x17, 0x13, 0x0f, 0x0c, 
-0x07, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x11, 0x13, 0x16, 0x18, 0x1e, 0x1d, 0x21, 
-0x42, 0x96, 0xeb, 0xfc, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xff, 0xf5, 0xd5, 0xa6, 0x83, 0x67, 0x35, 0x17, 0x08, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x04, 0x19, 0x3e, 0x64, 0x7f, 0x81, 0x6c, 0x5c, 0x4c, 0x3e, 0x32, 0x28, 0x16, 0x09, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x9c, 0xfa, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfb, 0xfe, 0xfe, 0xfa, 0xf7, 
-0xc6, 0x58, 0x25, 0x17, 0x13, 0x10, 0x0a, 0x07, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x06, 0x0d, 0x11, 0x14, 0x17, 0x1b, 0x1c, 0x26, 0x59, 0xb5, 0xf5, 0xfe, 0xfc, 0xfc, 0xff, 0xff, 
-0xff, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfe, 0xfc, 0xf1, 
-0xd2, 0xa2, 0x79, 0x53, 0x2b, 0x10, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0b, 0x2e, 0x57, 0x76, 0x83, 0x7b, 0x64, 
-0x54, 0x44, 0x36, 0x2c, 0x23, 0x11, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x82, 0xef, 
-0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 
-0xfc, 0xfc, 0xfe, 0xf8, 0xfa, 0xfe, 0xf6, 0xed, 0x8e, 0x34, 0x18, 0x0f, 0x0e, 0x0b, 0x04, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x13, 0x16, 0x19, 0x1b, 0x34, 
-0x7d, 0xd7, 0xf8, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 
-0xff, 0xfe, 0xfe, 0xfb, 0xf8, 0xfe, 0xff, 0xfc, 0xf7, 0xd0, 0x99, 0x6d, 0x44, 0x1e, 0x0a, 0x03, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x08, 0x19, 0x4b, 0x6b, 0x7e, 0x7e, 0x73, 0x5c, 0x4c, 0x3e, 0x30, 0x27, 0x1d, 0x0e, 0x05, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x07, 0x63, 0xe5, 0xf3, 0xfa, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xfb, 0xf7, 0xf7, 0xfe, 0x87, 
-0x29, 0x12, 0x10, 0x09, 0x08, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x06, 0x0d, 0x12, 0x1a, 0x1f, 0x4c, 0xaa, 0xf3, 0xfa, 0xfe, 0xfc, 0xfc, 0xff, 0xff, 
-0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 
-0xfe, 0xf7, 0xcd, 0x85, 0x60, 0x39, 0x15, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x13, 0x3b, 0x6a, 0x81, 0x7c, 0x79, 0x69, 0x53, 
-0x44, 0x38, 0x2c, 0x24, 0x1a, 0x0c, 0x05, 0x01, 0x00, 0x00, 0x00, 0x09, 0x4f, 0xd4, 0xfa, 0xf7, 
-0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 
-0xfc, 0xfb, 0xf8, 0xf3, 0xf7, 0xde, 0x73, 0x22, 0x11, 0x0c, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0a, 0x12, 0x21, 0x70, 
-0xd3, 0xfe, 0xf8, 0xfe, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf8, 0xfe, 0xf7, 0xbc, 0x8b, 0x5c, 0x2e, 0x12, 
-0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 
-0x27, 0x50, 0x78, 0x85, 0x7c, 0x72, 0x62, 0x4c, 0x3e, 0x33, 0x29, 0x21, 0x17, 0x0a, 0x05, 0x02, 
-0x01, 0x00, 0x00, 0x3a, 0xb2, 0xf5, 0xfa, 0xf8, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 0xfb, 0xfb, 0xfa, 0xfb, 0xcf, 0x61, 0x1e, 0x0d, 
-0x0c, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x24, 0x93, 0xe9, 0xfe, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 
-0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfc, 0xfc, 0xff, 0xe8, 0xb2, 0x77, 0x49, 0x21, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x18, 0x3d, 0x68, 0x83, 0x82, 0x74, 0x6a, 0x5b, 0x45, 
-0x39, 0x2f, 0x25, 0x1e, 0x16, 0x08, 0x03, 0x02, 0x01, 0x00, 0x17, 0x89, 0xed, 0xfb, 0xf8, 0xfb, 
-0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 
-0xfb, 0xfb, 0xf8, 0xcc, 0x64, 0x1a, 0x0d, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2c, 0xb5, 
-0xfa, 0xfb, 0xfc, 0xf8, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xfe, 0xfa, 0xd8, 0x9c, 0x63, 0x34, 
-0x10, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x11, 0x30, 
-0x5a, 0x7c, 0x86, 0x7b, 0x70, 0x64, 0x52, 0x3f, 0x35, 0x2c, 0x24, 0x20, 0x0d, 0x0d, 0x04, 0x00, 
-0x00, 0x00, 0x5b, 0xd8, 0xfa, 0xfc, 0xf8, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf6, 0xf8, 0xd1, 0x61, 0x1c, 0x11, 0x09, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0xda, 0xfb, 0xf8, 0xfa, 0xfb, 0xfa, 0xfc, 0xfe, 0xfe, 
-0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xff, 0xfe, 0xfb, 0xfe, 0xf3, 0xc6, 0x84, 0x51, 0x21, 0x0c, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x23, 0x4f, 0x78, 0x87, 0x83, 0x77, 0x6b, 0x5f, 0x4d, 0x3c, 
-0x33, 0x2b, 0x23, 0x1b, 0x10, 0x0c, 0x01, 0x00, 0x00, 0x19, 0xba, 0xfb, 0xfa, 0xfc, 0xfc, 0xff, 
-0xfa, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0xff, 0xf2, 
-0xfc, 0xd5, 0x5e, 0x1c, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xdd, 
-0xf5, 0xf2, 0xfc, 0xf1, 0xf8, 0xfc, 0xff, 0xfe, 0xfc, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xe3, 0xb3, 0x75, 
-0x39, 0x19, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x39, 0x69, 
-0x88, 0x87, 0x7e, 0x73, 0x66, 0x5a, 0x49, 0x39, 0x31, 0x28, 0x20, 0x17, 0x14, 0x06, 0x02, 0x00, 
-0x03, 0x68, 0xfe, 0xf8, 0xf2, 0xfc, 0xf8, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfb, 0xf8, 0xf3, 0xfc, 0xee, 0x60, 0x13, 0x06, 0x07, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf7, 0xf3, 0xfa, 0xff, 0xfa, 0xfc, 0xff, 0xfe, 
-0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xf9, 0xe2, 0x9e, 0x52, 0x29, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x0c, 0x29, 0x59, 0x80, 0x8c, 0x82, 0x77, 0x6c, 0x5e, 0x51, 0x42, 0x34, 
-0x2d, 0x25, 0x1d, 0x1b, 0x11, 0x08, 0x04, 0x01, 0x45, 0xd4, 0xfc, 0xf7, 0xfa, 0xfe, 0xf5, 0xfe, 
-0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfb, 0xf8, 0xd9, 
-0x6e, 0x14, 0x0b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 
-0x7a, 0xdd, 0xf6, 0xf5, 0xf8, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfb, 0xfc, 0xf8, 0xcd, 
-0x7c, 0x40, 0x1e, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x17, 0x40, 0x70, 0x8b, 
-0x8d, 0x7e, 0x72, 0x66, 0x57, 0x4a, 0x3d, 0x31, 0x2b, 0x24, 0x1c, 0x17, 0x11, 0x0b, 0x00, 0x1d, 
-0x9f, 0xf5, 0xfb, 0xfa, 0xfe, 0xff, 0xfb, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-0xff, 0xfe, 0xfb, 0xfb, 0xf8, 0xf7, 0xdc, 0x6a, 0x1a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0x69, 0xd0, 0xf2, 0xf6, 0xfb, 0xfe, 0xfe, 
-0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xfe, 0xee, 0xa7, 0x5c, 0x2e, 0x12, 0x04, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x06, 0x2a, 0x5b, 0x81, 0x8f, 0x89, 0x7a, 0x6c, 0x60, 0x51, 0x45, 0x39, 0x2f, 
-0x29, 0x22, 0x1b, 0x14, 0x11, 0x08, 0x09, 0x5c, 0xe0, 0xf8, 0xfb, 0xf8, 0xfa, 0xfe, 0xff, 0xff, 
-0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xf8, 0xfc, 0xde, 0x7f, 0x24, 
-0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0d, 0x5c, 0xde, 0xf5, 0xf8, 0xfc, 0xfc, 0xfb, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 
-0xd0, 0x85, 0x46, 0x20, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x3d, 0x71, 0x8c, 0x8f, 
-0x87, 0x76, 0x69, 0x5c, 0x4e, 0x42, 0x37, 0x2e, 0x29, 0x22, 0x1b, 0x19, 0x0e, 0x05, 0x20, 0xa5, 
-0xf2, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-0xff, 0xfe, 0xfa, 0xf8, 0xed, 0x91, 0x27, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x69, 0xf2, 0xf7, 0xfb, 0xfb, 
-0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xfa, 0xfe, 0xeb, 0xae, 0x5e, 0x2c, 0x0f, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x04, 0x14, 0x4e, 0x80, 0x92, 0x8d, 0x84, 0x73, 0x64, 0x57, 0x4b, 0x41, 0x36, 0x2b, 
-0x24, 0x1e, 0x19, 0x17, 0x11, 0x10, 0x63, 0xe1, 0xf7, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xfc, 0xfa, 0x98, 0x2e, 0x0c, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x07, 0x6f, 0xf1, 0xf7, 0xf8, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 
-0xf8, 0xd5, 0x7f, 0x39, 0x16, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x27, 0x65, 0x8b, 0x91, 0x88, 
-0x7e, 0x6c, 0x5e, 0x51, 0x46, 0x3d, 0x32, 0x28, 0x24, 0x1f, 0x1a, 0x17, 0x0f, 0x3a, 0xb3, 0xf8, 
-0xfa, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xfb, 0xfe, 
-0xf7, 0xfc, 0xf6, 0xbc, 0x2d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x83, 0xe7, 0xfe, 
-0xf7, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xfb, 0xee, 0xaf, 0x57, 0x25, 0x0b, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x05, 0x14, 0x3c, 0x7b, 0x92, 0x8e, 0x83, 0x7a, 0x68, 0x5a, 0x4d, 0x42, 0x39, 0x2f, 0x26, 
-0x23, 0x1f, 0x1b, 0x16, 0x11, 0x74, 0xe7, 0xfe, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfa, 0xfc, 0xfb, 0xfb, 0xfe, 0xc7, 0x52, 0x06, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x9d, 0xeb, 0xf8, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfb, 
-0xfd, 0xf9, 0xd2, 0x7c, 0x38, 0x16, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x24, 0x57, 0x8d, 0x97, 0x8d, 0x82, 
-0x76, 0x65, 0x57, 0x4a, 0x40, 0x39, 0x2e, 0x25, 0x22, 0x1e, 0x1a, 0x11, 0x23, 0xbe, 0xfa, 0xfc, 
-0xfb, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xfb, 0xf3, 
-0xfb, 0xdd, 0x6b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x39, 0xaa, 
-0xf6, 0xe9, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xec, 0xa7, 0x53, 0x23, 0x07, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x0f, 0x35, 0x6d, 0x98, 0x9a, 0x8d, 0x80, 0x75, 0x64, 0x56, 0x49, 0x3f, 0x38, 0x2d, 0x25, 
-0x21, 0x1d, 0x18, 0x0f, 0x4b, 0xf5, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xf7, 0xf8, 0xef, 0x8d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x48, 0xc5, 0xf5, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
-0xfc, 0xfc, 0xf9, 0xcf, 0x75, 0x30, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x18, 0x46, 0x7d, 0x9a, 0x97, 0x8b, 0x7e, 
-0x72, 0x61, 0x52, 0x45, 0x3c, 0x34, 0x2b, 0x24, 0x21, 0x1b, 0x16, 0x22, 0x94, 0xfe, 0xfa, 0xfc, 
-0xfc, 0xfa, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf7, 0xf8, 0xf7, 
-0xb2, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0c, 
-0x5d, 0xea, 0xf8, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xeb, 0xa0, 0x43, 0x13, 0x05, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x0d, 0x28, 0x5d, 0x8d, 0x99, 0x95, 0x87, 0x7b, 0x70, 0x5e, 0x4f, 0x42, 0x37, 0x30, 0x2a, 0x24, 
-0x20, 0x1a, 0x14, 0x42, 0xe4, 0xfa, 0xfe, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfb, 0xd0, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x7b, 0xf6, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 
-0xff, 0xfb, 0xf5, 0xf4, 0xc8, 0x64, 0x20, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x47, 0x7c, 0x9b, 0x9c, 0x92, 0x86, 0x7a, 
-0x6f, 0x5d, 0x4d, 0x40, 0x37, 0x33, 0x28, 0x26, 0x1d, 0x1d, 0x25, 0x89, 0xf3, 0xfa, 0xf8, 0xfe, 
-0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfc, 0xfb, 0xf7, 0xfb, 0xfb, 0xff, 0xdc, 0x62, 
-0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x06, 0x27, 0xa0, 0xef, 0xfe, 0xfe, 0xfc, 0xfa, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xf7, 0xfb, 0xe4, 0xa0, 0x38, 0x16, 
-0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 
-0x2a, 0x5c, 0x8d, 0xa2, 0x9b, 0x91, 0x84, 0x79, 0x6e, 0x5c, 0x4c, 0x40, 0x37, 0x30, 0x27, 0x25, 
-0x1f, 0x1d, 0x3f, 0xb9, 0xfc, 0xfc, 0xfb, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-0xf6, 0xfc, 0xfb, 0xfe, 0xf5, 0xf8, 0x92, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x4d, 0xbc, 0xf3, 0xfb, 0xfe, 0xff, 
-0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-0xff, 0xfc, 0xfb, 0xfb, 0xf4, 0xcd, 0x50, 0x20, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x3a, 0x6d, 0x96, 0xa3, 0x99, 0x8e, 0x83, 0x77, 
-0x6c, 0x5b, 0x4c, 0x3f, 0x36, 0x2e, 0x28, 0x24, 0x1e, 0x1f, 0x68, 0xe5, 0xfe, 0xfb, 0xfb, 0xfe, 
-0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf6, 0xfc, 0xf5, 0xfa, 0xfa, 0xd7, 0x33, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x06, 0x0d, 0x21, 0x6c, 0xdc, 0xfe, 0xf6, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfb, 0xfa, 0xf8, 0xe9, 0x6f, 0x2e, 
-0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 
-0x4d, 0x7e, 0x9c, 0xa2, 0x97, 0x8c, 0x80, 0x75, 0x6a, 0x5a, 0x4b, 0x3f, 0x34, 0x2d, 0x2b, 0x21, 
-0x1c, 0x2b, 0x98, 0xf6, 0xf6, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 
-0xfc, 0xfa, 0xf3, 0xfb, 0xed, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x33, 0x9f, 0xf3, 0xf7, 0xf8, 
-0xfc, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfa, 0xfa, 0xfe, 0xfb, 0xf6, 0xf0, 0x91, 0x40, 0x19, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x28, 0x5d, 0x89, 0xa0, 0xa3, 0x96, 0x8b, 0x7f, 0x74, 
-0x69, 0x59, 0x4b, 0x3e, 0x33, 0x2d, 0x2b, 0x20, 0x1c, 0x47, 0xc3, 0xfc, 0xf3, 0xff, 0xfc, 0xfc, 
-0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xf2, 0xf8, 0xf7, 0xa2, 0x19, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x05, 0x0d, 0x1b, 0x52, 0xc3, 0xfa, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfd, 0xf8, 0xb0, 0x4f, 
-0x20, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x35, 
-0x6c, 0x92, 0xa2, 0xa4, 0x96, 0x8a, 0x7e, 0x73, 0x68, 0x58, 0x4a, 0x3e, 0x35, 0x2e, 0x26, 0x1f, 
-0x24, 0x75, 0xe6, 0xfc, 0xf6, 0xfe, 0xfc, 0xfe, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 
-0xfb, 0xfa, 0xf8, 0xbc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x10, 0x1d, 0x5f, 0xd3, 0xff, 
-0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfa, 0xc9, 0x68, 0x2b, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x49, 0x7d, 0x98, 0xa5, 0xa4, 0x94, 0x89, 0x7d, 0x72, 
-0x67, 0x58, 0x4a, 0x3e, 0x37, 0x30, 0x23, 0x20, 0x2d, 0x94, 0xf2, 0xf8, 0xf8, 0xfc, 0xfa, 0xfc, 
-0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf3, 0xfe, 0xe2, 0x6f, 0x06, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0x0c, 0x14, 0x2c, 0x90, 0xfa, 0xf8, 0xfc, 0xfb, 0xfa, 0xff, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xfc, 0xfc, 0xff, 0xf9, 0xdb, 0x86, 
-0x3c, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x17, 0x62, 
-0x91, 0x9d, 0xa6, 0xa3, 0x92, 0x89, 0x7c, 0x71, 0x65, 0x59, 0x4a, 0x3f, 0x37, 0x31, 0x22, 0x24, 
-0x3d, 0xa7, 0xf5, 0xfb, 0xfe, 0xfb, 0xfa, 0xfb, 0xfc, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 
-0xf6, 0xf5, 0xaa, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x15, 0x4a, 0xc7, 
-0xfa, 0xfe, 0xfa, 0xfa, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xe8, 0xa3, 0x52, 0x21, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x24, 0x79, 0xa1, 0xa2, 0xa4, 0x9f, 0x90, 0x87, 0x7c, 0x71, 
-0x65, 0x59, 0x4b, 0x40, 0x37, 0x2f, 0x25, 0x27, 0x4a, 0xa0, 0xe5, 0xfa, 0xfe, 0xfc, 0xfc, 0xff, 
-0xfe, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0xdd, 0x5a, 0x07, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x07, 0x0d, 0x1f, 0x6f, 0xeb, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xff, 0xfe, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf1, 0xbc, 
-0x68, 0x30, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x37, 0x91, 
-0xaf, 0xa5, 0xa3, 0x9c, 0x8e, 0x87, 0x7b, 0x71, 0x65, 0x59, 0x4b, 0x41, 0x3b, 0x31, 0x2a, 0x2a, 
-0x4e, 0x82, 0xae, 0xd8, 0xee, 0xff, 0xfe, 0xfb, 0xfc, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 
-0xff, 0xa5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x10, 0x36, 
-0xc0, 0xf8, 0xfb, 0xfc, 0xfe, 0xff, 0xfc, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 0xcf, 0x80, 0x43, 0x12, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x45, 0xa3, 0xb8, 0xa6, 0x9e, 0x99, 0x90, 0x89, 0x7b, 0x70, 
-0x64, 0x59, 0x4c, 0x43, 0x3d, 0x30, 0x2d, 0x2f, 0x50, 0x65, 0x76, 0x99, 0xbe, 0xed, 0xfa, 0xfb, 
-0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 0xfe, 0xfc, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x10, 0x1d, 0x76, 0xe5, 0xff, 0xfa, 0xfc, 0xff, 0xfa, 0xfb, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xd9, 
-0x93, 0x54, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x16, 0x4f, 0xae, 
-0xc0, 0xa9, 0x9d, 0x97, 0x8e, 0x89, 0x7b, 0x70, 0x64, 0x59, 0x4e, 0x45, 0x3e, 0x2f, 0x2d, 0x3c, 
-0x57, 0x5e, 0x5f, 0x5f, 0x72, 0xa2, 0xca, 0xea, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xfa, 0xfb, 
-0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x11, 
-0x38, 0xab, 0xf7, 0xfc, 0xf7, 0xfe, 0xfa, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xdc, 0xa2, 0x5e, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x06, 0x1e, 0x5c, 0xb9, 0xc6, 0xac, 0x9c, 0x94, 0x8c, 0x87, 0x7b, 0x70, 
-0x64, 0x59, 0x4e, 0x46, 0x40, 0x33, 0x2f, 0x46, 0x5b, 0x60, 0x5b, 0x54, 0x5a, 0x6b, 0x84, 0xab, 
-0xd3, 0xea, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 
-0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfb, 0xfe, 0xf1, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x24, 0x71, 0xdc, 0xfc, 0xf7, 0xfc, 0xfb, 0xfc, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf9, 0xda, 
-0xae, 0x67, 0x25, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x2e, 0x77, 0xc6, 
-0xce, 0xb1, 0x99, 0x92, 0x8c, 0x84, 0x79, 0x6e, 0x64, 0x5a, 0x4f, 0x46, 0x40, 0x36, 0x33, 0x4d, 
-0x5d, 0x5b, 0x55, 0x54, 0x54, 0x56, 0x5c, 0x6b, 0x89, 0xa5, 0xdd, 0xf1, 0xfc, 0xfe, 0xff, 0xff, 
-0xfb, 0xfb, 0xff, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfc, 0xfc, 0xfb, 0xfb, 0xfa, 0xfa, 0xfe, 0xb7, 
-0x22, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 
-0x17, 0x41, 0xb3, 0xf6, 0xfc, 0xfa, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-0xfe, 0xff, 0xfe, 0xfc, 0xfc, 0xfc, 0xf6, 0xdf, 0xbc, 0x7d, 0x37, 0x0a, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x10, 0x3c, 0x8a, 0xd0, 0xd6, 0xb8, 0x99, 0x8e, 0x8b, 0x82, 0x77, 0x6e, 
-0x63, 0x5b, 0x50, 0x47, 0x3f, 0x38, 0x37, 0x51, 0x5f, 0x57, 0x52, 0x53, 0x53, 0x54, 0x54, 0x51, 
-0x56, 0x5f, 0x7b, 0xaf, 0xe4, 0xfb, 0xff, 0xfe, 0xfb, 0xfc, 0xfb, 0xfa, 0xfb, 0xfb, 0xfe, 0xff, 
-0xfb, 0xfc, 0xfc, 0xfb, 0xfa, 0xfb, 0xef, 0x71, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x11, 0x29, 0x7b, 0xe9, 0xfc, 0xfa, 0xfb, 0xfb, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xf5, 0xe5, 
-0xcb, 0x93, 0x47, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x46, 0x93, 0xd7, 
-0xde, 0xc0, 0x9d, 0x8a, 0x87, 0x83, 0x77, 0x6e, 0x62, 0x5a, 0x50, 0x49, 0x41, 0x39, 0x3c, 0x56, 
-0x5f, 0x58, 0x52, 0x50, 0x50, 0x51, 0x50, 0x48, 0x40, 0x3d, 0x38, 0x55, 0x86, 0xbe, 0xe6, 0xfb, 
-0xfe, 0xfb, 0xf7, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xfa, 0xfb, 0xfe, 0xc3, 0x33, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x0f, 0x1b, 0x45, 0xce, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe8, 0xd3, 0x9d, 0x4f, 0x11, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0x18, 0x4f, 0xa4, 0xd8, 0xe3, 0xce, 0xa8, 0x8a, 0x83, 0x80, 0x77, 0x6e, 
-0x62, 0x5a, 0x52, 0x4c, 0x44, 0x3b, 0x42, 0x5b, 0x5d, 0x58, 0x52, 0x4f, 0x4c, 0x49, 0x49, 0x44, 
-0x3c, 0x34, 0x2a, 0x22, 0x2b, 0x47, 0x70, 0xa9, 0xe1, 0xf3, 0xfc, 0xfe, 0xfb, 0xf8, 0xfc, 0xfe, 
-0xfb, 0xf8, 0xff, 0xf8, 0xfc, 0xf2, 0x79, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x13, 0x23, 0x86, 0xef, 0xfc, 0xfb, 0xfc, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xee, 0xec, 
-0xd8, 0xa6, 0x5a, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x27, 0x65, 0xaf, 0xdd, 
-0xe5, 0xd9, 0xb5, 0x90, 0x82, 0x7e, 0x77, 0x6e, 0x63, 0x5c, 0x53, 0x4d, 0x46, 0x3d, 0x48, 0x5e, 
-0x5b, 0x57, 0x51, 0x50, 0x4d, 0x47, 0x44, 0x3e, 0x33, 0x27, 0x1d, 0x1d, 0x1f, 0x22, 0x2b, 0x4c, 
-0x85, 0xb7, 0xde, 0xfb, 0xfe, 0xfb, 0xfc, 0xfe, 0xfe, 0xf7, 0xfe, 0xfc, 0xfb, 0xd1, 0x43, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x07, 0x0d, 0x17, 0x4b, 0xd4, 0xfc, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xfe, 0xff, 0xff, 0xfc, 0xf8, 0xed, 0xee, 0xde, 0xb3, 0x70, 0x24, 0x07, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x0c, 0x32, 0x83, 0xbd, 0xe1, 0xe5, 0xe0, 0xc5, 0x9a, 0x7f, 0x7c, 0x76, 0x6e, 
-0x65, 0x5e, 0x55, 0x4e, 0x49, 0x3e, 0x4c, 0x60, 0x57, 0x55, 0x50, 0x4c, 0x4b, 0x46, 0x42, 0x3b, 
-0x2d, 0x1f, 0x1d, 0x19, 0x1c, 0x1d, 0x1d, 0x24, 0x36, 0x57, 0x8a, 0xc2, 0xe1, 0xf5, 0xfc, 0xfe, 
-0xfe, 0xf7, 0xfe, 0xfe, 0xf1, 0x9a, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x11, 0x29, 0xa0, 0xfc, 0xfc, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xf8, 0xf2, 0xea, 0xf1, 
-0xe4, 0xc0, 0x84, 0x31, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x3c, 0x8b, 0xca, 0xe1, 
-0xe4, 0xe2, 0xcf, 0xa3, 0x7f, 0x7a, 0x75, 0x6e, 0x66, 0x60, 0x56, 0x4e, 0x49, 0x3e, 0x4e, 0x60, 
-0x55, 0x54, 0x50, 0x4b, 0x49, 0x41, 0x39, 0x32, 0x28, 0x1b, 0x19, 0x17, 0x17, 0x19, 0x1c, 0x1d, 
-0x20, 0x27, 0x38, 0x57, 0x84, 0xc5, 0xed, 0xfa, 0xfc, 0xf6, 0xfc, 0xfb, 0xde, 0x68, 0x0c, 0x00, 
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x08, 0x0e, 0x1a, 0x67, 0xee, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xfe, 0xff, 0xfe, 0xf6, 0xed, 0xeb, 0xf2, 0xe7, 0xc5, 0x8e, 0x38, 0x0d, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x0e, 0x3e, 0x87, 0xd3, 0xdf, 0xdd, 0xe9, 0xe1, 0xb8, 0x86, 0x76, 0x73, 0x6f, 
-0x68, 0x5e, 0x58, 0x4e, 0x47, 0x43, 0x50, 0x5e, 0x55, 0x50, 0x4e, 0x4a, 0x46, 0x3e, 0x35, 0x2b, 
-0x20, 0x19, 0x15, 0x15, 0x17, 0x18, 0x1a, 0x1b, 0x1d, 0x1d, 0x1e, 0x25, 0x33, 0x5e, 0x94, 0xc8, 
-0xee, 0xfa, 0xfe, 0xf6, 0xad, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x19, 0x38, 0xd0, 0xfb, 0xfb, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfb, 0xfc, 0xfb, 0xf2, 0xe7, 0xf1, 0xef, 
-0xe7, 0xca, 0x90, 0x38, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x3f, 0x89, 0xcd, 0xe3, 
-0xe2, 0xe9, 0xe6, 0xd0, 0x97, 0x77, 0x6e, 0x6a, 0x69, 0x5f, 0x5a, 0x54, 0x4a, 0x45, 0x51, 0x5c, 
-0x54, 0x4e, 0x4c, 0x47, 0x43, 0x3b, 0x31, 0x25, 0x1b, 0x15, 0x13, 0x13, 0x15, 0x17, 0x18, 0x19, 
-0x19, 0x1a, 0x1a, 0x1d, 0x1f, 0x2b, 0x41, 0x61, 0x90, 0xc8, 0xeb, 0xd4, 0x76, 0x1c, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x0b, 0x12, 0x22, 0xa9, 0xf5, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfb, 0xfe, 0xfe, 0xf6, 0xeb, 0xea, 0xf2, 0xef, 0xe5, 0xcc, 0x90, 0x38, 0x0d, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x10, 0x40, 0x8f, 0xcb, 0xe0, 0xe5, 0xe4, 0xe5, 0xe7, 0xb5, 0x86, 0x6b, 0x63, 
-0x67, 0x62, 0x5a, 0x55, 0x4c, 0x47, 0x51, 0x5a, 0x52, 0x4c, 0x4a, 0x44, 0x3e, 0x34, 0x29, 0x1d, 
-0x15, 0x10, 0x10, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x16, 0x16, 0x1a, 0x1c, 0x17, 0x19, 0x1c, 
-0x2b, 0x48, 0x61, 0x51, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x0c, 0x16, 0x72, 0xe4, 0xfb, 
-0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfb, 0xee, 0xe6, 0xf1, 0xee, 0xeb, 
-0xe5, 0xcc, 0x92, 0x3a, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x4a, 0x99, 0xc9, 0xdc, 
-0xe0, 0xe2, 0xe4, 0xe9, 0xca, 0x9e, 0x74, 0x60, 0x61, 0x62, 0x5a, 0x54, 0x4d, 0x4a, 0x52, 0x58, 
-0x4f, 0x4a, 0x48, 0x43, 0x3e, 0x31, 0x25, 0x1a, 0x11, 0x0d, 0x0f, 0x0f, 0x11, 0x11, 0x12, 0x13, 
-0x14, 0x15, 0x15, 0x17, 0x19, 0x18, 0x1b, 0x1c, 0x1d, 0x21, 0x25, 0x24, 0x11, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x06, 0x0c, 0x15, 0x54, 0xcf, 0xfa, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xfc, 0xf1, 0xe9, 0xea, 0xf2, 0xeb, 0xe9, 0xe3, 0xce, 0x9b, 0x45, 0x16, 0x03, 0x00, 0x00, 
-0x00, 0x01, 0x07, 0x24, 0x62, 0xaa, 0xd0, 0xdd, 0xde, 0xe5, 0xe5, 0xe4, 0xda, 0xba, 0x86, 0x65, 
-0x5d, 0x5f, 0x5c, 0x54, 0x4e, 0x4d, 0x54, 0x55, 0x4c, 0x48, 0x45, 0x42, 0x3c, 0x2e, 0x22, 0x17, 
-0x10, 0x0c, 0x0d, 0x0d, 0x0e, 0x0f, 0x10, 0x10, 0x11, 0x12, 0x14, 0x15, 0x13, 0x14, 0x18, 0x17, 
-0x19, 0x1d, 0x1b, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x12, 0x39, 0xab, 0xf6, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfb, 0xfe, 0xf3, 0xe5, 0xe9, 0xef, 0xee, 0xe9, 0xe6, 
-0xe1, 0xd3, 0xac, 0x5b, 0x22, 0x07, 0x01, 0x00, 0x00, 0x01, 0x0b, 0x2e, 0x74, 0xbb, 0xde, 0xe0, 
-0xe0, 0xe5, 0xe2, 0xe2, 0xe5, 0xd3, 0xa5, 0x79, 0x60, 0x59, 0x5c, 0x56, 0x50, 0x4f, 0x55, 0x53, 
-0x4a, 0x47, 0x43, 0x3f, 0x39, 0x29, 0x1d, 0x13, 0x0d, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 
-0x0d, 0x0d, 0x11, 0x12, 0x12, 0x13, 0x15, 0x14, 0x18, 0x1c, 0x1b, 0x17, 0x09, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x07, 0x10, 0x26, 0x83, 0xea, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 
-0xf7, 0xea, 0xe2, 0xea, 0xef, 0xe9, 0xe6, 0xe4, 0xe0, 0xd8, 0xba, 0x6d, 0x2c, 0x0a, 0x01, 0x00, 
-0x00, 0x01, 0x0c, 0x35, 0x82, 0xc1, 0xdb, 0xe1, 0xe0, 0xe0, 0xdc, 0xe4, 0xea, 0xe2, 0xc5, 0x91, 
-0x68, 0x54, 0x59, 0x54, 0x51, 0x50, 0x55, 0x52, 0x49, 0x46, 0x41, 0x3c, 0x34, 0x25, 0x19, 0x10, 
-0x0b, 0x08, 0x08, 0x08, 0x09, 0x0a, 0x0a, 0x0b, 0x0c, 0x0e, 0x0f, 0x0f, 0x11, 0x13, 0x12, 0x12, 
-0x12, 0x11, 0x13, 0x12, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0x20, 0x68, 0xe0, 
-0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xed, 0xe5, 0xe7, 0xee, 0xea, 0xe5, 0xe5, 0xe1, 
-0xe0, 0xda, 0xc1, 0x76, 0x30, 0x0c, 0x01, 0x00, 0x00, 0x01, 0x0c, 0x37, 0x82, 0xc0, 0xe3, 0xe0, 
-0xdd, 0xdd, 0xde, 0xe2, 0xe7, 0xea, 0xde, 0xc0, 0x90, 0x62, 0x54, 0x53, 0x4f, 0x53, 0x55, 0x4d, 
-0x48, 0x44, 0x3e, 0x3a, 0x2e, 0x1e, 0x13, 0x0a, 0x06, 0x06, 0x05, 0x06, 0x06, 0x07, 0x09, 0x0a, 
-0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 0x0e, 0x0f, 0x0f, 0x10, 0x11, 0x13, 0x0b, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0x02, 0x0f, 0x17, 0x47, 0xc5, 0xfe, 0xf3, 0xfe, 0xfb, 0xfb, 0xfc, 0xfc, 0xed, 
-0xe1, 0xe2, 0xe7, 0xe7, 0xe4, 0xe2, 0xe0, 0xde, 0xdd, 0xd6, 0xbf, 0x77, 0x32, 0x0b, 0x01, 0x00, 
-0x00, 0x01, 0x0d, 0x37, 0x84, 0xc1, 0xd9, 0xe1, 0xde, 0xdd, 0xde, 0xe1, 0xe5, 0xe6, 0xe4, 0xe1, 
-0xc5, 0x84, 0x55, 0x4f, 0x4e, 0x51, 0x52, 0x4a, 0x46, 0x42, 0x3e, 0x36, 0x2b, 0x1b, 0x11, 0x07, 
-0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0c, 0x0c, 0x0d, 0x0d, 
-0x0e, 0x10, 0x11, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0b, 0x16, 0x3a, 0xad, 
-0xf7, 0xf6, 0xfe, 0xfb, 0xfb, 0xf6, 0xf6, 0xdc, 0xdc, 0xe5, 0xeb, 0xe7, 0xe1, 0xe0, 0xde, 0xdd, 
-0xdc, 0xd5, 0xbf, 0x77, 0x32, 0x0c, 0x01, 0x00, 0x00, 0x01, 0x0c, 0x36, 0x84, 0xc6, 0xdb, 0xe1, 
-0xde, 0xdd, 0xdd, 0xde, 0xe0, 0xe2, 0xe4, 0xeb, 0xe5, 0xb3, 0x6f, 0x51, 0x48, 0x49, 0x4a, 0x46, 
-0x43, 0x3f, 0x3c, 0x33, 0x28, 0x17, 0x0d, 0x06, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 
-0x07, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0a, 0x0b, 0x0c, 0x0c, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x05, 0x06, 0x15, 0x2c, 0x8d, 0xf1, 0xfb, 0xfb, 0xff, 0xfb, 0xea, 0xde, 0xdc, 
-0xe1, 0xe6, 0xe6, 0xe2, 0xde, 0xe0, 0xdc, 0xda, 0xda, 0xd5, 0xbe, 0x77, 0x32, 0x0b, 0x01, 0x00, 
-0x00, 0x01, 0x0c, 0x36, 0x82, 0xc4, 0xde, 0xe1, 0xde, 0xdd, 0xdc, 0xdc, 0xdd, 0xe0, 0xe1, 0xe2, 
-0xe5, 0xd7, 0xa3, 0x6c, 0x4f, 0x48, 0x45, 0x44, 0x42, 0x3d, 0x37, 0x2f, 0x24, 0x13, 0x0c, 0x04, 
-0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 
-0x08, 0x0a, 0x0b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x16, 0x24, 0x71, 
-0xde, 0xfb, 0xfa, 0xfb, 0xf2, 0xdd, 0xd3, 0xe6, 0xe6, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xda, 0xd9, 
-0xd9, 0xd4, 0xbe, 0x77, 0x32, 0x0b, 0x01, 0x00, 0x00, 0x01, 0x0c, 0x37, 0x82, 0xc3, 0xdd, 0xe0, 
-0xdd, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xde, 0xe2, 0xe4, 0xe4, 0xd4, 0xa4, 0x69, 0x4f, 0x40, 0x3e, 
-0x3e, 0x3b, 0x35, 0x2c, 0x21, 0x11, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-0x02, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x05, 0x07, 0x16, 0x1f, 0x59, 0xcb, 0xfb, 0xfe, 0xe7, 0xd5, 0xce, 0xda, 0xe1, 
-0xe1, 0xde, 0xdd, 0xde, 0xdd, 0xd8, 0xd8, 0xd7, 0xd8, 0xd4, 0xbe, 0x77, 0x32, 0x0b, 0x01, 0x00, 
-0x00, 0x01, 0x0c, 0x37, 0x80, 0xc5, 0xdc, 0xdd, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xd9, 0xda, 0xe1, 
-0xe4, 0xe1, 0xe4, 0xd4, 0xa0, 0x71, 0x4c, 0x3a, 0x3a, 0x39, 0x35, 0x2b, 0x1d, 0x0e, 0x08, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 
-0x03, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x11, 0x1a, 0x44, 
-0xaf, 0xf5, 0xe4, 0xc7, 0xc5, 0xce, 0xdd, 0xd5, 0xdc, 0xdc, 0xd9, 0xda, 0xd9, 0xd5, 0xd7, 0xd5, 
-0xd7, 0xd2, 0xbe, 0x77, 0x33, 0x0c, 0x01, 0x00, 0x00, 0x01, 0x0d, 0x36, 0x7f, 0xc5, 0xda, 0xdc, 
-0xdc, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xdd, 0xda, 0xe2, 0xe4, 0xe1, 0xc0, 0x83, 0x4d, 
-0x3d, 0x35, 0x2f, 0x27, 0x1d, 0x0e, 0x07, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x18, 0x34, 0x72, 0xa3, 0x9f, 0xad, 0xc7, 0xd5, 0xd9, 0xd4, 
-0xda, 0xda, 0xd5, 0xd4, 0xd8, 0xd9, 0xd5, 0xd4, 0xd5, 0xd2, 0xbe, 0x77, 0x32, 0x0b, 0x01, 0x00, 
-0x00, 0x01, 0x0c, 0x36, 0x81, 0xc1, 0xdc, 0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd7, 0xd7, 
-0xd7, 0xd9, 0xdd, 0xe1, 0xde, 0xdc, 0xc6, 0x7e, 0x50, 0x38, 0x2c, 0x23, 0x1d, 0x0f, 0x08, 0x05, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x1a, 0x2b, 
-0x43, 0x62, 0x8b, 0xb7, 0xc8, 0xcb, 0xd4, 0xd3, 0xd3, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd3, 
-0xd1, 0xce, 0xbe, 0x77, 0x32, 0x0b, 0x01, 0x00, 0x00, 0x01, 0x0c, 0x36, 0x7f, 0xc0, 0xdb, 0xdd, 
-0xdc, 0xda, 0xd9, 0xd9, 0xd8, 0xd7, 0xd4, 0xd4, 0xd4, 0xd7, 0xd9, 0xdd, 0xda, 0xdd, 0xde, 0xbc, 
-0x85, 0x53, 0x36, 0x25, 0x1b, 0x0f, 0x08, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x04, 0x10, 0x17, 0x29, 0x3b, 0x61, 0x94, 0xbd, 0xc8, 0xc8, 0xcc, 0xcf, 
-0xd0, 0xd1, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd0, 0xcd, 0xbd, 0x77, 0x32, 0x0b, 0x01, 0x00, 
-0x00, 0x01, 0x0c, 0x36, 0x7f, 0xc0, 0xda, 0xdd, 0xdc, 0xda, 0xd9, 0xd8, 0xd8, 0xd5, 0xd3, 0xd1, 
-0xd3, 0xd3, 0xd5, 0xd7, 0xd8, 0xd9, 0xd7, 0xd1, 0xc3, 0x93, 0x57, 0x33, 0x1e, 0x0e, 0x0a, 0x03, 
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x0e, 0x17, 0x2c, 
-0x49, 0x76, 0xa4, 0xba, 0xc2, 0xc6, 0xc8, 0xcc, 0xce, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 
-0xcf, 0xcc, 0xbc, 0x77, 0x32, 0x0b, 0x01, 0x00, 0x00, 0x01, 0x0d, 0x34, 0x7c, 0xbf, 0xdb, 0xde, 
-0xdc, 0xda, 0xd9, 0xd8, 0xd7, 0xd4, 0xcf, 0xcf, 0xcf, 0xcf, 0xd0, 0xd0, 0xcb, 0xd1, 0xd4, 0xcc, 
-0xcc, 0xbc, 0x93, 0x5c, 0x32, 0x0f, 0x08, 0x06, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x01, 0x05, 0x10, 0x1d, 0x35, 0x59, 0x82, 0xa3, 0xb0, 0xbd, 0xc6, 0xcb, 0xca, 
-0xcb, 0xcc, 0xcf, 0xcf, 0xd0, 0xcf, 0xce, 0xce, 0xce, 0xca, 0xba, 0x75, 0x30, 0x0b, 0x01, 0x00, 
-0x00, 0x01, 0x0b, 0x30, 0x76, 0xbb, 0xd9, 0xdd, 0xdd, 0xdc, 0xd9, 0xd8, 0xd5, 0xd1, 0xcf, 0xce, 
-0xce, 0xce, 0xcc, 0xcb, 0xca, 0xcb, 0xce, 0xcc, 0xc5, 0xba, 0xb7, 0x91, 0x5a, 0x1d, 0x0b, 0x06, 
-0x04, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x06, 0x12, 0x24, 0x44, 
-0x67, 0x87, 0x9f, 0xb0, 0xbe, 0xc2, 0xc5, 0xc7, 0xc8, 0xca, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xcc, 
-0xcb, 0xc8, 0xb6, 0x6f, 0x2d, 0x0b, 0x01, 0x00, 0x00, 0x01, 0x07, 0x23, 0x5f, 0xa7, 0xcd, 0xdf, 
-0xdd, 0xdc, 0xd9, 0xd7, 0xd5, 0xd1, 0xcf, 0xcf, 0xce, 0xcc, 0xcb, 0xc8, 0xc7, 0xc8, 0xc5, 0xc0, 
-0xc0, 0xb9, 0xab, 0x9f, 0x7f, 0x44, 0x21, 0x0e, 0x07, 0x05, 0x04, 0x03, 0x01, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x04, 0x05, 0x07, 0x15, 0x2b, 0x51, 0x73, 0x8b, 0xa0, 0xb5, 0xbc, 0xba, 0xc1, 0xc2, 
-0xc5, 0xc6, 0xc8, 0xca, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xc2, 0xa5, 0x58, 0x20, 0x06, 0x01, 0x00, 
-0x00, 0x00, 0x04, 0x17, 0x4a, 0x91, 0xc5, 0xdb, 0xdc, 0xda, 0xd8, 0xd5, 0xd4, 0xd1, 0xcf, 0xce, 
-0xcb, 0xca, 0xc7, 0xc6, 0xc3, 0xc5, 0xc2, 0xb8, 0xb7, 0xb3, 0xa7, 0x9a, 0x89, 0x59, 0x33, 0x19, 
-0x0c, 0x06, 0x05, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x0a, 0x19, 0x33, 0x58, 
-0x74, 0x89, 0x9f, 0xae, 0xb4, 0xb7, 0xbe, 0xc0, 0xc0, 0xc2, 0xc3, 0xc5, 0xc7, 0xc6, 0xc6, 0xc6, 
-0xc5, 0xbb, 0x94, 0x43, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x3e, 0x88, 0xc4, 0xd7, 
-0xd9, 0xd9, 0xd7, 0xd5, 0xd3, 0xd1, 0xcf, 0xce, 0xca, 0xc8, 0xc6, 0xc5, 0xc5, 0xc2, 0xbd, 0xb9, 
-0xb5, 0xae, 0xa7, 0x99, 0x8a, 0x64, 0x43, 0x27, 0x14, 0x0b, 0x06, 0x03, 0x02, 0x02, 0x02, 0x01, 
-0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x01, 0x02, 0x03, 0x06, 0x0c, 0x1e, 0x3a, 0x5c, 0x75, 0x89, 0x9e, 0xa9, 0xaf, 0xb4, 0xb8, 0xbd, 
-0xbd, 0xbe, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb7, 0x8c, 0x39, 0x0e, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x0e, 0x3d, 0x87, 0xba, 0xd7, 0xd9, 0xd8, 0xd5, 0xd4, 0xd3, 0xd1, 0xcf, 0xce, 
-0xca, 0xc8, 0xc6, 0xc5, 0xc3, 0xc1, 0xbc, 0xb8, 0xb4, 0xad, 0xa5, 0x98, 0x8c, 0x6e, 0x51, 0x35, 
-0x20, 0x14, 0x0a, 0x06, 0x03, 0x03, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x06, 0x08, 0x10, 0x24, 0x3f, 0x61, 
-0x79, 0x8b, 0x9e, 0xa8, 0xad, 0xb2, 0xb5, 0xba, 0xba, 0xbc, 0xbe, 0xc0, 0xc1, 0xc1, 0xc2, 0xc2, 
-0xc3, 0xb7, 0x8a, 0x37, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x3b, 0x86, 0xc2, 0xd6, 
-0xd8, 0xd8, 0xd5, 0xd4, 0xd3, 0xd1, 0xcf, 0xce, 0xca, 0xc8, 0xc6, 0xc5, 0xc3, 0xc1, 0xbc, 0xb8, 
-0xb4, 0xad, 0xa5, 0x98, 0x8c, 0x74, 0x5b, 0x41, 0x2b, 0x1d, 0x0f, 0x0a, 0x06, 0x04, 0x05, 0x05, 
-0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x03, 0x06, 0x08, 0x0d, 0x14, 0x2a, 0x47, 0x67, 0x7d, 0x8e, 0x9e, 0xa7, 0xaa, 0xaf, 0xb2, 0xb7, 
-0xb9, 0xba, 0xbd, 0xbe, 0xbe, 0xc0, 0xc1, 0xc2, 0xc1, 0xb6, 0x8a, 0x37, 0x0d, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x0e, 0x39, 0x81, 0xc3, 0xd2, 0xd7, 0xd7, 0xd4, 0xd4, 0xd3, 0xd1, 0xcf, 0xce, 
-0xca, 0xc8, 0xc6, 0xc5, 0xc3, 0xc1, 0xbc, 0xb8, 0xb4, 0xad, 0xa5, 0x9d, 0x93, 0x7c, 0x66, 0x4e, 
-0x38, 0x2a, 0x19, 0x12, 0x0d, 0x09, 0x07, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x03, 
-0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04, 0x07, 0x0a, 0x0d, 0x12, 0x1a, 0x32, 0x51, 0x6f, 
-0x83, 0x91, 0x9e, 0xa4, 0xa9, 0xae, 0xaf, 0xb4, 0xb5, 0xb7, 0xb9, 0xba, 0xbc, 0xbd, 0xc1, 0xc1, 
-0xc1, 0xb5, 0x88, 0x35, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x33, 0x74, 0xb9, 0xd0, 
-0xd5, 0xd5, 0xd4, 0xd3, 0xd1, 0xd1, 0xcf, 0xce, 0xca, 0xc8, 0xc6, 0xc5, 0xc5, 0xc2, 0xbd, 0xb9, 
-0xb5, 0xae, 0xa7, 0xa0, 0x98, 0x84, 0x71, 0x5b, 0x44, 0x34, 0x24, 0x1d, 0x15, 0x10, 0x0c, 0x08, 
-0x06, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x05, 0x06, 0x08, 
-0x0c, 0x0e, 0x12, 0x18, 0x20, 0x39, 0x59, 0x74, 0x86, 0x92, 0x9d, 0xa3, 0xa8, 0xad, 0xae, 0xb3, 
-0xb4, 0xb5, 0xb8, 0xb9, 0xba, 0xba, 0xc0, 0xc0, 0xbd, 0xaf, 0x7e, 0x2f, 0x0b, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x08, 0x25, 0x5f, 0xa7, 0xcb, 0xd3, 0xd4, 0xd3, 0xd3, 0xd1, 0xd1, 0xcf, 0xce, 
-0xca, 0xc8, 0xc6, 0xc5, 0xc6, 0xc5, 0xc0, 0xbc, 0xb8, 0xb0, 0xa9, 0xa0, 0x99, 0x8a, 0x7a, 0x65, 
-0x4d, 0x3c, 0x2d, 0x25, 0x1c, 0x15, 0x10, 0x0c, 0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x04, 
-0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 0x03, 0x02, 0x03, 0x02, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 
-0x02, 0x03, 0x03, 0x03, 0x05, 0x06, 0x08, 0x0b, 0x0e, 0x12, 0x17, 0x1d, 0x24, 0x3e, 0x5f, 0x7a, 
-0x89, 0x93, 0x9c, 0xa0, 0xa7, 0xad, 0xae, 0xb2, 0xb3, 0xb3, 0xb5, 0xb7, 0xb8, 0xb9, 0xbe, 0xbf, 
-0xba, 0xa0, 0x69, 0x22, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 0x4c, 0x94, 0xc7, 
-0xd1, 0xd3, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xcf, 0xcb, 0xca, 0xc6, 0xc3, 0xc3, 0xc2, 0xbe, 0xba, 
-0xb7, 0xb2, 0xab, 0xa4, 0x9d, 0x90, 0x82, 0x6f, 0x58, 0x46, 0x38, 0x2f, 0x24, 0x1d, 0x17, 0x11, 
-0x0c, 0x0b, 0x09, 0x07, 0x07, 0x08, 0x08, 0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x03, 0x03, 0x04, 
-0x06, 0x06, 0x06, 0x05, 0x04, 0x03, 0x03, 0x03, 0x04, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 
-0x02, 0x01, 0x01, 0x01, 0x00, 0x01, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 
-0x12, 0x18, 0x1e, 0x24, 0x2c, 0x49, 0x67, 0x7c, 0x8a, 0x92, 0x9a, 0xa0, 0xa5, 0xaa, 0xad, 0xb0, 
-0xb3, 0xb4, 0xb7, 0xb7, 0xb9, 0xba, 0xbd, 0xbd, 0xb6, 0x94, 0x54, 0x15, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x11, 0x41, 0x8a, 0xc5, 0xd1, 0xd3, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xcf, 
-0xcc, 0xca, 0xc7, 0xc5, 0xc5, 0xc2, 0xc0, 0xbd, 0xb9, 0xb4, 0xaf, 0xa8, 0xa0, 0x94, 0x87, 0x77, 
-0x62, 0x52, 0x40, 0x37, 0x2c, 0x24, 0x1d, 0x17, 0x11, 0x0e, 0x0c, 0x0a, 0x08, 0x08, 0x07, 0x07, 
-0x08, 0x08, 0x09, 0x08, 0x08, 0x07, 0x08, 0x08, 0x07, 0x06, 0x04, 0x04, 0x03, 0x05, 0x06, 0x05, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 
-0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x03, 0x02, 0x04, 0x06, 0x06, 
-0x06, 0x06, 0x07, 0x09, 0x0b, 0x0c, 0x0f, 0x11, 0x16, 0x1d, 0x24, 0x28, 0x33, 0x50, 0x6e, 0x7f, 
-0x8a, 0x91, 0x99, 0xa0, 0xa4, 0xa8, 0xab, 0xae, 0xb2, 0xb4, 0xb5, 0xb7, 0xb8, 0xb9, 0xbc, 0xbc, 
-0xb3, 0x8d, 0x4c, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x3d, 0x8c, 0xc2, 
-0xd1, 0xd3, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xce, 0xcc, 0xcb, 0xca, 0xc8, 0xc7, 0xc5, 0xc2, 0xc0, 
-0xbd, 0xb8, 0xb3, 0xaa, 0xa4, 0x99, 0x90, 0x82, 0x6e, 0x5f, 0x4c, 0x42, 0x37, 0x2e, 0x27, 0x20, 
-0x1a, 0x18, 0x15, 0x11, 0x10, 0x0e, 0x0d, 0x0c, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x08, 0x06, 
-0x06, 0x07, 0x09, 0x0c, 0x0e, 0x0e, 0x0c, 0x08, 0x05, 0x03, 0x02, 0x02, 0x05, 0x03, 0x03, 0x03, 
-0x03, 0x01, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x03, 
-0x02, 0x04, 0x06, 0x07, 0x07, 0x06, 0x07, 0x07, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 
-0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x07, 0x07, 0x07, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x13, 0x17, 
-0x1c, 0x22, 0x28, 0x2d, 0x39, 0x58, 0x72, 0x82, 0x8c, 0x91, 0x99, 0xa0, 0xa4, 0xa8, 0xab, 0xad, 
-0xb0, 0xb3, 0xb4, 0xb5, 0xb7, 0xb8, 0xbc, 0xbb, 0xb0, 0x87, 0x46, 0x0e, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x0b, 0x2b, 0x6c, 0xb4, 0xca, 0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xce, 0xce, 
-0xcc, 0xcc, 0xcb, 0xca, 0xc8, 0xc6, 0xc5, 0xc2, 0xc0, 0xba, 0xb5, 0xb0, 0xa9, 0x9f, 0x97, 0x8b, 
-0x7a, 0x6c, 0x5a, 0x50, 0x44, 0x3c, 0x33, 0x2b, 0x23, 0x1e, 0x1a, 0x16, 0x13, 0x10, 0x0e, 0x0d, 
-0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0e, 0x12, 0x15, 0x17, 0x1a, 0x1d, 0x1f, 0x21, 0x21, 0x1d, 0x1a, 
-0x16, 0x11, 0x0e, 0x0d, 0x07, 0x05, 0x05, 0x05, 0x05, 0x04, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 
-0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 
-0x08, 0x08, 0x08, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x09, 
-0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x15, 0x18, 0x1d, 0x23, 0x29, 0x2f, 0x36, 0x43, 0x5f, 0x77, 0x84, 
-0x8c, 0x92, 0x99, 0xa0, 0xa4, 0xa7, 0xaa, 0xab, 0xaf, 0xb2, 0xb3, 0xb4, 0xb5, 0xb7, 0xbb, 0xb7, 
-0xa3, 0x72, 0x33, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x1b, 0x54, 0xa8, 
-0xc7, 0xcf, 0xce, 0xcc, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xca, 0xc8, 0xc6, 0xc5, 
-0xc2, 0xbd, 0xb8, 0xb5, 0xae, 0xa4, 0x9d, 0x92, 0x83, 0x76, 0x65, 0x5b, 0x4f, 0x46, 0x3e, 0x33, 
-0x2b, 0x28, 0x23, 0x1d, 0x1a, 0x16, 0x12, 0x11, 0x12, 0x14, 0x17, 0x1b, 0x1e, 0x21, 0x24, 0x27, 
-0x28, 0x29, 0x29, 0x28, 0x26, 0x28, 0x27, 0x26, 0x24, 0x21, 0x1d, 0x1c, 0x17, 0x12, 0x10, 0x0c, 
-0x09, 0x06, 0x05, 0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x04, 0x03, 0x05, 
-0x06, 0x06, 0x06, 0x07, 0x09, 0x0b, 0x09, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09, 0x06, 0x06, 0x06, 
-0x07, 0x08, 0x08, 0x09, 0x08, 0x09, 0x0b, 0x0b, 0x0c, 0x0f, 0x12, 0x14, 0x17, 0x1a, 0x1d, 0x23, 
-0x2a, 0x2f, 0x35, 0x3e, 0x4b, 0x66, 0x7b, 0x85, 0x8c, 0x92, 0x99, 0x9f, 0xa3, 0xa5, 0xa8, 0xab, 
-0xaf, 0xb2, 0xb3, 0xb4, 0xb5, 0xb7, 0xb9, 0xb4, 0x99, 0x5e, 0x23, 0x05, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x48, 0xa0, 0xc5, 0xcf, 0xce, 0xcc, 0xcb, 0xcb, 0xca, 0xca, 
-0xca, 0xca, 0xca, 0xc8, 0xcb, 0xca, 0xc8, 0xc6, 0xc3, 0xc0, 0xbc, 0xba, 0xb4, 0xa9, 0xa4, 0x9a, 
-0x8d, 0x82, 0x71, 0x66, 0x5b, 0x52, 0x48, 0x3e, 0x33, 0x2b, 0x28, 0x24, 0x22, 0x1e, 0x1d, 0x22, 
-0x27, 0x29, 0x2c, 0x30, 0x33, 0x34, 0x31, 0x2f, 0x30, 0x30, 0x30, 0x2f, 0x2e, 0x2b, 0x2b, 0x2c, 
-0x2b, 0x2b, 0x29, 0x29, 0x28, 0x25, 0x22, 0x1e, 0x1a, 0x14, 0x11, 0x0c, 0x0b, 0x07, 0x06, 0x03, 
-0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x0b, 0x0e, 0x12, 0x17, 0x1a, 0x15, 0x0f, 
-0x0c, 0x07, 0x06, 0x08, 0x08, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0d, 0x0e, 
-0x10, 0x14, 0x17, 0x1a, 0x1d, 0x20, 0x24, 0x29, 0x2f, 0x35, 0x3c, 0x45, 0x53, 0x6c, 0x7e, 0x86, 
-0x8c, 0x92, 0x99, 0x9f, 0xa2, 0xa4, 0xa8, 0xad, 0xb0, 0xb2, 0xb4, 0xb4, 0xb5, 0xb8, 0xb9, 0xb3, 
-0x92, 0x54, 0x1b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x40, 0x9a, 
-0xc2, 0xcd, 0xcc, 0xcb, 0xcb, 0xca, 0xca, 0xc8, 0xc8, 0xc8, 0xc7, 0xc7, 0xcc, 0xce, 0xcb, 0xca, 
-0xc7, 0xc3, 0xc0, 0xbe, 0xb8, 0xb0, 0xaa, 0xa3, 0x97, 0x8d, 0x7a, 0x6f, 0x64, 0x5b, 0x51, 0x47, 
-0x3e, 0x3d, 0x3b, 0x3b, 0x3d, 0x3e, 0x3e, 0x40, 0x42, 0x42, 0x41, 0x3e, 0x3e, 0x3c, 0x3b, 0x3a, 
-0x39, 0x37, 0x37, 0x38, 0x38, 0x39, 0x37, 0x35, 0x34, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x32, 
-0x30, 0x2c, 0x2b, 0x27, 0x24, 0x1f, 0x19, 0x15, 0x11, 0x0c, 0x07, 0x05, 0x03, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 
-0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0a, 0x0c, 0x10, 0x14, 0x18, 
-0x1d, 0x20, 0x24, 0x27, 0x2b, 0x2b, 0x2b, 0x24, 0x1b, 0x0e, 0x09, 0x09, 0x0b, 0x0c, 0x0c, 0x0c, 
-0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0e, 0x10, 0x11, 0x13, 0x17, 0x1c, 0x1f, 0x22, 0x24, 0x28, 0x2d, 
-0x33, 0x3a, 0x41, 0x4c, 0x59, 0x71, 0x82, 0x87, 0x8c, 0x92, 0x99, 0x9f, 0xa2, 0xa4, 0xa7, 0xab, 
-0xb0, 0xb3, 0xb4, 0xb5, 0xb7, 0xb8, 0xb8, 0xb0, 0x8d, 0x4e, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x37, 0x8c, 0xb9, 0xcc, 0xd1, 0xcf, 0xcb, 0xcb, 0xca, 0xc8, 
-0xc7, 0xc6, 0xc6, 0xc6, 0xc8, 0xcc, 0xce, 0xca, 0xc8, 0xc7, 0xc3, 0xc2, 0xbd, 0xb8, 0xb3, 0xaa, 
-0x9e, 0x92, 0x86, 0x7e, 0x73, 0x6c, 0x68, 0x64, 0x62, 0x65, 0x65, 0x65, 0x63, 0x5e, 0x59, 0x56, 
-0x54, 0x51, 0x4e, 0x4c, 0x4a, 0x47, 0x48, 0x48, 0x47, 0x46, 0x45, 0x46, 0x46, 0x43, 0x43, 0x44, 
-0x42, 0x42, 0x42, 0x42, 0x3e, 0x3e, 0x3e, 0x3d, 0x3c, 0x3b, 0x3a, 0x3a, 0x39, 0x38, 0x35, 0x34, 
-0x33, 0x2b, 0x25, 0x23, 0x1d, 0x17, 0x11, 0x0e, 0x0a, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 
-0x04, 0x04, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x05, 0x0a, 0x0c, 0x0f, 0x11, 0x14, 
-0x18, 0x1d, 0x1f, 0x23, 0x28, 0x2c, 0x31, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 
-0x2e, 0x24, 0x1c, 0x13, 0x0c, 0x0b, 0x0d, 0x0f, 0x0d, 0x0c, 0x0e, 0x11, 0x0e, 0x11, 0x15, 0x17, 
-0x1a, 0x1d, 0x20, 0x23, 0x26, 0x2a, 0x2d, 0x33, 0x3b, 0x41, 0x48, 0x52, 0x60, 0x74, 0x80, 0x86, 
-0x8b, 0x91, 0x9a, 0xa2, 0xa3, 0xa7, 0xaa, 0xaf, 0xb2, 0xb3, 0xb3, 0xb3, 0xb5, 0xb7, 0xb5, 0xab, 
-0x7b, 0x41, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x23, 0x70, 
-0xa7, 0xc3, 0xcf, 0xce, 0xcb, 0xcb, 0xca, 0xc8, 0xc7, 0xc6, 0xc6, 0xc6, 0xc7, 0xcb, 0xcc, 0xca, 
-0xcb, 0xcb, 0xc7, 0xc5, 0xc1, 0xbe, 0xbd, 0xb9, 0xb0, 0xa8, 0xa3, 0xa0, 0x9c, 0x97, 0x92, 0x8c, 
-0x87, 0x85, 0x83, 0x7f, 0x7b, 0x72, 0x6b, 0x68, 0x66, 0x63, 0x5f, 0x5e, 0x5c, 0x5a, 0x5a, 0x5a, 
-0x59, 0x58, 0x58, 0x58, 0x58, 0x55, 0x55, 0x56, 0x55, 0x55, 0x54, 0x54, 0x51, 0x50, 0x4f, 0x4e, 
-0x4d, 0x4c, 0x4b, 0x4a, 0x49, 0x49, 0x48, 0x47, 0x46, 0x47, 0x47, 0x46, 0x44, 0x42, 0x41, 0x3f, 
-0x3d, 0x3a, 0x35, 0x31, 0x2c, 0x29, 0x26, 0x1d, 0x1a, 0x17, 0x16, 0x15, 0x13, 0x12, 0x11, 0x11, 
-0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x1a, 0x1c, 0x1e, 0x22, 0x25, 
-0x27, 0x29, 0x2f, 0x31, 0x33, 0x34, 0x35, 0x37, 0x39, 0x39, 0x3a, 0x3b, 0x3c, 0x3e, 0x3e, 0x3e, 
-0x3c, 0x3c, 0x3b, 0x3b, 0x3b, 0x3a, 0x38, 0x37, 0x39, 0x39, 0x33, 0x2c, 0x25, 0x1a, 0x13, 0x0d, 
-0x11, 0x15, 0x14, 0x11, 0x15, 0x17, 0x1a, 0x1d, 0x1f, 0x24, 0x27, 0x29, 0x2b, 0x30, 0x33, 0x3a, 
-0x42, 0x4a, 0x50, 0x5a, 0x67, 0x79, 0x84, 0x8a, 0x8d, 0x93, 0x9c, 0xa2, 0xa4, 0xa7, 0xaa, 0xaf, 
-0xb2, 0xb3, 0xb3, 0xb3, 0xb5, 0xb7, 0xb1, 0x9b, 0x62, 0x2b, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x17, 0x5b, 0x97, 0xbd, 0xcc, 0xcc, 0xca, 0xcb, 0xca, 0xc8, 
-0xc6, 0xc5, 0xc5, 0xc5, 0xc6, 0xc8, 0xcc, 0xca, 0xce, 0xcf, 0xce, 0xd0, 0xce, 0xcb, 0xca, 0xc8, 
-0xc3, 0xbd, 0xb9, 0xb7, 0xb2, 0xad, 0xa4, 0x9a, 0x96, 0x94, 0x90, 0x8c, 0x87, 0x82, 0x7d, 0x7c, 
-0x7b, 0x77, 0x74, 0x73, 0x71, 0x6f, 0x6f, 0x6e, 0x6e, 0x6c, 0x6b, 0x6b, 0x6b, 0x69, 0x69, 0x6a, 
-0x6a, 0x69, 0x68, 0x68, 0x66, 0x64, 0x63, 0x62, 0x61, 0x61, 0x5f, 0x5e, 0x5d, 0x5d, 0x5c, 0x5c, 
-0x5b, 0x5a, 0x58, 0x58, 0x58, 0x58, 0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x5c, 0x5c, 0x5d, 0x5d, 0x5c, 
-0x59, 0x55, 0x54, 0x51, 0x4c, 0x49, 0x45, 0x43, 0x42, 0x40, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 
-0x3f, 0x41, 0x43, 0x44, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x48, 0x46, 0x45, 0x47, 0x48, 0x48, 
-0x46, 0x47, 0x47, 0x47, 0x46, 0x46, 0x45, 0x45, 0x45, 0x44, 0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 
-0x40, 0x40, 0x3f, 0x3e, 0x3b, 0x34, 0x2b, 0x1d, 0x16, 0x16, 0x17, 0x19, 0x1a, 0x1d, 0x1f, 0x22, 
-0x24, 0x29, 0x2c, 0x30, 0x33, 0x36, 0x3a, 0x41, 0x4b, 0x53, 0x5a, 0x63, 0x6f, 0x7d, 0x86, 0x8c, 
-0x91, 0x96, 0x9e, 0xa3, 0xa4, 0xa8, 0xab, 0xb0, 0xb3, 0xb3, 0xb2, 0xb3, 0xb4, 0xb6, 0xac, 0x8b, 
-0x50, 0x1d, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x46, 
-0x84, 0xb1, 0xc6, 0xca, 0xc8, 0xca, 0xc7, 0xc6, 0xc5, 0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xca, 0xca, 
-0xcf, 0xd3, 0xd3, 0xd7, 0xd5, 0xd1, 0xcf, 0xcc, 0xca, 0xc6, 0xc1, 0xbe, 0xb9, 0xb5, 0xaf, 0xa8, 
-0xa2, 0x9e, 0x9a, 0x98, 0x94, 0x92, 0x90, 0x8d, 0x8c, 0x89, 0x86, 0x85, 0x85, 0x83, 0x83, 0x82, 
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7a, 0x79, 0x77, 0x75, 
-0x74, 0x74, 0x73, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6f, 0x6e, 0x6e, 0x70, 0x70, 
-0x70, 0x70, 0x71, 0x73, 0x74, 0x76, 0x76, 0x79, 0x77, 0x75, 0x75, 0x72, 0x6e, 0x69, 0x67, 0x65, 
-0x63, 0x5f, 0x5d, 0x5b, 0x5a, 0x59, 0x57, 0x56, 0x56, 0x56, 0x58, 0x57, 0x57, 0x56, 0x57, 0x56, 
-0x56, 0x56, 0x56, 0x53, 0x51, 0x53, 0x54, 0x52, 0x4f, 0x50, 0x50, 0x50, 0x4f, 0x4f, 0x4e, 0x4f, 
-0x4f, 0x4e, 0x4d, 0x4c, 0x4c, 0x4b, 0x4c, 0x4a, 0x46, 0x44, 0x44, 0x45, 0x45, 0x42, 0x40, 0x3a, 
-0x30, 0x25, 0x1e, 0x1d, 0x1e, 0x22, 0x25, 0x29, 0x2b, 0x30, 0x33, 0x35, 0x38, 0x3e, 0x41, 0x49, 
-0x54, 0x5c, 0x64, 0x6c, 0x76, 0x82, 0x89, 0x8e, 0x94, 0x9a, 0xa0, 0xa5, 0xa7, 0xaa, 0xae, 0xb3, 
-0xb4, 0xb3, 0xb0, 0xb2, 0xb4, 0xb5, 0xa3, 0x77, 0x3c, 0x12, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x35, 0x72, 0xa7, 0xc3, 0xc8, 0xc8, 0xc8, 0xc7, 0xc6, 
-0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc5, 0xc8, 0xc8, 0xcf, 0xd5, 0xd5, 0xd7, 0xd7, 0xd4, 0xd3, 0xd0, 
-0xce, 0xcc, 0xc8, 0xc3, 0xbe, 0xbc, 0xb8, 0xb5, 0xb0, 0xab, 0xa8, 0xa5, 0xa2, 0xa0, 0x9e, 0x9d, 
-0x9c, 0x98, 0x97, 0x96, 0x96, 0x93, 0x94, 0x93, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
-0x91, 0x91, 0x90, 0x8e, 0x8d, 0x8c, 0x8b, 0x89, 0x87, 0x87, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 
-0x80, 0x80, 0x82, 0x80, 0x7e, 0x7c, 0x7d, 0x7b, 0x79, 0x74, 0x72, 0x71, 0x6e, 0x6b, 0x69, 0x67, 
-0x66, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x64, 0x62, 0x61, 0x61, 0x61, 0x60, 
-0x5e, 0x5f, 0x5f, 0x5e, 0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x5a, 0x59, 0x57, 0x56, 0x55, 0x52, 0x50, 
-0x4f, 0x4e, 0x4e, 0x4d, 0x4b, 0x4a, 0x49, 0x4a, 0x48, 0x42, 0x36, 0x2b, 0x25, 0x28, 0x2b, 0x2c, 
-0x30, 0x35, 0x38, 0x3c, 0x3f, 0x46, 0x4b, 0x52, 0x5d, 0x65, 0x6e, 0x76, 0x7e, 0x87, 0x8d, 0x92, 
-0x98, 0x9d, 0xa3, 0xa7, 0xa8, 0xab, 0xaf, 0xb4, 0xb4, 0xb3, 0xb0, 0xb0, 0xb3, 0xb4, 0x9a, 0x65, 
-0x2c, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2c, 
-0x68, 0x9f, 0xbf, 0xc6, 0xc7, 0xc8, 0xc6, 0xc5, 0xc3, 0xc2, 0xc2, 0xc2, 0xc1, 0xc3, 0xc6, 0xc7, 
-0xcf, 0xd5, 0xd7, 0xd8, 0xd9, 0xd9, 0xd8, 0xd5, 0xd4, 0xd4, 0xd3, 0xce, 0xc7, 0xc2, 0xbe, 0xba, 
-0xb8, 0xb8, 0xb4, 0xb2, 0xae, 0xab, 0xa8, 0xa9, 0xa9, 0xa7, 0xa5, 0xa5, 0xa5, 0xa3, 0xa4, 0xa5, 
-0xa4, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa0, 0x9f, 0x9e, 0x9d, 0x9c, 
-0x9a, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x96, 0x94, 0x93, 0x92, 0x92, 0x92, 0x91, 0x90, 0x90, 
-0x8e, 0x8e, 0x8e, 0x8e, 0x90, 0x90, 0x90, 0x8c, 0x8b, 0x8c, 0x8d, 0x8d, 0x8b, 0x8a, 0x8c, 0x8a, 
-0x89, 0x87, 0x85, 0x84, 0x82, 0x7f, 0x7e, 0x7d, 0x7b, 0x79, 0x76, 0x76, 0x76, 0x75, 0x72, 0x71, 
-0x6f, 0x6e, 0x6f, 0x70, 0x70, 0x6f, 0x6c, 0x6e, 0x6f, 0x6f, 0x6f, 0x6c, 0x6a, 0x69, 0x68, 0x68, 
-0x68, 0x67, 0x65, 0x63, 0x61, 0x60, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0x57, 0x54, 0x59, 0x54, 0x4f, 
-0x52, 0x56, 0x54, 0x4f, 0x3e, 0x39, 0x35, 0x33, 0x34, 0x39, 0x3e, 0x43, 0x48, 0x50, 0x56, 0x5d, 
-0x66, 0x6e, 0x75, 0x7e, 0x86, 0x8c, 0x91, 0x97, 0x9c, 0xa0, 0xa7, 0xa8, 0xa9, 0xad, 0xb0, 0xb5, 
-0xb4, 0xb2, 0xaf, 0xb0, 0xb2, 0xb3, 0x91, 0x59, 0x23, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23, 0x59, 0x93, 0xb8, 0xc5, 0xc7, 0xc8, 0xc6, 0xc5, 
-0xc3, 0xc2, 0xc1, 0xc1, 0xc0, 0xc2, 0xc5, 0xc6, 0xce, 0xd5, 0xd7, 0xd8, 0xd9, 0xda, 0xd8, 0xd5, 
-0xd1, 0xd1, 0xd0, 0xce, 0xcc, 0xcb, 0xca, 0xc7, 0xc5, 0xc2, 0xc0, 0xbd, 0xbc, 0xb8, 0xb4, 0xb5, 
-0xb4, 0xb2, 0xb0, 0xb2, 0xb2, 0xaf, 0xb2, 0xb2, 0xb0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb0, 
-0xb0, 0xaf, 0xae, 0xae, 0xad, 0xab, 0xaa, 0xa8, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa3, 0xa2, 0xa0, 
-0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9c, 0x99, 0x97, 0x99, 0x9a, 0x99, 0x99, 0x97, 0x97, 0x96, 0x99, 
-0x97, 0x96, 0x96, 0x94, 0x92, 0x93, 0x97, 0x96, 0x96, 0x94, 0x92, 0x92, 0x91, 0x90, 0x91, 0x90, 
-0x8d, 0x8c, 0x8a, 0x87, 0x86, 0x85, 0x83, 0x80, 0x7f, 0x7e, 0x7c, 0x7f, 0x7f, 0x7c, 0x7a, 0x7b, 
-0x7d, 0x79, 0x79, 0x79, 0x77, 0x76, 0x76, 0x75, 0x73, 0x72, 0x70, 0x6e, 0x6a, 0x69, 0x67, 0x65, 
-0x62, 0x5f, 0x5e, 0x5f, 0x5f, 0x5d, 0x5f, 0x61, 0x5f, 0x5f, 0x61, 0x64, 0x64, 0x58, 0x49, 0x3e, 
-0x3e, 0x42, 0x46, 0x49, 0x50, 0x59, 0x5f, 0x66, 0x6f, 0x74, 0x7b, 0x84, 0x8c, 0x91, 0x96, 0x9c, 
-0x9f, 0xa2, 0xa8, 0xa9, 0xa9, 0xad, 0xb2, 0xb7, 0xb4, 0xb2, 0xaf, 0xb0, 0xb2, 0xb0, 0x87, 0x4c, 
-0x1b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14, 
-0x3f, 0x7a, 0xa8, 0xbc, 0xc5, 0xc6, 0xc5, 0xc3, 0xc2, 0xc1, 0xc0, 0xbe, 0xc1, 0xc2, 0xc2, 0xc6, 
-0xcb, 0xd0, 0xd5, 0xd9, 0xda, 0xd9, 0xd8, 0xd7, 0xd5, 0xd5, 0xd4, 0xd3, 0xd0, 0xcf, 0xcc, 0xcb, 
-0xcb, 0xca, 0xc8, 0xc6, 0xc5, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xbe, 0xbd, 0xbd, 0xbd, 0xbd, 
-0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xb9, 0xb8, 0xb5, 
-0xb4, 0xb3, 0xb2, 0xb2, 0xb0, 0xb0, 0xaf, 0xae, 0xae, 0xab, 0xaa, 0xaa, 0xa9, 0xa9, 0xa8, 0xa8, 
-0xa5, 0xa5, 0xa4, 0xa4, 0xa3, 0xa2, 0xa2, 0xa3, 0xa3, 0xa2, 0xa0, 0xa0, 0x9f, 0x9f, 0x9f, 0x9e, 
-0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0x9d, 0x9c, 0x9a, 0x99, 0x99, 0x99, 0x98, 0x97, 0x96, 0x97, 0x96, 
-0x93, 0x90, 0x90, 0x90, 0x8e, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x87, 0x87, 0x86, 
-0x84, 0x80, 0x7d, 0x7c, 0x7a, 0x79, 0x76, 0x74, 0x72, 0x71, 0x70, 0x6e, 0x6c, 0x69, 0x69, 0x69, 
-0x6a, 0x6c, 0x6e, 0x6f, 0x72, 0x74, 0x75, 0x70, 0x66, 0x5b, 0x54, 0x58, 0x5c, 0x62, 0x66, 0x6e, 
-0x79, 0x82, 0x86, 0x89, 0x8e, 0x97, 0x9c, 0x9f, 0xa2, 0xa4, 0xa7, 0xab, 0xae, 0xb2, 0xb3, 0xb5, 
-0xb2, 0xaf, 0xad, 0xae, 0xae, 0xa4, 0x6d, 0x35, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x2e, 0x67, 0x9c, 0xbd, 0xc2, 0xc2, 0xc2, 0xc2, 
-0xc2, 0xc1, 0xc0, 0xc0, 0xc1, 0xc2, 0xc3, 0xc6, 0xca, 0xd1, 0xd7, 0xda, 0xda, 0xd9, 0xd9, 0xd7, 
-0xd7, 0xd7, 0xd7, 0xd7, 0xd4, 0xd3, 0xd1, 0xd0, 0xcf, 0xcc, 0xcc, 0xcb, 0xca, 0xc8, 0xc7, 0xc8, 
-0xc8, 0xc8, 0xc7, 0xc6, 0xc6, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xc6, 
-0xc5, 0xc5, 0xc5, 0xc5, 0xc2, 0xc1, 0xc0, 0xbe, 0xbd, 0xbc, 0xbc, 0xba, 0xb9, 0xb9, 0xb8, 0xb7, 
-0xb7, 0xb5, 0xb5, 0xb4, 0xb3, 0xb2, 0xb0, 0xb0, 0xaf, 0xaf, 0xae, 0xae, 0xad, 0xad, 0xab, 0xab, 
-0xab, 0xaa, 0xa9, 0xa9, 0xa8, 0xa8, 0xa7, 0xa5, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa3, 0xa3, 0xa2, 
-0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa0, 0x9f, 0x9c, 0x9d, 0x9c, 0x9c, 0x99, 0x98, 0x98, 
-0x97, 0x94, 0x94, 0x93, 0x92, 0x92, 0x91, 0x91, 0x8e, 0x8b, 0x89, 0x87, 0x85, 0x84, 0x82, 0x80, 
-0x7e, 0x7d, 0x7c, 0x7b, 0x79, 0x77, 0x77, 0x77, 0x76, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x80, 
-0x7f, 0x7d, 0x76, 0x6e, 0x69, 0x6a, 0x6f, 0x77, 0x80, 0x86, 0x8a, 0x8d, 0x93, 0x9a, 0x9e, 0xa2, 
-0xa3, 0xa5, 0xa8, 0xab, 0xaf, 0xb2, 0xb3, 0xb5, 0xb2, 0xae, 0xad, 0xad, 0xab, 0x9b, 0x5a, 0x25, 
-0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-0x1f, 0x50, 0x89, 0xb4, 0xc1, 0xbd, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 0xc2, 0xc3, 0xc5, 
-0xc8, 0xd0, 0xd8, 0xdc, 0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xd8, 0xd7, 0xd7, 0xd5, 
-0xd4, 0xd1, 0xd1, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xce, 0xce, 0xcc, 0xce, 0xce, 
-0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0xca, 0xc8, 0xc7, 
-0xc6, 0xc6, 0xc5, 0xc5, 0xc3, 0xc2, 0xc2, 0xc1, 0xc0, 0xbe, 0xbe, 0xbd, 0xba, 0xb9, 0xb8, 0xb7, 
-0xb7, 0xb7, 0xb7, 0xb5, 0xb4, 0xb4, 0xb4, 0xb2, 0xb2, 0xb0, 0xb0, 0xaf, 0xaf, 0xae, 0xad, 0xab, 
-0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0xa9, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xa9, 0xa8, 0xa8, 0xa8, 
-0xa7, 0xa3, 0xa7, 0xa5, 0xa5, 0xa4, 0xa3, 0xa3, 0xa2, 0xa0, 0x9f, 0x9f, 0x9e, 0x9e, 0x9d, 0x9c, 
-0x99, 0x96, 0x93, 0x92, 0x90, 0x8e, 0x8d, 0x8c, 0x89, 0x89, 0x89, 0x86, 0x84, 0x84, 0x84, 0x83, 
-0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x87, 0x8a, 0x8d, 0x91, 0x92, 0x8d, 0x86, 0x80, 0x7f, 0x82, 
-0x85, 0x8a, 0x8d, 0x92, 0x98, 0x9e, 0xa2, 0xa4, 0xa5, 0xa8, 0xaa, 0xae, 0xb0, 0xb2, 0xb3, 0xb3, 
-0xaf, 0xab, 0xa9, 0xab, 0xa5, 0x8a, 0x46, 0x19, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x35, 0x6c, 0xa4, 0xc0, 0xbf, 0xbe, 0xbe, 
-0xbe, 0xbe, 0xbe, 0xbd, 0xbe, 0xc1, 0xc2, 0xc2, 0xc6, 0xd0, 0xd9, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 
-0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xd9, 0xd8, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 
-0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xd1, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd1, 
-0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xce, 0xcc, 0xcc, 0xcb, 0xcb, 0xca, 0xca, 0xc8, 0xc7, 0xc6, 
-0xc6, 0xc5, 0xc3, 0xc2, 0xc1, 0xc0, 0xbd, 0xbc, 0xbd, 0xbd, 0xbd, 0xbc, 0xba, 0xba, 0xb9, 0xb7, 
-0xb7, 0xb5, 0xb5, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb2, 0xb2, 0xb2, 0xb2, 0xb0, 0xaf, 0xaf, 0xae, 
-0xaf, 0xaf, 0xb0, 0xb2, 0xb0, 0xaf, 0xaf, 0xaf, 0xae, 0xad, 0xab, 0xab, 0xaa, 0xa9, 0xa9, 0xa9, 
-0xa9, 0xa9, 0xa9, 0xa8, 0xa7, 0xa7, 0xa5, 0xa4, 0xa2, 0x9f, 0x9c, 0x9a, 0x99, 0x98, 0x96, 0x94, 
-0x92, 0x92, 0x92, 0x90, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8d, 0x8e, 0x92, 0x92, 0x93, 0x94, 
-0x97, 0x99, 0x9c, 0xa0, 0xa0, 0x9d, 0x97, 0x91, 0x8e, 0x90, 0x92, 0x96, 0x9c, 0xa0, 0xa4, 0xa7, 
-0xa8, 0xaa, 0xae, 0xb0, 0xb2, 0xb2, 0xb2, 0xb0, 0xad, 0xaa, 0xa9, 0xa8, 0x99, 0x71, 0x2d, 0x0d, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x08, 0x20, 0x51, 0x8d, 0xb9, 0xbf, 0xbe, 0xbd, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xbe, 0xc1, 0xc0, 
-0xc2, 0xcc, 0xd9, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 
-0xda, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd8, 0xd8, 
-0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd4, 0xd4, 0xd3, 0xd3, 
-0xd1, 0xd1, 0xd0, 0xd0, 0xcf, 0xce, 0xcc, 0xcc, 0xcb, 0xcb, 0xca, 0xc8, 0xc7, 0xc6, 0xc3, 0xc3, 
-0xc5, 0xc3, 0xc3, 0xc2, 0xc1, 0xc1, 0xc1, 0xbe, 0xbe, 0xbd, 0xbc, 0xbc, 0xba, 0xba, 0xbc, 0xba, 
-0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xb8, 0xb7, 0xb5, 0xb4, 0xb7, 
-0xb5, 0xb4, 0xb2, 0xb2, 0xb0, 0xb0, 0xb0, 0xaf, 0xaf, 0xaf, 0xaf, 0xae, 0xad, 0xad, 0xab, 0xab, 
-0xaa, 0xa8, 0xa5, 0xa5, 0xa4, 0xa3, 0xa0, 0x9e, 0x9c, 0x9c, 0x9c, 0x9a, 0x98, 0x97, 0x97, 0x97, 
-0x97, 0x98, 0x99, 0x99, 0x9a, 0x9d, 0x9f, 0xa0, 0xa2, 0xa2, 0xa0, 0xa2, 0xaa, 0xaf, 0xaa, 0xa5, 
-0xa5, 0xa2, 0x9e, 0x9e, 0xa0, 0xa3, 0xa5, 0xa8, 0xa9, 0xad, 0xaf, 0xb3, 0xb4, 0xb2, 0xb2, 0xad, 
-0xab, 0xaa, 0xaa, 0xa4, 0x8a, 0x56, 0x1b, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x39, 0x74, 0xad, 0xbd, 0xbe, 0xbd, 
-0xbc, 0xbc, 0xba, 0xb9, 0xb9, 0xbc, 0xbe, 0xbd, 0xc0, 0xcb, 0xd8, 0xdd, 0xdd, 0xde, 0xde, 0xde, 
-0xde, 0xde, 0xdd, 0xdd, 0xde, 0xde, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xdd, 0xdd, 0xdc, 0xdc, 0xda, 
-0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdd, 
-0xdd, 0xdd, 0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd7, 0xd5, 0xd4, 0xd4, 0xd3, 
-0xd1, 0xd0, 0xcf, 0xcf, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xc8, 0xc7, 
-0xc7, 0xc6, 0xc5, 0xc5, 0xc3, 0xc3, 0xc2, 0xc1, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 0xc0, 0xbe, 0xbd, 
-0xbd, 0xbd, 0xbd, 0xbd, 0xba, 0xb8, 0xb8, 0xba, 0xba, 0xb9, 0xba, 0xba, 0xb9, 0xb9, 0xb9, 0xb9, 
-0xb9, 0xb7, 0xb7, 0xb5, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb2, 0xaf, 0xaf, 0xae, 0xad, 0xaa, 0xa9, 
-0xa7, 0xa7, 0xa8, 0xa7, 0xa4, 0xa2, 0xa2, 0xa2, 0xa2, 0xa4, 0xa5, 0xa7, 0xa4, 0xa5, 0xa8, 0xa9, 
-0xad, 0xae, 0xae, 0xab, 0xae, 0xb2, 0xb4, 0xb5, 0xb7, 0xb5, 0xb3, 0xae, 0xaa, 0xa8, 0xa8, 0xaa, 
-0xab, 0xae, 0xb2, 0xb4, 0xb5, 0xb3, 0xb0, 0xaa, 0xaa, 0xaa, 0xa8, 0x9c, 0x76, 0x3d, 0x0e, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x0a, 0x29, 0x5f, 0xa0, 0xb8, 0xbd, 0xbc, 0xba, 0xba, 0xb8, 0xb7, 0xb7, 0xb9, 0xbd, 0xbd, 
-0xbe, 0xc8, 0xd5, 0xdc, 0xde, 0xde, 0xde, 0xde, 0xe0, 0xe0, 0xde, 0xde, 0xe0, 0xe0, 0xe1, 0xe1, 
-0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
-0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xd9, 0xd8, 0xd7, 0xd7, 0xd4, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd1, 
-0xd0, 0xcf, 0xce, 0xce, 0xcc, 0xcb, 0xcb, 0xca, 0xca, 0xc8, 0xc7, 0xc7, 0xc7, 0xc6, 0xc5, 0xc3, 
-0xc3, 0xc3, 0xc2, 0xc2, 0xc3, 0xc2, 0xc1, 0xc1, 0xc0, 0xc0, 0xc0, 0xc1, 0xc0, 0xbe, 0xbe, 0xbe, 
-0xc0, 0xbe, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbc, 0xbc, 0xba, 0xba, 0xb9, 0xb9, 0xb9, 
-0xb8, 0xb7, 0xb4, 0xb4, 0xb3, 0xb2, 0xb0, 0xaf, 0xae, 0xae, 0xae, 0xad, 0xab, 0xa9, 0xa9, 0xa9, 
-0xaa, 0xab, 0xad, 0xad, 0xad, 0xad, 0xaf, 0xb0, 0xb3, 0xb4, 0xb5, 0xb5, 0xb4, 0xb4, 0xb8, 0xba, 
-0xbc, 0xbe, 0xc0, 0xbc, 0xb8, 0xb3, 0xaf, 0xaf, 0xaf, 0xae, 0xb0, 0xb3, 0xb4, 0xb2, 0xad, 0xa9, 
-0xaa, 0xaa, 0xa6, 0x91, 0x61, 0x2b, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x18, 0x42, 0x8d, 0xb0, 0xba, 0xb9, 
-0xb9, 0xb9, 0xb7, 0xb4, 0xb5, 0xb8, 0xbc, 0xbe, 0xbe, 0xc6, 0xd3, 0xda, 0xdd, 0xde, 0xe0, 0xde, 
-0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 
-0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe5, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe1, 0xe1, 
-0xe1, 0xe0, 0xde, 0xde, 0xde, 0xe0, 0xe0, 0xe0, 0xde, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 
-0xd9, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd5, 0xd5, 0xd3, 0xd3, 0xd1, 0xd1, 0xd0, 0xcf, 0xcf, 0xce, 
-0xce, 0xcc, 0xcb, 0xcb, 0xcb, 0xca, 0xc8, 0xc8, 0xc8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc6, 0xc5, 
-0xc5, 0xc5, 0xc6, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 
-0xc1, 0xc0, 0xc0, 0xc0, 0xc0, 0xbe, 0xbe, 0xbe, 0xbd, 0xbd, 0xbc, 0xba, 0xb8, 0xb7, 0xb5, 0xb5, 
-0xb4, 0xb4, 0xb3, 0xb2, 0xb2, 0xaf, 0xaf, 0xaf, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xb4, 0xb5, 
-0xb7, 0xb8, 0xb8, 0xba, 0xbc, 0xbd, 0xc0, 0xc1, 0xc2, 0xc3, 0xc5, 0xc6, 0xc6, 0xc2, 0xbe, 0xb9, 
-0xb5, 0xb3, 0xb2, 0xb3, 0xb3, 0xaf, 0xaa, 0xa9, 0xaa, 0xaa, 0x9e, 0x7c, 0x48, 0x1a, 0x04, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x0c, 0x2a, 0x70, 0xa6, 0xb7, 0xb9, 0xb9, 0xb9, 0xb7, 0xb4, 0xb4, 0xb7, 0xba, 0xbd, 
-0xbd, 0xc3, 0xcf, 0xd9, 0xdd, 0xe0, 0xe0, 0xe0, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 
-0xe0, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 
-0xd5, 0xd4, 0xd4, 0xd3, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xcf, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 
-0xcc, 0xcc, 0xcb, 0xcb, 0xcc, 0xcb, 0xca, 0xca, 0xc8, 0xca, 0xca, 0xc8, 0xc8, 0xc8, 0xc8, 0xc7, 
-0xc7, 0xc7, 0xc8, 0xc8, 0xc8, 0xc7, 0xc7, 0xc7, 0xc6, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc3, 0xc2, 
-0xc2, 0xc2, 0xc1, 0xc1, 0xc0, 0xbe, 0xbc, 0xba, 0xba, 0xb9, 0xb8, 0xb8, 0xb7, 0xb4, 0xb4, 0xb5, 
-0xb5, 0xb7, 0xb7, 0xb7, 0xb8, 0xb8, 0xb9, 0xba, 0xbc, 0xbd, 0xbe, 0xc1, 0xc2, 0xc2, 0xc3, 0xc5, 
-0xc5, 0xc6, 0xc7, 0xc8, 0xc8, 0xc8, 0xc6, 0xc5, 0xc0, 0xbc, 0xb7, 0xb4, 0xb3, 0xaf, 0xab, 0xa8, 
-0xa9, 0xa5, 0x92, 0x64, 0x2f, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x1b, 0x59, 0x95, 0xb3, 0xb9, 
-0xb9, 0xb9, 0xb7, 0xb4, 0xb4, 0xb5, 0xb8, 0xba, 0xba, 0xc0, 0xcb, 0xd7, 0xdc, 0xe0, 0xe1, 0xe1, 
-0xe2, 0xe4, 0xe1, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe7, 0xe9, 0xe7, 0xe7, 0xe5, 0xe5, 0xe4, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe1, 0xe0, 0xe1, 0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xe0, 0xde, 
-0xde, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd7, 0xd5, 0xd5, 0xd5, 0xd4, 
-0xd4, 0xd3, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 0xd0, 0xcf, 0xce, 0xce, 
-0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xc8, 0xc8, 
-0xc8, 0xc8, 0xc8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc6, 0xc6, 0xc6, 0xc7, 0xc7, 0xc6, 0xc6, 0xc3, 0xc1, 
-0xc1, 0xc0, 0xc0, 0xbe, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbd, 0xbd, 0xbd, 0xbe, 0xc0, 0xc0, 
-0xc1, 0xc1, 0xc2, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc7, 0xc7, 0xc7, 0xc7, 0xc8, 0xca, 0xca, 
-0xc8, 0xc5, 0xc0, 0xb9, 0xb4, 0xaf, 0xaa, 0xa8, 0xa9, 0xa1, 0x86, 0x51, 0x1f, 0x06, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x10, 0x4b, 0x82, 0xab, 0xb6, 0xb9, 0xb9, 0xb7, 0xb4, 0xb4, 0xb3, 0xb5, 0xb9, 
-0xb9, 0xbc, 0xc3, 0xd4, 0xda, 0xe0, 0xe1, 0xe1, 0xe2, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xea, 
-0xe9, 0xe9, 0xe6, 0xe6, 0xe5, 0xe4, 0xe4, 0xe5, 0xe5, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe2, 0xe2, 0xe4, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 
-0xdc, 0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd5, 0xd5, 0xd4, 0xd3, 0xd3, 
-0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xcf, 0xcf, 0xcf, 0xd0, 0xcf, 0xcf, 0xcf, 0xce, 0xce, 
-0xce, 0xce, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xca, 
-0xc8, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xc6, 0xc6, 0xc5, 0xc5, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 
-0xc2, 0xc1, 0xc1, 0xc1, 0xc2, 0xc3, 0xc3, 0xc5, 0xc5, 0xc5, 0xc6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 
-0xc7, 0xca, 0xca, 0xc8, 0xc8, 0xc8, 0xca, 0xcb, 0xcb, 0xca, 0xc6, 0xbd, 0xb4, 0xad, 0xa8, 0xa8, 
-0xa7, 0x9c, 0x76, 0x3f, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x2f, 0x64, 0x96, 0xb0, 
-0xb7, 0xb9, 0xb7, 0xb4, 0xb4, 0xb2, 0xb3, 0xb7, 0xb8, 0xb8, 0xbd, 0xcf, 0xd7, 0xde, 0xe0, 0xe1, 
-0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe9, 
-0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xea, 0xe9, 0xe9, 0xe7, 0xe7, 0xe6, 0xe7, 0xe7, 0xe9, 
-0xe9, 0xe7, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe1, 
-0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xda, 0xda, 0xda, 0xda, 
-0xda, 0xd9, 0xd8, 0xd8, 0xd7, 0xd7, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd1, 
-0xd1, 0xd1, 0xd3, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 
-0xcf, 0xcf, 0xcf, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcb, 
-0xcb, 0xcb, 0xca, 0xc8, 0xc8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc6, 0xc6, 0xc6, 0xc7, 0xc7, 0xc8, 0xc8, 
-0xc8, 0xca, 0xcb, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xd0, 0xcf, 0xcf, 0xce, 0xcc, 0xcc, 0xcc, 
-0xcc, 0xcb, 0xc6, 0xb9, 0xaf, 0xa9, 0xa8, 0xa8, 0xa4, 0x89, 0x59, 0x27, 0x0a, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x04, 0x1a, 0x46, 0x7d, 0xa5, 0xb5, 0xb9, 0xb7, 0xb4, 0xb3, 0xb0, 0xb2, 0xb5, 
-0xb7, 0xb7, 0xba, 0xce, 0xd5, 0xdd, 0xe0, 0xe1, 0xe1, 0xe2, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe6, 
-0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe7, 0xe7, 0xe9, 0xe9, 
-0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe7, 0xe6, 0xe6, 0xe7, 0xe7, 0xe6, 
-0xe6, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 
-0xde, 0xde, 0xde, 0xdd, 0xdc, 0xdc, 0xda, 0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd7, 0xd7, 
-0xd7, 0xd7, 0xd5, 0xd5, 0xd7, 0xd5, 0xd4, 0xd4, 0xd3, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 
-0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 
-0xcf, 0xcf, 0xd0, 0xcf, 0xcf, 0xce, 0xcf, 0xd0, 0xcf, 0xcf, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 
-0xcb, 0xca, 0xca, 0xca, 0xcb, 0xcb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcf, 0xcf, 0xcf, 0xd0, 
-0xd0, 0xd1, 0xd0, 0xd0, 0xcf, 0xcf, 0xce, 0xcc, 0xce, 0xcb, 0xc2, 0xb3, 0xaa, 0xa8, 0xa9, 0xa8, 
-0x9a, 0x73, 0x3f, 0x16, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x2d, 0x62, 0x96, 
-0xaf, 0xb7, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xb5, 0xb7, 0xba, 0xc5, 0xd1, 0xdd, 0xdd, 0xde, 
-0xe2, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe6, 0xe6, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdc, 
-0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xd8, 0xd7, 0xd7, 
-0xd7, 0xd7, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd1, 
-0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xd3, 
-0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xce, 0xce, 0xce, 0xcf, 0xcf, 0xcf, 0xcf, 
-0xcf, 0xcf, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xce, 0xd0, 0xd1, 0xd0, 0xcf, 0xce, 
-0xd0, 0xca, 0xbc, 0xaf, 0xa9, 0xa8, 0xaa, 0xa4, 0x89, 0x5b, 0x26, 0x0b, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x06, 0x1a, 0x46, 0x7e, 0xa5, 0xb3, 0xb3, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 
-0xb4, 0xb7, 0xb9, 0xbe, 0xcc, 0xdc, 0xdc, 0xdd, 0xe2, 0xe4, 0xe2, 0xe4, 0xe5, 0xe5, 0xe5, 0xe6, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 0xea, 0xe9, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xea, 0xe9, 0xe9, 0xe7, 
-0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe1, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 
-0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 
-0xd8, 0xd8, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 
-0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd1, 0xd1, 
-0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 
-0xd0, 0xcf, 0xcf, 0xd1, 0xd3, 0xd1, 0xd0, 0xcf, 0xd0, 0xc7, 0xb8, 0xae, 0xa9, 0xa8, 0xa8, 0x9d, 
-0x73, 0x3d, 0x16, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x2c, 0x61, 
-0x91, 0xac, 0xb5, 0xb5, 0xb3, 0xb2, 0xb0, 0xb2, 0xb3, 0xb5, 0xb8, 0xba, 0xc7, 0xd7, 0xd9, 0xdc, 
-0xe0, 0xe0, 0xe2, 0xe4, 0xe5, 0xe4, 0xe4, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 
-0xea, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xe9, 0xe7, 0xe7, 0xe7, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xde, 
-0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 
-0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 
-0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd3, 
-0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd3, 0xd1, 0xd1, 
-0xce, 0xc2, 0xb3, 0xaa, 0xa8, 0xa6, 0xa1, 0x8f, 0x54, 0x25, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x13, 0x35, 0x65, 0x93, 0xb0, 0xb4, 0xb3, 0xb2, 0xb0, 0xb0, 
-0xb2, 0xb4, 0xb5, 0xb9, 0xc1, 0xd1, 0xd9, 0xdd, 0xde, 0xde, 0xe1, 0xe4, 0xe5, 0xe4, 0xe4, 0xe5, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 0xeb, 0xeb, 
-0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe4, 0xe4, 0xe2, 
-0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 
-0xde, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd8, 0xd8, 0xd8, 
-0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd5, 0xd5, 0xd5, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 
-0xd1, 0xd3, 0xd1, 0xd1, 0xd3, 0xd4, 0xd4, 0xd1, 0xc6, 0xb9, 0xab, 0xa7, 0xa6, 0xa0, 0x8e, 0x6c, 
-0x2c, 0x10, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x1a, 
-0x41, 0x79, 0xa6, 0xb0, 0xb3, 0xb2, 0xb0, 0xb0, 0xb0, 0xb3, 0xb4, 0xb8, 0xbe, 0xcb, 0xd7, 0xdd, 
-0xde, 0xe0, 0xe1, 0xe2, 0xe4, 0xe4, 0xe4, 0xe5, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xeb, 0xeb, 
-0xeb, 0xeb, 0xea, 0xea, 0xeb, 0xea, 0xea, 0xe9, 0xe9, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xde, 
-0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 
-0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 
-0xd7, 0xd7, 0xd7, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd4, 0xd3, 0xd3, 0xd3, 0xd5, 0xd4, 0xcf, 
-0xc0, 0xb2, 0xa7, 0xa5, 0xa2, 0x98, 0x79, 0x47, 0x17, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x27, 0x5b, 0x98, 0xac, 0xb2, 0xb2, 0xb0, 0xaf, 
-0xaf, 0xb0, 0xb2, 0xb8, 0xb9, 0xc5, 0xd3, 0xdc, 0xdd, 0xe0, 0xe1, 0xe2, 0xe4, 0xe2, 0xe2, 0xe4, 
-0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 0xeb, 0xeb, 
-0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xeb, 0xeb, 0xea, 0xea, 
-0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe7, 0xe6, 0xe6, 0xe5, 0xe4, 0xe4, 
-0xe5, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 
-0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
-0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdc, 0xdc, 0xda, 
-0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd5, 
-0xd5, 0xd5, 0xd4, 0xd3, 0xd5, 0xd7, 0xd1, 0xca, 0xba, 0xad, 0xa4, 0xa3, 0x9e, 0x8a, 0x60, 0x2b, 
-0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 
-0x15, 0x3e, 0x80, 0xa1, 0xae, 0xb1, 0xb0, 0xaf, 0xae, 0xaf, 0xb0, 0xb7, 0xb5, 0xc0, 0xd0, 0xd9, 
-0xdc, 0xde, 0xe0, 0xe2, 0xe4, 0xe2, 0xe2, 0xe4, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xea, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xed, 0xeb, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 
-0xe7, 0xe7, 0xe9, 0xe9, 0xe7, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe2, 
-0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe2, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe0, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 
-0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 
-0xde, 0xde, 0xde, 0xde, 0xde, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 
-0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd5, 0xd4, 0xd4, 0xd7, 0xd7, 0xd0, 0xc7, 
-0xb8, 0xaa, 0xa1, 0x9f, 0x95, 0x75, 0x45, 0x19, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x24, 0x60, 0x8d, 0xa9, 0xb1, 0xb0, 0xae, 
-0xad, 0xb0, 0xb3, 0xb5, 0xb7, 0xbc, 0xc7, 0xd5, 0xdd, 0xdc, 0xdd, 0xe0, 0xe1, 0xe2, 0xe4, 0xe4, 
-0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xea, 0xeb, 0xea, 0xea, 
-0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xea, 0xea, 0xe7, 0xe7, 0xe7, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 
-0xdd, 0xdd, 0xdc, 0xda, 0xda, 0xd9, 0xd8, 0xd7, 0xd7, 0xd7, 0xd8, 0xda, 0xd9, 0xd9, 0xd9, 0xd8, 
-0xd8, 0xd8, 0xd7, 0xd5, 0xd7, 0xd4, 0xc8, 0xba, 0xaf, 0xa7, 0xa1, 0x9b, 0x80, 0x56, 0x28, 0x0c, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x03, 0x0f, 0x3c, 0x6e, 0x9a, 0xb0, 0xb1, 0xae, 0xad, 0xae, 0xaf, 0xb3, 0xb7, 0xb9, 0xc0, 0xcf, 
-0xda, 0xdc, 0xdd, 0xde, 0xe1, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xe9, 
-0xe9, 0xe9, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xde, 0xdd, 0xdc, 0xda, 0xda, 0xd9, 0xd8, 0xd8, 
-0xd7, 0xd7, 0xd8, 0xda, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xd8, 0xd4, 0xd7, 0xd4, 0xc5, 0xb3, 
-0xa9, 0xa3, 0x9e, 0x8d, 0x63, 0x34, 0x13, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1c, 0x46, 0x78, 0x9f, 0xad, 0xae, 
-0xad, 0xab, 0xab, 0xaf, 0xb4, 0xb5, 0xb8, 0xc3, 0xd3, 0xdc, 0xdc, 0xdd, 0xe0, 0xe2, 0xe2, 0xe4, 
-0xe4, 0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xea, 0xeb, 0xeb, 
-0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xea, 0xea, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 
-0xe0, 0xdd, 0xdc, 0xdc, 0xdc, 0xda, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0xdc, 0xda, 0xda, 0xd9, 0xd8, 
-0xd8, 0xda, 0xd9, 0xd7, 0xd5, 0xcc, 0xbd, 0xad, 0xa4, 0xa0, 0x94, 0x6d, 0x3e, 0x18, 0x06, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x0d, 0x28, 0x56, 0x85, 0xa3, 0xaf, 0xaf, 0xad, 0xaa, 0xaf, 0xb3, 0xb4, 0xb5, 0xbd, 
-0xcc, 0xda, 0xda, 0xdc, 0xde, 0xe1, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe7, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 
-0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xe9, 0xe9, 0xe7, 0xe7, 0xe9, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe0, 0xde, 0xdd, 0xdd, 0xdd, 0xda, 0xd9, 0xd9, 
-0xd9, 0xd8, 0xd9, 0xdc, 0xda, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xd9, 0xd4, 0xc1, 0xb2, 0xa9, 
-0xa3, 0x98, 0x82, 0x4d, 0x23, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x13, 0x35, 0x67, 0x92, 0xaa, 
-0xb1, 0xaf, 0xad, 0xae, 0xb0, 0xb2, 0xb3, 0xb8, 0xc6, 0xd4, 0xd8, 0xd9, 0xdc, 0xde, 0xe1, 0xe2, 
-0xe2, 0xe2, 0xe4, 0xe4, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 
-0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xde, 0xde, 0xde, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdd, 0xdc, 0xdc, 0xda, 0xd9, 
-0xd9, 0xd7, 0xd8, 0xd8, 0xce, 0xb4, 0xa9, 0xa7, 0x9f, 0x8c, 0x69, 0x2f, 0x10, 0x03, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x07, 0x1d, 0x46, 0x75, 0x9e, 0xae, 0xaf, 0xad, 0xae, 0xae, 0xb0, 0xb3, 0xb5, 
-0xbe, 0xc8, 0xd7, 0xd9, 0xdc, 0xde, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe5, 0xe5, 0xe5, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 
-0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xde, 0xdd, 0xdc, 0xdc, 
-0xda, 0xda, 0xdc, 0xdd, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xd8, 0xd7, 0xd0, 0xc1, 0xad, 0xa4, 0xa3, 
-0x96, 0x74, 0x48, 0x19, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x25, 0x52, 0x8c, 
-0xa7, 0xad, 0xad, 0xad, 0xa9, 0xae, 0xb3, 0xb4, 0xb8, 0xc0, 0xd7, 0xd8, 0xdc, 0xde, 0xe1, 0xe1, 
-0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 
-0xe6, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 
-0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xde, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xdd, 0xdc, 0xdc, 0xda, 0xda, 
-0xd9, 0xdc, 0xd7, 0xc7, 0xb7, 0xa9, 0xa5, 0x9b, 0x84, 0x56, 0x28, 0x0a, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x03, 0x10, 0x34, 0x70, 0x96, 0xa1, 0xaf, 0xad, 0xad, 0xaf, 0xb0, 0xb2, 
-0xb4, 0xb7, 0xcc, 0xd7, 0xd8, 0xd8, 0xe1, 0xe2, 0xde, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe7, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe7, 0xe6, 0xe6, 0xe4, 0xe4, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe4, 0xe4, 0xe2, 0xe2, 0xe0, 0xde, 0xdd, 0xe0, 0xdd, 0xda, 0xd9, 
-0xd9, 0xd8, 0xd9, 0xdd, 0xe0, 0xde, 0xdd, 0xde, 0xd9, 0xda, 0xd3, 0xbd, 0xae, 0xa6, 0xa0, 0x91, 
-0x6b, 0x39, 0x11, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x15, 0x41, 
-0x6e, 0x93, 0xa3, 0xa7, 0xad, 0xae, 0xae, 0xaf, 0xb2, 0xb7, 0xc0, 0xcc, 0xd8, 0xd9, 0xda, 0xdc, 
-0xe0, 0xe1, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 
-0xea, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 
-0xe4, 0xe4, 0xe5, 0xe5, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe4, 0xe4, 0xe2, 
-0xe2, 0xe0, 0xde, 0xde, 0xe0, 0xdd, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xdd, 0xe0, 0xdd, 0xd9, 0xdc, 
-0xdc, 0xd1, 0xc1, 0xb0, 0xa7, 0x9d, 0x8a, 0x69, 0x3b, 0x1a, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x20, 0x45, 0x70, 0x94, 0xa6, 0xac, 0xab, 0xab, 0xab, 
-0xaf, 0xb4, 0xb5, 0xc2, 0xd4, 0xdc, 0xd7, 0xd8, 0xde, 0xe0, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe5, 0xe5, 0xe6, 0xe6, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 
-0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe6, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xde, 0xe0, 0xdd, 0xdc, 0xda, 
-0xda, 0xda, 0xda, 0xdd, 0xdd, 0xdc, 0xda, 0xdc, 0xd7, 0xc6, 0xb2, 0xa7, 0xa0, 0x8c, 0x69, 0x40, 
-0x1d, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 
-0x20, 0x48, 0x7a, 0x9c, 0xab, 0xaa, 0xaa, 0xaa, 0xae, 0xb2, 0xb2, 0xb9, 0xcb, 0xd9, 0xd8, 0xd7, 
-0xdd, 0xde, 0xe0, 0xe1, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe6, 0xe5, 0xe5, 
-0xe5, 0xe6, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 
-0xe4, 0xe4, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 
-0xe1, 0xe1, 0xe0, 0xe0, 0xde, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xde, 0xdc, 0xdc, 0xde, 0xde, 
-0xcc, 0xb8, 0xa8, 0xa2, 0x9b, 0x73, 0x44, 0x1f, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0d, 0x2b, 0x5b, 0x89, 0xa3, 0xab, 0xaa, 0xaa, 
-0xad, 0xaf, 0xb2, 0xb4, 0xc2, 0xd1, 0xd8, 0xd8, 0xd9, 0xdc, 0xde, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 
-0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xde, 0xdd, 0xdc, 0xdc, 
-0xdc, 0xdc, 0xdd, 0xde, 0xda, 0xda, 0xdd, 0xd9, 0xbd, 0xad, 0xa6, 0x9e, 0x8d, 0x57, 0x27, 0x0c, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x06, 0x15, 0x38, 0x69, 0x90, 0xa7, 0xab, 0xaa, 0xab, 0xad, 0xb0, 0xb4, 0xba, 0xc3, 0xd1, 0xd8, 
-0xd9, 0xda, 0xdd, 0xde, 0xe1, 0xe1, 0xe1, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe9, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 
-0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xde, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xd8, 0xd4, 0xc8, 
-0xaf, 0xa5, 0x9f, 0x8f, 0x6f, 0x36, 0x13, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x15, 0x34, 0x5c, 0x90, 0xa2, 0xaa, 
-0xaa, 0xaa, 0xad, 0xb3, 0xb5, 0xb8, 0xc3, 0xd1, 0xda, 0xda, 0xdc, 0xdd, 0xe0, 0xe1, 0xe1, 0xe2, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0xde, 0xdd, 0xdd, 
-0xde, 0xde, 0xdd, 0xdd, 0xdc, 0xd4, 0xc5, 0xb4, 0xa4, 0x97, 0x86, 0x65, 0x38, 0x14, 0x05, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x07, 0x16, 0x32, 0x6c, 0x8d, 0xa2, 0xa4, 0xaa, 0xa9, 0xad, 0xb2, 0xb3, 0xb5, 0xc6, 
-0xda, 0xda, 0xda, 0xdc, 0xe0, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 
-0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe5, 0xe1, 0xdd, 0xde, 0xe1, 0xde, 0xdd, 0xdd, 0xd5, 0xcb, 0xb7, 0xa3, 
-0x97, 0x85, 0x63, 0x3b, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x14, 0x3d, 0x65, 0x8d, 
-0x9a, 0xad, 0xa9, 0xaa, 0xae, 0xaf, 0xb2, 0xbd, 0xcf, 0xd8, 0xdc, 0xde, 0xdd, 0xde, 0xe0, 0xe1, 
-0xe1, 0xe1, 0xe2, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xde, 
-0xde, 0xdc, 0xda, 0xd8, 0xc8, 0xb9, 0xa9, 0x98, 0x83, 0x62, 0x3a, 0x18, 0x08, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x06, 0x1b, 0x3c, 0x6c, 0x8e, 0x9c, 0xa8, 0xa8, 0xaa, 0xad, 0xaf, 0xb4, 
-0xc1, 0xd0, 0xd9, 0xde, 0xdd, 0xdc, 0xde, 0xde, 0xe0, 0xe1, 0xe1, 0xe2, 0xe4, 0xe5, 0xe4, 0xe4, 
-0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe6, 0xe6, 
-0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xde, 0xe0, 0xe0, 0xde, 0xdd, 0xdc, 0xd8, 0xce, 0xb9, 0xab, 0x9d, 0x88, 
-0x61, 0x3a, 0x1a, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x1b, 0x3d, 
-0x6b, 0x88, 0xa2, 0xa7, 0xa8, 0xaa, 0xae, 0xb2, 0xb5, 0xc2, 0xd0, 0xda, 0xdd, 0xdc, 0xdd, 0xde, 
-0xde, 0xe0, 0xe1, 0xe2, 0xe4, 0xe5, 0xe4, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xde, 
-0xdc, 0xda, 0xd1, 0xbc, 0xab, 0x9d, 0x8c, 0x6b, 0x3a, 0x19, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x19, 0x3e, 0x6b, 0x91, 0xa3, 0xa7, 0xa9, 0xad, 0xb0, 
-0xaf, 0xb5, 0xc3, 0xd1, 0xd8, 0xda, 0xdc, 0xde, 0xe0, 0xe0, 0xe1, 0xe2, 0xe2, 0xe4, 0xe2, 0xe1, 
-0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe4, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe0, 0xde, 0xde, 0xda, 0xd1, 0xc0, 0xa7, 0x9b, 0x8a, 0x6c, 0x42, 
-0x18, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 
-0x15, 0x33, 0x66, 0x8d, 0x9e, 0xa1, 0xa6, 0xab, 0xae, 0xb2, 0xb8, 0xc2, 0xce, 0xd8, 0xda, 0xde, 
-0xe0, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 
-0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xdd, 0xde, 0xdd, 
-0xd3, 0xba, 0xa4, 0x98, 0x82, 0x61, 0x39, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x14, 0x3c, 0x69, 0x8b, 0x9d, 0xa5, 0xa7, 
-0xae, 0xaf, 0xb3, 0xb8, 0xc2, 0xd0, 0xd9, 0xdd, 0xde, 0xde, 0xe1, 0xe4, 0xe4, 0xe0, 0xe1, 0xe2, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe1, 0xe0, 
-0xe0, 0xe2, 0xe1, 0xe0, 0xda, 0xdc, 0xda, 0xd3, 0xc1, 0xac, 0x95, 0x83, 0x62, 0x3b, 0x19, 0x07, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x06, 0x1a, 0x3c, 0x66, 0x8c, 0xa2, 0xa6, 0xa8, 0xaa, 0xad, 0xb0, 0xb7, 0xc6, 0xd1, 0xda, 
-0xdd, 0xdc, 0xde, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 
-0xe2, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe2, 0xe1, 0xe1, 0xde, 0xdd, 0xdd, 0xda, 0xd0, 0xbd, 
-0xab, 0x9c, 0x81, 0x5f, 0x3a, 0x1a, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x1b, 0x3c, 0x64, 0x8a, 0xa1, 
-0xa2, 0xa6, 0xa9, 0xaa, 0xae, 0xba, 0xc5, 0xd3, 0xdc, 0xdc, 0xda, 0xdc, 0xde, 0xe1, 0xe1, 0xe1, 
-0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xde, 0xe1, 0xe4, 
-0xe0, 0xdd, 0xdc, 0xde, 0xde, 0xcf, 0xbb, 0xa7, 0x98, 0x86, 0x60, 0x3a, 0x19, 0x08, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x09, 0x1b, 0x3a, 0x63, 0x8b, 0x9d, 0xa3, 0xa7, 0xa8, 0xaa, 0xb3, 0xbc, 0xc7, 
-0xd3, 0xd8, 0xdc, 0xdc, 0xdd, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe0, 0xde, 0xde, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 
-0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe2, 0xe4, 0xe0, 0xdc, 0xda, 0xdc, 0xe0, 0xcc, 0xb8, 0xa2, 0x93, 
-0x83, 0x69, 0x38, 0x19, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x16, 0x30, 0x4f, 
-0x73, 0x8e, 0x9f, 0xa5, 0xa6, 0xab, 0xb0, 0xb7, 0xbe, 0xcc, 0xd8, 0xdd, 0xdd, 0xdd, 0xde, 0xe0, 
-0xe0, 0xe1, 0xe0, 0xe0, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 
-0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe2, 0xe0, 0xdd, 
-0xe0, 0xdd, 0xd3, 0xc8, 0xae, 0x9b, 0x86, 0x6e, 0x54, 0x34, 0x14, 0x06, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x12, 0x22, 0x45, 0x6a, 0x8a, 0x9d, 0xa2, 0xa7, 0xaa, 0xae, 
-0xb3, 0xbd, 0xca, 0xd5, 0xd9, 0xdc, 0xdd, 0xde, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdd, 0xdd, 0xdd, 0xd3, 0xbf, 0xa9, 0x9e, 0x85, 0x66, 0x42, 
-0x27, 0x13, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x0a, 
-0x20, 0x40, 0x69, 0x8a, 0x99, 0xa3, 0xa8, 0xad, 0xae, 0xb0, 0xb8, 0xc8, 0xd4, 0xd9, 0xdc, 0xdd, 
-0xe0, 0xe1, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe1, 0xe1, 0xe2, 
-0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
-0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe0, 0xde, 0xd8, 
-0xce, 0xbd, 0xa6, 0x93, 0x8a, 0x63, 0x3c, 0x1d, 0x0c, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0b, 0x1e, 0x3e, 0x5f, 0x81, 0x92, 0x9f, 0xab, 
-0xa9, 0xab, 0xb2, 0xba, 0xc5, 0xcf, 0xd9, 0xdd, 0xdd, 0xdd, 0xde, 0xe2, 0xe5, 0xe1, 0xe1, 0xe1, 
-0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xde, 0xde, 0xe1, 0xe2, 0xe1, 0xdd, 0xde, 
-0xe2, 0xe1, 0xe0, 0xdd, 0xdc, 0xde, 0xdc, 0xc6, 0xad, 0x98, 0x8d, 0x80, 0x66, 0x38, 0x1b, 0x0a, 
-0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x0b, 0x1c, 0x35, 0x4f, 0x79, 0x90, 0x9a, 0xa2, 0xa6, 0xab, 0xaf, 0xb5, 0xc2, 0xcf, 0xd5, 
-0xd9, 0xde, 0xe0, 0xe2, 0xe4, 0xe0, 0xe2, 0xe4, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 
-0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xe2, 0xe1, 0xdd, 0xd9, 0xdc, 0xde, 0xde, 0xd7, 0xc5, 0xa8, 
-0x95, 0x87, 0x6f, 0x51, 0x35, 0x18, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x11, 0x25, 0x4a, 0x66, 0x83, 
-0x95, 0x9d, 0xa4, 0xa6, 0xaa, 0xb4, 0xbe, 0xc7, 0xd3, 0xdd, 0xe0, 0xde, 0xdd, 0xde, 0xe2, 0xe5, 
-0xe4, 0xe2, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe4, 0xe4, 0xe1, 0xde, 0xdd, 0xde, 0xe4, 0xe1, 
-0xdc, 0xdd, 0xe1, 0xde, 0xd7, 0xbf, 0xa7, 0x8a, 0x78, 0x66, 0x45, 0x24, 0x10, 0x06, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x03, 0x09, 0x1d, 0x33, 0x51, 0x6e, 0x84, 0x95, 0x9f, 0xa4, 0xaa, 0xad, 0xb4, 
-0xc2, 0xcf, 0xd5, 0xd8, 0xd9, 0xdd, 0xe0, 0xe0, 0xe0, 0xde, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe2, 0xe4, 0xe2, 0xdd, 0xdd, 0xe0, 0xdd, 0xdc, 0xe1, 0xe1, 0xd5, 0xbe, 0xa9, 0x93, 0x84, 0x64, 
-0x46, 0x2a, 0x17, 0x09, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x08, 0x11, 0x27, 
-0x42, 0x5e, 0x7a, 0x92, 0x9b, 0xa1, 0xa3, 0xa9, 0xb3, 0xc1, 0xcb, 0xd4, 0xda, 0xdc, 0xdd, 0xde, 
-0xde, 0xde, 0xe2, 0xe5, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xdd, 0xdd, 0xde, 0xe0, 0xdd, 
-0xd9, 0xc6, 0xb0, 0x9c, 0x88, 0x74, 0x5b, 0x38, 0x1f, 0x0e, 0x06, 0x02, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0d, 0x1c, 0x32, 0x52, 0x77, 0x8a, 0x95, 0x9d, 0xa3, 
-0xa9, 0xb2, 0xbc, 0xc6, 0xcf, 0xd3, 0xd8, 0xdc, 0xde, 0xde, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 
-0xdd, 0xde, 0xe0, 0xe0, 0xdc, 0xda, 0xd9, 0xd0, 0xbe, 0xa1, 0x8e, 0x7f, 0x6c, 0x4f, 0x2f, 0x15, 
-0x0a, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x08, 0x13, 0x27, 0x4a, 0x63, 0x7a, 0x8e, 0x9d, 0xa2, 0xa6, 0xaa, 0xb2, 0xb8, 0xc5, 0xcf, 0xd8, 
-0xdc, 0xdc, 0xda, 0xd9, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xdd, 0xdd, 0xe0, 0xe1, 0xda, 0xd4, 0xbc, 0xa7, 
-0x95, 0x7e, 0x6c, 0x57, 0x3e, 0x24, 0x11, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0c, 0x1e, 0x35, 0x4f, 0x6c, 0x8b, 
-0x9c, 0xa0, 0xa0, 0xa4, 0xab, 0xaf, 0xba, 0xc7, 0xd0, 0xd5, 0xd7, 0xd8, 0xdc, 0xde, 0xe0, 0xe2, 
-0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xde, 0xde, 0xe0, 0xe1, 0xe4, 
-0xe4, 0xe5, 0xe0, 0xe4, 0xe5, 0xe2, 0xe0, 0xe0, 0xe1, 0xde, 0xde, 0xe0, 0xe0, 0xe0, 0xde, 0xdc, 
-0xda, 0xdd, 0xe1, 0xdc, 0xc2, 0xab, 0x93, 0x88, 0x77, 0x59, 0x3f, 0x27, 0x17, 0x0b, 0x05, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x01, 0x05, 0x0d, 0x1d, 0x37, 0x59, 0x75, 0x8e, 0x9b, 0xa1, 0xa0, 0xa1, 0xa7, 0xad, 
-0xb8, 0xc3, 0xcf, 0xd5, 0xda, 0xda, 0xdc, 0xdd, 0xde, 0xde, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xde, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xde, 0xde, 0xe0, 0xe2, 0xe4, 0xe1, 0xde, 0xde, 
-0xe0, 0xde, 0xde, 0xe1, 0xe1, 0xe0, 0xe0, 0xde, 0xd9, 0xcf, 0xbb, 0xa2, 0x8c, 0x81, 0x74, 0x66, 
-0x4e, 0x28, 0x14, 0x09, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x09, 0x15, 0x2b, 
-0x46, 0x69, 0x80, 0x91, 0x99, 0x9f, 0xa0, 0x9f, 0xa3, 0xad, 0xb7, 0xbe, 0xce, 0xd3, 0xd8, 0xdd, 
-0xde, 0xdc, 0xdd, 0xde, 0xe1, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 
-0xde, 0xde, 0xde, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe2, 0xde, 0xde, 0xde, 0xdd, 0xda, 0xd7, 0xce, 
-0xb5, 0x9f, 0x8e, 0x83, 0x73, 0x60, 0x4b, 0x33, 0x20, 0x0e, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x0d, 0x19, 0x34, 0x4f, 0x6d, 0x84, 0x8e, 0x97, 0x9a, 
-0x9d, 0xa1, 0xa6, 0xa6, 0xb6, 0xbe, 0xca, 0xd3, 0xd9, 0xdc, 0xda, 0xd9, 0xdc, 0xde, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 
-0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xde, 0xdd, 0xdc, 
-0xdc, 0xe1, 0xe2, 0xdf, 0xd6, 0xc3, 0xad, 0x9c, 0x89, 0x7b, 0x6d, 0x63, 0x4b, 0x35, 0x22, 0x13, 
-0x0a, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 
-0x05, 0x10, 0x1e, 0x34, 0x4c, 0x62, 0x7a, 0x8d, 0x9c, 0xa0, 0x9e, 0x9b, 0xa1, 0xa4, 0xa9, 0xb3, 
-0xc0, 0xcf, 0xd4, 0xd7, 0xd9, 0xdc, 0xde, 0xdd, 0xdd, 0xde, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 
-0xe0, 0xe0, 0xe1, 0xe0, 0xe1, 0xe2, 0xe1, 0xde, 0xdc, 0xd7, 0xcb, 0xbb, 0xa8, 0x95, 0x82, 0x75, 
-0x65, 0x54, 0x44, 0x34, 0x20, 0x12, 0x0a, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x0e, 0x19, 0x26, 0x41, 0x5e, 
-0x7c, 0x8e, 0x97, 0x9d, 0xa3, 0xa0, 0x9e, 0x9f, 0xa6, 0xb4, 0xbd, 0xc6, 0xca, 0xd1, 0xd7, 0xda, 
-0xd9, 0xdc, 0xde, 0xde, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xda, 0xda, 0xd7, 0xcf, 
-0xc8, 0xb0, 0x9f, 0x88, 0x76, 0x6b, 0x62, 0x53, 0x3b, 0x27, 0x19, 0x12, 0x09, 0x04, 0x01, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x02, 0x04, 0x07, 0x12, 0x23, 0x3c, 0x55, 0x6c, 0x88, 0xa1, 0xac, 0xaa, 0xa6, 
-0xa2, 0x9f, 0xa0, 0xa6, 0xaf, 0xba, 0xc7, 0xd0, 0xd3, 0xd8, 0xdc, 0xdc, 0xdc, 0xdd, 0xde, 0xde, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xda, 0xd9, 0xda, 0xdc, 0xde, 
-0xe0, 0xe0, 0xe1, 0xd9, 0xcf, 0xc0, 0xb1, 0x9c, 0x90, 0x82, 0x7e, 0x73, 0x61, 0x49, 0x34, 0x23, 
-0x15, 0x0c, 0x06, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x06, 
-0x0b, 0x13, 0x1f, 0x37, 0x5e, 0x7b, 0x90, 0xa5, 0xb4, 0xb6, 0xb7, 0xb8, 0xb6, 0xb1, 0xb3, 0xb7, 
-0xb8, 0xbb, 0xc2, 0xc8, 0xcc, 0xcf, 0xd1, 0xd4, 0xd7, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdd, 
-0xde, 0xdd, 0xd9, 0xd9, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xda, 0xda, 0xda, 
-0xda, 0xda, 0xda, 0xda, 0xd8, 0xd5, 0xd2, 0xcb, 0xc2, 0xb7, 0xa7, 0x98, 0x8b, 0x80, 0x77, 0x72, 
-0x6a, 0x59, 0x49, 0x38, 0x26, 0x16, 0x0b, 0x07, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x21, 0x33, 0x47, 0x62, 
-0x76, 0x89, 0x9e, 0xb6, 0xc4, 0xce, 0xd2, 0xd0, 0xcb, 0xc9, 0xcc, 0xce, 0xce, 0xcd, 0xca, 0xc7, 
-0xc7, 0xc7, 0xc8, 0xcb, 0xd0, 0xd4, 0xd5, 0xd4, 0xd7, 0xd8, 0xd7, 0xd7, 0xd9, 0xda, 0xd9, 0xd9, 
-0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd7, 0xd3, 0xce, 0xca, 0xc1, 0xbc, 0xb2, 0xa5, 0x9a, 
-0x92, 0x8a, 0x7e, 0x74, 0x6b, 0x5e, 0x51, 0x48, 0x3d, 0x2a, 0x1f, 0x15, 0x0b, 0x05, 0x02, 0x01, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x03, 0x07, 0x0c, 0x15, 0x20, 0x2c, 0x3b, 0x51, 0x6c, 0x86, 0xa3, 0xb7, 0xc0, 
-0xc5, 0xd2, 0xde, 0xe1, 0xe1, 0xe0, 0xdd, 0xd5, 0xc5, 0xbc, 0xb4, 0xb6, 0xbb, 0xbf, 0xc0, 0xc2, 
-0xc5, 0xc7, 0xc8, 0xc8, 0xca, 0xcb, 0xce, 0xcc, 0xcb, 0xcb, 0xc9, 0xc9, 0xc5, 0xc3, 0xc0, 0xbc, 
-0xb3, 0xaa, 0xa0, 0x98, 0x93, 0x8b, 0x7c, 0x73, 0x6e, 0x6a, 0x5f, 0x4e, 0x3f, 0x2f, 0x23, 0x1d, 
-0x16, 0x0d, 0x07, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x06, 
-0x09, 0x0f, 0x19, 0x27, 0x39, 0x51, 0x62, 0x6e, 0x7c, 0x94, 0xab, 0xb4, 0xc0, 0xcf, 0xde, 0xe2, 
-0xd3, 0xc4, 0xb3, 0xad, 0xb0, 0xb4, 0xb5, 0xb5, 0xb6, 0xb8, 0xb8, 0xb8, 0xb7, 0xb7, 0xb8, 0xb7, 
-0xb5, 0xb1, 0xaf, 0xa8, 0xa0, 0x9b, 0x9b, 0x97, 0x92, 0x8b, 0x7e, 0x77, 0x72, 0x6b, 0x5b, 0x4b, 
-0x44, 0x3f, 0x32, 0x22, 0x18, 0x0f, 0x09, 0x06, 0x04, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x0d, 0x17, 0x1d, 0x24, 
-0x2e, 0x43, 0x55, 0x60, 0x6b, 0x83, 0x9b, 0xa6, 0xaf, 0xaa, 0x9f, 0x9d, 0xa4, 0xad, 0xae, 0xad, 
-0xac, 0xac, 0xac, 0xaa, 0xa8, 0xa5, 0xa5, 0xa4, 0xa1, 0x9d, 0x96, 0x88, 0x7d, 0x77, 0x73, 0x72, 
-0x70, 0x67, 0x56, 0x46, 0x3f, 0x3a, 0x2b, 0x1d, 0x17, 0x14, 0x0f, 0x08, 0x05, 0x02, 0x01, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x06, 0x0c, 0x11, 0x14, 0x1b, 0x29, 0x3a, 0x42, 
-0x44, 0x44, 0x46, 0x50, 0x64, 0x74, 0x79, 0x75, 0x73, 0x72, 0x72, 0x70, 0x6f, 0x6f, 0x6f, 0x6e, 
-0x6d, 0x6a, 0x64, 0x50, 0x3c, 0x33, 0x31, 0x31, 0x2e, 0x29, 0x1d, 0x12, 0x0e, 0x0c, 0x08, 0x04, 
-0x03, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x02, 0x02, 0x02, 0x05, 0x09, 0x0e, 0x10, 0x0f, 0x10, 0x13, 0x1a, 0x26, 0x32, 0x35, 0x33, 
-0x31, 0x30, 0x30, 0x31, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2c, 0x2a, 0x1e, 0x13, 0x0e, 0x0c, 0x0c, 
-0x0c, 0x0a, 0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x04, 0x09, 0x0c, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
-0x0b, 0x0a, 0x0a, 0x07, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
\ No newline at end of file
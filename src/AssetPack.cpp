@@ -0,0 +1,192 @@
+#include "AssetPack.h"
+
+#include <string.h>
+
+#ifndef ARDUINO
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static uint32_t fnv1a(const uint8_t *data, size_t size)
+{
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < size; i++)
+  {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+AssetPack::AssetPack() : base(nullptr), mappedSize(0), header(nullptr), entries(nullptr)
+{
+#ifdef ARDUINO
+  mapHandle = 0;
+#endif
+}
+
+AssetPack::~AssetPack()
+{
+  close();
+}
+
+#ifdef ARDUINO
+
+bool AssetPack::open()
+{
+  if (isOpen())
+    return true;
+
+  const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                              (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE,
+                                                              ASSET_PARTITION_LABEL);
+  if (partition == nullptr)
+    return false;
+
+  const void *mapped = nullptr;
+
+  if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &mapped, &mapHandle) != ESP_OK)
+    return false;
+
+  base = (const uint8_t *)mapped;
+  mappedSize = partition->size;
+
+  if (!attach(base, mappedSize))
+  {
+    close();
+    return false;
+  }
+
+  return true;
+}
+
+void AssetPack::close()
+{
+  if (base != nullptr)
+    spi_flash_munmap(mapHandle);
+
+  base = nullptr;
+  mappedSize = 0;
+  header = nullptr;
+  entries = nullptr;
+}
+
+#else
+
+bool AssetPack::open(const char *path)
+{
+  if (isOpen())
+    return true;
+
+  int fd = ::open(path, O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0)
+  {
+    ::close(fd);
+    return false;
+  }
+
+  void *mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+
+  if (mapped == MAP_FAILED)
+    return false;
+
+  base = (const uint8_t *)mapped;
+  mappedSize = st.st_size;
+
+  if (!attach(base, mappedSize))
+  {
+    close();
+    return false;
+  }
+
+  return true;
+}
+
+void AssetPack::close()
+{
+  if (base != nullptr)
+    munmap((void *)base, mappedSize);
+
+  base = nullptr;
+  mappedSize = 0;
+  header = nullptr;
+  entries = nullptr;
+}
+
+#endif
+
+bool AssetPack::attach(const uint8_t *data, size_t size)
+{
+  if (size < sizeof(AssetPackHeader))
+    return false;
+
+  const AssetPackHeader *candidate = (const AssetPackHeader *)data;
+
+  if (candidate->magic != ASSET_PACK_MAGIC || candidate->version != ASSET_PACK_VERSION)
+    return false;
+
+  // The partition is larger than the pack, the file may not be.
+  if (candidate->size > size || candidate->size < sizeof(AssetPackHeader) + candidate->entryCount * sizeof(AssetEntry))
+    return false;
+
+  const AssetEntry *table = (const AssetEntry *)(data + sizeof(AssetPackHeader));
+
+  for (int i = 0; i < candidate->entryCount; i++)
+  {
+    if (table[i].offset % ASSET_PACK_ALIGN != 0 || table[i].offset + table[i].size > candidate->size)
+      return false;
+  }
+
+  header = candidate;
+  entries = table;
+  return true;
+}
+
+bool AssetPack::verify() const
+{
+  if (!isOpen())
+    return false;
+
+  return fnv1a(base + sizeof(AssetPackHeader), header->size - sizeof(AssetPackHeader)) == header->checksum;
+}
+
+int AssetPack::count() const
+{
+  return isOpen() ? header->entryCount : 0;
+}
+
+const AssetEntry *AssetPack::entry(int index) const
+{
+  if (index < 0 || index >= count())
+    return nullptr;
+
+  return &entries[index];
+}
+
+const AssetEntry *AssetPack::find(const char *name) const
+{
+  for (int i = 0; i < count(); i++)
+  {
+    if (strncmp(entries[i].name, name, ASSET_NAME_LEN) == 0)
+      return &entries[i];
+  }
+
+  return nullptr;
+}
+
+const uint8_t *AssetPack::data(const AssetEntry *asset) const
+{
+  if (asset == nullptr)
+    return nullptr;
+
+  return base + asset->offset;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ARDUINO
+#include <esp_partition.h>
+#endif
+
+// Binary asset pack, written by tools/asset_compiler.py and flashed to the
+// "assets" data partition (see spiral_partitions.csv). Layout:
+//
+//   AssetPackHeader
+//   AssetEntry[entryCount]
+//   payloads, each aligned to ASSET_PACK_ALIGN bytes
+//
+// All fields are little-endian. Offsets are relative to the start of the pack.
+// The compiler also generates AssetIndex.h with a TextureDesc for every
+// texture layout, so the firmware never has to look assets up by name.
+
+const uint32_t ASSET_PACK_MAGIC = 0x4B505353; // "SSPK"
+const uint16_t ASSET_PACK_VERSION = 2;
+const uint32_t ASSET_PACK_ALIGN = 32;
+const int ASSET_NAME_LEN = 32;
+
+const char ASSET_PARTITION_LABEL[] = "assets";
+const uint8_t ASSET_PARTITION_SUBTYPE = 0x40;
+
+enum AssetFormat : uint8_t
+{
+  ASSET_FORMAT_GRAY8 = 0,       // width * height bytes, row-major
+  ASSET_FORMAT_GRAY8_TILED = 1, // ASSET_TILE_SIZE square tiles, tile after tile
+  ASSET_FORMAT_GRAY4 = 2,       // two texels per byte, first in the high nibble
+  ASSET_FORMAT_TILE_MINMAX = 3, // min and max byte per tile
+  ASSET_FORMAT_SPIRAL_MAP = 4,  // 3 bytes per texel, see RotozoomEngine.h
+  ASSET_FORMAT_MONO1 = 5,       // FrameBuffer layout, 1 bit per texel, set is white
+  ASSET_FORMAT_POLAR_LUT = 6,   // PolarTexel per texel, see PolarEngine.h
+  ASSET_FORMAT_SPRITE = 7,      // SpriteHeader, then masked 1 bit texels, see Sprite.h
+};
+
+struct TextureDesc
+{
+  uint32_t offset;
+  uint16_t width;
+  uint16_t height;
+  AssetFormat format;
+};
+
+struct AssetPackHeader
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t entryCount;
+  uint32_t size;     // whole pack in bytes, header included
+  uint32_t checksum; // FNV-1a over everything after the header
+};
+
+struct AssetEntry
+{
+  char name[ASSET_NAME_LEN];
+  uint32_t offset;
+  uint32_t size;
+  uint16_t width;
+  uint16_t height;
+  uint8_t format;
+  uint8_t reserved[3];
+};
+
+static_assert(sizeof(AssetPackHeader) == 16, "AssetPackHeader layout must match tools/assetpack.py");
+static_assert(sizeof(AssetEntry) == 48, "AssetEntry layout must match tools/assetpack.py");
+
+// Read-only view of an asset pack. On the watch the pack is memory-mapped
+// straight out of the flash partition, on the host it is mmap()ed from a
+// file; in both cases textures are used in place without copying.
+class AssetPack
+{
+public:
+  AssetPack();
+  ~AssetPack();
+
+#ifdef ARDUINO
+  bool open();
+#else
+  bool open(const char *path);
+#endif
+  void close();
+
+  bool isOpen() const { return header != nullptr; }
+  bool verify() const;
+
+  int count() const;
+  const AssetEntry *entry(int index) const;
+  const AssetEntry *find(const char *name) const;
+  const uint8_t *data(const AssetEntry *asset) const;
+  const uint8_t *data(const TextureDesc &texture) const { return base + texture.offset; }
+
+  uint32_t checksum() const { return isOpen() ? header->checksum : 0; }
+
+private:
+  bool attach(const uint8_t *data, size_t size);
+
+  const uint8_t *base;
+  size_t mappedSize;
+  const AssetPackHeader *header;
+  const AssetEntry *entries;
+
+#ifdef ARDUINO
+  spi_flash_mmap_handle_t mapHandle;
+#endif
+};
@@ -0,0 +1,29 @@
+#include "Dither.h"
+
+#include <stdlib.h>
+
+void DitherNoise::attach(const uint8_t *noise)
+{
+  source = noise;
+
+#if SPIRAL_NOISE_PLACEMENT == 2
+  static uint8_t *noiseCopy = nullptr;
+
+  if (noiseCopy == nullptr)
+  {
+    noiseCopy = (uint8_t *)malloc(SCREEN_WIDTH * SCREEN_HEIGHT);
+
+    if (noiseCopy != nullptr)
+      memcpy(noiseCopy, noise, SCREEN_WIDTH * SCREEN_HEIGHT);
+  }
+
+  // Out of heap is not fatal, dither straight from flash instead
+  this->noise = noiseCopy != nullptr ? noiseCopy : noise;
+#else
+  this->noise = noise;
+#endif
+
+#if SPIRAL_NOISE_PLACEMENT == 1
+  rowY = -1;
+#endif
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "FaceConfig.h"
+#include "FrameBuffer.h"
+
+// Screen-space blue noise the textures are thresholded against: a pixel is
+// white when its texel is brighter than the noise under it. Where the noise
+// is read from is picked by SPIRAL_NOISE_PLACEMENT.
+class DitherNoise
+{
+public:
+  // noise is SCREEN_WIDTH x SCREEN_HEIGHT, straight from the asset pack
+  void attach(const uint8_t *noise);
+
+  inline const uint8_t *row(int16_t y)
+  {
+#if SPIRAL_NOISE_PLACEMENT == 1
+    if (y != rowY)
+    {
+      memcpy(rowBuffer, source + y * SCREEN_WIDTH, SCREEN_WIDTH);
+      rowY = y;
+    }
+
+    return rowBuffer;
+#else
+    return noise + y * SCREEN_WIDTH;
+#endif
+  }
+
+private:
+  const uint8_t *source = nullptr;
+  const uint8_t *noise = nullptr;
+
+#if SPIRAL_NOISE_PLACEMENT == 1
+  uint8_t rowBuffer[SCREEN_WIDTH];
+  int16_t rowY = -1;
+#endif
+};
@@ -0,0 +1,282 @@
+#pragma once
+
+// Compile-time switches for the watch face. All of them can be overridden
+// from build_flags in platformio.ini, e.g. -DSPIRAL_IRAM_KERNELS=0.
+
+#ifdef ARDUINO
+#include <esp_attr.h>
+#else
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#endif
+
+// Run the rasterizer inner loops from IRAM instead of through the flash
+// cache, where they compete with the textures they sample.
+#ifndef SPIRAL_IRAM_KERNELS
+#define SPIRAL_IRAM_KERNELS 1
+#endif
+
+// Keep the small constant tables (hand geometry) in DRAM instead of flash.
+#ifndef SPIRAL_DRAM_TABLES
+#define SPIRAL_DRAM_TABLES 1
+#endif
+
+// Where the blue noise used for dithering is read from:
+//   0 - straight from the memory-mapped asset pack (flash)
+//   1 - the current scanline is copied to DRAM before it is used
+//   2 - the whole texture is copied to DRAM once per wake (40 KB of heap)
+#ifndef SPIRAL_NOISE_PLACEMENT
+#define SPIRAL_NOISE_PLACEMENT 2
+#endif
+
+// Sample the face and matcap textures through a DRAM tile cache (see
+// TextureCache.h) instead of straight from flash, with this many 1 KB tiles.
+#ifndef SPIRAL_TEXTURE_CACHE
+#define SPIRAL_TEXTURE_CACHE 1
+#endif
+
+#ifndef SPIRAL_TEXTURE_CACHE_TILES
+#define SPIRAL_TEXTURE_CACHE_TILES 16
+#endif
+
+// Sample minified face triangles (the inner spiral loops) from a smaller
+// level of the face texture's mip chain.
+#ifndef SPIRAL_FACE_MIPS
+#define SPIRAL_FACE_MIPS 1
+#endif
+
+// How the spiral is drawn:
+//   SPIRAL_ENGINE_TRIANGLES - rasterize and texture every loop triangle
+//   SPIRAL_ENGINE_ROTOZOOM  - turn a map of the spiral baked by the asset
+//                             compiler by the minute angle (RotozoomEngine.h)
+//   SPIRAL_ENGINE_BAKED     - copy the spiral and shadow of the minute from
+//                             frames baked by the asset compiler, only the
+//                             hands are drawn at runtime
+//   SPIRAL_ENGINE_POLAR     - one raster-order pass over a per-pixel polar
+//                             lookup table baked by the asset compiler
+//                             (PolarEngine.h)
+//   SPIRAL_ENGINE_ANALYTIC  - the same pass with the table computed per pixel
+//                             with approximate math (FastMath.h), nothing
+//                             baked
+#define SPIRAL_ENGINE_TRIANGLES 0
+#define SPIRAL_ENGINE_ROTOZOOM 1
+#define SPIRAL_ENGINE_BAKED 2
+#define SPIRAL_ENGINE_POLAR 3
+#define SPIRAL_ENGINE_ANALYTIC 4
+
+#ifndef SPIRAL_ENGINE
+#define SPIRAL_ENGINE SPIRAL_ENGINE_TRIANGLES
+#endif
+
+// Rim thicknesses baked for the engines that draw from baked data; the
+// battery fill is rounded to the nearest one. Baked frames take 300 KB of
+// the asset partition per bucket.
+#ifndef SPIRAL_BATTERY_BUCKETS
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_BAKED
+#define SPIRAL_BATTERY_BUCKETS 2
+#else
+#define SPIRAL_BATTERY_BUCKETS 3
+#endif
+#endif
+
+// Draw the hands from pre-dithered sprites baked by the asset compiler (see
+// Sprite.h) instead of rasterizing them, with the hour hand turning in this
+// many steps per revolution rather than every minute. The sprites take about
+// 1 KB of the asset partition each, which the rotozoom maps and the baked
+// frames leave no room for. Baking them needs a host C++ compiler, so they are
+// off unless asked for.
+#ifndef SPIRAL_HAND_SPRITES
+#define SPIRAL_HAND_SPRITES 0
+#endif
+
+#ifndef SPIRAL_HOUR_HAND_STEPS
+#define SPIRAL_HOUR_HAND_STEPS 144
+#endif
+
+// Draw the static decorations over the spiral (the shadow in its centre) from
+// pre-dithered sprites baked by the asset compiler instead of rasterizing
+// them. Off by default like SPIRAL_HAND_SPRITES; the baked frames already hold
+// the shadow and have no use for it.
+#ifndef SPIRAL_OVERLAY_SPRITES
+#define SPIRAL_OVERLAY_SPRITES 0
+#endif
+
+// Below this battery voltage, in millivolts, draw the face the cheap way (see
+// FaceRenderer::drawSpiralEconomy()) until the battery is back above it by
+// SPIRAL_ECONOMY_HYSTERESIS_MV; 0 for never. The baked engine is as cheap
+// as it gets already and ignores it.
+#ifndef SPIRAL_ECONOMY_MV
+#define SPIRAL_ECONOMY_MV 3600
+#endif
+
+#ifndef SPIRAL_ECONOMY_HYSTERESIS_MV
+#define SPIRAL_ECONOMY_HYSTERESIS_MV 100
+#endif
+
+// Keep the last frame in RTC memory (see FrameCache.h), so wakes that would
+// draw the same face again do not render it.
+#ifndef SPIRAL_FRAME_CACHE
+#define SPIRAL_FRAME_CACHE 1
+#endif
+
+// On minute ticks send the panel only the windows of the frame that changed
+// since the cached one (see FrameDiff.h), at most this many, instead of the
+// whole screen; 0 leaves every refresh to Watchy.
+#ifndef SPIRAL_REFRESH_WINDOWS
+#define SPIRAL_REFRESH_WINDOWS 4
+#endif
+
+// Draw the face on this many of the ESP32's cores (1 or 2, see SecondCore.h).
+// Two split it into bands of rows, each core taking the next band left until
+// none are. Needs a second tile cache.
+#ifndef SPIRAL_RENDER_CORES
+#define SPIRAL_RENDER_CORES 1
+#endif
+
+// On minute ticks, look at the buttons before drawing, between the bands of
+// two cores and before the refresh, and on a press drop the frame and go to
+// sleep, so the press wakes the watch at once instead of after the frame and
+// its refresh.
+#ifndef SPIRAL_INTERRUPTIBLE
+#define SPIRAL_INTERRUPTIBLE 0
+#endif
+
+// While the panel refreshes on a minute tick, draw the face of the next tick
+// and keep it in the frame cache in place of the one shown (see FrameCache.h),
+// so the next tick sends it without drawing, unless the battery bucket
+// changed. A wake in between that has nothing to diff against refreshes the
+// whole panel instead, like the first tick does.
+#ifndef SPIRAL_PRERENDER
+#define SPIRAL_PRERENDER 0
+#endif
+
+// Pixels partial refreshes may flip before a minute tick gets a full refresh
+// to clear the ghosting (see RefreshScheduler.h). The turning spiral flips
+// about 4800 a minute, so this is a full refresh about every hour.
+#ifndef SPIRAL_GHOST_PIXELS
+#define SPIRAL_GHOST_PIXELS 300000
+#endif
+
+// Hour whose minute 0 tick always gets a full refresh, -1 for none
+#ifndef SPIRAL_FULL_REFRESH_HOUR
+#define SPIRAL_FULL_REFRESH_HOUR 3
+#endif
+
+// From SPIRAL_NIGHT_START up to the hour SPIRAL_NIGHT_END, wake for the face
+// only every this many minutes (10 or 15 are good) and show the time of the
+// last such tick; a button press brings back every minute for as long. 0
+// wakes every minute all day (see TickSchedule.h).
+#ifndef SPIRAL_NIGHT_MINUTES
+#define SPIRAL_NIGHT_MINUTES 0
+#endif
+
+#ifndef SPIRAL_NIGHT_START
+#define SPIRAL_NIGHT_START 23
+#endif
+
+#ifndef SPIRAL_NIGHT_END
+#define SPIRAL_NIGHT_END 7
+#endif
+
+// On an UP press on the watch face, sweep the spiral a whole turn round to
+// the time in this many frames with partial refreshes of what changed, before
+// the face itself; 0 for none. The frames are drawn the economy way (see
+// FaceRenderer::drawSpiralEconomy()), each while the panel shows the one
+// before.
+#ifndef SPIRAL_ANIMATION_FRAMES
+#define SPIRAL_ANIMATION_FRAMES 0
+#endif
+
+// Longest the sweep may take in milliseconds, it skips to the face after
+#ifndef SPIRAL_ANIMATION_MS
+#define SPIRAL_ANIMATION_MS 5000
+#endif
+
+// Fetch the weather settings.h asks for every WEATHER_UPDATE_INTERVAL minutes
+// on a minute tick, on a task on the other core while the face is drawn (see
+// WeatherSync.h), and set the RTC from NTP after it when SPIRAL_SYNC_NTP is
+// set. The face shows the temperature of the last fetch. Needs WiFi set up
+// from Watchy's menu. The tick waits up to SPIRAL_SYNC_TIMEOUT_MS for it
+// after the refresh, before deep sleep.
+#ifndef SPIRAL_WEATHER_SYNC
+#define SPIRAL_WEATHER_SYNC 0
+#endif
+
+#ifndef SPIRAL_SYNC_NTP
+#define SPIRAL_SYNC_NTP 1
+#endif
+
+#ifndef SPIRAL_SYNC_TIMEOUT_MS
+#define SPIRAL_SYNC_TIMEOUT_MS 15000
+#endif
+
+#if SPIRAL_REFRESH_WINDOWS && !SPIRAL_FRAME_CACHE
+#error "SPIRAL_REFRESH_WINDOWS diffs against the frame cache, enable SPIRAL_FRAME_CACHE"
+#endif
+
+#if SPIRAL_PRERENDER && !SPIRAL_REFRESH_WINDOWS
+#error "SPIRAL_PRERENDER keeps the windows of its frame for the next tick, enable SPIRAL_REFRESH_WINDOWS"
+#endif
+
+#if SPIRAL_PRERENDER && SPIRAL_ANIMATION_FRAMES
+#error "SPIRAL_PRERENDER leaves animateSpiral() no shown frame to sweep from, pick one"
+#endif
+
+#if SPIRAL_ANIMATION_FRAMES && !SPIRAL_REFRESH_WINDOWS
+#error "SPIRAL_ANIMATION_FRAMES refreshes the windows that changed, enable SPIRAL_REFRESH_WINDOWS"
+#endif
+
+#if SPIRAL_RENDER_CORES != 1 && SPIRAL_RENDER_CORES != 2
+#error "SPIRAL_RENDER_CORES is 1 or 2"
+#endif
+
+// CPU clock in MHz for drawing frames, and for the rest of a watch face wake:
+// sending frames to the panel and waiting for it. 240, 160 or 80 (below 80
+// the APB clock and with it the SPI clock drops too); 0 leaves the clock
+// alone. Compare the profiler's energy line across settings, a render bound
+// by flash reads may not gain from the highest clock.
+#ifndef SPIRAL_RENDER_MHZ
+#define SPIRAL_RENDER_MHZ 0
+#endif
+
+#ifndef SPIRAL_IDLE_MHZ
+#define SPIRAL_IDLE_MHZ 0
+#endif
+
+#if (SPIRAL_RENDER_MHZ != 0 && SPIRAL_RENDER_MHZ < 80) || (SPIRAL_IDLE_MHZ != 0 && SPIRAL_IDLE_MHZ < 80)
+#error "SPIRAL_RENDER_MHZ and SPIRAL_IDLE_MHZ go no lower than 80, where SPI still runs at full speed"
+#endif
+
+// Print the cycle counts of every frame to Serial (see Profiler.h).
+#ifndef SPIRAL_PROFILE
+#define SPIRAL_PROFILE 0
+#endif
+
+// Supply current of the ESP32 running, as a base plus so much per MHz of CPU
+// clock, and in light sleep, in microamps, for the energy per wake in the
+// profiler's report. Datasheet figures (50 mA at 240 MHz, 30 mA at 80 MHz),
+// the panel's own draw is not counted.
+#ifndef SPIRAL_ACTIVE_BASE_UA
+#define SPIRAL_ACTIVE_BASE_UA 20000
+#endif
+
+#ifndef SPIRAL_ACTIVE_UA_PER_MHZ
+#define SPIRAL_ACTIVE_UA_PER_MHZ 125
+#endif
+
+#ifndef SPIRAL_LIGHT_SLEEP_UA
+#define SPIRAL_LIGHT_SLEEP_UA 800
+#endif
+
+#if SPIRAL_IRAM_KERNELS
+#define HOT_KERNEL IRAM_ATTR
+#else
+#define HOT_KERNEL
+#endif
+
+#if SPIRAL_DRAM_TABLES
+#define HOT_TABLE DRAM_ATTR
+#else
+#define HOT_TABLE
+#endif
@@ -0,0 +1,21 @@
+#include "FaceGeometry.h"
+
+Vector EDGE_NORMAL[VECTOR_SIZE];
+
+float SCALE[VECTOR_SIZE * LOOP_COUNT];
+
+void initFaceGeometry()
+{
+  Vector up = {-1.0f, 0.0f};
+  
+  for (int i = 0; i < VECTOR_SIZE; i++)
+  {
+    EDGE_NORMAL[i] = Vector::rotateVector(up, i * STEP_ANGLE);
+    EDGE_NORMAL[i].normalize();
+  }
+
+  for (int i = 0; i < VECTOR_SIZE * LOOP_COUNT; i++)
+  {
+    SCALE[i] = pow(LOOP_SCALE, i / (float)VECTOR_SIZE);
+  }
+}
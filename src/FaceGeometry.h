@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Vector.h"
+
+// Geometry of the spiral face, shared by every engine that draws it and by
+// the host tools that bake it.
+
+const int DENSITY = 1;
+const int VECTOR_SIZE = 60 * DENSITY;
+const float STEP_ANGLE = 360 / VECTOR_SIZE;
+
+const int STEP_MINUTE = DENSITY;
+const int STEP_HOUR = VECTOR_SIZE/12;
+
+const Vector CENTER = {99.5f, 99.5f};
+const int RADIUS = 99;
+const int RIM_SIZE = 20;
+const int FACE_RADIUS = 260 - RIM_SIZE;
+
+const float BATTERY_MIN = 0.5f;
+const float BATTERY_RANGE = 1.0f - BATTERY_MIN;
+
+const float LOOP_SCALE = 0.45f;
+const int LOOP_COUNT = 4;
+
+const int HOUR_HAND_SIZE = 70;
+const int MINUTE_HAND_SIZE = 90;
+
+// Computed at startup by initFaceGeometry(), so already in DRAM
+extern Vector EDGE_NORMAL[VECTOR_SIZE];
+extern float SCALE[VECTOR_SIZE * LOOP_COUNT];
+
+void initFaceGeometry();
+
+// Rim thickness for a battery fill in [0, 1]
+inline float rimSizeForFill(float batteryFill)
+{
+  return RIM_SIZE * (BATTERY_MIN + BATTERY_RANGE * batteryFill);
+}
+
+// Which of steps evenly spaced hour hand positions shows hour:minute
+inline int hourHandStep(int hour, int minute, int steps)
+{
+  return ((hour % 12) * 60 + minute) * steps / (12 * 60);
+}
+
+// Nearest of buckets evenly spaced battery fills, and back
+inline int batteryBucket(float batteryFill, int buckets)
+{
+  if (buckets < 2)
+    return 0;
+
+  return (int)(batteryFill * (buckets - 1) + 0.5f);
+}
+
+inline float bucketFill(int bucket, int buckets)
+{
+  return buckets < 2 ? 1.0f : bucket / (float)(buckets - 1);
+}
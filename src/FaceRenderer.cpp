@@ -0,0 +1,554 @@
+#include "FaceRenderer.h"
+#include "AssetIndex.h"
+#include "FaceGeometry.h"
+#include "Profiler.h"
+#include "Rasterizer.h"
+
+#include <string.h>
+
+const Vector SHADOW_CORNER_1 = {66.0f,66.0f};
+const Vector SHADOR_CORNER_2 = {133.0f,66.0f};
+const Vector SHADOR_CORNER_3 = {133.0f,133.0f};
+const Vector SHADOR_CORNER_4 = {66.0f,133.0f};
+
+HOT_TABLE const Vector HAND[] =
+{{0.0f, -1.0f},
+ {0.0f, -0.8f}, 
+ {0.1f, -0.8f},
+{0.0f, 0.0f},
+ {0.05f, 0.15f},
+{-0.05f, 0.15f},
+ {-0.1f, -0.8f}};
+
+HOT_TABLE const Vector HAND_NORMAL[] =
+{{0.5f, -0.85f}, {0.2f, -0.2f}, {0.85f, -0.5f},
+{0.3f, -0.1f}, {0.96f, -0.1f}, {0.3f, 0.1f}, {0.96f, 0.1f},
+{0.0f, 0.3f}, {0.1f, 0.96f}, {-0.1f, 0.96f},
+{-0.3f, -0.1f}, {-0.96f, -0.1f}, {-0.3f, 0.1f}, {-0.96f, 0.1f},
+{-0.5f, -0.85f}, {-0.2f, -0.2f}, {-0.85f, -0.5f}};
+
+HOT_TABLE const int HAND_POS_INDEX[] = 
+{0,1,2,
+1,2,3,
+2,3,4,
+3,4,5,
+3,5,6,
+3,6,1,
+6,1,0};
+
+const int HAND_POS_LEN = 7;
+
+HOT_TABLE const int HAND_NORMAL_INDEX[] = 
+{0,1,2,
+3,4,5,
+4,5,6,
+7,8,9,
+10,11,13,
+10,13,12,
+14,15,16};
+
+HOT_TABLE const int HAND_OUTLINE_INDEX[] = {0,2,4,5,6};
+
+const int HAND_OUTLINE_LEN = 5;
+
+// Economy profile: every other spiral segment, in two flat shades
+const int ECONOMY_STEP = 2;
+const uint8_t ECONOMY_FACE_SHADE = 212;
+const uint8_t ECONOMY_RIM_SHADE = 108;
+
+// 4x4 Bayer matrix scaled to texel thresholds
+HOT_TABLE const uint8_t BAYER_4X4[4][4] =
+{{  8, 136,  40, 168},
+ {200,  72, 232, 104},
+ { 56, 184,  24, 152},
+ {248, 120, 216,  88}};
+
+// Texels dithered against the blue noise into the frame, lines black
+struct DitherPlot
+{
+  FrameBuffer &frame;
+  DitherNoise &noise;
+  TextureSampler &sampler;
+  const Texture *texture;
+  ClipRect clip;
+
+  void bind(VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2)
+  {
+    sampler.bind(*texture, v0, uv0, v1, uv1, v2, uv2);
+  }
+
+  void pixel(int16_t x, int16_t y, int16_t u, int16_t v)
+  {
+    frame.setPixel(x, y, sampler.sample(u, v) > noise.row(y)[x]);
+  }
+
+  void solid(int16_t x, int16_t y)
+  {
+    frame.setPixel(x, y, false);
+  }
+};
+
+// Only the pixels that dither black are drawn, the rest keep what is under
+// them
+struct MaskPlot
+{
+  FrameBuffer &frame;
+  DitherNoise &noise;
+  const uint8_t *texels;
+  ClipRect clip;
+
+  void bind(VectorInt, Vector, VectorInt, Vector, VectorInt, Vector) {}
+
+  void pixel(int16_t x, int16_t y, int16_t u, int16_t v)
+  {
+    if (!(texels[v * SCREEN_WIDTH + u] > noise.row(y)[x]))
+      frame.setPixel(x, y, false);
+  }
+
+  void solid(int16_t x, int16_t y)
+  {
+    frame.setPixel(x, y, false);
+  }
+};
+
+// Flat shades about the means of the face and matcap textures, dithered with
+// an ordered matrix: no texel or noise reads
+struct FlatPlot
+{
+  FrameBuffer &frame;
+  const Texture *face;
+  const Texture *texture;
+  uint8_t shade;
+  ClipRect clip;
+
+  void bind(VectorInt, Vector, VectorInt, Vector, VectorInt, Vector)
+  {
+    shade = texture == face ? ECONOMY_FACE_SHADE : ECONOMY_RIM_SHADE;
+  }
+
+  void pixel(int16_t x, int16_t y, int16_t, int16_t)
+  {
+    frame.setPixel(x, y, shade > BAYER_4X4[y & 3][x & 3]);
+  }
+
+  void solid(int16_t x, int16_t y)
+  {
+    frame.setPixel(x, y, false);
+  }
+};
+
+// What covers every pixel, for the RotozoomEngine map
+struct MapPlot
+{
+  uint8_t *map;
+  int16_t width;
+  TextureSampler &sampler;
+  const Texture *texture;
+  const Texture *face;
+  ClipRect clip;
+
+  void bind(VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2)
+  {
+    sampler.bind(*texture, v0, uv0, v1, uv1, v2, uv2);
+  }
+
+  void pixel(int16_t x, int16_t y, int16_t u, int16_t v)
+  {
+    uint8_t *texel = map + (y * width + x) * RotozoomEngine::MAP_TEXEL_BYTES;
+
+    // Texel coordinates are truncated, so texel u is centred on u + 0.5
+    texel[0] = (uint8_t)(int8_t)(u - (int)CENTER.x);
+    texel[1] = (uint8_t)(int8_t)(v - (int)CENTER.y);
+    texel[2] = texture == face ? SPIRAL_MAP_FACE + sampler.level() : SPIRAL_MAP_RIM;
+  }
+
+  void solid(int16_t x, int16_t y)
+  {
+    map[(y * width + x) * RotozoomEngine::MAP_TEXEL_BYTES + 2] = SPIRAL_MAP_LINE;
+  }
+};
+
+void FaceRenderer::load(const AssetPack &pack)
+{
+  const TextureDesc *faceTiled = nullptr;
+  const TextureDesc *matCapTiled = nullptr;
+  const TextureDesc *faceMips = nullptr;
+  int faceMipCount = 0;
+
+#if SPIRAL_TEXTURE_CACHE
+  static_assert(ASSET_TILE_SIZE == TextureCache::TILE_SIZE, "tiled textures must match the cache tile size");
+
+  faceTiled = &Assets::SpiralFaceWithShadow_tiled;
+  matCapTiled = &Assets::MatCapSource_tiled;
+#endif
+
+#if SPIRAL_FACE_MIPS
+  faceMips = Assets::SpiralFaceWithShadow_mips;
+  faceMipCount = Assets::SpiralFaceWithShadow_mipCount;
+#endif
+
+  face.load(pack, Assets::SpiralFaceWithShadow, faceTiled, faceMips, faceMipCount);
+  matCap.load(pack, Assets::MatCapSource, matCapTiled);
+  shadowCenter = pack.data(Assets::SpiralFaceShadowCenter);
+
+  noise.attach(pack.data(Assets::BlueNoise200));
+}
+
+// Where segment i of the spiral, drawn with every step-th segment, has its
+// corners: v1 and v2 on the inner edge of the rim, v4 and v6 on the outer
+struct SpiralSegment
+{
+  int index;
+  int nextIndex;
+  float scale1;
+  float scale2;
+  Vector v1;
+  Vector v2;
+  Vector v4;
+  Vector v6;
+};
+
+static SpiralSegment spiralSegment(Vector center, int minute, float rimSize, int i, int step)
+{
+  SpiralSegment s;
+
+  s.index = i % VECTOR_SIZE;
+  s.nextIndex = (i + step) % VECTOR_SIZE;
+
+  int scaleIndex = i - minute;
+  int scaleNextIndex = scaleIndex + step;
+
+  float currentLoopSCale = SCALE[scaleIndex];
+  float nextLoopScale = SCALE[scaleNextIndex];
+
+  s.scale1 = FACE_RADIUS * currentLoopSCale;
+  s.scale2 = FACE_RADIUS * nextLoopScale;
+  s.v1 = EDGE_NORMAL[s.index] * s.scale1 + center;
+  s.v2 = EDGE_NORMAL[s.nextIndex] * s.scale2 + center;
+  s.v4 = EDGE_NORMAL[s.index] * (s.scale1 + rimSize * currentLoopSCale) + center;
+  s.v6 = EDGE_NORMAL[s.nextIndex] * (s.scale2 + rimSize * nextLoopScale) + center;
+
+  return s;
+}
+
+template <class Plot>
+void FaceRenderer::walkSpiral(Plot &plot, Vector center, int minute, float rimSize, int step)
+{
+  for (int i = minute; i < VECTOR_SIZE * 3 + minute; i += step)
+  {
+    SpiralSegment s = spiralSegment(center, minute, rimSize, i, step);
+
+    Vector uv1 = EDGE_NORMAL[s.index] * RADIUS + CENTER;
+    Vector uv2 = EDGE_NORMAL[s.nextIndex] * RADIUS + CENTER;
+
+    float scale3 = s.scale1 * LOOP_SCALE;
+    Vector v1a = EDGE_NORMAL[s.index] * scale3 + center;
+    Vector uv1a = EDGE_NORMAL[s.index] * RADIUS * LOOP_SCALE + CENTER;
+
+    float scale4 = s.scale2 * LOOP_SCALE;
+    Vector v2a = EDGE_NORMAL[s.nextIndex] * scale4 + center;
+    Vector uv2a = EDGE_NORMAL[s.nextIndex] * RADIUS * LOOP_SCALE + CENTER;
+
+    plot.texture = &face;
+    Rasterizer::fillTriangle(plot, v1a, uv1a, s.v1, uv1, s.v2, uv2);
+    Rasterizer::fillTriangle(plot, v2a, uv2a, v1a, uv1a, s.v2, uv2);
+
+    Vector uv3 = EDGE_NORMAL[s.index] * -RADIUS + CENTER;
+    Vector uv4 = EDGE_NORMAL[s.index] * RADIUS + CENTER;
+    Vector uv5 = EDGE_NORMAL[s.nextIndex] * -RADIUS + CENTER;
+    Vector uv6 = EDGE_NORMAL[s.nextIndex] * RADIUS + CENTER;
+
+    plot.texture = &matCap;
+    Rasterizer::fillTriangle(plot, s.v1, uv3, s.v4, uv4, s.v2, uv5);
+    Rasterizer::fillTriangle(plot, s.v4, uv4, s.v2, uv5, s.v6, uv6);
+
+    Rasterizer::drawLine(plot, s.v1.x, s.v1.y, s.v2.x, s.v2.y);
+    Rasterizer::drawLine(plot, s.v4.x, s.v4.y, s.v6.x, s.v6.y);
+  }
+
+  // SCALE ends with the last loop, which only gets its outline
+  for (int i = VECTOR_SIZE * 3 + minute; i + step < VECTOR_SIZE * 4 + minute; i += step)
+  {
+    SpiralSegment s = spiralSegment(center, minute, rimSize, i, step);
+
+    Rasterizer::drawTriangle(plot, s.v1.x, s.v1.y, s.v4.x, s.v4.y, s.v2.x, s.v2.y);
+    Rasterizer::drawTriangle(plot, s.v4.x, s.v4.y, s.v2.x, s.v2.y, s.v6.x, s.v6.y);
+  }
+}
+
+void FaceRenderer::drawBackground(FrameBuffer &frame, int minute, float batteryFill)
+{
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_BAKED
+  const uint8_t *frames = spiralFrames[batteryBucket(batteryFill, SPIRAL_BATTERY_BUCKETS)];
+
+  // Without baked frames fall back to the triangles
+  if (frames != nullptr)
+  {
+    const uint8_t *minuteFrame = frames + (minute % VECTOR_SIZE) * FrameBuffer::BYTES;
+    int offset = clip.left / 8;
+    int bytes = clip.right / 8 - offset;
+
+    for (int y = clip.top; y < clip.bottom; y++)
+    {
+      int row = y * FrameBuffer::STRIDE + offset;
+      memcpy(frame.pixels + row, minuteFrame + row, bytes);
+    }
+
+    profiler.lap(PROFILE_SPIRAL);
+    return;
+  }
+#endif
+
+  if (economy)
+  {
+    drawSpiralEconomy(frame, minute, batteryFill);
+    profiler.lap(PROFILE_SPIRAL);
+    return;
+  }
+
+  drawSpiral(frame, minute, batteryFill);
+
+  profiler.lap(PROFILE_SPIRAL);
+
+#if SPIRAL_OVERLAY_SPRITES
+  // Without baked overlays fall back to the triangles
+  if (overlays[0] != nullptr)
+  {
+    drawOverlays(frame);
+    profiler.lap(PROFILE_SHADOW);
+    return;
+  }
+#endif
+
+  drawShadow(frame);
+
+  profiler.lap(PROFILE_SHADOW);
+}
+
+void FaceRenderer::drawOverlays(FrameBuffer &frame)
+{
+#if SPIRAL_OVERLAY_SPRITES
+  for (int i = 0; i < MAX_OVERLAYS; i++)
+  {
+    if (overlays[i] != nullptr)
+      drawSprite(frame, overlays[i], clip.top, clip.bottom, clip.left, clip.right);
+  }
+#else
+  (void)frame;
+#endif
+}
+
+void FaceRenderer::drawSpiral(FrameBuffer &frame, int minute, float batteryFill)
+{
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_ROTOZOOM
+  const uint8_t *map = spiralMap[batteryBucket(batteryFill, SPIRAL_BATTERY_BUCKETS)];
+
+  // Without a baked map fall back to the triangles
+  if (map != nullptr)
+  {
+    rotozoom.draw(frame, map, minute, face, matCap, noise, clip.top, clip.bottom, clip.left, clip.right);
+    return;
+  }
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_POLAR
+  // Without a baked table fall back to the triangles
+  if (spiralLut != nullptr)
+  {
+    polar.draw(frame, spiralLut, minute, rimSizeForFill(batteryFill), face, matCap, noise, clip.top, clip.bottom,
+               clip.left, clip.right);
+    return;
+  }
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_ANALYTIC
+  polar.drawAnalytic(frame, minute, rimSizeForFill(batteryFill), face, matCap, noise, clip.top, clip.bottom,
+                     clip.left, clip.right);
+#else
+  drawSpiralTriangles(frame, minute, batteryFill);
+#endif
+}
+
+void FaceRenderer::drawSpiralTriangles(FrameBuffer &frame, int minute, float batteryFill)
+{
+  DitherPlot plot = {frame, noise, sampler, &face, clip};
+  walkSpiral(plot, CENTER, minute, rimSizeForFill(batteryFill));
+}
+
+void FaceRenderer::drawSpiralEconomy(FrameBuffer &frame, int minute, float batteryFill)
+{
+  FlatPlot plot = {frame, &face, &face, 0, clip};
+  walkSpiral(plot, CENTER, minute, rimSizeForFill(batteryFill), ECONOMY_STEP);
+}
+
+void FaceRenderer::drawSpiralMap(uint8_t *map, int16_t width, int16_t height, Vector center, float rimSize)
+{
+  MapPlot plot = {map, width, sampler, &face, &face, {0, 0, width, height}};
+  walkSpiral(plot, center, 0, rimSize);
+}
+
+void FaceRenderer::drawShadow(FrameBuffer &frame)
+{
+  MaskPlot plot = {frame, noise, shadowCenter, clip};
+
+  Rasterizer::fillTriangle(plot, SHADOW_CORNER_1, SHADOW_CORNER_1, SHADOR_CORNER_2, SHADOR_CORNER_2, SHADOR_CORNER_3, SHADOR_CORNER_3);
+  Rasterizer::fillTriangle(plot, SHADOR_CORNER_3, SHADOR_CORNER_3, SHADOR_CORNER_4, SHADOR_CORNER_4, SHADOW_CORNER_1, SHADOW_CORNER_1);
+}
+
+void FaceRenderer::drawHand(FrameBuffer &frame, float angle, float size)
+{
+  DitherPlot plot = {frame, noise, sampler, &matCap, clip};
+
+  float radians = angle * DEG_TO_RAD;
+  float sinAngle = sin(radians);
+  float cosAngle = cos(radians);
+
+  for (int i = 0; i < HAND_POS_LEN; i++)
+  {
+    Vector v1 = Vector::rotateVector(HAND[HAND_POS_INDEX[i * 3]], sinAngle, cosAngle) * size + CENTER;
+    Vector v2 = Vector::rotateVector(HAND[HAND_POS_INDEX[i * 3 + 1]], sinAngle, cosAngle) * size + CENTER;
+    Vector v3 = Vector::rotateVector(HAND[HAND_POS_INDEX[i * 3 + 2]], sinAngle, cosAngle) * size + CENTER;
+
+    Vector uv1 = Vector::rotateVector(HAND_NORMAL[HAND_NORMAL_INDEX[i * 3]], sinAngle, cosAngle) * 99 + CENTER;
+    Vector uv2 = Vector::rotateVector(HAND_NORMAL[HAND_NORMAL_INDEX[i * 3 + 1]], sinAngle, cosAngle) * 99 + CENTER;
+    Vector uv3 = Vector::rotateVector(HAND_NORMAL[HAND_NORMAL_INDEX[i * 3 + 2]], sinAngle, cosAngle) * 99 + CENTER;
+
+    Rasterizer::fillTriangle(plot, v1, uv1, v2, uv2, v3, uv3);
+  }
+
+  Vector currentPoint = Vector::rotateVector(HAND[HAND_OUTLINE_INDEX[0]], sinAngle, cosAngle) * size + CENTER;
+
+  for (int i = 0; i < HAND_OUTLINE_LEN; i++)
+  {
+    Vector nextPoint = Vector::rotateVector(HAND[HAND_OUTLINE_INDEX[(i + 1) % HAND_OUTLINE_LEN]], sinAngle, cosAngle) * size + CENTER;
+
+    Rasterizer::drawLine(plot, currentPoint.x, currentPoint.y, nextPoint.x, nextPoint.y);
+
+    currentPoint = nextPoint;
+  }
+}
+
+#if SPIRAL_HAND_SPRITES
+// Where a sprite is drawn
+static ClipRect spriteBounds(const uint8_t *sprite)
+{
+  const SpriteHeader *header = (const SpriteHeader *)sprite;
+
+  return {(int16_t)(header->column * 8), header->top, (int16_t)((header->column + header->bytes) * 8),
+          (int16_t)(header->top + header->rows)};
+}
+#endif
+
+// Where drawHand() draws, with a pixel to spare for rounding
+static ClipRect handBounds(float angle, float size)
+{
+  float radians = angle * DEG_TO_RAD;
+  float sinAngle = sin(radians);
+  float cosAngle = cos(radians);
+  Vector low = CENTER;
+  Vector high = CENTER;
+
+  for (int i = 0; i < HAND_POS_LEN; i++)
+  {
+    Vector v = Vector::rotateVector(HAND[i], sinAngle, cosAngle) * size + CENTER;
+
+    low = {fminf(low.x, v.x), fminf(low.y, v.y)};
+    high = {fmaxf(high.x, v.x), fmaxf(high.y, v.y)};
+  }
+
+  return clipToScreen({(int16_t)(floorf(low.x) - 1), (int16_t)(floorf(low.y) - 1), (int16_t)(ceilf(high.x) + 2),
+                       (int16_t)(ceilf(high.y) + 2)});
+}
+
+ClipRect FaceRenderer::handBounds(int hour, int minute) const
+{
+#if SPIRAL_HAND_SPRITES
+  int step = hourHandStep(hour, minute, SPIRAL_HOUR_HAND_STEPS);
+
+  if (hourHandSprites[step] != nullptr && minuteHandSprites[minute] != nullptr)
+    return unionClip(spriteBounds(hourHandSprites[step]), spriteBounds(minuteHandSprites[minute]));
+
+  float hourAngle = step * 360.0f / SPIRAL_HOUR_HAND_STEPS;
+#else
+  float hourAngle = ((hour % 12) + minute / 60.0f) * 30;
+#endif
+
+  return unionClip(::handBounds(hourAngle, HOUR_HAND_SIZE), ::handBounds(minute * STEP_ANGLE, MINUTE_HAND_SIZE));
+}
+
+// Digits, a minus and a degree sign of 3 x 5 pixels, the top row in the high
+// bits and the leftmost pixel of a row in its high bit
+static const uint16_t TEMPERATURE_GLYPHS[] =
+{
+  0x7B6F, 0x2C97, 0x73E7, 0x73CF, 0x5BC9, 0x79CF, 0x79EF, 0x7249, 0x7BEF, 0x7BCF, 0x01C0, 0x7BC0,
+};
+
+const int GLYPH_MINUS = 10;
+const int GLYPH_DEGREE = 11;
+const int GLYPH_SCALE = 2;
+
+void FaceRenderer::drawTemperature(FrameBuffer &frame)
+{
+  if (temperature == NO_TEMPERATURE)
+    return;
+
+  ClipRect box = intersectClip(clip, TEMPERATURE_BOUNDS);
+
+  if (box.left >= box.right || box.top >= box.bottom)
+    return;
+
+  for (int y = box.top; y < box.bottom; y++)
+    memset(frame.pixels + y * FrameBuffer::STRIDE + box.left / 8, 0xFF, (box.right - box.left) / 8);
+
+  int glyphs[4];
+  int count = 0;
+  int degrees = temperature < 0 ? -temperature : temperature;
+
+  if (temperature < 0)
+    glyphs[count++] = GLYPH_MINUS;
+
+  if (degrees >= 10)
+    glyphs[count++] = degrees / 10 % 10;
+
+  glyphs[count++] = degrees % 10;
+  glyphs[count++] = GLYPH_DEGREE;
+
+  int16_t left = TEMPERATURE_BOUNDS.left + 2;
+  int16_t top = TEMPERATURE_BOUNDS.top + 3;
+
+  for (int i = 0; i < count; i++, left += 4 * GLYPH_SCALE)
+  {
+    for (int16_t y = top; y < top + 5 * GLYPH_SCALE; y++)
+    {
+      for (int16_t x = left; x < left + 3 * GLYPH_SCALE; x++)
+      {
+        int bit = 14 - (y - top) / GLYPH_SCALE * 3 - (x - left) / GLYPH_SCALE;
+
+        if (x >= box.left && x < box.right && y >= box.top && y < box.bottom &&
+            (TEMPERATURE_GLYPHS[glyphs[i]] & (1 << bit)))
+          frame.setPixel(x, y, false);
+      }
+    }
+  }
+}
+
+void FaceRenderer::drawHands(FrameBuffer &frame, int hour, int minute)
+{
+#if SPIRAL_HAND_SPRITES
+  int step = hourHandStep(hour, minute, SPIRAL_HOUR_HAND_STEPS);
+
+  // Without baked sprites fall back to the triangles, at the same angles
+  if (hourHandSprites[step] != nullptr && minuteHandSprites[minute] != nullptr)
+  {
+    drawSprite(frame, hourHandSprites[step], clip.top, clip.bottom, clip.left, clip.right);
+    drawSprite(frame, minuteHandSprites[minute], clip.top, clip.bottom, clip.left, clip.right);
+    return;
+  }
+
+  drawHand(frame, step * 360.0f / SPIRAL_HOUR_HAND_STEPS, HOUR_HAND_SIZE);
+#else
+  drawHand(frame, ((hour % 12) + minute / 60.0f) * 30, HOUR_HAND_SIZE);
+#endif
+
+  drawHand(frame, minute * STEP_ANGLE, MINUTE_HAND_SIZE);
+}
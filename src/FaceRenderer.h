@@ -0,0 +1,155 @@
+#pragma once
+
+#include <stdint.h>
+#include "AssetPack.h"
+#include "Dither.h"
+#include "FaceConfig.h"
+#include "FrameBuffer.h"
+#include "PolarEngine.h"
+#include "Rasterizer.h"
+#include "RotozoomEngine.h"
+#include "Sprite.h"
+#include "Texture.h"
+#include "Vector.h"
+
+// The white box in the bottom left corner drawTemperature() draws into, whole
+// bytes wide
+const ClipRect TEMPERATURE_BOUNDS = {0, SCREEN_HEIGHT - 16, 40, SCREEN_HEIGHT};
+
+// Draws the face into a FrameBuffer. It does not touch the display, so the
+// same code runs on the watch and in the host tools that bake the face.
+class FaceRenderer
+{
+public:
+  // Points the textures into an open pack matching AssetIndex.h
+  void load(const AssetPack &pack);
+
+  // Limits every draw call below to clip, whose left and right are multiples
+  // of 8 (the sprites and the spiral engines draw whole bytes), so a frame can
+  // be drawn band by band or only part of it redrawn; the whole screen until
+  // changed
+  void setClip(const ClipRect &clip) { this->clip = clip; }
+  void setBand(int16_t top, int16_t bottom) { clip = {0, top, SCREEN_WIDTH, bottom}; }
+
+#if SPIRAL_TEXTURE_CACHE
+  // Renderers drawing at the same time need a tile cache each
+  void setTextureCache(TextureCache *cache) { sampler.setCache(cache); }
+#endif
+
+  // drawBackground() draws only drawSpiralEconomy() while set
+  void setEconomy(bool economy) { this->economy = economy; }
+
+  // Whole degrees drawTemperature() shows, -99 to 99, or NO_TEMPERATURE
+  static const int NO_TEMPERATURE = -128;
+
+  void setTemperature(int degrees) { temperature = degrees; }
+
+  // Everything under the hands: the spiral, then the shadow in its centre
+  void drawBackground(FrameBuffer &frame, int minute, float batteryFill);
+
+  void drawSpiral(FrameBuffer &frame, int minute, float batteryFill);
+
+  // The spiral as SPIRAL_ENGINE_TRIANGLES draws it, whatever the engine, to
+  // compare the other engines against
+  void drawSpiralTriangles(FrameBuffer &frame, int minute, float batteryFill);
+
+  // Every other segment of the spiral in flat shades, and no shadow, for a
+  // low battery
+  void drawSpiralEconomy(FrameBuffer &frame, int minute, float batteryFill);
+
+  void drawShadow(FrameBuffer &frame);
+
+  // The overlays that are set, in order
+  void drawOverlays(FrameBuffer &frame);
+  void drawHand(FrameBuffer &frame, float angle, float size);
+
+  // Both hands for the time, from the sprites when they are set
+  void drawHands(FrameBuffer &frame, int hour, int minute);
+
+  // The temperature set in TEMPERATURE_BOUNDS, in digits of 3 x 5 pixels
+  // scaled up twice; nothing without one
+  void drawTemperature(FrameBuffer &frame);
+
+  // Covers every pixel drawHands() draws for the time
+  ClipRect handBounds(int hour, int minute) const;
+
+  // What covers every texel of the minute 0 spiral, in the RotozoomEngine
+  // map format, into a width x height map with CENTER moved to center.
+  // Texels the spiral does not cover are left alone.
+  void drawSpiralMap(uint8_t *map, int16_t width, int16_t height, Vector center, float rimSize);
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_ROTOZOOM
+  // Baked drawSpiralMap() for a battery bucket
+  void setSpiralMap(int bucket, const uint8_t *map) { spiralMap[bucket] = map; }
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_POLAR
+  // Baked PolarEngine::bakeLut()
+  void setSpiralLut(const PolarTexel *lut) { spiralLut = lut; }
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_BAKED
+  // Baked drawBackground() frames of every minute for a battery bucket, one
+  // after the other
+  void setSpiralFrames(int bucket, const uint8_t *frames) { spiralFrames[bucket] = frames; }
+#endif
+
+#if SPIRAL_HAND_SPRITES
+  // Baked drawHand() sprites of the minute hand at every minute and of the
+  // hour hand at every hourHandStep()
+  void setMinuteHandSprite(int minute, const uint8_t *sprite) { minuteHandSprites[minute] = sprite; }
+  void setHourHandSprite(int step, const uint8_t *sprite) { hourHandSprites[step] = sprite; }
+#endif
+
+#if SPIRAL_OVERLAY_SPRITES
+  // Baked sprites of static decorations drawn over the spiral: whatever a
+  // draw call (drawShadow()) puts on the screen, the same every frame. With
+  // none set drawBackground() rasterizes the shadow.
+  static const int MAX_OVERLAYS = 4;
+
+  void setOverlay(int index, const uint8_t *sprite) { overlays[index] = sprite; }
+#endif
+
+private:
+  // Every step-th segment of the spiral: its faces and rims, then the lines
+  // between them
+  template <class Plot>
+  void walkSpiral(Plot &plot, Vector center, int minute, float rimSize, int step = 1);
+
+  ClipRect clip = SCREEN_CLIP;
+  bool economy = false;
+  int temperature = NO_TEMPERATURE;
+
+  Texture face;
+  Texture matCap;
+  const uint8_t *shadowCenter = nullptr;
+
+  DitherNoise noise;
+  TextureSampler sampler;
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_ROTOZOOM
+  RotozoomEngine rotozoom;
+  const uint8_t *spiralMap[SPIRAL_BATTERY_BUCKETS] = {};
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_POLAR || SPIRAL_ENGINE == SPIRAL_ENGINE_ANALYTIC
+  PolarEngine polar;
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_POLAR
+  const PolarTexel *spiralLut = nullptr;
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_BAKED
+  const uint8_t *spiralFrames[SPIRAL_BATTERY_BUCKETS] = {};
+#endif
+
+#if SPIRAL_OVERLAY_SPRITES
+  const uint8_t *overlays[MAX_OVERLAYS] = {};
+#endif
+
+#if SPIRAL_HAND_SPRITES
+  const uint8_t *minuteHandSprites[VECTOR_SIZE] = {};
+  const uint8_t *hourHandSprites[SPIRAL_HOUR_HAND_STEPS] = {};
+#endif
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Cheap approximations for per-pixel shading, where libm's atan2f/log2f/sqrtf
+// would cost more than everything else together. The error bounds are
+// measured over the whole screen's range (tools/host/bench.cpp checks them).
+
+// Angle of (x, y) like atan2f, in radians. Octant reduction and a cubic for
+// atan on [0, 1]; absolute error below 0.0050 rad (0.29 degrees).
+inline float fastAtan2(float y, float x)
+{
+  const float HALF_PI = 1.57079633f;
+  const float PI = 3.14159265f;
+
+  float ax = x < 0.0f ? -x : x;
+  float ay = y < 0.0f ? -y : y;
+
+  if (ax == 0.0f && ay == 0.0f)
+    return 0.0f;
+
+  float angle;
+
+  if (ax > ay)
+  {
+    float z = ay / ax;
+    angle = z * (0.97239411f - 0.19194795f * z * z);
+  }
+  else
+  {
+    float z = ax / ay;
+    angle = HALF_PI - z * (0.97239411f - 0.19194795f * z * z);
+  }
+
+  if (x < 0.0f)
+    angle = PI - angle;
+
+  return y < 0.0f ? -angle : angle;
+}
+
+// log2 of a positive, normal x. The exponent comes straight from the float's
+// bits, the mantissa goes through a cubic; absolute error below 0.00064.
+inline float fastLog2(float x)
+{
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+
+  float exponent = (float)(int)((bits >> 23) & 0xFF) - 127.0f;
+
+  bits = (bits & 0x007FFFFF) | 0x3F800000;
+
+  float m;
+  memcpy(&m, &bits, sizeof(m));
+
+  return exponent + ((0.158251025f * m - 1.051887613f) * m + 3.047905888f) * m - 2.153632702f;
+}
+
+// 1 / sqrt(x) for a positive, normal x, the bit trick plus one Newton step;
+// relative error below 0.18%.
+inline float fastInvSqrt(float x)
+{
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+
+  bits = 0x5F3759DF - (bits >> 1);
+
+  float y;
+  memcpy(&y, &bits, sizeof(y));
+
+  return y * (1.5f - 0.5f * x * y * y);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+const int SCREEN_WIDTH = 200;
+const int SCREEN_HEIGHT = 200;
+
+// 1 bit per pixel frame in the layout GxEPD2 keeps its own buffer in: rows of
+// SCREEN_WIDTH / 8 bytes, leftmost pixel in the most significant bit, a set
+// bit is white.
+struct FrameBuffer
+{
+  static const int STRIDE = SCREEN_WIDTH / 8;
+  static const int BYTES = STRIDE * SCREEN_HEIGHT;
+
+  uint8_t pixels[BYTES];
+
+  void fill(bool white)
+  {
+    memset(pixels, white ? 0xFF : 0x00, BYTES);
+  }
+
+  void setPixel(int16_t x, int16_t y, bool white)
+  {
+    uint8_t &byte = pixels[y * STRIDE + (x >> 3)];
+    uint8_t mask = 0x80 >> (x & 7);
+
+    if (white)
+      byte |= mask;
+    else
+      byte &= ~mask;
+  }
+
+  bool getPixel(int16_t x, int16_t y) const
+  {
+    return pixels[y * STRIDE + (x >> 3)] & (0x80 >> (x & 7));
+  }
+};
@@ -0,0 +1,167 @@
+#include "FrameCache.h"
+#include "AssetIndex.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <rom/crc.h>
+#endif
+
+// Bump when FrameCacheEntry changes
+const uint16_t FRAME_CACHE_VERSION = 4;
+
+const int AHEAD_WINDOWS = SPIRAL_REFRESH_WINDOWS > 0 ? SPIRAL_REFRESH_WINDOWS : 1;
+
+struct FrameCacheEntry
+{
+  uint16_t version;
+  FrameKey key;
+  uint8_t ahead;       // the frame is drawn for the next tick, not shown
+  uint8_t windowCount; // of the frame drawn ahead
+  uint16_t flipped;
+  uint16_t reserved;
+  uint32_t configHash;
+  FrameWindow windows[AHEAD_WINDOWS];
+  uint32_t crc; // over everything but itself
+  FrameBuffer frame;
+};
+
+static RTC_DATA_ATTR FrameCacheEntry entry;
+
+FrameCache frameCache;
+
+static uint32_t crc32(const uint8_t *data, size_t size, uint32_t crc)
+{
+#ifdef ARDUINO
+  return crc32_le(crc, data, size);
+#else
+  // Same CRC-32 as the ROM's crc32_le()
+  crc = ~crc;
+
+  for (size_t i = 0; i < size; i++)
+  {
+    crc ^= data[i];
+
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+
+  return ~crc;
+#endif
+}
+
+static uint32_t entryCrc(const FrameCacheEntry &e)
+{
+  uint32_t crc = crc32((const uint8_t *)&e, offsetof(FrameCacheEntry, crc), 0);
+  return crc32(e.frame.pixels, FrameBuffer::BYTES, crc);
+}
+
+// FNV-1a over everything besides the key that changes what is rendered
+static uint32_t configHash()
+{
+  const uint32_t config[] =
+  {
+    ASSET_PACK_CHECKSUM,
+    SPIRAL_ENGINE,
+    SPIRAL_BATTERY_BUCKETS,
+    SPIRAL_FACE_MIPS,
+    SPIRAL_HAND_SPRITES,
+    SPIRAL_HOUR_HAND_STEPS,
+    SPIRAL_OVERLAY_SPRITES,
+  };
+
+  const uint8_t *bytes = (const uint8_t *)config;
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < sizeof(config); i++)
+  {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+static bool sameKey(const FrameKey &a, const FrameKey &b)
+{
+  return a.minute == b.minute && a.hour == b.hour && a.bucket == b.bucket && a.economy == b.economy &&
+         a.temperature == b.temperature;
+}
+
+static bool valid(const FrameCacheEntry &e)
+{
+  return e.version == FRAME_CACHE_VERSION && e.configHash == configHash() && e.crc == entryCrc(e);
+}
+
+static bool loadEntry(const FrameCacheEntry &e, const FrameKey &key, bool ahead, FrameBuffer &frame)
+{
+  if (e.ahead != ahead || !sameKey(e.key, key) || !valid(e))
+    return false;
+
+  memcpy(frame.pixels, e.frame.pixels, FrameBuffer::BYTES);
+  return true;
+}
+
+static void storeEntry(FrameCacheEntry &e, const FrameKey &key, const FrameBuffer &frame, const FrameWindow *windows,
+                       int count, int flipped)
+{
+  e.version = FRAME_CACHE_VERSION;
+  e.key = key;
+  e.ahead = windows != nullptr;
+  e.windowCount = count;
+  e.flipped = flipped;
+  e.reserved = 0;
+  e.configHash = configHash();
+  memset(e.windows, 0, sizeof(e.windows));
+
+  if (windows != nullptr)
+    memcpy(e.windows, windows, count * sizeof(FrameWindow));
+
+  memcpy(e.frame.pixels, frame.pixels, FrameBuffer::BYTES);
+  e.crc = entryCrc(e);
+}
+
+const FrameBuffer *FrameCache::previous(FrameKey *key) const
+{
+  if (entry.ahead || !valid(entry))
+    return nullptr;
+
+  if (key != nullptr)
+    *key = entry.key;
+
+  return &entry.frame;
+}
+
+bool FrameCache::load(const FrameKey &key, FrameBuffer &frame) const
+{
+  return loadEntry(entry, key, false, frame);
+}
+
+void FrameCache::store(const FrameKey &key, const FrameBuffer &frame)
+{
+  storeEntry(entry, key, frame, nullptr, 0, 0);
+}
+
+void FrameCache::invalidate()
+{
+  entry.version = 0;
+}
+
+void FrameCache::storeAhead(const FrameKey &key, const FrameBuffer &frame, const FrameWindow *windows, int count,
+                            int flipped)
+{
+  storeEntry(entry, key, frame, windows, count, flipped);
+}
+
+bool FrameCache::loadAhead(const FrameKey &key, FrameBuffer &frame, FrameWindow *windows, int &count,
+                           int &flipped) const
+{
+  if (!loadEntry(entry, key, true, frame))
+    return false;
+
+  count = entry.windowCount;
+  flipped = entry.flipped;
+  memcpy(windows, entry.windows, count * sizeof(FrameWindow));
+  return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include "FaceConfig.h"
+#include "FrameBuffer.h"
+#include "FrameDiff.h"
+
+// What a frame was rendered for. The battery fill only counts by bucket, so a
+// voltage wobble does not force a redraw.
+struct FrameKey
+{
+  uint8_t minute;
+  uint8_t hour;
+  uint8_t bucket;
+  uint8_t economy;
+  int8_t temperature; // whole degrees shown, FaceRenderer::NO_TEMPERATURE for none
+};
+
+// The last rendered frame, kept in RTC slow memory across deep sleep. A wake
+// that would draw the same face again, like a button press back to the watch
+// face, takes it from here instead of rendering. The entry carries a layout
+// version and a hash of everything else the frame depends on (the switches in
+// FaceConfig.h and the asset pack), and a CRC over all of it, so a new
+// firmware or a corrupted RTC memory is never mistaken for a hit.
+//
+// With SPIRAL_PRERENDER the entry can hold the frame drawn ahead for the next
+// tick instead, with the windows it changes against the frame it replaced and
+// the pixels it flips: RTC slow memory has no room for both frames. Until the
+// next tick shows it and stores it back, previous() has nothing and load()
+// misses.
+class FrameCache
+{
+public:
+  // Copies the cached frame into frame if it was rendered for key
+  bool load(const FrameKey &key, FrameBuffer &frame) const;
+  void store(const FrameKey &key, const FrameBuffer &frame);
+  void invalidate();
+
+  // The last frame stored whatever it was rendered for, which is what the
+  // panel shows, and into key what that was; nullptr when there is none
+  const FrameBuffer *previous(FrameKey *key = nullptr) const;
+
+  // The frame drawn ahead, with up to SPIRAL_REFRESH_WINDOWS windows
+  void storeAhead(const FrameKey &key, const FrameBuffer &frame, const FrameWindow *windows, int count,
+                  int flipped);
+  bool loadAhead(const FrameKey &key, FrameBuffer &frame, FrameWindow *windows, int &count, int &flipped) const;
+};
+
+extern FrameCache frameCache;
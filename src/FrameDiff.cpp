@@ -0,0 +1,80 @@
+#include "FrameDiff.h"
+
+// Unchanged rows two bands can be apart and still be sent as one window
+const int MERGE_ROWS = 8;
+
+FrameWindow mergeWindows(const FrameWindow &a, const FrameWindow &b)
+{
+  int16_t left = a.x < b.x ? a.x : b.x;
+  int16_t right = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+  int16_t top = a.y < b.y ? a.y : b.y;
+  int16_t bottom = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+
+  return {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+}
+
+int diffFrames(const FrameBuffer &previous, const FrameBuffer &current, int top, int bottom, FrameWindow *windows,
+               int maxWindows)
+{
+  int count = 0;
+
+  for (int y = top; y < bottom; y++)
+  {
+    const uint8_t *before = previous.pixels + y * FrameBuffer::STRIDE;
+    const uint8_t *after = current.pixels + y * FrameBuffer::STRIDE;
+    int first = 0, last = FrameBuffer::STRIDE - 1;
+
+    while (first < FrameBuffer::STRIDE && before[first] == after[first])
+      first++;
+
+    if (first == FrameBuffer::STRIDE)
+      continue;
+
+    while (before[last] == after[last])
+      last--;
+
+    FrameWindow row = {(int16_t)(first * 8), (int16_t)y, (int16_t)((last - first + 1) * 8), 1};
+
+    if (count > 0 && y - (windows[count - 1].y + windows[count - 1].h) <= MERGE_ROWS)
+    {
+      windows[count - 1] = mergeWindows(windows[count - 1], row);
+      continue;
+    }
+
+    if (count == maxWindows)
+    {
+      // Out of windows: merge the two neighbours with the smallest gap, the
+      // new row being the last one
+      int closest = count - 1;
+      int closestGap = y - (windows[count - 1].y + windows[count - 1].h);
+
+      for (int i = 0; i + 1 < count; i++)
+      {
+        int gap = windows[i + 1].y - (windows[i].y + windows[i].h);
+
+        if (gap < closestGap)
+        {
+          closest = i;
+          closestGap = gap;
+        }
+      }
+
+      if (closest == count - 1)
+      {
+        windows[closest] = mergeWindows(windows[closest], row);
+        continue;
+      }
+
+      windows[closest] = mergeWindows(windows[closest], windows[closest + 1]);
+
+      for (int i = closest + 1; i + 1 < count; i++)
+        windows[i] = windows[i + 1];
+
+      count--;
+    }
+
+    windows[count++] = row;
+  }
+
+  return count;
+}
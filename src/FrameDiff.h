@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdint.h>
+#include "FrameBuffer.h"
+
+// Screen rectangle in pixels, x and w on byte columns
+struct FrameWindow
+{
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+// Bands of changed rows between two frames, among rows top .. bottom - 1,
+// each cut to the byte columns that changed in it. Bands closer than a few
+// rows are merged, since every window costs a command round trip, and the
+// closest ones are merged until at most maxWindows are left.
+// @return Number of windows, 0 when the frames are the same
+int diffFrames(const FrameBuffer &previous, const FrameBuffer &current, int top, int bottom, FrameWindow *windows,
+               int maxWindows);
+
+// Smallest window holding both
+FrameWindow mergeWindows(const FrameWindow &a, const FrameWindow &b);
+
+inline int windowBytes(const FrameWindow &window)
+{
+  return window.w / 8 * window.h;
+}
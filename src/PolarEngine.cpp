@@ -0,0 +1,301 @@
+#include "PolarEngine.h"
+#include "FastMath.h"
+
+#include <math.h>
+
+// Half a pixel of c at radius 1, in POLAR_BAND_ONE units
+static float edgeScale()
+{
+  // c = 60 rho - a changes by 60 / (r log(1 / LOOP_SCALE)) per pixel outwards
+  // and by 1 / (r STEP_ANGLE) along the circle
+  float radial = VECTOR_SIZE / logf(1.0f / LOOP_SCALE);
+  float tangential = 1.0f / (STEP_ANGLE * DEG_TO_RAD);
+
+  return 0.5f * sqrtf(radial * radial + tangential * tangential) * POLAR_BAND_ONE;
+}
+
+void PolarEngine::bakeLut(PolarTexel *lut)
+{
+  const float logLoop = logf(1.0f / LOOP_SCALE);
+  const float edge = edgeScale();
+
+  for (int y = 0; y < SCREEN_HEIGHT; y++)
+  {
+    for (int x = 0; x < SCREEN_WIDTH; x++)
+    {
+      PolarTexel &texel = lut[y * SCREEN_WIDTH + x];
+      Vector d = {x - CENTER.x, y - CENTER.y};
+      float r = sqrtf(d.x * d.x + d.y * d.y);
+
+      // EDGE_NORMAL[i] points at -(cos, sin) of i * STEP_ANGLE
+      float a = atan2f(-d.y, -d.x) / (STEP_ANGLE * DEG_TO_RAD);
+
+      if (a < 0.0f)
+        a += VECTOR_SIZE;
+
+      if (a >= VECTOR_SIZE)
+        a -= VECTOR_SIZE;
+
+      float rho = logf(FACE_RADIUS / r) / logLoop;
+      float band = (VECTOR_SIZE * rho - a) * POLAR_BAND_ONE;
+
+      texel.band = (int16_t)fminf(fmaxf(roundf(band), -32768.0f), 32767.0f);
+      texel.u = (int8_t)roundf(d.x / r * RADIUS);
+      texel.v = (int8_t)roundf(d.y / r * RADIUS);
+      texel.angle = (uint8_t)a;
+      texel.edge = (uint8_t)fminf(roundf(edge / r), 255.0f);
+    }
+  }
+}
+
+void PolarEngine::prepare(float rimSize, const Texture &face)
+{
+  if (!faceScaleReady)
+  {
+    for (int i = 0; i < FACE_SCALE_COUNT; i++)
+    {
+      float f = (i + 0.5f) / (float)FACE_SCALE_COUNT;
+      faceScale[i] = (int16_t)lroundf(powf(LOOP_SCALE, f) * 16384.0f);
+    }
+
+#if SPIRAL_FACE_MIPS
+    // The triangles pick floor(0.5 * log2(uv area / screen area)), and a
+    // face's UVs are RADIUS / (FACE_RADIUS * SCALE[k]) times its size
+    for (int k = 0; k < VECTOR_SIZE * 3; k++)
+    {
+      int level = (int)floorf(log2f(RADIUS / (FACE_RADIUS * SCALE[k])));
+      stepLevel[k] = level < 0 ? 0 : level > face.mipCount ? face.mipCount : level;
+    }
+#endif
+
+    faceScaleReady = true;
+  }
+
+  if (rimSize == preparedRim)
+    return;
+
+  // The rim of a step spans FACE_RADIUS .. FACE_RADIUS + rimSize times its
+  // scale, so the same log-width below every loop edge
+  const float logLoop = logf(1.0f / LOOP_SCALE);
+  float width = VECTOR_SIZE * logf(1.0f + rimSize / FACE_RADIUS) / logLoop;
+
+  rimWidth = (int)(width * POLAR_BAND_ONE);
+
+  if (rimWidth > (RIM_SCALE_COUNT << FACE_SCALE_SHIFT))
+    rimWidth = RIM_SCALE_COUNT << FACE_SCALE_SHIFT;
+
+  for (int i = 0; i < RIM_SCALE_COUNT; i++)
+  {
+    float below = (i + 0.5f) * (1 << FACE_SCALE_SHIFT) / POLAR_BAND_ONE;
+    float outside = powf(LOOP_SCALE, -below / VECTOR_SIZE) - 1.0f;
+    float g = rimSize > 0.0f ? fminf(outside * FACE_RADIUS / rimSize, 1.0f) : 0.0f;
+    rimScale[i] = (int16_t)lroundf((2.0f * g - 1.0f) * 16384.0f);
+  }
+
+  preparedRim = rimSize;
+}
+
+static inline int clampTexel(int value, int size)
+{
+  if (value < 0)
+    return 0;
+
+  if (value > size - 1)
+    return size - 1;
+
+  return value;
+}
+
+// Texels straight from the baked table
+struct LutSource
+{
+  const PolarTexel *lut;
+  const PolarTexel *rowTexels;
+
+  void row(int y) { rowTexels = lut + y * SCREEN_WIDTH; }
+  PolarTexel texel(int x) { return rowTexels[x]; }
+};
+
+// Texels computed per pixel, as bakeLut() does but with FastMath.h in place of
+// libm. The angle is off by at most 0.0050 rad, which moves the seam at the
+// minute hand by under 0.7 px at the screen corners; with the log-radius
+// error the band is off by at most 5 / POLAR_BAND_ONE of a step, under
+// 0.2 px of loop edge.
+struct AnalyticSource
+{
+  float angleScale;
+  float bandScale;
+  float bandOffset;
+  float edge;
+  float dy;
+  float dy2;
+
+  AnalyticSource()
+  {
+    const float log2Loop = log2f(1.0f / LOOP_SCALE);
+
+    angleScale = 1.0f / (STEP_ANGLE * DEG_TO_RAD);
+    // 60 rho = 60 (log2 FACE_RADIUS - log2(r^2) / 2) / log2(1 / LOOP_SCALE)
+    bandScale = -0.5f * VECTOR_SIZE / log2Loop;
+    bandOffset = VECTOR_SIZE * log2f(FACE_RADIUS) / log2Loop;
+    edge = edgeScale();
+  }
+
+  void row(int y)
+  {
+    dy = y - CENTER.y;
+    dy2 = dy * dy;
+  }
+
+  PolarTexel texel(int x)
+  {
+    PolarTexel texel;
+    float dx = x - CENTER.x;
+    float r2 = dx * dx + dy2;
+    float invR = fastInvSqrt(r2);
+
+    // EDGE_NORMAL[i] points at -(cos, sin) of i * STEP_ANGLE
+    float a = fastAtan2(-dy, -dx) * angleScale;
+
+    if (a < 0.0f)
+      a += VECTOR_SIZE;
+
+    if (a >= VECTOR_SIZE)
+      a -= VECTOR_SIZE;
+
+    float band = (bandOffset + bandScale * fastLog2(r2) - a) * POLAR_BAND_ONE;
+
+    // CENTER sits between pixels, so r2 >= 0.5 and the band stays in range.
+    // Biased to round by truncation, without a branch on the sign
+    texel.band = (int16_t)((int32_t)(band + 32768.5f) - 32768);
+    texel.u = (int8_t)((int32_t)(dx * invR * RADIUS + 128.5f) - 128);
+    texel.v = (int8_t)((int32_t)(dy * invR * RADIUS + 128.5f) - 128);
+    texel.angle = (uint8_t)a;
+    texel.edge = (uint8_t)fminf(edge * invR + 0.5f, 255.0f);
+
+    return texel;
+  }
+};
+
+template <class Source>
+void HOT_KERNEL PolarEngine::shade(FrameBuffer &frame, Source &source, int minute, const Texture &face,
+                                   const Texture &matCap, DitherNoise &noise, int top, int bottom, int left,
+                                   int right)
+{
+  const int32_t loop = VECTOR_SIZE * POLAR_BAND_ONE;
+  const int32_t minuteBand = minute * POLAR_BAND_ONE;
+
+  // UVs are scaled in 2.14 fixed point; the offset puts them around CENTER
+  // and rounds to the texel under them
+  const int32_t uvOffset = (int32_t)lroundf(CENTER.x * 16384.0f);
+
+  for (int y = top; y < bottom; y++)
+  {
+    const uint8_t *noiseRow = noise.row(y);
+    uint8_t *out = frame.pixels + y * FrameBuffer::STRIDE + left / 8;
+
+    source.row(y);
+
+    for (int x = left; x < right; x += 8)
+    {
+      uint8_t bits = 0;
+
+      for (int bit = 0; bit < 8; bit++)
+      {
+        PolarTexel texel = source.texel(x + bit);
+
+        // One loop added so everything from the rim of the outermost loop
+        // on is positive
+        int32_t t = texel.band + minuteBand - (texel.angle < minute ? loop : 0) + loop;
+        int32_t edge = texel.edge;
+        bool white = true;
+
+        if (t >= 0 && t < loop * 4 + edge)
+        {
+          int32_t n = t / loop;
+          int32_t f = t - n * loop;
+          int32_t below = loop - f;
+          int32_t rimEdge = below - rimWidth;
+          int step = texel.angle - minute;
+
+          if (step < 0)
+            step += VECTOR_SIZE;
+
+          if ((f < edge && n >= 1) || (n < 4 && (below <= edge || (rimEdge > -edge && rimEdge < edge))))
+          {
+            // Loop edge n or n + 1, or the outer edge of the rim below the
+            // latter, the outlines of the three loops and the innermost one
+            white = false;
+          }
+          else if (below <= rimWidth && n == 3)
+          {
+            // The innermost loop is only outlined, segment by segment, which
+            // at its size is black
+            white = false;
+          }
+          else if (below <= rimWidth && n < 3)
+          {
+            // Rim of loop n, drawn over the inner end of the face before it
+            int32_t scale = rimScale[below >> FACE_SCALE_SHIFT];
+            int su = clampTexel((texel.u * scale + uvOffset) >> 14, matCap.width);
+            int sv = clampTexel((texel.v * scale + uvOffset) >> 14, matCap.height);
+
+            white = matCap.texels[sv * matCap.width + su] > noiseRow[x + bit];
+          }
+          else if (n >= 1 && n < 4)
+          {
+            // Face of loop n - 1
+            int32_t scale = faceScale[f >> FACE_SCALE_SHIFT];
+            int su = (texel.u * scale + uvOffset) >> 14;
+            int sv = (texel.v * scale + uvOffset) >> 14;
+            const uint8_t *texels = face.texels;
+            int width = face.width;
+            int height = face.height;
+
+#if SPIRAL_FACE_MIPS
+            int level = stepLevel[(n - 1) * VECTOR_SIZE + step];
+
+            if (level > 0)
+            {
+              texels = face.mips[level - 1];
+              width = face.mipDescs[level - 1].width;
+              height = face.mipDescs[level - 1].height;
+              su >>= level;
+              sv >>= level;
+            }
+#endif
+
+            su = clampTexel(su, width);
+            sv = clampTexel(sv, height);
+
+            white = texels[sv * width + su] > noiseRow[x + bit];
+          }
+        }
+
+        bits = (bits << 1) | white;
+      }
+
+      *out++ = bits;
+    }
+  }
+}
+
+void HOT_KERNEL PolarEngine::draw(FrameBuffer &frame, const PolarTexel *lut, int minute, float rimSize,
+                                  const Texture &face, const Texture &matCap, DitherNoise &noise, int top,
+                                  int bottom, int left, int right)
+{
+  LutSource source = {lut, nullptr};
+
+  prepare(rimSize, face);
+  shade(frame, source, minute, face, matCap, noise, top, bottom, left, right);
+}
+
+void HOT_KERNEL PolarEngine::drawAnalytic(FrameBuffer &frame, int minute, float rimSize, const Texture &face,
+                                          const Texture &matCap, DitherNoise &noise, int top, int bottom,
+                                          int left, int right)
+{
+  AnalyticSource source;
+
+  prepare(rimSize, face);
+  shade(frame, source, minute, face, matCap, noise, top, bottom, left, right);
+}
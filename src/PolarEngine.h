@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+#include "Dither.h"
+#include "FaceConfig.h"
+#include "FaceGeometry.h"
+#include "FrameBuffer.h"
+#include "Texture.h"
+
+// Every pixel of the spiral is described by its angle index a (continuous,
+// in EDGE_NORMAL steps) and its log-radius rho = log(FACE_RADIUS / r) /
+// log(1 / LOOP_SCALE), so r = FACE_RADIUS * LOOP_SCALE^rho. The face of
+// loop step k spans rho = k / 60 .. k / 60 + 1 and step k sits at angle index
+// (m + k) % 60, so at minute m a pixel lies 60 rho - (a - m) % 60 steps into
+// the spiral. Split into a part fixed per pixel, the band coordinate
+// c = 60 rho - a, and the minute, that is
+//
+//   t = c + m - (a < m ? 60 : 0)
+//
+// t / 60 is the loop, t % 60 how far into it the pixel is, which gives the
+// face UV (RADIUS * LOOP_SCALE^(t % 60 / 60) along the pixel's direction) or,
+// within the rim's log-width below a loop edge, the rim UV. The outlines are
+// the pixels within half a pixel of a loop edge or of the outer edge of a rim,
+// in band units, which shrink with the radius. A minute change only moves t,
+// so the spiral is one raster-order pass over a flash LUT that the asset
+// compiler bakes, with no triangles.
+struct PolarTexel
+{
+  int16_t band;  // c in POLAR_BAND_ONE units
+  int8_t u;      // RADIUS * the pixel's direction from CENTER
+  int8_t v;
+  uint8_t angle; // floor(a)
+  uint8_t edge;  // half a pixel of c in POLAR_BAND_ONE units, at most 255
+};
+
+static_assert(sizeof(PolarTexel) == 6, "PolarTexel layout is baked into the asset pack");
+static_assert(VECTOR_SIZE <= 255, "angle index must fit PolarTexel::angle");
+
+const int POLAR_BAND_SHIFT = 6;
+const int POLAR_BAND_ONE = 1 << POLAR_BAND_SHIFT;
+
+class PolarEngine
+{
+public:
+  // SCREEN_WIDTH x SCREEN_HEIGHT texels, row by row
+  static void bakeLut(PolarTexel *lut);
+
+  // Rows top .. bottom - 1 of the spiral, in the columns left .. right - 1,
+  // which are multiples of 8
+  void draw(FrameBuffer &frame, const PolarTexel *lut, int minute, float rimSize, const Texture &face,
+            const Texture &matCap, DitherNoise &noise, int top, int bottom, int left = 0,
+            int right = SCREEN_WIDTH);
+
+  // The same pass with every texel computed on the fly instead of read from a
+  // table, see AnalyticSource in PolarEngine.cpp for the error it adds
+  void drawAnalytic(FrameBuffer &frame, int minute, float rimSize, const Texture &face, const Texture &matCap,
+                    DitherNoise &noise, int top, int bottom, int left = 0, int right = SCREEN_WIDTH);
+
+private:
+  // Face UV scale LOOP_SCALE^(f / 60) in 2.14 fixed point, by f in 1/16 steps
+  static const int FACE_SCALE_SHIFT = POLAR_BAND_SHIFT - 4;
+  static const int FACE_SCALE_COUNT = VECTOR_SIZE << (POLAR_BAND_SHIFT - FACE_SCALE_SHIFT);
+  static const int RIM_SCALE_COUNT = 256;
+
+  void prepare(float rimSize, const Texture &face);
+
+  template <class Source>
+  void shade(FrameBuffer &frame, Source &source, int minute, const Texture &face, const Texture &matCap,
+             DitherNoise &noise, int top, int bottom, int left, int right);
+
+  int16_t faceScale[FACE_SCALE_COUNT];
+  bool faceScaleReady = false;
+
+  // Rim UV scale -1 at the inner edge .. 1 at the outer, by distance below
+  // the loop edge in 1/16 steps
+  int16_t rimScale[RIM_SCALE_COUNT];
+  int rimWidth;
+  float preparedRim = -1.0f;
+
+#if SPIRAL_FACE_MIPS
+  // Mip level of the face of every loop step, as the triangles pick it
+  uint8_t stepLevel[VECTOR_SIZE * 3];
+#endif
+};
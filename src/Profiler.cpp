@@ -0,0 +1,172 @@
+#include "Profiler.h"
+
+Profiler profiler;
+
+#if SPIRAL_PROFILE
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#define PROFILE_PRINTF Serial.printf
+#define PROFILE_UNIT "cycles"
+#define CYCLES_PER_US getCpuFrequencyMhz()
+#define CPU_MHZ getCpuFrequencyMhz()
+#define CURRENT_CORE xPortGetCoreID()
+typedef BaseType_t Core;
+#else
+#include <stdio.h>
+#include <chrono>
+#include <thread>
+#define PROFILE_PRINTF printf
+#define PROFILE_UNIT "ns"
+#define CYCLES_PER_US 1000
+#define CPU_MHZ 240
+#define CURRENT_CORE std::this_thread::get_id()
+typedef std::thread::id Core;
+#endif
+
+const float SUPPLY_VOLTS = 3.3f;
+
+struct CounterInfo
+{
+  const char *name;
+  bool timed;
+};
+
+static const CounterInfo COUNTERS[PROFILE_COUNTER_COUNT] =
+{
+  {"assets", true},
+  {"spiral", true},
+  {"shadow", true},
+  {"hands", true},
+  {"push", true},
+  {"refresh", true},
+  {"prerender", true},
+  {"to panel", true},
+  {"sleep", true},
+  {"core wait", true},
+  {"interrupt", true},
+  {"tile hits", false},
+  {"tile miss", false},
+  {"tile skip", false},
+  {"mip tris", false},
+  {"frame hit", false},
+  {"ahead hit", false},
+  {"economy", false},
+  {"anim frames", false},
+  {"sent bytes", false},
+  {"flipped", false},
+  {"ghost px", false},
+  {"full", false},
+  {"sleep us", false},
+};
+
+static uint32_t now()
+{
+#ifdef ARDUINO
+  return ESP.getCycleCount();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Where start() was called
+static Core owner;
+
+void Profiler::start()
+{
+#ifdef ARDUINO
+  static bool serialStarted = false;
+
+  if (!serialStarted)
+  {
+    Serial.begin(115200);
+    serialStarted = true;
+  }
+#endif
+
+  for (int i = 0; i < PROFILE_COUNTER_COUNT; i++)
+    values[i] = 0;
+
+  first = last = accounted = now();
+  diverted = PROFILE_COUNTER_COUNT;
+  owner = CURRENT_CORE;
+
+  accountedSleep = 0;
+  activeUs = 0.0f;
+  activeMicrojoules = 0.0f;
+}
+
+void Profiler::lap(ProfileCounter counter)
+{
+  if (CURRENT_CORE != owner)
+    return;
+
+  uint32_t current = now();
+  values[diverted < PROFILE_COUNTER_COUNT ? diverted : counter] += current - last;
+  last = current;
+}
+
+void Profiler::add(ProfileCounter counter, uint32_t value)
+{
+  if (CURRENT_CORE == owner)
+    values[counter] += value;
+}
+
+void Profiler::mark(ProfileCounter counter)
+{
+  values[counter] = now() - first;
+}
+
+void Profiler::activeSince(uint32_t current, float &us, float &microjoules) const
+{
+  // Whether the cycle counter runs on through light sleep or not, the sleep
+  // lap holds what it counted then
+  uint32_t cycles = current - accounted - (values[PROFILE_SLEEP] - accountedSleep);
+
+  us = cycles / (float)CYCLES_PER_US;
+  microjoules = SUPPLY_VOLTS * us * (SPIRAL_ACTIVE_BASE_UA + SPIRAL_ACTIVE_UA_PER_MHZ * CPU_MHZ) / 1e6f;
+}
+
+void Profiler::clockChanging()
+{
+  if (CURRENT_CORE != owner)
+    return;
+
+  uint32_t current = now();
+  float us, microjoules;
+
+  activeSince(current, us, microjoules);
+  activeUs += us;
+  activeMicrojoules += microjoules;
+
+  accounted = current;
+  accountedSleep = values[PROFILE_SLEEP];
+}
+
+void Profiler::report(const char *title) const
+{
+  PROFILE_PRINTF("%s (engine %d, iram %d, dram tables %d, noise %d, tile cache %d, mips %d, hand sprites %d, frame cache %d, windows %d, cores %d, prerender %d, mhz %d/%d, night %d, animation %d, weather %d)\n", title,
+                 SPIRAL_ENGINE, SPIRAL_IRAM_KERNELS, SPIRAL_DRAM_TABLES, SPIRAL_NOISE_PLACEMENT,
+                 SPIRAL_TEXTURE_CACHE ? SPIRAL_TEXTURE_CACHE_TILES : 0, SPIRAL_FACE_MIPS, SPIRAL_HAND_SPRITES,
+                 SPIRAL_FRAME_CACHE, SPIRAL_REFRESH_WINDOWS, SPIRAL_RENDER_CORES, SPIRAL_PRERENDER,
+                 SPIRAL_RENDER_MHZ, SPIRAL_IDLE_MHZ, SPIRAL_NIGHT_MINUTES, SPIRAL_ANIMATION_FRAMES,
+                 SPIRAL_WEATHER_SYNC);
+
+  for (int i = 0; i < PROFILE_COUNTER_COUNT; i++)
+  {
+    if (values[i] == 0)
+      continue;
+
+    PROFILE_PRINTF("  %-10s %10u %s\n", COUNTERS[i].name, (unsigned)values[i], COUNTERS[i].timed ? PROFILE_UNIT : "");
+  }
+
+  float us, microjoules;
+  activeSince(now(), us, microjoules);
+
+  us += activeUs;
+  microjoules += activeMicrojoules + SUPPLY_VOLTS * values[PROFILE_SLEEP_US] * SPIRAL_LIGHT_SLEEP_UA / 1e6f;
+
+  PROFILE_PRINTF("  %-10s %10u uJ (%u us active)\n", "energy", (unsigned)microjoules, (unsigned)us);
+}
+
+#endif
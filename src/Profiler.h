@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+#include "FaceConfig.h"
+
+// Per-frame counters. Timed phases are closed with lap(), which adds the
+// cycles since the previous lap; event counters are bumped with add(). mark()
+// sets a timed counter to the cycles since start(), and work done on the side
+// of the frame goes to one counter whatever it laps with divert(). The report
+// ends with the energy the wake took, from the cycles run since start() and
+// the microseconds slept (PROFILE_SLEEP_US); call clockChanging() before the
+// CPU clock changes, so the cycles run so far count at the clock they ran at.
+// Only the core that called start() counts, calls from the other one are
+// ignored.
+// Counters still 0 are left out of the report. With SPIRAL_PROFILE off every
+// call compiles away.
+enum ProfileCounter : uint8_t
+{
+  PROFILE_ASSETS,
+  PROFILE_SPIRAL,
+  PROFILE_SHADOW,
+  PROFILE_HANDS,
+  PROFILE_PUSH,
+  PROFILE_REFRESH,
+  PROFILE_PRERENDER,
+  PROFILE_TO_PANEL,
+  PROFILE_SLEEP,
+  PROFILE_CORE_WAIT,
+  PROFILE_INTERRUPTED,
+  PROFILE_TILE_HITS,
+  PROFILE_TILE_MISSES,
+  PROFILE_TILE_BYPASS,
+  PROFILE_MIP_TRIANGLES,
+  PROFILE_FRAME_CACHE_HITS,
+  PROFILE_PRERENDER_HITS,
+  PROFILE_ECONOMY_FRAMES,
+  PROFILE_ANIMATION_FRAMES,
+  PROFILE_REFRESH_BYTES,
+  PROFILE_FLIPPED_PIXELS,
+  PROFILE_GHOST_PIXELS,
+  PROFILE_FULL_REFRESHES,
+  PROFILE_SLEEP_US,
+  PROFILE_COUNTER_COUNT
+};
+
+class Profiler
+{
+public:
+#if SPIRAL_PROFILE
+  void start();
+  void lap(ProfileCounter counter);
+  void mark(ProfileCounter counter);
+  // Until called again with PROFILE_COUNTER_COUNT
+  void divert(ProfileCounter counter) { diverted = counter; }
+  void add(ProfileCounter counter, uint32_t value);
+  uint32_t get(ProfileCounter counter) const { return values[counter]; }
+  void clockChanging();
+  void report(const char *title) const;
+
+private:
+  // Time and energy of the cycles run awake since the last clockChanging()
+  void activeSince(uint32_t current, float &us, float &microjoules) const;
+
+  uint32_t values[PROFILE_COUNTER_COUNT];
+  uint32_t first;
+  uint32_t last;
+  ProfileCounter diverted;
+
+  uint32_t accounted;
+  uint32_t accountedSleep;
+  float activeUs;
+  float activeMicrojoules;
+#else
+  void start() {}
+  void lap(ProfileCounter) {}
+  void mark(ProfileCounter) {}
+  void divert(ProfileCounter) {}
+  void add(ProfileCounter, uint32_t) {}
+  uint32_t get(ProfileCounter) const { return 0; }
+  void clockChanging() {}
+  void report(const char *) const {}
+#endif
+};
+
+extern Profiler profiler;
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "FaceConfig.h"
+#include "FrameBuffer.h"
+#include "Vector.h"
+
+// Textured triangle and line rasterizer, templated on what a pixel turns
+// into. A Plot provides:
+//
+//   ClipRect clip;                          pixels outside are never plotted
+//   void bind(VectorInt v0, Vector uv0,     called once per triangle with the
+//             VectorInt v1, Vector uv1,     vertices sorted by y
+//             VectorInt v2, Vector uv2);
+//   void pixel(int16_t x, int16_t y,        a covered pixel and its truncated
+//              int16_t u, int16_t v);       texture coordinates
+//   void solid(int16_t x, int16_t y);       a pixel of a line
+//
+// The edge walking is the Adafruit GFX fillTriangle one, so the faces cover
+// exactly the pixels they did when they were drawn straight into the display.
+
+struct ClipRect
+{
+  int16_t left;
+  int16_t top;
+  int16_t right;  // exclusive
+  int16_t bottom; // exclusive
+};
+
+const ClipRect SCREEN_CLIP = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+
+inline ClipRect unionClip(const ClipRect &a, const ClipRect &b)
+{
+  return {a.left < b.left ? a.left : b.left, a.top < b.top ? a.top : b.top,
+          a.right > b.right ? a.right : b.right, a.bottom > b.bottom ? a.bottom : b.bottom};
+}
+
+// Empty, with right <= left or bottom <= top, when they do not overlap
+inline ClipRect intersectClip(const ClipRect &a, const ClipRect &b)
+{
+  return {a.left > b.left ? a.left : b.left, a.top > b.top ? a.top : b.top,
+          a.right < b.right ? a.right : b.right, a.bottom < b.bottom ? a.bottom : b.bottom};
+}
+
+inline ClipRect clipToScreen(const ClipRect &clip)
+{
+  return {clip.left < 0 ? (int16_t)0 : clip.left, clip.top < 0 ? (int16_t)0 : clip.top,
+          clip.right > SCREEN_WIDTH ? (int16_t)SCREEN_WIDTH : clip.right,
+          clip.bottom > SCREEN_HEIGHT ? (int16_t)SCREEN_HEIGHT : clip.bottom};
+}
+
+// Widened to whole bytes, as FaceRenderer::setClip() takes it
+inline ClipRect byteAlignClip(const ClipRect &clip)
+{
+  return {(int16_t)(clip.left & ~7), clip.top, (int16_t)((clip.right + 7) & ~7), clip.bottom};
+}
+
+namespace Rasterizer
+{
+
+inline void barycentric(VectorInt p, VectorInt v0, VectorInt v1, VectorInt a, float invDen, float &u, float &v, float &w)
+{
+    VectorInt v2 = p - a;
+    // ToDo: Premultiply v0 and v1 by invDen?
+    v = (v2.x * v1.y - v1.x * v2.y) * invDen;
+    w = (v0.x * v2.y - v2.x * v0.y) * invDen;
+    u = 1.0 - v - w;
+}
+
+template <class Plot>
+void HOT_KERNEL span(Plot &plot, int x, int y, int w, VectorInt v0, Vector uv0, VectorInt a, Vector uv1, VectorInt b, Vector uv2, float invDen)
+{
+  if (y < plot.clip.top || y >= plot.clip.bottom)
+    return;
+
+  int start = x < plot.clip.left ? plot.clip.left : x;
+  int end = x + w > plot.clip.right ? plot.clip.right : x + w;
+
+  for (int px = start; px < end; px++)
+  {
+    float ua, va, wa;
+    VectorInt pointA = {px, y};
+    barycentric(pointA, a, b, v0, invDen, ua, va, wa);
+
+    Vector uv = uv0 * ua + uv1 * va + uv2 * wa;
+
+    plot.pixel(px, y, uv.x, uv.y);
+  }
+}
+
+// Degenerate triangle squashed onto one scanline
+template <class Plot>
+void HOT_KERNEL flatSpan(Plot &plot, int16_t x, int16_t y, int16_t w, Vector uvA, Vector uvB)
+{
+  if (y < plot.clip.top || y >= plot.clip.bottom)
+    return;
+
+  for (int i = 0; i < w; i++)
+  {
+    if (x + i < plot.clip.left || x + i >= plot.clip.right)
+      continue;
+
+    float lerpVal = i / (w + 1.0);
+    Vector uv = (uvA * lerpVal) + (uvB * (1.0 - lerpVal));
+    plot.pixel(x + i, y, uv.x, uv.y);
+  }
+}
+
+template <class T>
+inline void swapValues(T &a, T &b)
+{
+  T t = a;
+  a = b;
+  b = t;
+}
+
+template <class Plot>
+void HOT_KERNEL fillTriangle(Plot &plot, VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2)
+{
+  int16_t a, b, y, last;
+  Vector uvA, uvB;
+
+  // Sort coordinates by Y order (y2 >= y1 >= y0)
+  if (v0.y > v1.y) {
+    swapValues(v0, v1);
+    swapValues(uv0, uv1);
+  }
+  if (v1.y > v2.y) {
+    swapValues(v2, v1);
+    swapValues(uv2, uv1);
+  }
+  if (v0.y > v1.y) {
+    swapValues(v0, v1);
+    swapValues(uv0, uv1);
+  }
+
+  // Nothing to do outside the clip rows, before the bind
+  if (v2.y < plot.clip.top || v0.y >= plot.clip.bottom)
+    return;
+
+  plot.bind(v0, uv0, v1, uv1, v2, uv2);
+
+  if (v0.y == v2.y) { // Handle awkward all-on-same-line case as its own thing
+    a = b = v0.x;
+    uvA = uv0;
+    uvB = uv0;
+
+    if (v1.x < a)
+    {
+      a = v1.x;
+      uvA = uv1;
+    }
+    else if (v1.x > b)
+    { 
+      b = v1.x;
+      uvB = uv1;
+    }
+    if (v2.x < a)
+    {
+      a = v2.x;
+      uvA = uv2;
+    }
+    else if (v2.x > b)
+    {
+      b = v2.x;
+      uvB = uv2;
+    }
+
+    flatSpan(plot, a, v0.y, b - a + 1, uvA, uvB);
+    return;
+  }
+
+  int16_t dx01 = v1.x - v0.x, dy01 = v1.y - v0.y, 
+          dx02 = v2.x - v0.x, dy02 = v2.y - v0.y,
+          dx12 = v2.x - v1.x, dy12 = v2.y - v1.y;
+  int32_t sa = 0, sb = 0;
+
+  // For upper part of triangle, find scanline crossings for segments
+  // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
+  // is included here (and second loop will be skipped, avoiding a /0
+  // error there), otherwise scanline y1 is skipped here and handled
+  // in the second loop...which also avoids a /0 error here if y0=y1
+  // (flat-topped triangle).
+  if (v1.y == v2.y)
+    last = v1.y; // Include y1 scanline
+  else
+    last = v1.y - 1; // Skip it
+
+  VectorInt aa = v1 - v0, bb = v2 - v0;
+  float den = VectorInt::crossProduct(aa, bb);
+
+  // Collinear vertices, every pixel takes uv0
+  float invDen = den != 0.0f ? 1 / den : 0.0f;
+
+  int startY = v0.y;
+
+  if (startY < plot.clip.top)
+  {
+    sa += (plot.clip.top - startY) * dx01;
+    sb += (plot.clip.top - startY) * dx02;
+    startY = plot.clip.top;
+  }
+
+  for (y = startY; y <= last && y < plot.clip.bottom; y++) {
+    a = v0.x + sa / dy01;
+    b = v0.x + sb / dy02;
+
+    sa += dx01;
+    sb += dx02;
+
+    /* longhand:
+    a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
+    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
+    */
+    if (a > b)
+      swapValues(a, b);
+
+    span(plot, a, y, b - a + 1, v0, uv0, aa, uv1, bb, uv2, invDen);
+  }
+
+  startY = last + 1;
+
+  // For lower part of triangle, find scanline crossings for segments
+  // 0-2 and 1-2.  This loop is skipped if y1=y2.
+  sa = (int32_t)dx12 * (startY - v1.y);
+  sb = (int32_t)dx02 * (startY - v0.y);
+
+  if (startY < plot.clip.top)
+  {
+    sa += (plot.clip.top - startY) * dx12;
+    sb += (plot.clip.top - startY) * dx02;
+    startY = plot.clip.top;
+  }
+
+  int endY = v2.y;
+
+  if (endY > plot.clip.bottom - 1)
+    endY = plot.clip.bottom - 1;
+
+  for (y = startY; y <= endY; y++) {
+    a = v1.x + sa / dy12;
+    b = v0.x + sb / dy02;
+
+    sa += dx12;
+    sb += dx02;
+
+    /* longhand:
+    a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
+    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
+    */
+    if (a > b)
+      swapValues(a, b);
+
+    span(plot, a, y, b - a + 1, v0, uv0, aa, uv1, bb, uv2, invDen);
+  }
+}
+
+template <class Plot>
+inline void solid(Plot &plot, int16_t x, int16_t y)
+{
+  if (x >= plot.clip.left && x < plot.clip.right && y >= plot.clip.top && y < plot.clip.bottom)
+    plot.solid(x, y);
+}
+
+// Bresenham line, the same pixels as Adafruit GFX drawLine
+template <class Plot>
+void drawLine(Plot &plot, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  if ((y0 < plot.clip.top && y1 < plot.clip.top) || (y0 >= plot.clip.bottom && y1 >= plot.clip.bottom))
+    return;
+
+  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+
+  if (steep) {
+    swapValues(x0, y0);
+    swapValues(x1, y1);
+  }
+
+  if (x0 > x1) {
+    swapValues(x0, x1);
+    swapValues(y0, y1);
+  }
+
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = y0 < y1 ? 1 : -1;
+
+  for (; x0 <= x1; x0++) {
+    if (steep)
+      solid(plot, y0, x0);
+    else
+      solid(plot, x0, y0);
+
+    err -= dy;
+
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+template <class Plot>
+void drawTriangle(Plot &plot, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+  drawLine(plot, x0, y0, x1, y1);
+  drawLine(plot, x1, y1, x2, y2);
+  drawLine(plot, x2, y2, x0, y0);
+}
+
+}
@@ -0,0 +1,41 @@
+#include "RefreshScheduler.h"
+
+// Pixels flipped by partial refreshes since the last full one
+static RTC_DATA_ATTR uint32_t flippedSinceFull = 0;
+
+RefreshScheduler refreshScheduler;
+
+int RefreshScheduler::countFlipped(const FrameBuffer &previous, const FrameBuffer &current, int top, int bottom)
+{
+  int flipped = 0;
+
+  for (int i = top * FrameBuffer::STRIDE; i < bottom * FrameBuffer::STRIDE; i++)
+    flipped += __builtin_popcount(previous.pixels[i] ^ current.pixels[i]);
+
+  return flipped;
+}
+
+bool RefreshScheduler::fullRefreshDue(int flipped, int hour, int minute) const
+{
+#if SPIRAL_FULL_REFRESH_HOUR >= 0
+  if (hour == SPIRAL_FULL_REFRESH_HOUR && minute == 0)
+    return true;
+#endif
+
+  return flippedSinceFull + flipped > SPIRAL_GHOST_PIXELS;
+}
+
+void RefreshScheduler::partialRefreshDone(int flipped)
+{
+  flippedSinceFull += flipped;
+}
+
+void RefreshScheduler::fullRefreshDone()
+{
+  flippedSinceFull = 0;
+}
+
+uint32_t RefreshScheduler::ghostPixels() const
+{
+  return flippedSinceFull;
+}
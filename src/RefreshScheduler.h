@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include "FaceConfig.h"
+#include "FrameBuffer.h"
+
+// Picks full or partial refreshes for the minute ticks. Partial refreshes are
+// fast but leave ghosting behind that only a full refresh clears, roughly in
+// proportion to how many pixels they flipped. The pixels flipped since the
+// last full refresh are counted in RTC memory, and a full refresh is due
+// once they pass SPIRAL_GHOST_PIXELS, or at SPIRAL_FULL_REFRESH_HOUR.
+class RefreshScheduler
+{
+public:
+  // Pixels that differ among rows top .. bottom - 1
+  static int countFlipped(const FrameBuffer &previous, const FrameBuffer &current, int top, int bottom);
+
+  bool fullRefreshDue(int flipped, int hour, int minute) const;
+
+  void partialRefreshDone(int flipped);
+  void fullRefreshDone();
+
+  uint32_t ghostPixels() const;
+};
+
+extern RefreshScheduler refreshScheduler;
@@ -0,0 +1,111 @@
+#include "RotozoomEngine.h"
+#include "FaceGeometry.h"
+
+#include <math.h>
+
+struct MapLevel
+{
+  const uint8_t *texels;
+  int width;
+  int height;
+};
+
+static inline int clampTexel(int value, int size)
+{
+  if (value < 0)
+    return 0;
+
+  if (value > size - 1)
+    return size - 1;
+
+  return value;
+}
+
+void HOT_KERNEL RotozoomEngine::draw(FrameBuffer &frame, const uint8_t *map, int minute, const Texture &face,
+                                     const Texture &matCap, DitherNoise &noise, int top, int bottom, int left,
+                                     int right) const
+{
+  float radians = minute * STEP_ANGLE * DEG_TO_RAD;
+  float sinAngle = sinf(radians);
+  float cosAngle = cosf(radians);
+
+  // Texture to sample for every material, faces by mip level
+  MapLevel levels[SPIRAL_MAP_FACE + Texture::MAX_MIPS + 1] = {};
+  levels[SPIRAL_MAP_RIM] = {matCap.texels, matCap.width, matCap.height};
+  levels[SPIRAL_MAP_FACE] = {face.texels, face.width, face.height};
+
+  for (int i = 0; i < face.mipCount; i++)
+    levels[SPIRAL_MAP_FACE + 1 + i] = {face.mips[i], face.mipDescs[i].width, face.mipDescs[i].height};
+
+  // UVs are turned forwards in 2.14 fixed point; the offset puts them back
+  // around CENTER and rounds to the texel under them
+  const int32_t uvSin = (int32_t)lroundf(sinAngle * 16384.0f);
+  const int32_t uvCos = (int32_t)lroundf(cosAngle * 16384.0f);
+  const int32_t uvOffset = (int32_t)lroundf(CENTER.x * 16384.0f);
+
+  // The map texel under pixel p is R(-angle) (p - CENTER) + map center,
+  // stepping one pixel right adds the first column of R(-angle)
+  int32_t stepU = (int32_t)lroundf(cosAngle * 65536.0f);
+  int32_t stepV = (int32_t)lroundf(-sinAngle * 65536.0f);
+
+  for (int y = top; y < bottom; y++)
+  {
+    float dx = -CENTER.x;
+    float dy = y - CENTER.y;
+
+    // Half a texel added so the shift below rounds to the nearest texel
+    int32_t u = (int32_t)lroundf((cosAngle * dx + sinAngle * dy + ROTOZOOM_MAP_CENTER + 0.5f) * 65536.0f);
+    int32_t v = (int32_t)lroundf((-sinAngle * dx + cosAngle * dy + ROTOZOOM_MAP_CENTER + 0.5f) * 65536.0f);
+
+    // Stepped to left as the whole row would be, so a clipped pixel samples
+    // the same texel
+    u += stepU * left;
+    v += stepV * left;
+
+    const uint8_t *noiseRow = noise.row(y);
+    uint8_t *out = frame.pixels + y * FrameBuffer::STRIDE + left / 8;
+
+    for (int x = left; x < right; x += 8)
+    {
+      uint8_t bits = 0;
+
+      for (int bit = 0; bit < 8; bit++)
+      {
+        // Negative coordinates wrap to huge unsigned ones and fail the test
+        uint32_t mu = (uint32_t)(u >> 16);
+        uint32_t mv = (uint32_t)(v >> 16);
+        bool white = true;
+
+        if (mu < MAP_SIZE && mv < MAP_SIZE)
+        {
+          const uint8_t *texel = map + (mv * MAP_SIZE + mu) * MAP_TEXEL_BYTES;
+          uint8_t material = texel[2];
+
+          if (material == SPIRAL_MAP_LINE)
+          {
+            white = false;
+          }
+          else if (material != SPIRAL_MAP_EMPTY)
+          {
+            int32_t tu = (int8_t)texel[0];
+            int32_t tv = (int8_t)texel[1];
+            int level = material > SPIRAL_MAP_FACE ? material - SPIRAL_MAP_FACE : 0;
+            const MapLevel &source = levels[material];
+
+            int su = clampTexel(((uvCos * tu - uvSin * tv + uvOffset) >> 14) >> level, source.width);
+            int sv = clampTexel(((uvSin * tu + uvCos * tv + uvOffset) >> 14) >> level, source.height);
+
+            white = source.texels[sv * source.width + su] > noiseRow[x + bit];
+          }
+        }
+
+        bits = (bits << 1) | white;
+
+        u += stepU;
+        v += stepV;
+      }
+
+      *out++ = bits;
+    }
+  }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include "Dither.h"
+#include "FaceConfig.h"
+#include "FrameBuffer.h"
+#include "Texture.h"
+
+// The spiral at minute m is the minute 0 spiral turned by m steps: vertex k
+// of every loop sits on EDGE_NORMAL[(m + k) % 60]. Its UVs turn with it, but
+// the textures do not, so the dial digits stay upright. This engine keeps
+// the minute 0 spiral as a map of what covers every texel (baked by the asset
+// compiler, one per battery bucket) and produces a frame by resampling the
+// map turned by the minute angle, walking it with a 16.16 fixed-point DDA,
+// turning the UV it finds by the same angle, and dithering the texel there.
+// No triangle is set up at all.
+//
+// A map texel is 3 bytes: u and v as int8 relative to CENTER, then one of
+// SpiralMapMaterial.
+enum SpiralMapMaterial : uint8_t
+{
+  SPIRAL_MAP_EMPTY = 0, // not covered, white
+  SPIRAL_MAP_LINE = 1,  // loop outline, black
+  SPIRAL_MAP_RIM = 2,   // matcap
+  SPIRAL_MAP_FACE = 3,  // face texture, plus the mip level it was drawn from
+};
+
+class RotozoomEngine
+{
+public:
+  // Side of the square map; big enough that the turned screen corners stay
+  // inside it
+  static const int MAP_SIZE = 288;
+  static const int MAP_TEXEL_BYTES = 3;
+
+  // Nearest map texel for every pixel of rows top .. bottom - 1 in the
+  // columns left .. right - 1, which are multiples of 8; texels outside the
+  // map are white
+  void draw(FrameBuffer &frame, const uint8_t *map, int minute, const Texture &face, const Texture &matCap,
+            DitherNoise &noise, int top, int bottom, int left = 0, int right = SCREEN_WIDTH) const;
+};
+
+// Where CENTER lands in the map
+const float ROTOZOOM_MAP_CENTER = (RotozoomEngine::MAP_SIZE - 1) / 2.0f;
@@ -0,0 +1,59 @@
+#include "SecondCore.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <thread>
+#endif
+
+SecondCore secondCore;
+
+#ifdef ARDUINO
+// Rendering needs less, the rest is headroom
+const uint32_t WORKER_STACK = 8192;
+
+static TaskHandle_t worker = nullptr;
+static TaskHandle_t caller = nullptr;
+
+static SecondCore::Work pendingWork;
+static void *pendingContext;
+
+// Task notifications carry the hand-over both ways, and their critical
+// sections order the memory accesses around them
+static void workerTask(void *)
+{
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    pendingWork(pendingContext, 1);
+    xTaskNotifyGive(caller);
+  }
+}
+
+void SecondCore::run(Work work, void *context)
+{
+  if (worker == nullptr &&
+      xTaskCreatePinnedToCore(workerTask, "SecondCore", WORKER_STACK, nullptr, uxTaskPriorityGet(nullptr), &worker,
+                              1 - xPortGetCoreID()) != pdPASS)
+  {
+    worker = nullptr;
+    work(context, 0);
+    return;
+  }
+
+  pendingWork = work;
+  pendingContext = context;
+  caller = xTaskGetCurrentTaskHandle();
+
+  xTaskNotifyGive(worker);
+  work(context, 0);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+#else
+void SecondCore::run(Work work, void *context)
+{
+  std::thread other(work, context, 1);
+  work(context, 0);
+  other.join();
+}
+#endif
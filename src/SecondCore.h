@@ -0,0 +1,18 @@
+#pragma once
+
+// Runs work on both ESP32 cores at once: the calling one and a task pinned to
+// the other, created on first use. The Arduino code runs on core 1, core 0
+// otherwise only has the radio stack. On the host the other core is a thread.
+class SecondCore
+{
+public:
+  typedef void (*Work)(void *context, int core);
+
+  // Calls work(context, 1) on the other core and work(context, 0) on this one
+  // and returns once both have. Without a second core work(context, 0) is
+  // all that runs, so work has to pick what it does from a shared counter
+  // rather than by core.
+  void run(Work work, void *context);
+};
+
+extern SecondCore secondCore;
@@ -1,795 +1,936 @@
 #include "SpiralWatchy.h"
+#include "AssetIndex.h"
+#include "FaceConfig.h"
+#include "FaceGeometry.h"
+#include "FrameCache.h"
+#include "FrameDiff.h"
+#include "Profiler.h"
+#include "RefreshScheduler.h"
+#include "SecondCore.h"
+#include "TickSchedule.h"
+#include "WeatherSync.h"
+
+#include <atomic>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+
+#if SPIRAL_INTERRUPTIBLE
+#include <rom/gpio.h>
+#endif
 
 const float VOLTAGE_MIN = 3.5f;
 const float VOLTAGE_MAX = 4.2f;
 const float VOLTAGE_WARNING = 3.6f;
 const float VOLTAGE_RANGE = VOLTAGE_MAX - VOLTAGE_MIN;
 
-const int DENSITY = 1;
-const int VECTOR_SIZE = 60 * DENSITY;
-const float STEP_ANGLE = 360 / VECTOR_SIZE;
-
-const int STEP_MINUTE = DENSITY;
-const int STEP_HOUR = VECTOR_SIZE/12;
+const float BATTERY_WARNING = BATTERY_MIN + ((VOLTAGE_WARNING - VOLTAGE_MIN) / VOLTAGE_RANGE) * BATTERY_RANGE;
 
-const Vector CENTER = {99.5f, 99.5f};
-const int RADIUS = 99;
-const int RIM_SIZE = 20;
-const int FACE_RADIUS = 260 - RIM_SIZE;
+// Battery fills the economy profile switches on below and off above
+const float ECONOMY_ON = (SPIRAL_ECONOMY_MV / 1000.0f - VOLTAGE_MIN) / VOLTAGE_RANGE;
+const float ECONOMY_OFF = ((SPIRAL_ECONOMY_MV + SPIRAL_ECONOMY_HYSTERESIS_MV) / 1000.0f - VOLTAGE_MIN) / VOLTAGE_RANGE;
 
-const float BATTERY_MIN = 0.5f;
-const float BATTERY_RANGE = 1.0f - BATTERY_MIN;
-const float BATTERY_WARNING = BATTERY_MIN + ((VOLTAGE_WARNING - VOLTAGE_MIN) / VOLTAGE_RANGE) * BATTERY_RANGE;
+// Kept across deep sleep for the hysteresis
+static RTC_DATA_ATTR bool economy = false;
 
-const Vector SHADOW_CORNER_1 = {66.0f,66.0f};
-const Vector SHADOR_CORNER_2 = {133.0f,66.0f};
-const Vector SHADOR_CORNER_3 = {133.0f,133.0f};
-const Vector SHADOR_CORNER_4 = {66.0f,133.0f};
-
-const float LOOP_SCALE = 0.45f;
-
-const Vector HAND[] =
-{{0.0f, -1.0f},
- {0.0f, -0.8f}, 
- {0.1f, -0.8f},
-{0.0f, 0.0f},
- {0.05f, 0.15f},
-{-0.05f, 0.15f},
- {-0.1f, -0.8f}};
-
-const Vector HAND_NORMAL[] =
-{{0.5f, -0.85f}, {0.2f, -0.2f}, {0.85f, -0.5f},
-{0.3f, -0.1f}, {0.96f, -0.1f}, {0.3f, 0.1f}, {0.96f, 0.1f},
-{0.0f, 0.3f}, {0.1f, 0.96f}, {-0.1f, 0.96f},
-{-0.3f, -0.1f}, {-0.96f, -0.1f}, {-0.3f, 0.1f}, {-0.96f, 0.1f},
-{-0.5f, -0.85f}, {-0.2f, -0.2f}, {-0.85f, -0.5f}};
-
-const int HAND_POS_INDEX[] = 
-{0,1,2,
-1,2,3,
-2,3,4,
-3,4,5,
-3,5,6,
-3,6,1,
-6,1,0};
-
-const int HAND_POS_LEN = 7;
-
-const int HAND_NORMAL_INDEX[] = 
-{0,1,2,
-3,4,5,
-4,5,6,
-7,8,9,
-10,11,13,
-10,13,12,
-14,15,16};
-
-const int HAND_OUTLINE_INDEX[] = {0,2,4,5,6};
-
-const int HAND_OUTLINE_LEN = 5;
-
-Vector EDGE_NORMAL[VECTOR_SIZE];
-
-float SCALE[VECTOR_SIZE * 4];
+// Rendered off screen, then copied into the display buffer in one go
+FrameBuffer faceFrame;
 
-SpiralWatchy::SpiralWatchy(const watchySettings& s) : Watchy(s)
+// The temperature of the last weather fetched in whole degrees, as the face
+// shows it
+static int shownTemperature()
 {
-  Vector up = {-1.0f, 0.0f};
-  
-  for (int i = 0; i < VECTOR_SIZE; i++)
-  {
-    EDGE_NORMAL[i] = Vector::rotateVector(up, i * STEP_ANGLE);
-    EDGE_NORMAL[i].normalize();
-  }
+#if SPIRAL_WEATHER_SYNC
+  const Weather &weather = weatherSync.weather();
 
-  for (int i = 0; i < VECTOR_SIZE * 4; i++)
+  if (weather.valid)
   {
-    SCALE[i] = pow(LOOP_SCALE, i / (float)VECTOR_SIZE);
+    int degrees = (weather.temperature + (weather.temperature < 0 ? -5 : 5)) / 10;
+    return degrees < -99 ? -99 : degrees > 99 ? 99 : degrees;
   }
+#endif
+
+  return FaceRenderer::NO_TEMPERATURE;
 }
 
-static float lerp(float a, float b, float f)
+// Switches the CPU clock for what follows when the SPIRAL_*_MHZ switches ask
+// for one
+static void setClock(int mhz)
 {
-    return a * (1.0f - f) + (b * f);
+  if (mhz == 0 || (int)getCpuFrequencyMhz() == mhz)
+    return;
+
+  profiler.clockChanging();
+  setCpuFrequencyMhz(mhz);
 }
 
-void SpiralWatchy::drawWatchFace()
+SpiralWatchy::SpiralWatchy(const watchySettings& s) : Watchy(s)
 {
-  display.fillScreen(GxEPD_WHITE);
-  display.setTextColor(GxEPD_BLACK);
+  initFaceGeometry();
+}
 
-  int hour = currentTime.Hour;
-  int minute = currentTime.Minute;
-  
-  float minuteNormalized = minute / 60.0f;
-  float hourNormalized = (hour + minuteNormalized) / 24.0f;
+void SpiralWatchy::init(String datetime)
+{
+  // Only drawing frames runs at SPIRAL_RENDER_MHZ
+  setClock(SPIRAL_IDLE_MHZ);
 
-  float batteryFill = getBatteryFill();
-  float batteryFillScale = BATTERY_MIN + BATTERY_RANGE * batteryFill;
-  float rimSize = RIM_SIZE * batteryFillScale;
+#if SPIRAL_INTERRUPTIBLE
+  // A button wake draws the face for the press, which must not drop it
+  interruptible = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0 && guiState == WATCHFACE_STATE;
+#endif
 
-  for (int i = minute; i < VECTOR_SIZE * 3 + minute; i++)
+#if SPIRAL_REFRESH_WINDOWS || SPIRAL_NIGHT_MINUTES || SPIRAL_WEATHER_SYNC
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0 && guiState == WATCHFACE_STATE)
   {
-    int index = i % VECTOR_SIZE;
-    int nextIndex = (i + 1) % VECTOR_SIZE;
+    // What Watchy::init() of the release platformio.ini pins does for a tick,
+    // with the face drawn our way. Its showWatchFace() and deepSleep() are not
+    // virtual, so there is no hooking in between them.
+    Wire.begin(SDA, SCL);
+    RTC.init();
+    display.epd2.initWatchy();
+    display.epd2.setBusyCallback(busyCallback, this);
+
+    RTC.read(currentTime);
+
+    // An alarm the RTC could not skip goes straight back to sleep
+    if (tickSchedule.due(currentTime.Hour, currentTime.Minute))
+    {
+      // The radio connects while the face is drawn and refreshed
+      startWeatherSync();
 
-    int scaleIndex = i - minute;
-    int scaleNextIndex = scaleIndex + 1;
+#if SPIRAL_REFRESH_WINDOWS
+      showWatchFaceWindows();
+#else
+      showWatchFace(true);
+#endif
 
-    float currentLoopSCale = SCALE[scaleIndex];
+      if (settings.vibrateOClock && currentTime.Minute == 0)
+        vibMotor(75, 4);
 
-    float scale1 = FACE_RADIUS * currentLoopSCale;
-    Vector v1 = EDGE_NORMAL[index] * scale1 + CENTER;
-    Vector uv1 = EDGE_NORMAL[index] * RADIUS + CENTER;
+      finishWeatherSync();
+      storeAhead();
+    }
 
-    float nextLoopScale = SCALE[scaleNextIndex];
-    float scale2 = FACE_RADIUS * nextLoopScale;
-    Vector v2 = EDGE_NORMAL[nextIndex] * scale2 + CENTER;
-    Vector uv2 = EDGE_NORMAL[nextIndex] * RADIUS + CENTER;
+    scheduleNextTick();
+    deepSleep();
+    return;
+  }
+#endif
 
-    float scale3 = scale1 * LOOP_SCALE;
-    Vector v1a = EDGE_NORMAL[index] * scale3 + CENTER;
-    Vector uv1a = EDGE_NORMAL[index] * RADIUS * LOOP_SCALE + CENTER;
+  Watchy::init(datetime);
+}
 
-    float scale4 = scale2 * LOOP_SCALE;
-    Vector v2a = EDGE_NORMAL[nextIndex] * scale4 + CENTER;
-    Vector uv2a = EDGE_NORMAL[nextIndex] * RADIUS * LOOP_SCALE + CENTER;
+void SpiralWatchy::handleButtonPress()
+{
+  bool onFace = guiState == WATCHFACE_STATE;
 
-    fillTriangle2(v1a, uv1a, v1, uv1, v2, uv2, SpiralFaceWithShadow, 200, 200);
-    fillTriangle2(v2a, uv2a, v1a, uv1a, v2, uv2, SpiralFaceWithShadow, 200, 200);
+  // Watchy only reads the RTC for the buttons that draw
+  RTC.read(currentTime);
 
-    Vector v4 = EDGE_NORMAL[index] * (scale1 + rimSize * currentLoopSCale) + CENTER;
-    Vector uv3 = EDGE_NORMAL[index] * -RADIUS + CENTER;
-    Vector uv4 = EDGE_NORMAL[index] * RADIUS + CENTER;
+  // Every minute again for a while, starting with the face drawn for the press
+  tickSchedule.buttonPressed(currentTime.Hour, currentTime.Minute);
+  scheduleNextTick();
 
-    Vector v6 = EDGE_NORMAL[nextIndex] * (scale2 + rimSize * nextLoopScale) + CENTER;
-    Vector uv5 = EDGE_NORMAL[nextIndex] * -RADIUS + CENTER;
-    Vector uv6 = EDGE_NORMAL[nextIndex] * RADIUS + CENTER;
+#if SPIRAL_ANIMATION_FRAMES
+  // Nothing else happens for UP on the face
+  if (onFace && (esp_sleep_get_ext1_wakeup_status() & UP_BTN_MASK))
+  {
+    animateSpiral();
+    return;
+  }
+#endif
 
-    fillTriangle2(v1, uv3, v4, uv4, v2, uv5, MatCapSource, 200, 200);
-    fillTriangle2(v4, uv4, v2, uv5, v6, uv6, MatCapSource, 200, 200);
+  Watchy::handleButtonPress();
 
-    display.drawLine(v1.x, v1.y, v2.x, v2.y, GxEPD_BLACK);
-    display.drawLine(v4.x, v4.y, v6.x, v6.y, GxEPD_BLACK);
-  }
+  // Watchy comes back to the face from its menus with a full refresh
+  if (!onFace && guiState == WATCHFACE_STATE)
+    refreshScheduler.fullRefreshDone();
+}
 
-  for (int i = VECTOR_SIZE * 3 + minute; i < VECTOR_SIZE * 4 + minute - 1; i++)
-  {
-    int index = i % VECTOR_SIZE;
-    int nextIndex = (i + 1) % VECTOR_SIZE;
+bool SpiralWatchy::loadAssets()
+{
+  // A pack built from different assets has different offsets
+  if (!assets.open() || assets.checksum() != ASSET_PACK_CHECKSUM)
+    return false;
+
+  loadRenderer(renderer);
+
+#if SPIRAL_RENDER_CORES > 1
+  loadRenderer(workerRenderer);
+
+#if SPIRAL_TEXTURE_CACHE
+  static TextureCache workerTextureCache;
+  workerRenderer.setTextureCache(&workerTextureCache);
+#endif
+#endif
 
-    int scaleIndex = i - minute;
-    int scaleNextIndex = scaleIndex + 1;
+  return true;
+}
 
-    float currentLoopSCale = SCALE[scaleIndex];
+void SpiralWatchy::loadRenderer(FaceRenderer &target)
+{
+  target.load(assets);
+  target.setEconomy(economy || animating);
+  target.setTemperature(shownTemperature());
 
-    float scale1 = FACE_RADIUS * currentLoopSCale;
-    Vector v1 = EDGE_NORMAL[index] * scale1 + CENTER;
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_ROTOZOOM
+  static_assert(Assets::SpiralMapCount == SPIRAL_BATTERY_BUCKETS, "asset pack baked for a different number of battery buckets");
 
-    float nextLoopScale = SCALE[scaleNextIndex];
-    float scale2 = FACE_RADIUS * nextLoopScale;
-    Vector v2 = EDGE_NORMAL[nextIndex] * scale2 + CENTER;
+  for (int i = 0; i < Assets::SpiralMapCount; i++)
+    target.setSpiralMap(i, assets.data(Assets::SpiralMap[i]));
+#endif
 
-    Vector v4 = EDGE_NORMAL[index] * (scale1 + rimSize * currentLoopSCale) + CENTER;
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_POLAR
+  target.setSpiralLut((const PolarTexel *)assets.data(Assets::SpiralLut));
+#endif
 
-    Vector v6 = EDGE_NORMAL[nextIndex] * (scale2 + rimSize * nextLoopScale) + CENTER;
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_BAKED
+  static_assert(Assets::SpiralFramesCount == SPIRAL_BATTERY_BUCKETS, "asset pack baked for a different number of battery buckets");
 
-    display.drawTriangle(v1.x, v1.y, v4.x, v4.y, v2.x, v2.y, GxEPD_BLACK);
-    display.drawTriangle(v4.x, v4.y, v2.x, v2.y, v6.x, v6.y, GxEPD_BLACK);
-  }
+  for (int i = 0; i < Assets::SpiralFramesCount; i++)
+    target.setSpiralFrames(i, assets.data(Assets::SpiralFrames[i]));
+#endif
 
-  fillTriangle(SHADOW_CORNER_1, SHADOW_CORNER_1, SHADOR_CORNER_2, SHADOR_CORNER_2, SHADOR_CORNER_3, SHADOR_CORNER_3, SpiralFaceShadowCenter, 200, 200, GxEPD_BLACK);
-  fillTriangle(SHADOR_CORNER_3, SHADOR_CORNER_3, SHADOR_CORNER_4, SHADOR_CORNER_4, SHADOW_CORNER_1, SHADOW_CORNER_1, SpiralFaceShadowCenter, 200, 200, GxEPD_BLACK);
+#if SPIRAL_OVERLAY_SPRITES
+  static_assert(Assets::OverlayCount <= FaceRenderer::MAX_OVERLAYS, "asset pack baked with more overlays than FaceRenderer has room for");
 
-  float hourAngle = ((float)(hour % 12) + minuteNormalized) * 30;
+  for (int i = 0; i < Assets::OverlayCount; i++)
+    target.setOverlay(i, assets.data(Assets::Overlay[i]));
+#endif
 
-  DrawHand(hourAngle, 70);
-  DrawHand(minute * 6, 90);
+#if SPIRAL_HAND_SPRITES
+  static_assert(Assets::MinuteHandCount == VECTOR_SIZE, "asset pack baked without minute hand sprites");
+  static_assert(Assets::HourHandCount == SPIRAL_HOUR_HAND_STEPS, "asset pack baked for a different number of hour hand steps");
+
+  for (int i = 0; i < Assets::MinuteHandCount; i++)
+    target.setMinuteHandSprite(i, assets.data(Assets::MinuteHand[i]));
+
+  for (int i = 0; i < Assets::HourHandCount; i++)
+    target.setHourHandSprite(i, assets.data(Assets::HourHand[i]));
+#endif
 }
 
-void SpiralWatchy::DrawHand(float angle, float size)
+void SpiralWatchy::drawWatchFace()
 {
-  float radians = angle * DEG_TO_RAD;
-  float sinAngle = sin(radians);
-  float cosAngle = cos(radians);
+  profiler.start();
+  facePushed = false;
 
-  for (int i = 0; i < HAND_POS_LEN; i++)
-  {
-    Vector v1 = Vector::rotateVector(HAND[HAND_POS_INDEX[i * 3]], sinAngle, cosAngle) * size + CENTER;
-    Vector v2 = Vector::rotateVector(HAND[HAND_POS_INDEX[i * 3 + 1]], sinAngle, cosAngle) * size + CENTER;
-    Vector v3 = Vector::rotateVector(HAND[HAND_POS_INDEX[i * 3 + 2]], sinAngle, cosAngle) * size + CENTER;
+  display.fillScreen(GxEPD_WHITE);
+  display.setTextColor(GxEPD_BLACK);
 
-    Vector uv1 = Vector::rotateVector(HAND_NORMAL[HAND_NORMAL_INDEX[i * 3]], sinAngle, cosAngle) * 99 + CENTER;
-    Vector uv2 = Vector::rotateVector(HAND_NORMAL[HAND_NORMAL_INDEX[i * 3 + 1]], sinAngle, cosAngle) * 99 + CENTER;
-    Vector uv3 = Vector::rotateVector(HAND_NORMAL[HAND_NORMAL_INDEX[i * 3 + 2]], sinAngle, cosAngle) * 99 + CENTER;
+  int hour = currentTime.Hour;
+  int minute = tickSchedule.shownMinute(hour, currentTime.Minute);
+  float batteryFill = getBatteryFill();
 
-    fillTriangle2(v1, uv1, v2, uv2, v3, uv3, MatCapSource, 200, 200);
+#if SPIRAL_FRAME_CACHE
+  if (frameCache.load(frameKey(hour, minute, batteryFill), faceFrame))
+  {
+    profiler.add(PROFILE_FRAME_CACHE_HITS, 1);
+    pushFrame(faceFrame);
+    profiler.lap(PROFILE_PUSH);
+    profiler.report("drawWatchFace");
+    return;
   }
+#endif
 
-  Vector currentPoint = Vector::rotateVector(HAND[HAND_OUTLINE_INDEX[0]], sinAngle, cosAngle) * size + CENTER;
-
-  for (int i = 0; i < HAND_OUTLINE_LEN; i++)
+  if (!drawFace(hour, minute, batteryFill))
   {
-    Vector nextPoint = Vector::rotateVector(HAND[HAND_OUTLINE_INDEX[(i + 1) % HAND_OUTLINE_LEN]], sinAngle, cosAngle) * size + CENTER;
+    // Nothing to texture with, "pio run -t uploadassets" was never run or is out of date
+    display.setCursor(10, 100);
+    display.print("No asset pack");
+    return;
+  }
 
-    display.drawLine(currentPoint.x, currentPoint.y, nextPoint.x, nextPoint.y, GxEPD_BLACK);
+  pushFrame(faceFrame);
 
-    currentPoint = nextPoint;
-  }
+  // Watchy refreshes the panel right after
+  profiler.lap(PROFILE_PUSH);
+  profiler.mark(PROFILE_TO_PANEL);
+  profiler.report("drawWatchFace");
+
+  // Instead of the one Watchy::init() set
+  display.epd2.setBusyCallback(busyCallback, this);
 }
 
-float SpiralWatchy::getBatteryFill()
+FrameKey SpiralWatchy::frameKey(int hour, int minute, float batteryFill)
 {
-  float VBAT = getBatteryVoltage();
+  return {(uint8_t)minute, (uint8_t)hour, (uint8_t)batteryBucket(batteryFill, SPIRAL_BATTERY_BUCKETS), economy,
+          (int8_t)shownTemperature()};
+}
 
-  // 12 battery states
-  float batState = ((VBAT - VOLTAGE_MIN) / VOLTAGE_RANGE);
-  if (batState > 1.0f)
-    batState = 1.0f;
-  if (batState < 0.0f)
-    batState = 0.0f;
+bool SpiralWatchy::drawFace(int hour, int minute, float batteryFill)
+{
+  FrameKey key = frameKey(hour, minute, batteryFill);
 
-  return batState;
-}
+  if (!renderFace(faceFrame, hour, minute, batteryFill))
+    return false;
 
-#ifndef _swap_int16_t
-#define _swap_int16_t(a, b)                                                    \
-  {                                                                            \
-    int16_t t = a;                                                             \
-    a = b;                                                                     \
-    b = t;                                                                     \
-  }
+  // Last chance before the frame is cached as what the panel shows
+  checkButtons();
+
+#if SPIRAL_FRAME_CACHE
+  frameCache.store(key, faceFrame);
 #endif
 
-#ifndef _swap_vector
-#define _swap_vector(a, b)                                                    \
-  {                                                                            \
-    Vector t = a;                                                             \
-    a = b;                                                                     \
-    b = t;                                                                     \
-  }
+  return true;
+}
+
+// Watchy only wakes on the buttons from deep sleep, so a press while a tick
+// draws would wait for the frame and its refresh, or be missed if it is over
+// by then
+static bool buttonPressed()
+{
+#if SPIRAL_INTERRUPTIBLE
+  uint64_t levels = ((uint64_t)gpio_input_get_high() << 32) | gpio_input_get();
+  return (levels & (BTN_PIN_MASK)) != 0;
+#else
+  return false;
 #endif
+}
+
+// Bands are whole rows, so no two share a byte of the frame. They all land in
+// one whole frame rather than being streamed out strip by strip: the frame
+// cache, the diff against the shown frame and the second write after a
+// refresh all need it whole, so a strip buffer would come on top of it.
+static void drawBand(FaceRenderer &renderer, FrameBuffer &frame, int16_t top, int16_t bottom, int hour, int minute,
+                     float batteryFill)
+{
+  memset(frame.pixels + top * FrameBuffer::STRIDE, 0xFF, (bottom - top) * FrameBuffer::STRIDE);
+
+  renderer.setBand(top, bottom);
+  renderer.drawBackground(frame, minute, batteryFill);
+  renderer.drawHands(frame, hour, minute);
+  renderer.drawTemperature(frame);
+  renderer.setBand(0, SCREEN_HEIGHT);
 
-#ifndef _swap_vector_int
-#define _swap_vector_int(a, b)                                                    \
-  {                                                                            \
-    VectorInt t = a;                                                             \
-    a = b;                                                                     \
-    b = t;                                                                     \
+  profiler.lap(PROFILE_HANDS);
+}
+
+#if SPIRAL_RENDER_CORES > 1
+// Bands the two cores share a frame in, enough for neither to wait long for
+// the other at the end
+const int CORE_BANDS = 8;
+
+// A frame for both cores to draw
+struct BandWork
+{
+  FaceRenderer *renderers[2];
+  FrameBuffer *frame;
+  int hour;
+  int minute;
+  float batteryFill;
+  std::atomic<int> nextBand;
+  bool interruptible;
+  std::atomic<bool> pressed;
+};
+
+static void drawBands(void *context, int core)
+{
+  BandWork &work = *(BandWork *)context;
+  int band;
+
+  // Whichever core is done first takes the next band. SecondCore orders the
+  // frame's bytes, the counter needs no more than being atomic.
+  while ((band = work.nextBand.fetch_add(1, std::memory_order_relaxed)) < CORE_BANDS)
+  {
+    if (work.interruptible && (work.pressed || buttonPressed()))
+    {
+      work.pressed = true;
+      return;
+    }
+
+    drawBand(*work.renderers[core], *work.frame, band * SCREEN_HEIGHT / CORE_BANDS,
+             (band + 1) * SCREEN_HEIGHT / CORE_BANDS, work.hour, work.minute, work.batteryFill);
   }
+}
 #endif
 
-static float clamp(float val, float min, float max)
+bool SpiralWatchy::renderFace(FrameBuffer &frame, int hour, int minute, float batteryFill)
 {
-  if (val > max)
-    val = max;
-  
-  if (val < min)
-    val = min;
+  if (!loadAssets())
+    return false;
+
+  setClock(SPIRAL_RENDER_MHZ);
+
+  profiler.lap(PROFILE_ASSETS);
+
+  if (economy)
+    profiler.add(PROFILE_ECONOMY_FRAMES, 1);
+
+#if SPIRAL_RENDER_CORES > 1
+  BandWork work;
+  work.renderers[0] = &renderer;
+  work.renderers[1] = &workerRenderer;
+  work.frame = &frame;
+  work.hour = hour;
+  work.minute = minute;
+  work.batteryFill = batteryFill;
+  work.nextBand = 0;
+  work.interruptible = interruptible;
+  work.pressed = false;
+
+  secondCore.run(drawBands, &work);
+  profiler.lap(PROFILE_CORE_WAIT);
+
+  if (work.pressed)
+    abandonFrame();
+#else
+  checkButtons();
+  drawBand(renderer, frame, 0, SCREEN_HEIGHT, hour, minute, batteryFill);
+#endif
 
-  return val;
+  setClock(SPIRAL_IDLE_MHZ);
+  return true;
 }
 
-static void barycentric(VectorInt p, VectorInt v0, VectorInt v1, VectorInt a, float invDen, float &u, float &v, float &w)
+void SpiralWatchy::checkButtons()
 {
-    VectorInt v2 = p - a;
-    // ToDo: Premultiply v0 and v1 by invDen?
-    v = (v2.x * v1.y - v1.x * v2.y) * invDen;
-    w = (v0.x * v2.y - v2.x * v0.y) * invDen;
-    u = 1.0 - v - w;
+  if (interruptible && buttonPressed())
+    abandonFrame();
 }
 
+#if SPIRAL_PRERENDER || SPIRAL_ANIMATION_FRAMES
+// Drawn into while faceFrame is still being sent to the panel
+static FrameBuffer aheadFrame;
+#endif
 
-static bool getColor(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h) 
+// The tick TickSchedule says draws next after hour:minute, and the minute it
+// shows
+static void nextTick(int hour, int minute, int &nextHour, int &nextMinute)
 {
-  int16_t byteWidth = (w + 7) / 8;
-  return (pgm_read_byte(bitmap + y * byteWidth + x / 8) & (128 >> (x & 7)));
+  int next = (hour * 60 + minute + tickSchedule.minutesToNext(hour, minute)) % (24 * 60);
+
+  nextHour = next / 60;
+  nextMinute = tickSchedule.shownMinute(nextHour, next % 60);
 }
 
-void SpiralWatchy::drawLine(int x, int y, int w, VectorInt v0, Vector uv0, VectorInt a, Vector uv1, VectorInt b, Vector uv2, float invDen, const uint8_t *bitmap, int16_t bw, int16_t bh)
+void SpiralWatchy::prerenderNext(int hour, int minute, float batteryFill)
 {
-  for (int i = 0; i < w; i++)
-  {
-    float ua, va, wa;
-    VectorInt pointA = {x + i, y};
-    barycentric(pointA, a, b, v0, invDen, ua, va, wa);
+#if SPIRAL_PRERENDER
+  // The battery only moves the rim by bucket, a new bucket is drawn then
+  nextTick(hour, minute, nextHour, nextMinute);
+  nextBatteryFill = batteryFill;
+  prerenderPending = true;
+#else
+  (void)hour;
+  (void)minute;
+  (void)batteryFill;
+#endif
+}
 
-    Vector uv = uv0 * ua + uv1 * va + uv2 * wa;
+void SpiralWatchy::storeAhead()
+{
+#if SPIRAL_PRERENDER
+  if (!aheadDrawn)
+    return;
 
-    bool white = getColor(uv.x, uv.y, bitmap, bw, bh);
-    display.drawPixel(x + i, y, white ? GxEPD_WHITE : GxEPD_BLACK);
-  }
+  aheadDrawn = false;
+
+  int hour;
+  int minute;
+  nextTick(currentTime.Hour, currentTime.Minute, hour, minute);
+
+  // A sync moved the clock or fetched another temperature, or the face shown
+  // is unknown
+  const FrameBuffer *previous = frameCache.previous();
+
+  if (hour != nextHour || minute != nextMinute || shownTemperature() != aheadTemperature || previous == nullptr)
+    return;
+
+  FrameWindow windows[SPIRAL_REFRESH_WINDOWS];
+  int count = diffFrames(*previous, aheadFrame, 0, SCREEN_HEIGHT, windows, SPIRAL_REFRESH_WINDOWS);
+  int aheadFlipped = RefreshScheduler::countFlipped(*previous, aheadFrame, 0, SCREEN_HEIGHT);
+
+  frameCache.storeAhead(frameKey(nextHour, nextMinute, nextBatteryFill), aheadFrame, windows, count, aheadFlipped);
+#endif
 }
 
-void SpiralWatchy::fillTriangle(VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2, const uint8_t bitmap[], int w, int h)
+bool SpiralWatchy::showAhead(const FrameKey &key)
 {
-  int16_t a, b, y, last;
-  Vector uvA, uvB;
+#if SPIRAL_PRERENDER
+  FrameWindow windows[SPIRAL_REFRESH_WINDOWS];
+  int count;
+  int aheadFlipped;
 
-  // Sort coordinates by Y order (y2 >= y1 >= y0)
-  if (v0.y > v1.y) {
-    _swap_vector_int(v0, v1);
-    _swap_vector(uv0, uv1);
-  }
-  if (v1.y > v2.y) {
-    _swap_vector_int(v2, v1);
-    _swap_vector(uv2, uv1);
-  }
-  if (v0.y > v1.y) {
-    _swap_vector_int(v0, v1);
-    _swap_vector(uv0, uv1);
-  }
+  if (!frameCache.loadAhead(key, faceFrame, windows, count, aheadFlipped))
+    return false;
 
-  display.startWrite();
-  if (v0.y == v2.y) { // Handle awkward all-on-same-line case as its own thing
-    a = b = v0.x;
-    uvA = uv0;
-    uvB = uv0;
+  profiler.add(PROFILE_PRERENDER_HITS, 1);
 
-    if (v1.x < a)
-    {
-      a = v1.x;
-      uvA = uv1;
-    }
-    else if (v1.x > b)
-    { 
-      b = v1.x;
-      uvB = uv1;
-    }
-    if (v2.x < a)
-    {
-      a = v2.x;
-      uvA = uv2;
-    }
-    else if (v2.x > b)
-    {
-      b = v2.x;
-      uvB = uv2;
-    }
+  sendWindows(windows, count);
+  flipped += aheadFlipped;
+
+  // What the panel shows from now on
+  frameCache.store(key, faceFrame);
+  return true;
+#else
+  (void)key;
+  return false;
+#endif
+}
+
+void SpiralWatchy::scheduleNextTick()
+{
+#if SPIRAL_NIGHT_MINUTES
+  int ahead = tickSchedule.minutesToNext(currentTime.Hour, currentTime.Minute);
 
-    writeFastHLineUV(a, v0.y, b - a + 1, uvA, uvB, bitmap, w, h);
-    display.endWrite();
+  // Watchy's deep sleep only clears the DS3231's alarm flag, so an alarm set
+  // here holds. The PCF8563's alarm is set for the next minute on every deep
+  // sleep instead, its ticks that are not due wake only to sleep again.
+  if (RTC.rtcType != DS3231)
     return;
-  }
 
-  int16_t dx01 = v1.x - v0.x, dy01 = v1.y - v0.y, 
-          dx02 = v2.x - v0.x, dy02 = v2.y - v0.y,
-          dx12 = v2.x - v1.x, dy12 = v2.y - v1.y;
-  int32_t sa = 0, sb = 0;
-
-  // For upper part of triangle, find scanline crossings for segments
-  // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
-  // is included here (and second loop will be skipped, avoiding a /0
-  // error there), otherwise scanline y1 is skipped here and handled
-  // in the second loop...which also avoids a /0 error here if y0=y1
-  // (flat-topped triangle).
-  if (v1.y == v2.y)
-    last = v1.y; // Include y1 scanline
+  if (ahead == 1)
+    RTC.rtc_ds.setAlarm(DS3232RTC::ALM2_EVERY_MINUTE, 0, 0, 0, 0);
   else
-    last = v1.y - 1; // Skip it
+    RTC.rtc_ds.setAlarm(DS3232RTC::ALM2_MATCH_MINUTES, 0, (currentTime.Minute + ahead) % 60, 0, 0);
+#endif
+}
 
-    
-  VectorInt aa = v1 - v0, bb = v2 - v0;
-  float invDen = 1 / VectorInt::crossProduct(aa, bb);
+void SpiralWatchy::startWeatherSync()
+{
+#if SPIRAL_WEATHER_SYNC
+  int minute = currentTime.Hour * 60 + currentTime.Minute;
 
-  int startY = v0.y;
+  if (!weatherSync.due(minute, settings.weatherUpdateInterval))
+    return;
 
-  if (startY < 0)
-  {
-    sa += -startY * dx01;
-    sb += -startY * dx02;
-    startY = 0;
-  }
+  // The query Watchy::getWeatherData() makes, by city or by place
+  WeatherQuery query = {settings.cityID.c_str(), settings.lat.c_str(), settings.lon.c_str(),
+                        settings.weatherUnit.c_str(), settings.weatherLang.c_str(), settings.weatherAPIKey.c_str()};
+  char url[WeatherSync::URL_SIZE];
 
-  for (y = startY; y <= last && y < 200; y++) {
-    a = v0.x + sa / dy01;
-    b = v0.x + sb / dy02;
+  if (!WeatherSync::expandUrl(url, sizeof(url), settings.weatherURL.c_str(), query))
+    return;
 
-    sa += dx01;
-    sb += dx02;
+  weatherSync.start(minute, url, SPIRAL_SYNC_NTP ? settings.ntpServer.c_str() : nullptr, settings.gmtOffset);
+#endif
+}
 
-    
-    /* longhand:
-    a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if (a > b)
-      _swap_int16_t(a, b);
+void SpiralWatchy::finishWeatherSync()
+{
+#if SPIRAL_WEATHER_SYNC
+  struct tm time;
 
-    drawLine(a, y, b - a + 1, v0, uv0, aa, uv1, bb, uv2, invDen, bitmap, w, h);
-  }
+  if (!weatherSync.finish(SPIRAL_SYNC_TIMEOUT_MS, time))
+    return;
 
-  startY = last + 1;
+  tmElements_t synced;
+  synced.Second = time.tm_sec;
+  synced.Minute = time.tm_min;
+  synced.Hour = time.tm_hour;
+  synced.Wday = time.tm_wday + 1;
+  synced.Day = time.tm_mday;
+  synced.Month = time.tm_mon + 1;
+  synced.Year = time.tm_year + 1900 - 1970;
 
-  // For lower part of triangle, find scanline crossings for segments
-  // 0-2 and 1-2.  This loop is skipped if y1=y2.
-  sa = (int32_t)dx12 * (startY - v1.y);
-  sb = (int32_t)dx02 * (startY - v0.y);
-  
-  if (startY < 0)
+  RTC.set(synced);
+
+  // A correction of whole hours, like a change to or from daylight saving
+  // time, only moves the hour hand; anything else shows on the next tick
+  if (synced.Minute == currentTime.Minute && synced.Hour != currentTime.Hour)
+    showHour(synced.Hour);
+
+  currentTime = synced;
+#endif
+}
+
+void SpiralWatchy::busyCallback(const void *watchy)
+{
+  SpiralWatchy *self = (SpiralWatchy *)watchy;
+
+  // Work that can wait for the panel is done while it refreshes
+  if (self->prerenderPending)
   {
-    sa += -startY * dx12;
-    sb += -startY * dx02;
-    startY = 0;
+    self->prerenderPending = false;
+    self->prerender();
   }
- 
-  int endY = v2.y;
 
-  if (endY > 200)
-    endY = 200;
+  profiler.lap(PROFILE_REFRESH);
 
-  for (y = startY; y <= endY; y++) {
-    a = v1.x + sa / dy12;
-    b = v0.x + sb / dy02;
+  // Light sleep would drop the WiFi connection of a sync still going, the
+  // other core waits for it instead
+  if (weatherSync.running())
+  {
+    delay(1);
+    profiler.lap(PROFILE_SLEEP);
+    return;
+  }
 
-    sa += dx12;
-    sb += dx02;
+  // Then light sleep until BUSY drops, as WatchyDisplay's own callback does;
+  // setting this one replaced it
+  unsigned long sleepStart = micros();
 
-    /* longhand:
-    a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if (a > b)
-      _swap_int16_t(a, b);
+  gpio_wakeup_enable((gpio_num_t)DISPLAY_BUSY, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  esp_light_sleep_start();
 
-    drawLine(a, y, b - a + 1, v0, uv0, aa, uv1, bb, uv2, invDen, bitmap, w, h);
-  }
-  display.endWrite();
+  profiler.add(PROFILE_SLEEP_US, micros() - sleepStart);
+  profiler.lap(PROFILE_SLEEP);
 }
 
-void SpiralWatchy::writeFastHLineUV(int16_t x, int16_t y, int16_t w, Vector uvA, Vector uvB, const uint8_t bitmap[], int bw, int bh)
+void SpiralWatchy::prerender()
 {
-  display.startWrite();
+#if SPIRAL_PRERENDER || SPIRAL_ANIMATION_FRAMES
+  profiler.lap(PROFILE_REFRESH);
+  profiler.divert(PROFILE_PRERENDER);
 
-  for (int i = 0; i < w; i++)
-  {
-    float lerpVal = i / (w + 1.0);
-    Vector uv = (uvA * lerpVal) + (uvB * (1.0 - lerpVal));
-    bool white = getColor(uv.x, uv.y, bitmap, bw, bh);
-    display.drawPixel(x + i, y, white ? GxEPD_WHITE : GxEPD_BLACK);
-  }
+  // The panel is refreshing, there is nothing left to drop
+  interruptible = false;
+
+  // The next frame of the sweep for animateSpiral(), or the next tick's face
+  bool drawn = renderFace(aheadFrame, nextHour, nextMinute, nextBatteryFill);
+  aheadDrawn = drawn && !animating;
+  aheadTemperature = shownTemperature();
 
-  display.endWrite();
+  profiler.lap(PROFILE_PRERENDER);
+  profiler.divert(PROFILE_COUNTER_COUNT);
+#endif
 }
 
-static bool getColor2(int16_t x, int16_t y, int16_t xUv, int16_t yUv, const uint8_t *bitmap, int16_t w, int16_t h) 
+void SpiralWatchy::pushFrame(const FrameBuffer &frame)
 {
-  return bitmap[yUv * w + xUv] > BlueNoise200[y * 200 + x];
+  display.drawBitmap(0, 0, frame.pixels, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_WHITE, GxEPD_BLACK);
+  facePushed = true;
 }
 
-void SpiralWatchy::drawLine2(int x, int y, int w, VectorInt v0, Vector uv0, VectorInt a, Vector uv1, VectorInt b, Vector uv2, float invDen, const uint8_t *bitmap, int16_t bw, int16_t bh)
-{
-  for (int i = 0; i < w; i++)
-  {
-    float ua, va, wa;
-    VectorInt pointA = {x + i, y};
-    barycentric(pointA, a, b, v0, invDen, ua, va, wa);
+#if SPIRAL_REFRESH_WINDOWS
+// What the panel shows, taken from the frame cache before it is replaced
+static FrameBuffer shownFrame;
+#endif
 
-    Vector uv = uv0 * ua + uv1 * va + uv2 * wa;
+void SpiralWatchy::showWatchFaceWindows()
+{
+#if SPIRAL_REFRESH_WINDOWS
+  display.setFullWindow();
+  guiState = WATCHFACE_STATE;
 
-    bool white = getColor2(x + i, y, uv.x, uv.y, bitmap, bw, bh);
-    display.drawPixel(x + i, y, white ? GxEPD_WHITE : GxEPD_BLACK);
-  }
-}
+  profiler.start();
+  facePushed = false;
 
-void SpiralWatchy::fillTriangle2(VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2, const uint8_t bitmap[], int w, int h)
-{
-  int16_t a, b, y, last;
-  Vector uvA, uvB;
+  int hour = currentTime.Hour;
+  int minute = tickSchedule.shownMinute(hour, currentTime.Minute);
+  float batteryFill = getBatteryFill();
+  FrameKey key = frameKey(hour, minute, batteryFill);
 
-  // Sort coordinates by Y order (y2 >= y1 >= y0)
-  if (v0.y > v1.y) {
-    _swap_vector_int(v0, v1);
-    _swap_vector(uv0, uv1);
-  }
-  if (v1.y > v2.y) {
-    _swap_vector_int(v2, v1);
-    _swap_vector(uv2, uv1);
-  }
-  if (v0.y > v1.y) {
-    _swap_vector_int(v0, v1);
-    _swap_vector(uv0, uv1);
-  }
+  writtenCount = 0;
+  flipped = 0;
 
-  display.startWrite();
-  if (v0.y == v2.y) { // Handle awkward all-on-same-line case as its own thing
-    a = b = v0.x;
-    uvA = uv0;
-    uvB = uv0;
+  if (!showAhead(key))
+  {
+    const FrameBuffer *previous = frameCache.previous();
 
-    if (v1.x < a)
+    // Nothing known about what the panel shows, so nothing about its ghosting
+    // either
+    if (previous == nullptr)
     {
-      a = v1.x;
-      uvA = uv1;
+      drawWatchFace();
+      prerenderNext(hour, currentTime.Minute, batteryFill);
+      display.display(false);
+      refreshScheduler.fullRefreshDone();
+      return;
     }
-    else if (v1.x > b)
-    { 
-      b = v1.x;
-      uvB = uv1;
-    }
-    if (v2.x < a)
+
+    memcpy(shownFrame.pixels, previous->pixels, FrameBuffer::BYTES);
+
+    // The panel already shows this frame
+    if (frameCache.load(key, faceFrame))
     {
-      a = v2.x;
-      uvA = uv2;
+      profiler.add(PROFILE_FRAME_CACHE_HITS, 1);
+      pushFrame(faceFrame);
+      profiler.report("refreshWindows");
+      return;
     }
-    else if (v2.x > b)
+
+    if (!drawFace(hour, minute, batteryFill))
     {
-      b = v2.x;
-      uvB = uv2;
+      drawWatchFace();
+      display.display(true);
+      return;
     }
 
-    writeFastHLineUV2(a, v0.y, b - a + 1, uvA, uvB, bitmap, w, h);
-    display.endWrite();
-    return;
+    writeWindows(0, SCREEN_HEIGHT);
   }
 
-  int16_t dx01 = v1.x - v0.x, dy01 = v1.y - v0.y, 
-          dx02 = v2.x - v0.x, dy02 = v2.y - v0.y,
-          dx12 = v2.x - v1.x, dy12 = v2.y - v1.y;
-  int32_t sa = 0, sb = 0;
-
-  // For upper part of triangle, find scanline crossings for segments
-  // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
-  // is included here (and second loop will be skipped, avoiding a /0
-  // error there), otherwise scanline y1 is skipped here and handled
-  // in the second loop...which also avoids a /0 error here if y0=y1
-  // (flat-topped triangle).
-  if (v1.y == v2.y)
-    last = v1.y; // Include y1 scanline
-  else
-    last = v1.y - 1; // Skip it
+  profiler.lap(PROFILE_PUSH);
 
-    
-  VectorInt aa = v1 - v0, bb = v2 - v0;
-  float invDen = 1 / VectorInt::crossProduct(aa, bb);
+  pushFrame(faceFrame);
 
-  int startY = v0.y;
+  profiler.add(PROFILE_FLIPPED_PIXELS, flipped);
+  profiler.mark(PROFILE_TO_PANEL);
+  prerenderNext(hour, currentTime.Minute, batteryFill);
 
-  if (startY < 0)
+  // The controller holds the whole new frame by now, the windows that did not
+  // change already were
+  if (refreshScheduler.fullRefreshDue(flipped, hour, minute))
+  {
+    display.epd2.refresh(false);
+    display.epd2.writeImagePartAgain(faceFrame.pixels, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0, SCREEN_WIDTH,
+                                     SCREEN_HEIGHT);
+    refreshScheduler.fullRefreshDone();
+    profiler.add(PROFILE_FULL_REFRESHES, 1);
+    profiler.add(PROFILE_REFRESH_BYTES, FrameBuffer::BYTES);
+  }
+  else
   {
-    sa += -startY * dx01;
-    sb += -startY * dx02;
-    startY = 0;
+    refreshWritten();
+    refreshScheduler.partialRefreshDone(flipped);
   }
 
-  for (y = startY; y <= last && y < 200; y++) {
-    a = v0.x + sa / dy01;
-    b = v0.x + sb / dy02;
+  profiler.lap(PROFILE_REFRESH);
+  profiler.add(PROFILE_GHOST_PIXELS, refreshScheduler.ghostPixels());
+  profiler.report("refreshWindows");
+#endif
+}
 
-    sa += dx01;
-    sb += dx02;
+bool SpiralWatchy::showHour(int hour)
+{
+#if SPIRAL_REFRESH_WINDOWS
+  FrameKey shown;
+  const FrameBuffer *previous = frameCache.previous(&shown);
 
-    
-    /* longhand:
-    a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if (a > b)
-      _swap_int16_t(a, b);
+  if (previous == nullptr)
+    return false;
 
-    if (y >= 0 && y < 200)
-      drawLine2(a, y, b - a + 1, v0, uv0, aa, uv1, bb, uv2, invDen, bitmap, w, h);
-  }
+  float batteryFill = getBatteryFill();
+  FrameKey key = frameKey(hour, shown.minute, batteryFill);
+
+  // The spiral and the rim stay as they are
+  if (key.bucket != shown.bucket || key.economy != shown.economy || !loadAssets())
+    return false;
+
+  profiler.start();
 
-  startY = last + 1;
+  memcpy(shownFrame.pixels, previous->pixels, FrameBuffer::BYTES);
+  memcpy(faceFrame.pixels, previous->pixels, FrameBuffer::BYTES);
 
-  // For lower part of triangle, find scanline crossings for segments
-  // 0-2 and 1-2.  This loop is skipped if y1=y2.
-  sa = (int32_t)dx12 * (startY - v1.y);
-  sb = (int32_t)dx02 * (startY - v0.y);
-  
-  if (startY < 0)
+  // Everything under the hands before and after is drawn again, and the
+  // temperature when a weather sync changed it
+  ClipRect clips[2] = {byteAlignClip(unionClip(renderer.handBounds(shown.hour, shown.minute),
+                                               renderer.handBounds(hour, shown.minute))),
+                       TEMPERATURE_BOUNDS};
+  int clipCount = key.temperature != shown.temperature ? 2 : 1;
+  int top = SCREEN_HEIGHT;
+  int bottom = 0;
+
+  for (int i = 0; i < clipCount; i++)
   {
-    sa += -startY * dx12;
-    sb += -startY * dx02;
-    startY = 0;
+    const ClipRect &clip = clips[i];
+
+    for (int y = clip.top; y < clip.bottom; y++)
+      memset(faceFrame.pixels + y * FrameBuffer::STRIDE + clip.left / 8, 0xFF, (clip.right - clip.left) / 8);
+
+    renderer.setClip(clip);
+    renderer.drawBackground(faceFrame, shown.minute, batteryFill);
+    renderer.drawHands(faceFrame, hour, shown.minute);
+    renderer.drawTemperature(faceFrame);
+
+    top = clip.top < top ? clip.top : top;
+    bottom = clip.bottom > bottom ? clip.bottom : bottom;
   }
- 
-  int endY = v2.y;
 
-  if (endY > 200)
-    endY = 200;
+  renderer.setClip(SCREEN_CLIP);
 
-  for (y = startY; y <= endY; y++) {
-    a = v1.x + sa / dy12;
-    b = v0.x + sb / dy02;
+  profiler.lap(PROFILE_HANDS);
+  frameCache.store(key, faceFrame);
+  pushFrame(faceFrame);
 
-    sa += dx12;
-    sb += dx02;
+  writtenCount = 0;
+  flipped = 0;
 
-    /* longhand:
-    a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if (a > b)
-      _swap_int16_t(a, b);
+  writeWindows(top, bottom);
+  refreshWritten();
+  refreshScheduler.partialRefreshDone(flipped);
 
-    drawLine2(a, y, b - a + 1, v0, uv0, aa, uv1, bb, uv2, invDen, bitmap, w, h);
-  }
-  display.endWrite();
+  profiler.lap(PROFILE_REFRESH);
+  profiler.report("showHour");
+  return true;
+#else
+  (void)hour;
+  return false;
+#endif
 }
 
-void SpiralWatchy::writeFastHLineUV2(int16_t x, int16_t y, int16_t w, Vector uvA, Vector uvB, const uint8_t bitmap[], int bw, int bh)
+void SpiralWatchy::writeWindows(int top, int bottom)
 {
-  display.startWrite();
-
-  for (int i = 0; i < w; i++)
-  {
-    float lerpVal = i / (w + 1.0);
-    Vector uv = (uvA * lerpVal) + (uvB * (1.0 - lerpVal));
-    bool white = getColor2(x + i, y, uv.x, uv.y, bitmap, bw, bh);
-    display.drawPixel(x + i, y, white ? GxEPD_WHITE : GxEPD_BLACK);
-  }
-
-  display.endWrite();
+#if SPIRAL_REFRESH_WINDOWS
+  FrameWindow windows[SPIRAL_REFRESH_WINDOWS];
+  int count = diffFrames(shownFrame, faceFrame, top, bottom, windows, SPIRAL_REFRESH_WINDOWS);
+
+  flipped += RefreshScheduler::countFlipped(shownFrame, faceFrame, top, bottom);
+  sendWindows(windows, count);
+#else
+  (void)top;
+  (void)bottom;
+#endif
 }
 
-void SpiralWatchy::drawLine(int x, int y, int w, VectorInt v0, Vector uv0, VectorInt a, Vector uv1, VectorInt b, Vector uv2, float invDen, const uint8_t *bitmap, int16_t bw, int16_t bh, uint16_t color)
+void SpiralWatchy::sendWindows(const FrameWindow *windows, int count)
 {
-  for (int i = 0; i < w; i++)
+#if SPIRAL_REFRESH_WINDOWS
+  // Watchy does not rotate the display, so frame and panel coordinates are
+  // the same
+  for (int i = 0; i < count; i++)
   {
-    float ua, va, wa;
-    VectorInt pointA = {x + i, y};
-    barycentric(pointA, a, b, v0, invDen, ua, va, wa);
+    const FrameWindow &w = windows[i];
 
-    Vector uv = uv0 * ua + uv1 * va + uv2 * wa;
+    display.epd2.writeImagePart(faceFrame.pixels, w.x, w.y, SCREEN_WIDTH, SCREEN_HEIGHT, w.x, w.y, w.w, w.h);
+    profiler.add(PROFILE_REFRESH_BYTES, windowBytes(w));
 
-    bool draw = getColor2(x + i, y, uv.x, uv.y, bitmap, bw, bh);
-
-    if (!draw)
-      display.drawPixel(x + i, y, color);
+    // Out of room, the last window grows instead
+    if (writtenCount < MAX_WRITTEN)
+      written[writtenCount++] = w;
+    else
+      written[MAX_WRITTEN - 1] = mergeWindows(written[MAX_WRITTEN - 1], w);
   }
+#else
+  (void)windows;
+  (void)count;
+#endif
 }
 
-void SpiralWatchy::fillTriangle(VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2, const uint8_t bitmap[], int w, int h, uint16_t color)
+void SpiralWatchy::refreshWritten()
 {
-  int16_t a, b, y, last;
-  Vector uvA, uvB;
+  // What GxEPD2's displayWindow() does after writing, but with one refresh
+  // for all the windows. The controller keeps the previous image for the
+  // differential waveform, so every window is written again after it.
+  if (writtenCount == 0)
+    return;
 
-  // Sort coordinates by Y order (y2 >= y1 >= y0)
-  if (v0.y > v1.y) {
-    _swap_vector_int(v0, v1);
-    _swap_vector(uv0, uv1);
-  }
-  if (v1.y > v2.y) {
-    _swap_vector_int(v2, v1);
-    _swap_vector(uv2, uv1);
-  }
-  if (v0.y > v1.y) {
-    _swap_vector_int(v0, v1);
-    _swap_vector(uv0, uv1);
+  FrameWindow all = written[0];
+
+  for (int i = 1; i < writtenCount; i++)
+    all = mergeWindows(all, written[i]);
+
+  display.epd2.refresh(all.x, all.y, all.w, all.h);
+
+  for (int i = 0; i < writtenCount; i++)
+  {
+    const FrameWindow &w = written[i];
+
+    display.epd2.writeImagePartAgain(faceFrame.pixels, w.x, w.y, SCREEN_WIDTH, SCREEN_HEIGHT, w.x, w.y, w.w, w.h);
+    profiler.add(PROFILE_REFRESH_BYTES, windowBytes(w));
   }
+}
 
-  display.startWrite();
-  if (v0.y == v2.y) { // Handle awkward all-on-same-line case as its own thing
-    a = b = v0.x;
-    uvA = uv0;
-    uvB = uv0;
+#if SPIRAL_ANIMATION_FRAMES
+// Minute frame of the animation draws at: a whole turn of the spiral, and the
+// minute hand with it, ending on minute
+static int sweepMinute(int minute, int frame)
+{
+  return (minute + VECTOR_SIZE * (SPIRAL_ANIMATION_FRAMES - frame) / SPIRAL_ANIMATION_FRAMES) % VECTOR_SIZE;
+}
+#endif
 
-    if (v1.x < a)
-    {
-      a = v1.x;
-      uvA = uv1;
-    }
-    else if (v1.x > b)
-    { 
-      b = v1.x;
-      uvB = uv1;
-    }
-    if (v2.x < a)
-    {
-      a = v2.x;
-      uvA = uv2;
-    }
-    else if (v2.x > b)
-    {
-      b = v2.x;
-      uvB = uv2;
-    }
+void SpiralWatchy::animateSpiral()
+{
+#if SPIRAL_ANIMATION_FRAMES
+  const FrameBuffer *previous = frameCache.previous();
 
-    writeFastHLineUV(a, v0.y, b - a + 1, uvA, uvB, bitmap, w, h, color);
-    display.endWrite();
+  // Nothing to diff the first frame against
+  if (previous == nullptr)
     return;
-  }
 
-  int16_t dx01 = v1.x - v0.x, dy01 = v1.y - v0.y, 
-          dx02 = v2.x - v0.x, dy02 = v2.y - v0.y,
-          dx12 = v2.x - v1.x, dy12 = v2.y - v1.y;
-  int32_t sa = 0, sb = 0;
-
-  // For upper part of triangle, find scanline crossings for segments
-  // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
-  // is included here (and second loop will be skipped, avoiding a /0
-  // error there), otherwise scanline y1 is skipped here and handled
-  // in the second loop...which also avoids a /0 error here if y0=y1
-  // (flat-topped triangle).
-  if (v1.y == v2.y)
-    last = v1.y; // Include y1 scanline
-  else
-    last = v1.y - 1; // Skip it
+  memcpy(shownFrame.pixels, previous->pixels, FrameBuffer::BYTES);
 
-    
-  VectorInt aa = v1 - v0, bb = v2 - v0;
-  float invDen = 1 / VectorInt::crossProduct(aa, bb);
+  profiler.start();
+  display.epd2.setBusyCallback(busyCallback, this);
 
-  int startY = v0.y;
+  int hour = currentTime.Hour;
+  int minute = tickSchedule.shownMinute(hour, currentTime.Minute);
+  float batteryFill = getBatteryFill();
+  unsigned long start = millis();
 
-  if (startY < 0)
-  {
-    sa += -startY * dx01;
-    sb += -startY * dx02;
-    startY = 0;
-  }
+  // Every frame is drawn while the panel refreshes the one before, only the
+  // first waits for it
+  animating = true;
 
-  for (y = startY; y <= last && y < 200; y++) {
-    a = v0.x + sa / dy01;
-    b = v0.x + sb / dy02;
+  int frame = 1;
+  bool drawn = renderFace(faceFrame, hour, sweepMinute(minute, frame), batteryFill);
 
-    sa += dx01;
-    sb += dx02;
+  while (drawn && frame < SPIRAL_ANIMATION_FRAMES && millis() - start < SPIRAL_ANIMATION_MS)
+  {
+    if (frame + 1 < SPIRAL_ANIMATION_FRAMES)
+    {
+      nextHour = hour;
+      nextMinute = sweepMinute(minute, frame + 1);
+      nextBatteryFill = batteryFill;
+      prerenderPending = true;
+    }
 
-    
-    /* longhand:
-    a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if (a > b)
-      _swap_int16_t(a, b);
+    refreshAnimationFrame();
+    profiler.add(PROFILE_ANIMATION_FRAMES, 1);
 
-    drawLine(a, y, b - a + 1, v0, uv0, aa, uv1, bb, uv2, invDen, bitmap, w, h, color);
+    memcpy(faceFrame.pixels, aheadFrame.pixels, FrameBuffer::BYTES);
+    frame++;
   }
 
-  startY = last + 1;
-
-  // For lower part of triangle, find scanline crossings for segments
-  // 0-2 and 1-2.  This loop is skipped if y1=y2.
-  sa = (int32_t)dx12 * (startY - v1.y);
-  sb = (int32_t)dx02 * (startY - v0.y);
+  animating = false;
+  prerenderPending = false;
 
-  if (startY < 0)
+  // The face itself, cached as what the panel shows like on a tick
+  if (drawFace(hour, minute, batteryFill))
   {
-    sa += -startY * dx12;
-    sb += -startY * dx02;
-    startY = 0;
+    pushFrame(faceFrame);
+    refreshAnimationFrame();
   }
 
-  int endY = v2.y;
+  profiler.report("animateSpiral");
+#endif
+}
 
-  if (endY > 200)
-    endY = 200;
+void SpiralWatchy::refreshAnimationFrame()
+{
+#if SPIRAL_ANIMATION_FRAMES
+  writtenCount = 0;
+  flipped = 0;
 
-  for (y = startY; y <= endY; y++) {
-    a = v1.x + sa / dy12;
-    b = v0.x + sb / dy02;
+  writeWindows(0, SCREEN_HEIGHT);
+  profiler.lap(PROFILE_PUSH);
 
-    sa += dx12;
-    sb += dx02;
+  refreshWritten();
+  refreshScheduler.partialRefreshDone(flipped);
+  profiler.lap(PROFILE_REFRESH);
 
-    /* longhand:
-    a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if (a > b)
-      _swap_int16_t(a, b);
+  memcpy(shownFrame.pixels, faceFrame.pixels, FrameBuffer::BYTES);
+#endif
+}
 
-   drawLine(a, y, b - a + 1, v0, uv0, aa, uv1, bb, uv2, invDen, bitmap, w, h, color);
+void SpiralWatchy::abandonFrame()
+{
+#if SPIRAL_REFRESH_WINDOWS
+  // The controller is left holding what the panel shows
+  for (int i = 0; i < writtenCount; i++)
+  {
+    const FrameWindow &w = written[i];
+    display.epd2.writeImagePart(shownFrame.pixels, w.x, w.y, SCREEN_WIDTH, SCREEN_HEIGHT, w.x, w.y, w.w, w.h);
   }
-  display.endWrite();
+#endif
+
+  profiler.mark(PROFILE_INTERRUPTED);
+  profiler.report("interrupted");
+
+  // The button is still down, so it wakes the watch again at once
+  deepSleep();
 }
 
-void SpiralWatchy::writeFastHLineUV(int16_t x, int16_t y, int16_t w, Vector uvA, Vector uvB, const uint8_t bitmap[], int bw, int bh, uint16_t color)
+float SpiralWatchy::getBatteryFill()
 {
-  display.startWrite();
+  float VBAT = getBatteryVoltage();
 
-  for (int i = 0; i < w; i++)
-  {
-    float lerpVal = i / (w + 1.0);
-    Vector uv = (uvA * lerpVal) + (uvB * (1.0 - lerpVal));
-    bool draw = getColor2(x + i, y, uv.x, uv.y, bitmap, bw, bh);
+  // 12 battery states
+  float batState = ((VBAT - VOLTAGE_MIN) / VOLTAGE_RANGE);
+  if (batState > 1.0f)
+    batState = 1.0f;
+  if (batState < 0.0f)
+    batState = 0.0f;
 
-    if (!draw)
-      display.drawPixel(x + i, y, color);
-  }
+#if SPIRAL_ECONOMY_MV > 0 && SPIRAL_ENGINE != SPIRAL_ENGINE_BAKED
+  // Every frame is drawn for the fill read here, the profile goes with it
+  if (batState < ECONOMY_ON)
+    economy = true;
+  else if (batState > ECONOMY_OFF)
+    economy = false;
+#endif
 
-  display.endWrite();
-}
\ No newline at end of file
+  return batState;
+}
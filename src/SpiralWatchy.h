@@ -1,45 +1,120 @@
 #pragma once
 
 #include <Watchy.h>
-#include "../include/images.h"
-#include "../include/MatCapSource.h"
-#include "Vector.h"
-#include "../include/BlueNoise200.h"
-#include "../include/SpiralFaceShadow.h"
-#include "../include/SpiralFaceShadowCenter.h"
-#include "../include/SpiralFaceWithShadow.h"
+#include "AssetPack.h"
+#include "FaceRenderer.h"
+#include "FrameBuffer.h"
+#include "FrameCache.h"
+#include "FrameDiff.h"
 
 class SpiralWatchy : public Watchy
 {
 public:
   SpiralWatchy(const watchySettings& s);
+
+  // Minute ticks on the watch face are drawn and refreshed here, everything
+  // else is left to Watchy::init(), which this hides
+  void init(String datetime = "");
+
   void drawWatchFace();
+  void handleButtonPress();
 
   float getBatteryFill();
 
-  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
-                              int16_t w, int16_t h, uint16_t color, bool even);
+  bool loadAssets();
+  void loadRenderer(FaceRenderer &target);
+
+  // Copies a rendered frame into the display buffer
+  void pushFrame(const FrameBuffer &frame);
+
+  // Moves the hour hand the panel shows to hour, for a correction that leaves
+  // the minute alone, redrawing and refreshing only around the hands and the
+  // temperature; false when anything else about the face changed too
+  bool showHour(int hour);
+
+private:
+  static FrameKey frameKey(int hour, int minute, float batteryFill);
+
+  // Draws the face into faceFrame and caches it; false without an asset pack
+  bool drawFace(int hour, int minute, float batteryFill);
+
+  // Draws the face into frame; false without an asset pack
+  bool renderFace(FrameBuffer &frame, int hour, int minute, float batteryFill);
+
+  // On a tick with SPIRAL_INTERRUPTIBLE, drops the frame and goes to sleep
+  // when a button is down; the press wakes the watch again right away
+  void checkButtons();
+  void abandonFrame();
+
+  // Sets the RTC alarm for the next tick TickSchedule says draws
+  void scheduleNextTick();
+
+  // With SPIRAL_WEATHER_SYNC, starts fetching the weather when it is due, and
+  // waits for it before deep sleep, setting the RTC from NTP
+  void startWeatherSync();
+  void finishWeatherSync();
+
+  // With SPIRAL_PRERENDER, has the next tick's face drawn during the next wait
+  // for the panel; hour and minute are the time now, not the one shown
+  void prerenderNext(int hour, int minute, float batteryFill);
+
+  // Keeps the face prerenderNext() had drawn in the frame cache for the next
+  // tick, unless the time changed since; before deep sleep
+  void storeAhead();
+
+  // Writes the windows of the face stored ahead for key, as writeWindows()
+  // does for one drawn now; false when none was
+  bool showAhead(const FrameKey &key);
+
+  // Draws the next tick's face, or the next frame of animateSpiral(), while
+  // the panel refreshes
+  void prerender();
+
+  // Sweeps the spiral round to the time, then shows the face
+  void animateSpiral();
+  void refreshAnimationFrame();
+
+  // GxEPD2 calls it while the panel is BUSY refreshing: runs the deferred
+  // work, then light sleeps until the refresh is done
+  static void busyCallback(const void *watchy);
+
+  // Draws the face, writes the windows of rows top to bottom that changed to
+  // the controller, then refreshes only that part of the panel
+  void showWatchFaceWindows();
+  void writeWindows(int top, int bottom);
+  void sendWindows(const FrameWindow *windows, int count);
+  void refreshWritten();
+
+  AssetPack assets;
+  FaceRenderer renderer;
+
+#if SPIRAL_RENDER_CORES > 1
+  // Draws on the second core
+  FaceRenderer workerRenderer;
+#endif
 
+  // Whether the last drawWatchFace() pushed a rendered face
+  bool facePushed = false;
 
-  void DrawHand(float angle, float size);                           
-  void fillTriangle(VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2, const uint8_t bitmap[], int w, int h);
-  
-   void drawLine(int x, int y, int w, VectorInt v0, Vector uv0, VectorInt a, Vector uv1, VectorInt b, Vector uv2, float den, const uint8_t *bitmap, int16_t bw, int16_t bh);
+  // Windows written to the controller by writeWindows() and the pixels they
+  // flipped, for the refresh
+  static const int MAX_WRITTEN = SPIRAL_REFRESH_WINDOWS > 0 ? SPIRAL_REFRESH_WINDOWS : 1;
 
-                                
-  void writeFastHLineUV(int16_t x, int16_t y, int16_t w, Vector uvA, Vector uvB, const uint8_t bitmap[], int bw, int bh);
+  FrameWindow written[MAX_WRITTEN];
+  int writtenCount = 0;
+  int flipped = 0;
 
-  void fillTriangle2(VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2, const uint8_t bitmap[], int w, int h);
-  
-  void drawLine2(int x, int y, int w, VectorInt v0, Vector uv0, VectorInt a, Vector uv1, VectorInt b, Vector uv2, float den, const uint8_t *bitmap, int16_t bw, int16_t bh);
-            
-  void writeFastHLineUV2(int16_t x, int16_t y, int16_t w, Vector uvA, Vector uvB, const uint8_t bitmap[], int bw, int bh);
+  // Whether checkButtons() may drop the frame
+  bool interruptible = false;
 
-  
+  // Whether frames are drawn for animateSpiral(), the economy way
+  bool animating = false;
 
-  void fillTriangle(VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2, const uint8_t bitmap[], int w, int h, uint16_t color);
-  
-  void drawLine(int x, int y, int w, VectorInt v0, Vector uv0, VectorInt a, Vector uv1, VectorInt b, Vector uv2, float den, const uint8_t *bitmap, int16_t bw, int16_t bh, uint16_t color);
-            
-  void writeFastHLineUV(int16_t x, int16_t y, int16_t w, Vector uvA, Vector uvB, const uint8_t bitmap[], int bw, int bh, uint16_t color);
+  // What prerender() draws, and whether it drew the next tick's face
+  bool prerenderPending = false;
+  bool aheadDrawn = false;
+  int nextHour = 0;
+  int nextMinute = 0;
+  float nextBatteryFill = 0.0f;
+  int aheadTemperature = FaceRenderer::NO_TEMPERATURE;
 };
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include "FrameBuffer.h"
+
+// Pre-dithered 1bpp image with a coverage mask, baked by the asset compiler
+// for a fixed place on the screen. The header is followed by rows * bytes
+// pairs of (bits, mask) bytes in FrameBuffer layout; pixels outside the mask
+// have their bits clear. Crops start on a byte column, so drawing is a masked
+// byte copy with no shifting.
+struct SpriteHeader
+{
+  uint8_t column; // first byte column of the crop
+  uint8_t top;    // first row
+  uint8_t bytes;  // bytes per row
+  uint8_t rows;
+};
+
+static_assert(sizeof(SpriteHeader) == 4, "SpriteHeader layout is baked into the asset pack");
+
+// Only the rows top .. bottom - 1 and the byte columns of pixels left ..
+// right - 1 of the screen are touched; left and right are rounded to bytes
+inline void drawSprite(FrameBuffer &frame, const uint8_t *sprite, int top = 0, int bottom = SCREEN_HEIGHT,
+                       int left = 0, int right = SCREEN_WIDTH)
+{
+  const SpriteHeader *header = (const SpriteHeader *)sprite;
+  int first = top > header->top ? top - header->top : 0;
+  int last = bottom < header->top + header->rows ? bottom - header->top : header->rows;
+  int firstByte = left / 8 > header->column ? left / 8 - header->column : 0;
+  int lastByte = (right + 7) / 8 < header->column + header->bytes ? (right + 7) / 8 - header->column : header->bytes;
+  const uint8_t *pairs = sprite + sizeof(SpriteHeader) + first * header->bytes * 2;
+  uint8_t *row = frame.pixels + (header->top + first) * FrameBuffer::STRIDE + header->column;
+
+  for (int y = first; y < last; y++, row += FrameBuffer::STRIDE, pairs += header->bytes * 2)
+  {
+    for (int i = firstByte; i < lastByte; i++)
+      row[i] = (row[i] & ~pairs[i * 2 + 1]) | pairs[i * 2];
+  }
+}
@@ -0,0 +1,85 @@
+#include "Texture.h"
+#include "Profiler.h"
+
+#include <math.h>
+
+#if SPIRAL_TEXTURE_CACHE
+TextureCache textureCache;
+#endif
+
+void Texture::load(const AssetPack &pack, const TextureDesc &base, const TextureDesc *tiledDesc,
+                   const TextureDesc *mipChain, int mipChainCount)
+{
+  texels = pack.data(base);
+  width = base.width;
+  height = base.height;
+
+  tiled = tiledDesc != nullptr ? pack.data(*tiledDesc) : nullptr;
+
+  mipCount = mipChainCount < MAX_MIPS ? mipChainCount : MAX_MIPS;
+  mipDescs = mipChain;
+
+  for (int i = 0; i < mipCount; i++)
+    mips[i] = pack.data(mipChain[i]);
+}
+
+#if SPIRAL_FACE_MIPS
+// Mip level for a triangle from how many texels land on each pixel
+static int selectMipLevel(int mipCount, VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2)
+{
+  float screenArea = fabsf(VectorInt::crossProduct(v1 - v0, v2 - v0));
+
+  if (screenArea < 1.0f)
+    return 0;
+
+  float uvArea = fabsf(Vector::crossProduct(uv1 - uv0, uv2 - uv0));
+  int level = (int)floorf(0.5f * log2f(uvArea / screenArea));
+
+  if (level < 0)
+    return 0;
+
+  if (level > mipCount)
+    return mipCount;
+
+  return level;
+}
+#endif
+
+void TextureSampler::bind(const Texture &texture, VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2)
+{
+  this->texture = &texture;
+
+#if SPIRAL_FACE_MIPS
+  mipLevel = 0;
+
+  if (texture.mipCount > 0)
+    mipLevel = selectMipLevel(texture.mipCount, v0, uv0, v1, uv1, v2, uv2);
+
+  if (mipLevel > 0)
+  {
+    const TextureDesc &mip = texture.mipDescs[mipLevel - 1];
+    mipTexels = texture.mips[mipLevel - 1];
+    mipWidth = mip.width;
+    mipHeight = mip.height;
+
+    profiler.add(PROFILE_MIP_TRIANGLES, 1);
+
+#if SPIRAL_TEXTURE_CACHE
+    cache->unbind();
+#endif
+    return;
+  }
+#endif
+
+#if SPIRAL_TEXTURE_CACHE
+  if (texture.tiled == nullptr)
+  {
+    cache->unbind();
+    return;
+  }
+
+  cache->bind(texture.tiled, texture.width, texture.height,
+              fminf(uv0.x, fminf(uv1.x, uv2.x)), fminf(uv0.y, fminf(uv1.y, uv2.y)),
+              fmaxf(uv0.x, fmaxf(uv1.x, uv2.x)), fmaxf(uv0.y, fmaxf(uv1.y, uv2.y)));
+#endif
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+#include "AssetPack.h"
+#include "FaceConfig.h"
+#include "TextureCache.h"
+#include "Vector.h"
+
+// A gray8 texture in the asset pack and the optional copies of it the asset
+// compiler can add: the same texels in cache tiles, and the mip chain below
+// the base level.
+struct Texture
+{
+  static const int MAX_MIPS = 8;
+
+  const uint8_t *texels;
+  int16_t width;
+  int16_t height;
+
+  const uint8_t *tiled;
+  const uint8_t *mips[MAX_MIPS];
+  const TextureDesc *mipDescs;
+  int mipCount;
+
+  void load(const AssetPack &pack, const TextureDesc &base, const TextureDesc *tiledDesc = nullptr,
+            const TextureDesc *mipChain = nullptr, int mipChainCount = 0);
+};
+
+#if SPIRAL_TEXTURE_CACHE
+extern TextureCache textureCache;
+#endif
+
+// Picks what sample() reads for a triangle: a mip level when the texture is
+// minified, otherwise the tiles under the triangle's UVs made resident in the
+// tile cache, if the texture has a tiled copy and they all fit, otherwise the
+// texture itself.
+class TextureSampler
+{
+public:
+  void bind(const Texture &texture, VectorInt v0, Vector uv0, VectorInt v1, Vector uv1, VectorInt v2, Vector uv2);
+
+#if SPIRAL_TEXTURE_CACHE
+  // textureCache unless set, every core needs one of its own
+  void setCache(TextureCache *cache) { this->cache = cache; }
+#endif
+
+  // Mip level picked for the bound triangle, 0 for the base texture
+  int level() const
+  {
+#if SPIRAL_FACE_MIPS
+    return mipLevel;
+#else
+    return 0;
+#endif
+  }
+
+  inline uint8_t sample(int16_t u, int16_t v) const
+  {
+#if SPIRAL_FACE_MIPS
+    if (mipLevel > 0)
+    {
+      u >>= mipLevel;
+      v >>= mipLevel;
+
+      if (u < 0) u = 0;
+      if (u > mipWidth - 1) u = mipWidth - 1;
+      if (v < 0) v = 0;
+      if (v > mipHeight - 1) v = mipHeight - 1;
+
+      return mipTexels[v * mipWidth + u];
+    }
+#endif
+
+#if SPIRAL_TEXTURE_CACHE
+    if (cache->isBound())
+      return cache->sample(u, v);
+#endif
+
+    return texture->texels[v * texture->width + u];
+  }
+
+private:
+  const Texture *texture = nullptr;
+
+#if SPIRAL_TEXTURE_CACHE
+  TextureCache *cache = &textureCache;
+#endif
+
+#if SPIRAL_FACE_MIPS
+  // Level picked for the current triangle, 0 for the base texture
+  int mipLevel = 0;
+  const uint8_t *mipTexels = nullptr;
+  int mipWidth = 0;
+  int mipHeight = 0;
+#endif
+};
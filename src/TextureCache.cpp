@@ -0,0 +1,108 @@
+#include "TextureCache.h"
+#include "Profiler.h"
+
+#include <math.h>
+#include <string.h>
+
+TextureCache::TextureCache()
+{
+  reset();
+}
+
+void TextureCache::reset()
+{
+  for (int i = 0; i < SPIRAL_TEXTURE_CACHE_TILES; i++)
+  {
+    slotTile[i] = nullptr;
+    slotStamp[i] = 0;
+  }
+
+  stamp = 0;
+  bound = false;
+}
+
+int TextureCache::findSlot(const uint8_t *tile) const
+{
+  for (int i = 0; i < SPIRAL_TEXTURE_CACHE_TILES; i++)
+  {
+    if (slotTile[i] == tile)
+      return i;
+  }
+
+  return -1;
+}
+
+int TextureCache::evictSlot() const
+{
+  int oldest = 0;
+
+  for (int i = 1; i < SPIRAL_TEXTURE_CACHE_TILES; i++)
+  {
+    if (slotStamp[i] < slotStamp[oldest])
+      oldest = i;
+  }
+
+  return oldest;
+}
+
+bool HOT_KERNEL TextureCache::bind(const uint8_t *tiled, int width, int height, float u0, float v0, float u1, float v1)
+{
+  bound = false;
+
+  // One texel of margin each side, UVs are truncated when sampling
+  minU = (int)floorf(u0) - 1;
+  minV = (int)floorf(v0) - 1;
+  maxU = (int)ceilf(u1) + 1;
+  maxV = (int)ceilf(v1) + 1;
+
+  if (minU < 0) minU = 0;
+  if (minV < 0) minV = 0;
+  if (maxU > width - 1) maxU = width - 1;
+  if (maxV > height - 1) maxV = height - 1;
+
+  if (minU > maxU || minV > maxV)
+    return false;
+
+  int tilesX = (width + TILE_SIZE - 1) >> TILE_SHIFT;
+  int tilesY = (height + TILE_SIZE - 1) >> TILE_SHIFT;
+  int tileX0 = minU >> TILE_SHIFT, tileX1 = maxU >> TILE_SHIFT;
+  int tileY0 = minV >> TILE_SHIFT, tileY1 = maxV >> TILE_SHIFT;
+
+  if (tilesX > MAX_TILES_PER_SIDE || tilesY > MAX_TILES_PER_SIDE ||
+      (tileX1 - tileX0 + 1) * (tileY1 - tileY0 + 1) > SPIRAL_TEXTURE_CACHE_TILES)
+  {
+    profiler.add(PROFILE_TILE_BYPASS, 1);
+    return false;
+  }
+
+  // Tiles touched by this bind carry the newest stamp, so they are never
+  // evicted for each other
+  stamp++;
+
+  for (int ty = tileY0; ty <= tileY1; ty++)
+  {
+    for (int tx = tileX0; tx <= tileX1; tx++)
+    {
+      const uint8_t *tile = tiled + (ty * tilesX + tx) * TILE_BYTES;
+      int slot = findSlot(tile);
+
+      if (slot >= 0)
+      {
+        profiler.add(PROFILE_TILE_HITS, 1);
+      }
+      else
+      {
+        profiler.add(PROFILE_TILE_MISSES, 1);
+        slot = evictSlot();
+        memcpy(slots[slot], tile, TILE_BYTES);
+        slotTile[slot] = tile;
+      }
+
+      slotStamp[slot] = stamp;
+      tileMap[ty * MAX_TILES_PER_SIDE + tx] = slots[slot];
+    }
+  }
+
+  bound = true;
+  return true;
+}
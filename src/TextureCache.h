@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+#include "FaceConfig.h"
+
+// Small DRAM cache of square texture tiles, filled from textures stored in
+// the ASSET_FORMAT_GRAY8_TILED layout. Before a triangle is filled, bind()
+// makes every tile under its UV bounding box resident, so the span loop only
+// samples DRAM. Tiles stay cached across triangles and the least recently
+// used one is evicted first.
+class TextureCache
+{
+public:
+  static const int TILE_SHIFT = 5;
+  static const int TILE_SIZE = 1 << TILE_SHIFT;
+  static const int TILE_BYTES = TILE_SIZE * TILE_SIZE;
+  static const int MAX_TILES_PER_SIDE = 8;
+
+  TextureCache();
+
+  void reset();
+
+  // Returns false when the bounding box needs more tiles than there are
+  // slots; the caller has to sample the texture directly then.
+  bool bind(const uint8_t *tiled, int width, int height, float u0, float v0, float u1, float v1);
+  void unbind() { bound = false; }
+  bool isBound() const { return bound; }
+
+  inline uint8_t sample(int u, int v) const
+  {
+    // Barycentric UVs can stray a little past the triangle's bounding box
+    if (u < minU) u = minU;
+    if (u > maxU) u = maxU;
+    if (v < minV) v = minV;
+    if (v > maxV) v = maxV;
+
+    const uint8_t *tile = tileMap[(v >> TILE_SHIFT) * MAX_TILES_PER_SIDE + (u >> TILE_SHIFT)];
+    return tile[((v & (TILE_SIZE - 1)) << TILE_SHIFT) + (u & (TILE_SIZE - 1))];
+  }
+
+private:
+  int findSlot(const uint8_t *tile) const;
+  int evictSlot() const;
+
+  uint8_t slots[SPIRAL_TEXTURE_CACHE_TILES][TILE_BYTES];
+  const uint8_t *slotTile[SPIRAL_TEXTURE_CACHE_TILES];
+  uint32_t slotStamp[SPIRAL_TEXTURE_CACHE_TILES];
+  uint32_t stamp;
+
+  const uint8_t *tileMap[MAX_TILES_PER_SIDE * MAX_TILES_PER_SIDE];
+  int minU, minV, maxU, maxV;
+  bool bound;
+};
@@ -0,0 +1,66 @@
+#include "TickSchedule.h"
+
+const int MINUTES_PER_DAY = 24 * 60;
+
+// Minutes between the ticks that draw at night
+#if SPIRAL_NIGHT_MINUTES > 1
+const int NIGHT_STEP = SPIRAL_NIGHT_MINUTES;
+#else
+const int NIGHT_STEP = 1;
+#endif
+
+// Minute of the day of the last button press, -1 for none yet
+static RTC_DATA_ATTR int16_t pressMinute = -1;
+
+TickSchedule tickSchedule;
+
+static bool night(int hour)
+{
+#if SPIRAL_NIGHT_START > SPIRAL_NIGHT_END
+  return hour >= SPIRAL_NIGHT_START || hour < SPIRAL_NIGHT_END;
+#else
+  return hour >= SPIRAL_NIGHT_START && hour < SPIRAL_NIGHT_END;
+#endif
+}
+
+bool TickSchedule::quiet(int hour, int minute) const
+{
+  if (NIGHT_STEP == 1 || !night(hour))
+    return false;
+
+  if (pressMinute < 0)
+    return true;
+
+  int sincePress = (hour * 60 + minute - pressMinute + MINUTES_PER_DAY) % MINUTES_PER_DAY;
+  return sincePress >= NIGHT_STEP;
+}
+
+bool TickSchedule::due(int hour, int minute) const
+{
+  return !quiet(hour, minute) || minute % NIGHT_STEP == 0;
+}
+
+int TickSchedule::shownMinute(int hour, int minute) const
+{
+  return quiet(hour, minute) ? minute - minute % NIGHT_STEP : minute;
+}
+
+int TickSchedule::minutesToNext(int hour, int minute) const
+{
+  int now = hour * 60 + minute;
+
+  for (int ahead = 1; ahead < NIGHT_STEP; ahead++)
+  {
+    int next = (now + ahead) % MINUTES_PER_DAY;
+
+    if (due(next / 60, next % 60))
+      return ahead;
+  }
+
+  return NIGHT_STEP;
+}
+
+void TickSchedule::buttonPressed(int hour, int minute)
+{
+  pressMinute = hour * 60 + minute;
+}
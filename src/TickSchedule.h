@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdint.h>
+#include "FaceConfig.h"
+
+// Which minute ticks draw the face. From SPIRAL_NIGHT_START to
+// SPIRAL_NIGHT_END only every SPIRAL_NIGHT_MINUTES minutes does, and the face
+// shows the time of the last one, so the coarser hands are plain to see. A
+// button press brings every minute back for SPIRAL_NIGHT_MINUTES minutes; the
+// time of the last one is kept in RTC memory.
+class TickSchedule
+{
+public:
+  // Whether a tick at hour:minute draws, the others are slept through
+  bool due(int hour, int minute) const;
+
+  // The minute the face shows at hour:minute
+  int shownMinute(int hour, int minute) const;
+
+  // Minutes from hour:minute to the next tick that draws
+  int minutesToNext(int hour, int minute) const;
+
+  void buttonPressed(int hour, int minute);
+
+private:
+  bool quiet(int hour, int minute) const;
+};
+
+extern TickSchedule tickSchedule;
@@ -1,6 +1,14 @@
 #pragma once
 
+#ifdef ARDUINO
 #include <Arduino.h>
+#else
+#include <math.h>
+
+#ifndef DEG_TO_RAD
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#endif
+#endif
 #include "VectorInt.h"
 
 struct Vector
@@ -88,5 +96,5 @@ public:
         return {x * scale, y * scale};
     }
 
-    operator VectorInt() const {return {x, y};}
+    operator VectorInt() const {return {(int)x, (int)y};}
 };
\ No newline at end of file
@@ -1,6 +1,14 @@
 #pragma once
 
+#ifdef ARDUINO
 #include <Arduino.h>
+#else
+#include <math.h>
+
+#ifndef DEG_TO_RAD
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#endif
+#endif
 
 struct VectorInt
 {
@@ -76,6 +84,6 @@ public:
 
     VectorInt operator*(const float scale) const
     {
-        return {x * scale, y * scale};
+        return {(int)(x * scale), (int)(y * scale)};
     }
 };
\ No newline at end of file
@@ -0,0 +1,452 @@
+#include "WeatherSync.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFi.h>
+#include <esp_sntp.h>
+#else
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+const int MINUTES_PER_DAY = 24 * 60;
+
+// Longest the NTP answer is waited for once connected, the HTTP one has its
+// own timeouts
+const uint32_t NTP_TIMEOUT_MS = 5000;
+const int HTTP_TIMEOUT_MS = 5000;
+
+static RTC_DATA_ATTR Weather cached = {false, 0, 0};
+
+// Minute of the day of the last start(), -1 for none yet
+static RTC_DATA_ATTR int16_t lastStart = -1;
+
+WeatherSync weatherSync;
+
+// What the task was asked for and what it got; the main core only reads the
+// result after the task signalled it is done
+struct SyncJob
+{
+  char url[WeatherSync::URL_SIZE];
+  char ntpServer[64];
+  long gmtOffset;
+
+  bool gotWeather;
+  Weather weather;
+  bool gotTime;
+  struct tm time;
+};
+
+static SyncJob job;
+
+// Set by start(), cleared by the task when it is done. The busy callback reads
+// it on this core while the task runs on the other.
+static std::atomic<bool> busy(false);
+
+// The value of the first "key" at or after from, nullptr when there is none
+static const char *valueOf(const char *from, const char *key)
+{
+  char quoted[16];
+  int length = snprintf(quoted, sizeof(quoted), "\"%s\"", key);
+
+  while ((from = strstr(from, quoted)) != nullptr)
+  {
+    from += length;
+
+    while (*from == ' ')
+      from++;
+
+    // A string value that looks like the key
+    if (*from++ != ':')
+      continue;
+
+    while (*from == ' ')
+      from++;
+
+    return from;
+  }
+
+  return nullptr;
+}
+
+bool WeatherSync::parse(const char *body, Weather &weather, long &gmtOffset)
+{
+  // {"weather":[{"id":800,"main":"Clear",...}],...,"main":{"temp":21.5,...},...,"timezone":-14400,...}
+  const char *conditions = valueOf(body, "weather");
+  const char *id = conditions != nullptr ? valueOf(conditions, "id") : nullptr;
+  const char *main = body;
+
+  // The condition has a "main" of its own, a string
+  while ((main = valueOf(main, "main")) != nullptr && *main != '{')
+    ;
+
+  const char *temp = main != nullptr ? valueOf(main, "temp") : nullptr;
+
+  if (id == nullptr || temp == nullptr)
+    return false;
+
+  char *end;
+  long condition = strtol(id, &end, 10);
+
+  if (end == id)
+    return false;
+
+  float temperature = strtof(temp, &end);
+
+  if (end == temp)
+    return false;
+
+  weather.valid = true;
+  weather.temperature = (int16_t)lroundf(temperature * 10.0f);
+  weather.condition = (int16_t)condition;
+
+  // Seconds from UTC at the city, with daylight saving time
+  const char *timezone = valueOf(body, "timezone");
+
+  if (timezone != nullptr)
+  {
+    long offset = strtol(timezone, &end, 10);
+
+    if (end != timezone)
+      gmtOffset = offset;
+  }
+
+  return true;
+}
+
+bool WeatherSync::expandUrl(char *url, size_t size, const char *pattern, const WeatherQuery &query)
+{
+  const struct
+  {
+    const char *name;
+    const char *value;
+  } fields[] = {
+    {"{cityID}", query.cityID}, {"{lat}", query.lat},   {"{lon}", query.lon},
+    {"{units}", query.units},   {"{lang}", query.lang}, {"{apiKey}", query.apiKey},
+  };
+
+  size_t length = 0;
+
+  while (*pattern != '\0')
+  {
+    // Anything but a placeholder is copied as it is
+    const char *value = pattern;
+    size_t valueLength = 1;
+    size_t patternLength = 1;
+
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+    {
+      size_t nameLength = strlen(fields[i].name);
+
+      if (strncmp(pattern, fields[i].name, nameLength) == 0)
+      {
+        value = fields[i].value != nullptr ? fields[i].value : "";
+        valueLength = strlen(value);
+        patternLength = nameLength;
+        break;
+      }
+    }
+
+    if (length + valueLength >= size)
+      return false;
+
+    memcpy(url + length, value, valueLength);
+    length += valueLength;
+    pattern += patternLength;
+  }
+
+  if (length >= size)
+    return false;
+
+  url[length] = '\0';
+  return true;
+}
+
+#ifdef ARDUINO
+// The radio stack runs on core 0 too, the fetch mostly waits on it
+const uint32_t SYNC_STACK = 8192;
+
+static SemaphoreHandle_t done = nullptr;
+
+static void syncTask(void *)
+{
+  // Credentials stored by Watchy's WiFi setup
+  WiFi.mode(WIFI_STA);
+  WiFi.begin();
+
+  if (WiFi.waitForConnectResult() == WL_CONNECTED)
+  {
+    HTTPClient http;
+    long gmtOffset = job.gmtOffset;
+
+    http.setConnectTimeout(HTTP_TIMEOUT_MS);
+    http.setTimeout(HTTP_TIMEOUT_MS);
+    http.begin(job.url);
+
+    if (http.GET() == HTTP_CODE_OK)
+      job.gotWeather = WeatherSync::parse(http.getString().c_str(), job.weather, gmtOffset);
+
+    http.end();
+
+    if (job.ntpServer[0] != '\0')
+    {
+      // getLocalTime() takes any system time past 2016, which deep sleep keeps
+      // from the last sync running on the RC clock, so wait for the answer
+      sntp_set_sync_status(SNTP_SYNC_STATUS_RESET);
+      configTime(gmtOffset, 0, job.ntpServer);
+
+      uint32_t start = millis();
+
+      while (sntp_get_sync_status() != SNTP_SYNC_STATUS_COMPLETED && millis() - start < NTP_TIMEOUT_MS)
+        delay(10);
+
+      job.gotTime = sntp_get_sync_status() == SNTP_SYNC_STATUS_COMPLETED && getLocalTime(&job.time, 0);
+      sntp_stop();
+    }
+  }
+
+  WiFi.mode(WIFI_OFF);
+
+  busy = false;
+  xSemaphoreGive(done);
+  vTaskDelete(nullptr);
+}
+
+static bool startTask()
+{
+  if (done == nullptr)
+    done = xSemaphoreCreateBinary();
+
+  busy = done != nullptr &&
+         xTaskCreatePinnedToCore(syncTask, "WeatherSync", SYNC_STACK, nullptr, uxTaskPriorityGet(nullptr), nullptr,
+                                 1 - xPortGetCoreID()) == pdPASS;
+  return busy;
+}
+
+static bool waitTask(uint32_t timeoutMs)
+{
+  return xSemaphoreTake(done, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+}
+#else
+static std::mutex doneMutex;
+static std::condition_variable doneSignal;
+
+// http://host[:port]/path only, into body
+static bool httpGet(const char *url, char *body, size_t size)
+{
+  const char *prefix = "http://";
+
+  if (strncmp(url, prefix, strlen(prefix)) != 0)
+    return false;
+
+  const char *host = url + strlen(prefix);
+  const char *path = strchr(host, '/');
+  const char *colon = strchr(host, ':');
+  char hostName[64];
+  char port[8] = "80";
+
+  if (path == nullptr)
+    path = "/";
+
+  const char *hostEnd = colon != nullptr && colon < path ? colon : path;
+
+  if ((size_t)(hostEnd - host) >= sizeof(hostName))
+    return false;
+
+  memcpy(hostName, host, hostEnd - host);
+  hostName[hostEnd - host] = '\0';
+
+  if (hostEnd == colon)
+    snprintf(port, sizeof(port), "%.*s", (int)(path - colon - 1), colon + 1);
+
+  addrinfo hints = {};
+  addrinfo *address;
+  hints.ai_socktype = SOCK_STREAM;
+
+  if (getaddrinfo(hostName, port, &hints, &address) != 0)
+    return false;
+
+  int fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+  timeval timeout = {HTTP_TIMEOUT_MS / 1000, 0};
+  bool connected = fd >= 0 && setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0 &&
+                   connect(fd, address->ai_addr, address->ai_addrlen) == 0;
+
+  freeaddrinfo(address);
+
+  char request[512];
+  int requestLength = snprintf(request, sizeof(request), "GET %s HTTP/1.0\r\nHost: %s\r\n\r\n", path, hostName);
+  size_t received = 0;
+
+  if (connected && send(fd, request, requestLength, 0) == requestLength)
+  {
+    ssize_t count;
+
+    while (received + 1 < size && (count = recv(fd, body + received, size - 1 - received, 0)) > 0)
+      received += count;
+  }
+
+  if (fd >= 0)
+    close(fd);
+
+  body[received] = '\0';
+
+  // HTTP/1.x 200, then the body after the headers
+  const char *content = strstr(body, "\r\n\r\n");
+
+  if (strncmp(body, "HTTP/1.", 7) != 0 || strncmp(body + 8, " 200", 4) != 0 || content == nullptr)
+    return false;
+
+  memmove(body, content + 4, strlen(content + 4) + 1);
+  return true;
+}
+
+// Seconds from 1900, where NTP counts from, to 1970
+const uint32_t NTP_UNIX_OFFSET = 2208988800u;
+
+// One SNTP request to host[:port], into now
+static bool sntpQuery(const char *server, time_t &now)
+{
+  const char *colon = strchr(server, ':');
+  size_t hostLength = colon != nullptr ? (size_t)(colon - server) : strlen(server);
+  char hostName[64];
+  char port[8] = "123";
+
+  if (hostLength >= sizeof(hostName))
+    return false;
+
+  memcpy(hostName, server, hostLength);
+  hostName[hostLength] = '\0';
+
+  if (colon != nullptr)
+    snprintf(port, sizeof(port), "%s", colon + 1);
+
+  addrinfo hints = {};
+  addrinfo *address;
+  hints.ai_socktype = SOCK_DGRAM;
+
+  if (getaddrinfo(hostName, port, &hints, &address) != 0)
+    return false;
+
+  // Connected, so a refused request fails at once instead of timing out
+  int fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+  timeval timeout = {NTP_TIMEOUT_MS / 1000, 0};
+  bool connected = fd >= 0 && setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0 &&
+                   connect(fd, address->ai_addr, address->ai_addrlen) == 0;
+
+  freeaddrinfo(address);
+
+  // Version 4, client mode, the rest 0
+  uint8_t packet[48] = {0x23};
+  ssize_t received = -1;
+
+  if (connected && send(fd, packet, sizeof(packet), 0) == (ssize_t)sizeof(packet))
+    received = recv(fd, packet, sizeof(packet), 0);
+
+  if (fd >= 0)
+    close(fd);
+
+  // A server answers in mode 4, with the seconds it sent it at from byte 40
+  if (received != (ssize_t)sizeof(packet) || (packet[0] & 7) != 4)
+    return false;
+
+  uint32_t seconds = (uint32_t)packet[40] << 24 | (uint32_t)packet[41] << 16 | (uint32_t)packet[42] << 8 | packet[43];
+  now = (time_t)(seconds - NTP_UNIX_OFFSET);
+  return true;
+}
+
+static void syncThread()
+{
+  static char body[4096];
+  long gmtOffset = job.gmtOffset;
+  time_t now;
+
+  if (httpGet(job.url, body, sizeof(body)))
+    job.gotWeather = WeatherSync::parse(body, job.weather, gmtOffset);
+
+  if (job.ntpServer[0] != '\0' && sntpQuery(job.ntpServer, now))
+  {
+    // What configTime() makes of the offset on the device
+    now += gmtOffset;
+    job.gotTime = gmtime_r(&now, &job.time) != nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(doneMutex);
+  busy = false;
+  doneSignal.notify_all();
+}
+
+static bool startTask()
+{
+  busy = true;
+  std::thread(syncThread).detach();
+  return true;
+}
+
+static bool waitTask(uint32_t timeoutMs)
+{
+  std::unique_lock<std::mutex> lock(doneMutex);
+  return doneSignal.wait_for(lock, std::chrono::milliseconds(timeoutMs), [] { return !busy; });
+}
+#endif
+
+bool WeatherSync::due(int minute, int intervalMinutes) const
+{
+  return lastStart < 0 || (minute - lastStart + MINUTES_PER_DAY) % MINUTES_PER_DAY >= intervalMinutes;
+}
+
+void WeatherSync::start(int minute, const char *url, const char *ntpServer, long gmtOffset)
+{
+  if (busy)
+    return;
+
+  // A failed fetch waits for the next interval too, rather than keeping the
+  // radio busy every tick
+  lastStart = minute;
+
+  snprintf(job.url, sizeof(job.url), "%s", url);
+  snprintf(job.ntpServer, sizeof(job.ntpServer), "%s", ntpServer != nullptr ? ntpServer : "");
+  job.gmtOffset = gmtOffset;
+  job.gotWeather = false;
+  job.gotTime = false;
+
+  if (!startTask())
+    job.url[0] = '\0';
+}
+
+bool WeatherSync::running() const
+{
+  return busy;
+}
+
+bool WeatherSync::finish(uint32_t timeoutMs, struct tm &time)
+{
+  // Not started this wake
+  if (job.url[0] == '\0' || !waitTask(timeoutMs))
+    return false;
+
+  job.url[0] = '\0';
+
+  if (job.gotWeather)
+    cached = job.weather;
+
+  time = job.time;
+  return job.gotTime;
+}
+
+const Weather &WeatherSync::weather() const
+{
+  return cached;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include "FaceConfig.h"
+
+// The last weather fetched
+struct Weather
+{
+  bool valid;
+  int16_t temperature; // tenths of a degree, in the unit settings.h asks for
+  int16_t condition;   // OpenWeatherMap condition id
+};
+
+// What settings.h fills the placeholders of its weather URL with
+struct WeatherQuery
+{
+  const char *cityID;
+  const char *lat;
+  const char *lon;
+  const char *units;
+  const char *lang;
+  const char *apiKey;
+};
+
+// Fetches the weather, and the time from NTP, on a task pinned to the other
+// core while this one draws the face, so a sync never holds up a tick. The
+// wake that starts it draws with the weather cached in RTC memory, finish()
+// waits for the task before deep sleep and caches what it got. On the host
+// the task is a thread that fetches plain http:// URLs and asks an SNTP
+// server over UDP directly; tools/host/sync_check.py runs it against local
+// stub servers.
+class WeatherSync
+{
+public:
+  static const size_t URL_SIZE = 256;
+
+  // Whether intervalMinutes have passed since the last start(), minutes being
+  // the minute of the day
+  bool due(int minute, int intervalMinutes) const;
+
+  // Starts fetching url, then the time from ntpServer unless it is nullptr or
+  // empty; a host name with an optional :port on the host. Both strings are
+  // copied. gmtOffset is only used when the response has no "timezone" for
+  // the city, which includes daylight saving time.
+  void start(int minute, const char *url, const char *ntpServer, long gmtOffset);
+
+  // Whether a fetch is still going, the radio must not light sleep then
+  bool running() const;
+
+  // Waits up to timeoutMs for the fetch and caches the weather if it got
+  // one; true when it got the local time as well, into time
+  bool finish(uint32_t timeoutMs, struct tm &time);
+
+  const Weather &weather() const;
+
+  // The fields of an OpenWeatherMap current weather response, and its
+  // "timezone" into gmtOffset when it has one
+  static bool parse(const char *body, Weather &weather, long &gmtOffset);
+
+  // pattern with the placeholders Watchy::getWeatherData() fills in, {cityID}
+  // or {lat} and {lon}, {units}, {lang} and {apiKey}, into url; false when
+  // it does not fit into size
+  static bool expandUrl(char *url, size_t size, const char *pattern, const WeatherQuery &query);
+};
+
+extern WeatherSync weatherSync;
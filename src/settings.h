@@ -3,26 +3,41 @@
 
 //Weather Settings
 #define CITY_ID "5128581" //New York City https://openweathermap.org/current#cityid
+
+//You can also use LAT,LON for your location instead of CITY_ID, but not both
+//#define LAT "40.7127" //New York City, Looked up on https://www.latlong.net/
+//#define LON "-74.0059"
+
+#ifdef CITY_ID
+    #define OPENWEATHERMAP_URL "http://api.openweathermap.org/data/2.5/weather?id={cityID}&lang={lang}&units={units}&appid={apiKey}" //open weather api using city ID
+#else
+    #define OPENWEATHERMAP_URL "http://api.openweathermap.org/data/2.5/weather?lat={lat}&lon={lon}&lang={lang}&units={units}&appid={apiKey}" //open weather api using lat lon
+#endif
+
 #define OPENWEATHERMAP_APIKEY "f058fe1cad2afe8e2ddc5d063a64cecb" //use your own API key :)
-#define OPENWEATHERMAP_URL "http://api.openweathermap.org/data/2.5/weather?id=" //open weather api
 #define TEMP_UNIT "metric" //metric = Celsius , imperial = Fahrenheit
 #define TEMP_LANG "en"
 #define WEATHER_UPDATE_INTERVAL 30 //must be greater than 5, measured in minutes
 //NTP Settings
 #define NTP_SERVER "pool.ntp.org"
-#define GMT_OFFSET_SEC 3600 * 5 //New York is UTC 1
-#define DST_OFFSET_SEC 3600
+#define GMT_OFFSET_SEC 3600 * -5 //New York is UTC -5 EST, -4 EDT
 
 watchySettings settings{
-    CITY_ID,
-    OPENWEATHERMAP_APIKEY,
-    OPENWEATHERMAP_URL,
-    TEMP_UNIT,
-    TEMP_LANG,
-    WEATHER_UPDATE_INTERVAL,
-    NTP_SERVER,
-    GMT_OFFSET_SEC,
-    DST_OFFSET_SEC
+    #ifdef CITY_ID
+        .cityID = CITY_ID,
+    #else
+        .cityID = "",
+        .lat = LAT,
+        .lon = LON,
+    #endif
+    .weatherAPIKey = OPENWEATHERMAP_APIKEY,
+    .weatherURL = OPENWEATHERMAP_URL,
+    .weatherUnit = TEMP_UNIT,
+    .weatherLang = TEMP_LANG,
+    .weatherUpdateInterval = WEATHER_UPDATE_INTERVAL,
+    .ntpServer = NTP_SERVER,
+    .gmtOffset = GMT_OFFSET_SEC,
+    .vibrateOClock = true, //Buzz on the hour
 };
 
-#endif
\ No newline at end of file
+#endif
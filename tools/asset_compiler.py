@@ -0,0 +1,396 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+"""
+Asset compiler
+~~~~~~~~~~~~~~
+Compile the textures listed in assets/assets.json into the binary asset pack,
+a header of constexpr texture descriptors pointing into it and a size report.
+Runs automatically as part of "pio run" (see tools/pio_assets.py), or by hand:
+   >>> python tools/asset_compiler.py <output dir> [-DSPIRAL_...=<value> ...]
+
+Spiral engines that draw from baked images, and the hand and overlay sprites
+(see src/FaceConfig.h), get them baked into the pack too: the textures are compiled into a first pack, the
+host baker in tools/host/ is built with HOST_CXX (default "c++") and the
+firmware's SPIRAL_* switches and renders the images from that pack with the
+firmware's own renderer, and the final pack holds both.
+
+Outputs, all written to <output dir>:
+   assets.bin         the pack, flashed with "pio run -t uploadassets"
+   AssetIndex.h       constexpr TextureDesc for every texture layout
+   assets_report.txt  size of every asset and of the whole pack
+   assets_config.txt  the SPIRAL_* overrides the pack was compiled for
+
+Layouts a texture can request in the manifest:
+   gray8    8 bits per texel, row-major
+   tiled    8 bits per texel, TILE_SIZE x TILE_SIZE tiles stored one after the
+            other, edge texels repeated into the padding
+   gray4    4 bits per texel, row-major, first texel in the high nibble
+   mips     mip chain below the base level, each level gray8, 2x2 box filter
+   minmax   min and max texel value of every TILE_SIZE x TILE_SIZE tile
+"""
+
+from __future__ import print_function
+import sys, os, re, json, subprocess
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import assetpack
+
+
+############################### Global Variables ###############################
+
+TILE_SIZE = 32
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MANIFEST = os.path.join(PROJECT_DIR, "assets", "assets.json")
+PARTITIONS = os.path.join(PROJECT_DIR, "spiral_partitions.csv")
+SOURCE_DIR = os.path.join(PROJECT_DIR, "src")
+HOST_DIR = os.path.join(PROJECT_DIR, "tools", "host")
+FACE_CONFIG = os.path.join(SOURCE_DIR, "FaceConfig.h")
+
+LAYOUT_SUFFIX = {
+    "gray8": "",
+    "tiled": ".tiled",
+    "gray4": ".gray4",
+    "mips": ".mips",
+    "minmax": ".minmax",
+}
+
+################################## Functions ###################################
+
+## Texel fetch with the coordinates clamped to the texture.
+def texel(width, height, data, x, y):
+    x = min(max(x, 0), width - 1)
+    y = min(max(y, 0), height - 1)
+    return data[y * width + x]
+
+
+## Number of tiles along one side of a texture.
+def tileCount(size):
+    return (size + TILE_SIZE - 1) // TILE_SIZE
+
+
+def layoutTiled(width, height, data):
+    out = bytearray()
+    for ty in range(tileCount(height)):
+        for tx in range(tileCount(width)):
+            for y in range(TILE_SIZE):
+                for x in range(TILE_SIZE):
+                    out.append(texel(width, height, data, tx * TILE_SIZE + x, ty * TILE_SIZE + y))
+    return out
+
+
+def layoutGray4(width, height, data):
+    out = bytearray()
+    for y in range(height):
+        for x in range(0, width, 2):
+            high = data[y * width + x] >> 4
+            low = data[y * width + x + 1] >> 4 if x + 1 < width else 0
+            out.append((high << 4) | low)
+    return out
+
+
+## Build the mip chain below the base level.
+# @return List of (width, height, bytes), largest level first
+def mipChain(width, height, data):
+    levels = []
+    while width > 1 or height > 1:
+        nextWidth = (width + 1) // 2
+        nextHeight = (height + 1) // 2
+        level = bytearray()
+        for y in range(nextHeight):
+            for x in range(nextWidth):
+                total = (texel(width, height, data, 2 * x, 2 * y) +
+                         texel(width, height, data, 2 * x + 1, 2 * y) +
+                         texel(width, height, data, 2 * x, 2 * y + 1) +
+                         texel(width, height, data, 2 * x + 1, 2 * y + 1))
+                level.append((total + 2) // 4)
+        width, height, data = nextWidth, nextHeight, level
+        levels.append((width, height, data))
+    return levels
+
+
+def layoutMinMax(width, height, data):
+    out = bytearray()
+    for ty in range(tileCount(height)):
+        for tx in range(tileCount(width)):
+            values = [data[y * width + x]
+                      for y in range(ty * TILE_SIZE, min((ty + 1) * TILE_SIZE, height))
+                      for x in range(tx * TILE_SIZE, min((tx + 1) * TILE_SIZE, width))]
+            out.append(min(values))
+            out.append(max(values))
+    return out
+
+
+LAYOUT_FORMAT = {
+    "gray8": assetpack.FORMAT_GRAY8,
+    "tiled": assetpack.FORMAT_GRAY8_TILED,
+    "gray4": assetpack.FORMAT_GRAY4,
+    "mips": assetpack.FORMAT_GRAY8,
+    "minmax": assetpack.FORMAT_TILE_MINMAX,
+}
+
+
+## Size of the "assets" partition from the partition table, None if missing.
+def partitionSize(path):
+    with open(path) as f:
+        for line in f:
+            fields = [x.strip() for x in line.split("#")[0].split(",")]
+            if len(fields) >= 5 and fields[0] == "assets":
+                return int(fields[4], 0)
+    return None
+
+
+## Turn the manifest into pack entries plus the descriptors to generate.
+# @return (entries, descriptors) where descriptors is a list of
+#         (identifier, entry index, byte offset in entry, width, height, format,
+#          group) and group is None or the (array, count) names to list the
+#          descriptor under
+def compileTextures(manifest):
+    entries = []
+    descriptors = []
+
+    for name in sorted(manifest["textures"]):
+        texture = manifest["textures"][name]
+        source = os.path.join(PROJECT_DIR, "assets", texture["source"])
+        width, height, data = assetpack.loadGray8(source)
+
+        for layout in texture["layouts"]:
+            if layout not in LAYOUT_SUFFIX:
+                raise ValueError("%s: unknown layout \"%s\"" % (name, layout))
+
+            index = len(entries)
+            fmt = LAYOUT_FORMAT[layout]
+
+            if layout == "mips":
+                payload = bytearray()
+                for level, (levelWidth, levelHeight, levelData) in enumerate(mipChain(width, height, data)):
+                    descriptors.append(("%s_mip%d" % (name, level + 1), index, len(payload), levelWidth, levelHeight, fmt,
+                                        (name + "_mips", name + "_mipCount")))
+                    payload += levelData
+            else:
+                payload = {
+                    "gray8": lambda: data,
+                    "tiled": lambda: layoutTiled(width, height, data),
+                    "gray4": lambda: layoutGray4(width, height, data),
+                    "minmax": lambda: layoutMinMax(width, height, data),
+                }[layout]()
+                identifier = name if layout == "gray8" else "%s_%s" % (name, layout)
+                descriptors.append((identifier, index, 0, width, height, fmt, None))
+
+            entries.append((name + LAYOUT_SUFFIX[layout], width, height, fmt, bytes(payload)))
+
+    return entries, descriptors
+
+
+FORMAT_NAMES = {
+    assetpack.FORMAT_GRAY8: "ASSET_FORMAT_GRAY8",
+    assetpack.FORMAT_GRAY8_TILED: "ASSET_FORMAT_GRAY8_TILED",
+    assetpack.FORMAT_GRAY4: "ASSET_FORMAT_GRAY4",
+    assetpack.FORMAT_TILE_MINMAX: "ASSET_FORMAT_TILE_MINMAX",
+    assetpack.FORMAT_SPIRAL_MAP: "ASSET_FORMAT_SPIRAL_MAP",
+    assetpack.FORMAT_MONO1: "ASSET_FORMAT_MONO1",
+    assetpack.FORMAT_POLAR_LUT: "ASSET_FORMAT_POLAR_LUT",
+    assetpack.FORMAT_SPRITE: "ASSET_FORMAT_SPRITE",
+}
+
+
+def generateIndex(pack, descriptors):
+    parsed = assetpack.parse(pack)
+    checksum = assetpack.HEADER.unpack_from(pack, 0)[4]
+
+    s = "// Generated by tools/asset_compiler.py from assets/assets.json, do not edit.\n"
+    s += "#pragma once\n\n"
+    s += "#include \"AssetPack.h\"\n\n"
+    s += "const uint32_t ASSET_PACK_CHECKSUM = 0x%08x;\n" % checksum
+    s += "const uint32_t ASSET_PACK_SIZE = %d;\n" % len(pack)
+    s += "const int ASSET_TILE_SIZE = %d;\n\n" % TILE_SIZE
+    s += "namespace Assets\n{\n"
+
+    groups = {}
+    for identifier, index, offset, width, height, fmt, group in descriptors:
+        s += "  constexpr TextureDesc %s = {0x%06x, %d, %d, %s};\n" % (
+            identifier, parsed[index][1] + offset, width, height, FORMAT_NAMES[fmt])
+        if group:
+            groups.setdefault(group, []).append(identifier)
+
+    for array, count in sorted(groups):
+        members = groups[(array, count)]
+        s += "\n  constexpr int %s = %d;\n" % (count, len(members))
+        s += "  constexpr TextureDesc %s[] = {%s};\n" % (array, ", ".join(members))
+
+    s += "}\n"
+    return s
+
+
+def generateReport(pack, capacity):
+    lines = ["%-32s %-6s %9s" % ("asset", "format", "bytes")]
+    for name, offset, length, width, height, fmt in assetpack.parse(pack):
+        lines.append("%-32s %-6d %9d" % (name, fmt, length))
+    lines.append("")
+    lines.append("%-39s %9d" % ("pack total", len(pack)))
+    if capacity:
+        lines.append("%-39s %9d (%.1f%% used)" % ("assets partition", capacity, 100.0 * len(pack) / capacity))
+    return "\n".join(lines) + "\n"
+
+
+## Value of every SPIRAL_* switch: the defaults in FaceConfig.h with the
+#  build's -D overrides applied.
+# @param defines Dictionary of overridden switches, name to value string
+def faceConfig(defines):
+    raw = {}
+    with open(FACE_CONFIG) as f:
+        for line in f:
+            match = re.match(r"\s*#define\s+(SPIRAL_\w+)\s+(\S+)\s*$", line)
+            if match:
+                raw[match.group(1)] = match.group(2)
+    raw.update(defines)
+
+    config = {}
+    for name in raw:
+        value = raw[name]
+        while value in raw and value != name:
+            value = raw[value]
+        config[name] = int(value, 0)
+    return config
+
+
+## Whether the configuration draws from images baked by the host baker: the
+#  spiral of some engines, and the hand and overlay sprites.
+def needsBake(config):
+    return config["SPIRAL_ENGINE"] in (config["SPIRAL_ENGINE_ROTOZOOM"], config["SPIRAL_ENGINE_BAKED"],
+                                       config["SPIRAL_ENGINE_POLAR"]) or \
+        config["SPIRAL_HAND_SPRITES"] != 0 or config["SPIRAL_OVERLAY_SPRITES"] != 0
+
+
+def hostSources():
+    sources = [os.path.join(HOST_DIR, "bake.cpp")]
+    for name in sorted(os.listdir(SOURCE_DIR)):
+        if name.endswith(".cpp") and name not in ("main.cpp", "SpiralWatchy.cpp", "WeatherSync.cpp"):
+            sources.append(os.path.join(SOURCE_DIR, name))
+    return sources
+
+
+## Build the host baker against the AssetIndex.h of the first pack.
+# @return Path of the executable
+def buildBaker(buildDir, indexDir, defines):
+    executable = os.path.join(buildDir, "bake" + (".exe" if os.name == "nt" else ""))
+    command = [os.environ.get("HOST_CXX", "c++"), "-std=c++17", "-O2",
+               "-I" + SOURCE_DIR, "-I" + indexDir]
+    command += ["-D%s=%s" % (name, defines[name]) for name in sorted(defines)]
+    command += hostSources() + ["-o", executable]
+    subprocess.check_call(command)
+    return executable
+
+
+## Render the baked images from the textures-only pack.
+# @return List of (array, index, width, height, format, bytes)
+def bake(outDir, entries, defines):
+    stageDir = os.path.join(outDir, "stage1")
+    if not os.path.isdir(stageDir):
+        os.makedirs(stageDir)
+
+    entries, descriptors = entries
+    pack = assetpack.build(entries)
+    writeIfChanged(os.path.join(stageDir, "assets.bin"), pack, "wb")
+    writeIfChanged(os.path.join(stageDir, "AssetIndex.h"), generateIndex(pack, descriptors))
+
+    baker = buildBaker(stageDir, stageDir, defines)
+    listing = subprocess.check_output([baker, os.path.join(stageDir, "assets.bin"), stageDir])
+
+    images = []
+    for line in listing.decode().splitlines():
+        array, index, width, height, fmt, name = line.split()
+        with open(os.path.join(stageDir, name), "rb") as f:
+            images.append((array, int(index), int(width), int(height), int(fmt), f.read()))
+    return images
+
+
+## Append the baked images to the pack entries, as <array>_<index>
+#  descriptors listed in <array>[] and <array>Count, or as <array> alone for
+#  an index of -1.
+def addBaked(entries, descriptors, images):
+    for array, index, width, height, fmt, data in images:
+        if index < 0:
+            descriptors.append((array, len(entries), 0, width, height, fmt, None))
+            entries.append((array, width, height, fmt, data))
+        else:
+            descriptors.append(("%s_%d" % (array, index), len(entries), 0, width, height, fmt, (array, array + "Count")))
+            entries.append(("%s.%d" % (array, index), width, height, fmt, data))
+
+
+## Write a file only when its content changes, so unchanged generated headers
+#  do not trigger a rebuild.
+def writeIfChanged(path, content, mode="w"):
+    if os.path.exists(path):
+        with open(path, "r" + mode[1:]) as f:
+            if f.read() == content:
+                return
+    with open(path, mode) as f:
+        f.write(content)
+
+
+## Inputs whose change requires recompiling the assets.
+def inputs(manifest, config):
+    paths = [MANIFEST, PARTITIONS, FACE_CONFIG, os.path.abspath(__file__), assetpack.__file__]
+    for texture in manifest["textures"].values():
+        paths.append(os.path.join(PROJECT_DIR, "assets", texture["source"]))
+    if needsBake(config):
+        paths += [os.path.join(SOURCE_DIR, x) for x in os.listdir(SOURCE_DIR)]
+        paths += [os.path.join(HOST_DIR, x) for x in os.listdir(HOST_DIR)]
+    return paths
+
+
+## Compile the assets into outDir unless the outputs are already up to date.
+# @param defines SPIRAL_* switches overridden by the firmware build, name to
+#                value string
+# @return True when the pack fits the assets partition
+def run(outDir, defines={}, force=False):
+    with open(MANIFEST) as f:
+        manifest = json.load(f)
+
+    config = faceConfig(defines)
+    configText = "".join("%s=%s\n" % (name, defines[name]) for name in sorted(defines))
+
+    outputs = [os.path.join(outDir, x) for x in ("assets.bin", "AssetIndex.h", "assets_report.txt", "assets_config.txt")]
+    if not force and all(os.path.exists(x) for x in outputs):
+        newest = max(os.path.getmtime(x) for x in inputs(manifest, config))
+        with open(outputs[3]) as f:
+            sameConfig = f.read() == configText
+        if sameConfig and newest <= min(os.path.getmtime(x) for x in outputs):
+            return True
+
+    if not os.path.isdir(outDir):
+        os.makedirs(outDir)
+
+    entries, descriptors = compileTextures(manifest)
+    if needsBake(config):
+        addBaked(entries, descriptors, bake(outDir, (list(entries), list(descriptors)), defines))
+
+    pack = assetpack.build(entries)
+    capacity = partitionSize(PARTITIONS)
+    report = generateReport(pack, capacity)
+
+    writeIfChanged(outputs[0], pack, "wb")
+    writeIfChanged(outputs[1], generateIndex(pack, descriptors))
+    writeIfChanged(outputs[2], report)
+    with open(outputs[3], "w") as f:
+        f.write(configText)
+    print(report, end="")
+
+    if capacity is not None and len(pack) > capacity:
+        print("Error: asset pack (%d bytes) does not fit the assets partition (%d bytes)" % (len(pack), capacity), file=sys.stderr)
+        return False
+    return True
+
+
+#################################### Main ######################################
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2 or not all(x.startswith("-D") and "=" in x for x in sys.argv[2:]):
+        print("Usage:")
+        print("python " + sys.argv[0] + " <output dir> [-DSPIRAL_...=<value> ...]")
+        exit(-1)
+
+    defines = dict(x[2:].split("=", 1) for x in sys.argv[2:])
+    exit(0 if run(sys.argv[1], defines, force=True) else -1)
@@ -0,0 +1,119 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+"""
+Asset pack writer
+~~~~~~~~~~~~~~~~~
+Binary format of the asset pack read by src/AssetPack.cpp. The pack is built
+by tools/asset_compiler.py; this module can also be run on its own to list the
+contents of a pack:
+   >>> python tools/assetpack.py <assets.bin>
+"""
+
+from __future__ import print_function
+import sys, struct
+
+
+############################### Global Variables ###############################
+
+MAGIC = 0x4B505353  # "SSPK"
+VERSION = 2
+ALIGN = 32
+NAME_LEN = 32
+
+FORMAT_GRAY8 = 0
+FORMAT_GRAY8_TILED = 1
+FORMAT_GRAY4 = 2
+FORMAT_TILE_MINMAX = 3
+FORMAT_SPIRAL_MAP = 4
+FORMAT_MONO1 = 5
+FORMAT_POLAR_LUT = 6
+FORMAT_SPRITE = 7
+
+HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<%dsIIHHB3x" % NAME_LEN)
+
+################################## Functions ###################################
+
+## 32-bit FNV-1a, matches fnv1a() in src/AssetPack.cpp.
+# @param data   Bytes to hash
+# @return The hash value
+def fnv1a(data):
+    h = 2166136261
+    for b in bytearray(data):
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+## Round a size up to the pack alignment.
+def align(value):
+    return (value + ALIGN - 1) // ALIGN * ALIGN
+
+
+## Load an image as an 8-bit grayscale texture. Only the first channel of the
+#  image is used.
+# @param path   Source image path
+# @return (width, height, bytes)
+def loadGray8(path):
+    from PIL import Image
+    im = Image.open(path)
+    width, height = im.size
+    first = im.split()[0] if len(im.getbands()) > 1 else im
+    return width, height, first.tobytes()
+
+
+## Serialize a list of assets into a pack.
+# @param assets   List of (name, width, height, format, payload)
+# @return The pack as bytes
+def build(assets):
+    tableEnd = HEADER.size + ENTRY.size * len(assets)
+    offset = align(tableEnd)
+
+    table = b""
+    payload = b""
+
+    for name, width, height, fmt, data in assets:
+        if len(name) >= NAME_LEN:
+            raise ValueError("asset name too long: " + name)
+        table += ENTRY.pack(name.encode("ascii"), offset, len(data), width, height, fmt)
+        padding = align(len(data)) - len(data)
+        payload += bytes(data) + b"\0" * padding
+        offset += len(data) + padding
+
+    body = table + b"\0" * (align(tableEnd) - tableEnd) + payload
+    header = HEADER.pack(MAGIC, VERSION, len(assets), HEADER.size + len(body), fnv1a(body))
+    return header + body
+
+
+## Parse a pack back into its entries, used to check a file before flashing.
+# @param pack   The pack as bytes
+# @return List of (name, offset, size, width, height, format)
+def parse(pack):
+    magic, version, count, size, checksum = HEADER.unpack_from(pack, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("not an asset pack")
+    if size != len(pack) or fnv1a(pack[HEADER.size:]) != checksum:
+        raise ValueError("asset pack is corrupt")
+
+    entries = []
+    for i in range(count):
+        name, offset, length, width, height, fmt = ENTRY.unpack_from(pack, HEADER.size + i * ENTRY.size)
+        entries.append((name.rstrip(b"\0").decode("ascii"), offset, length, width, height, fmt))
+    return entries
+
+
+#################################### Main ######################################
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        print("Usage:")
+        print("python " + sys.argv[0] + " <assets.bin>")
+        exit(-1)
+
+    with open(sys.argv[1], "rb") as f:
+        pack = f.read()
+
+    for name, offset, length, width, height, fmt in parse(pack):
+        print("%-32s %4dx%-4d fmt %d %7d bytes @ 0x%06x" % (name, width, height, fmt, length, offset))
+    print("%d bytes total" % len(pack))
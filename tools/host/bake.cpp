@@ -0,0 +1,214 @@
+// Host side of the asset compiler: renders the data the configured spiral
+// engine and the hand sprites draw from, with the same renderer the firmware runs. Built and run
+// by tools/asset_compiler.py against the textures-only pack it compiled
+// first, with the SPIRAL_* switches of the firmware build.
+//
+//   bake <pack> <output dir>
+//
+// Every image is written to <output dir> as raw texels, and described on
+// stdout by one line per image:
+//
+//   <array> <index> <width> <height> <format> <file>
+//
+// where an index of -1 marks an image that is not part of an array.
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "AssetIndex.h"
+#include "FaceGeometry.h"
+#include "FaceRenderer.h"
+#include "Sprite.h"
+
+static bool writeImage(const std::string &dir, const char *array, int index, int width, int height,
+                       AssetFormat format, const std::vector<uint8_t> &data)
+{
+  std::string file = std::string(array) + (index >= 0 ? "_" + std::to_string(index) : "") + ".raw";
+  FILE *f = fopen((dir + "/" + file).c_str(), "wb");
+
+  if (f == nullptr)
+    return false;
+
+  bool written = fwrite(data.data(), 1, data.size(), f) == data.size();
+  fclose(f);
+
+  printf("%s %d %d %d %d %s\n", array, index, width, height, format, file.c_str());
+  return written;
+}
+
+static bool writeSprite(const std::string &dir, const char *array, int index, const std::vector<uint8_t> &sprite)
+{
+  const SpriteHeader *header = (const SpriteHeader *)sprite.data();
+
+  // Described as 8 pixels per byte of the crop
+  return writeImage(dir, array, index, header->bytes * 8, header->rows, ASSET_FORMAT_SPRITE, sprite);
+}
+
+// Crops what draw(frame) draws into a sprite (see Sprite.h). It is drawn over
+// white and over black: pixels that differ are not covered, the rest keep
+// what was drawn.
+template <class Draw>
+static std::vector<uint8_t> bakeSprite(Draw draw)
+{
+  static FrameBuffer overWhite, overBlack;
+
+  overWhite.fill(true);
+  overBlack.fill(false);
+  draw(overWhite);
+  draw(overBlack);
+
+  int left = FrameBuffer::STRIDE, right = -1, top = SCREEN_HEIGHT, bottom = -1;
+
+  for (int y = 0; y < SCREEN_HEIGHT; y++)
+  {
+    for (int i = 0; i < FrameBuffer::STRIDE; i++)
+    {
+      int index = y * FrameBuffer::STRIDE + i;
+
+      if ((uint8_t)~(overWhite.pixels[index] ^ overBlack.pixels[index]) != 0)
+      {
+        left = std::min(left, i);
+        right = std::max(right, i);
+        top = std::min(top, y);
+        bottom = std::max(bottom, y);
+      }
+    }
+  }
+
+  std::vector<uint8_t> sprite(sizeof(SpriteHeader));
+  SpriteHeader header = {0, 0, 0, 0};
+
+  if (right >= left)
+    header = {(uint8_t)left, (uint8_t)top, (uint8_t)(right - left + 1), (uint8_t)(bottom - top + 1)};
+
+  memcpy(sprite.data(), &header, sizeof(header));
+
+  for (int y = 0; y < header.rows; y++)
+  {
+    for (int i = 0; i < header.bytes; i++)
+    {
+      int index = (header.top + y) * FrameBuffer::STRIDE + header.column + i;
+      uint8_t mask = ~(overWhite.pixels[index] ^ overBlack.pixels[index]);
+
+      sprite.push_back(overWhite.pixels[index] & mask);
+      sprite.push_back(mask);
+    }
+  }
+
+  return sprite;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 3)
+  {
+    fprintf(stderr, "Usage: %s <pack> <output dir>\n", argv[0]);
+    return 1;
+  }
+
+  AssetPack pack;
+
+  if (!pack.open(argv[1]) || pack.checksum() != ASSET_PACK_CHECKSUM)
+  {
+    fprintf(stderr, "%s: not the pack AssetIndex.h was generated for\n", argv[1]);
+    return 1;
+  }
+
+  std::string dir = argv[2];
+
+  initFaceGeometry();
+
+  FaceRenderer renderer;
+  renderer.load(pack);
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_ROTOZOOM
+  const int size = RotozoomEngine::MAP_SIZE;
+  Vector center = {ROTOZOOM_MAP_CENTER, ROTOZOOM_MAP_CENTER};
+
+  for (int bucket = 0; bucket < SPIRAL_BATTERY_BUCKETS; bucket++)
+  {
+    std::vector<uint8_t> map(size * size * RotozoomEngine::MAP_TEXEL_BYTES, SPIRAL_MAP_EMPTY);
+    renderer.drawSpiralMap(map.data(), size, size, center, rimSizeForFill(bucketFill(bucket, SPIRAL_BATTERY_BUCKETS)));
+
+    if (!writeImage(dir, "SpiralMap", bucket, size, size, ASSET_FORMAT_SPIRAL_MAP, map))
+      return 1;
+  }
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_POLAR
+  {
+    std::vector<uint8_t> lut(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(PolarTexel));
+    PolarEngine::bakeLut((PolarTexel *)lut.data());
+
+    if (!writeImage(dir, "SpiralLut", -1, SCREEN_WIDTH, SCREEN_HEIGHT, ASSET_FORMAT_POLAR_LUT, lut))
+      return 1;
+  }
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_BAKED
+  // No frames are set on the renderer, so it draws them with the triangles
+  for (int bucket = 0; bucket < SPIRAL_BATTERY_BUCKETS; bucket++)
+  {
+    std::vector<uint8_t> frames;
+    FrameBuffer frame;
+
+    for (int minute = 0; minute < VECTOR_SIZE; minute++)
+    {
+      frame.fill(true);
+      renderer.drawBackground(frame, minute, bucketFill(bucket, SPIRAL_BATTERY_BUCKETS));
+      frames.insert(frames.end(), frame.pixels, frame.pixels + FrameBuffer::BYTES);
+    }
+
+    if (!writeImage(dir, "SpiralFrames", bucket, SCREEN_WIDTH, SCREEN_HEIGHT * VECTOR_SIZE, ASSET_FORMAT_MONO1, frames))
+      return 1;
+  }
+#endif
+
+#if SPIRAL_HAND_SPRITES
+  for (int minute = 0; minute < VECTOR_SIZE; minute++)
+  {
+    std::vector<uint8_t> sprite = bakeSprite([&](FrameBuffer &frame)
+    {
+      renderer.drawHand(frame, minute * STEP_ANGLE, MINUTE_HAND_SIZE);
+    });
+
+    if (!writeSprite(dir, "MinuteHand", minute, sprite))
+      return 1;
+  }
+
+  for (int step = 0; step < SPIRAL_HOUR_HAND_STEPS; step++)
+  {
+    std::vector<uint8_t> sprite = bakeSprite([&](FrameBuffer &frame)
+    {
+      renderer.drawHand(frame, step * 360.0f / SPIRAL_HOUR_HAND_STEPS, HOUR_HAND_SIZE);
+    });
+
+    if (!writeSprite(dir, "HourHand", step, sprite))
+      return 1;
+  }
+#endif
+
+#if SPIRAL_OVERLAY_SPRITES
+  // Static decorations drawn over the spiral, in order; add new ones here
+  void (FaceRenderer::*overlays[])(FrameBuffer &) = {&FaceRenderer::drawShadow};
+  const int overlayCount = sizeof(overlays) / sizeof(overlays[0]);
+
+  static_assert(overlayCount <= FaceRenderer::MAX_OVERLAYS, "more overlays than FaceRenderer has room for");
+
+  for (int i = 0; i < overlayCount; i++)
+  {
+    std::vector<uint8_t> sprite = bakeSprite([&](FrameBuffer &frame)
+    {
+      (renderer.*overlays[i])(frame);
+    });
+
+    if (!writeSprite(dir, "Overlay", i, sprite))
+      return 1;
+  }
+#endif
+
+  return 0;
+}
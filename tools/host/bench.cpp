@@ -0,0 +1,287 @@
+// Host benchmark of the configured spiral engine against the triangle path,
+// of the face drawn in bands on one core against two (SecondCore.h), of the
+// hands moved by redrawing only their bounds, and a check of the error bounds
+// documented in src/FastMath.h. Not part of the asset compiler, build it by
+// hand against a compiled pack, all on one command line:
+//
+//   c++ -std=c++17 -O2 -pthread -Isrc -I<pack dir> -DSPIRAL_ENGINE=SPIRAL_ENGINE_ANALYTIC
+//       tools/host/bench.cpp src/AssetPack.cpp src/Dither.cpp src/FaceGeometry.cpp
+//       src/FaceRenderer.cpp src/PolarEngine.cpp src/Profiler.cpp src/RotozoomEngine.cpp
+//       src/SecondCore.cpp src/Texture.cpp src/TextureCache.cpp -o bench
+//   bench <pack dir>/assets.bin
+//
+// Engines that draw from baked data need a pack compiled with the same
+// SPIRAL_* switches. SPIRAL_ENGINE_BAKED only copies frames, drawSpiral()
+// draws its triangles.
+
+#include <math.h>
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+
+#include "AssetIndex.h"
+#include "FaceGeometry.h"
+#include "FaceRenderer.h"
+#include "FastMath.h"
+#include "SecondCore.h"
+
+// Bands the two-core timing splits the face into, as SPIRAL_RENDER_CORES does
+// on the watch
+const int BENCH_BANDS = 8;
+
+static bool checkBound(const char *name, double error, double bound)
+{
+  bool ok = error <= bound;
+  printf("  %-12s max error %.6f (bound %.6f)%s\n", name, error, bound, ok ? "" : "  FAILED");
+  return ok;
+}
+
+// Every argument the spiral feeds the approximations, and a bit more
+static bool checkFastMath()
+{
+  double atanError = 0.0, logError = 0.0, invSqrtError = 0.0;
+
+  for (int y = -400; y <= 400; y++)
+  {
+    for (int x = -400; x <= 400; x++)
+    {
+      float fx = x * 0.5f + 0.25f, fy = y * 0.5f + 0.25f;
+      float r2 = fx * fx + fy * fy;
+
+      atanError = fmax(atanError, fabs(fastAtan2(fy, fx) - atan2((double)fy, (double)fx)));
+      logError = fmax(logError, fabs(fastLog2(r2) - log2((double)r2)));
+      invSqrtError = fmax(invSqrtError, fabs(fastInvSqrt(r2) * sqrt((double)r2) - 1.0));
+    }
+  }
+
+  printf("FastMath.h\n");
+
+  bool ok = checkBound("fastAtan2", atanError, 0.0050);
+  ok &= checkBound("fastLog2", logError, 0.00064);
+  ok &= checkBound("fastInvSqrt", invSqrtError, 0.0018);
+  return ok;
+}
+
+template <class Draw>
+static double timeFrames(FrameBuffer *frames, Draw draw)
+{
+  const int REPEATS = 10;
+  auto start = std::chrono::steady_clock::now();
+
+  for (int repeat = 0; repeat < REPEATS; repeat++)
+  {
+    for (int minute = 0; minute < VECTOR_SIZE; minute++)
+    {
+      frames[minute].fill(true);
+      draw(frames[minute], minute);
+    }
+  }
+
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / (REPEATS * VECTOR_SIZE);
+}
+
+// The way SpiralWatchy::renderFace() shares bands between the cores
+struct BandWork
+{
+  FaceRenderer *renderers[2];
+  FrameBuffer *frame;
+  int minute;
+  float batteryFill;
+  std::atomic<int> nextBand;
+};
+
+static void drawBands(void *context, int core)
+{
+  BandWork &work = *(BandWork *)context;
+  FaceRenderer &renderer = *work.renderers[core];
+  int band;
+
+  while ((band = work.nextBand.fetch_add(1, std::memory_order_relaxed)) < BENCH_BANDS)
+  {
+    int16_t top = band * SCREEN_HEIGHT / BENCH_BANDS;
+    int16_t bottom = (band + 1) * SCREEN_HEIGHT / BENCH_BANDS;
+
+    renderer.setBand(top, bottom);
+    renderer.drawBackground(*work.frame, work.minute, work.batteryFill);
+    renderer.drawHands(*work.frame, work.minute / 5, work.minute);
+    renderer.setBand(0, SCREEN_HEIGHT);
+  }
+}
+
+static void drawFace(FaceRenderer &renderer, FrameBuffer &frame, int hour, int minute, float batteryFill)
+{
+  frame.fill(true);
+  renderer.drawBackground(frame, minute, batteryFill);
+  renderer.drawHands(frame, hour, minute);
+}
+
+// The hour hand moved on from hour - 1 the way SpiralWatchy::showHour() does
+// it, in the bounds of the hands before and after
+static void redrawHands(FaceRenderer &renderer, FrameBuffer &frame, int hour, int minute, float batteryFill)
+{
+  ClipRect clip = byteAlignClip(unionClip(renderer.handBounds((hour + 23) % 24, minute),
+                                          renderer.handBounds(hour, minute)));
+
+  for (int y = clip.top; y < clip.bottom; y++)
+    memset(frame.pixels + y * FrameBuffer::STRIDE + clip.left / 8, 0xFF, (clip.right - clip.left) / 8);
+
+  renderer.setClip(clip);
+  renderer.drawBackground(frame, minute, batteryFill);
+  renderer.drawHands(frame, hour, minute);
+  renderer.setClip(SCREEN_CLIP);
+}
+
+static void setUp(FaceRenderer &renderer, const AssetPack &pack)
+{
+  renderer.load(pack);
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_ROTOZOOM
+  for (int i = 0; i < Assets::SpiralMapCount; i++)
+    renderer.setSpiralMap(i, pack.data(Assets::SpiralMap[i]));
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_POLAR
+  renderer.setSpiralLut((const PolarTexel *)pack.data(Assets::SpiralLut));
+#endif
+
+#if SPIRAL_ENGINE == SPIRAL_ENGINE_BAKED
+  for (int i = 0; i < Assets::SpiralFramesCount; i++)
+    renderer.setSpiralFrames(i, pack.data(Assets::SpiralFrames[i]));
+#endif
+
+#if SPIRAL_OVERLAY_SPRITES
+  for (int i = 0; i < Assets::OverlayCount; i++)
+    renderer.setOverlay(i, pack.data(Assets::Overlay[i]));
+#endif
+
+#if SPIRAL_HAND_SPRITES
+  for (int i = 0; i < Assets::MinuteHandCount; i++)
+    renderer.setMinuteHandSprite(i, pack.data(Assets::MinuteHand[i]));
+
+  for (int i = 0; i < Assets::HourHandCount; i++)
+    renderer.setHourHandSprite(i, pack.data(Assets::HourHand[i]));
+#endif
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "Usage: %s <pack>\n", argv[0]);
+    return 1;
+  }
+
+  AssetPack pack;
+
+  if (!pack.open(argv[1]) || pack.checksum() != ASSET_PACK_CHECKSUM)
+  {
+    fprintf(stderr, "%s: not the pack AssetIndex.h was generated for\n", argv[1]);
+    return 1;
+  }
+
+  bool ok = checkFastMath();
+
+  initFaceGeometry();
+
+  static FaceRenderer renderer;
+  setUp(renderer, pack);
+
+  static FrameBuffer engineFrames[VECTOR_SIZE];
+  static FrameBuffer triangleFrames[VECTOR_SIZE];
+  const float batteryFill = 1.0f;
+
+  double engineTime = timeFrames(engineFrames, [&](FrameBuffer &frame, int minute)
+  {
+    renderer.drawSpiral(frame, minute, batteryFill);
+  });
+
+  double triangleTime = timeFrames(triangleFrames, [&](FrameBuffer &frame, int minute)
+  {
+    renderer.drawSpiralTriangles(frame, minute, batteryFill);
+  });
+
+  long differing = 0;
+
+  for (int minute = 0; minute < VECTOR_SIZE; minute++)
+  {
+    for (int i = 0; i < FrameBuffer::BYTES; i++)
+      differing += __builtin_popcount(engineFrames[minute].pixels[i] ^ triangleFrames[minute].pixels[i]);
+  }
+
+  printf("Spiral (engine %d)\n", SPIRAL_ENGINE);
+  printf("  engine      %8.1f us/frame\n", engineTime);
+  printf("  triangles   %8.1f us/frame\n", triangleTime);
+  printf("  differing   %8.2f %% of pixels\n", 100.0 * differing / (VECTOR_SIZE * SCREEN_WIDTH * SCREEN_HEIGHT));
+
+  static FaceRenderer workerRenderer;
+  setUp(workerRenderer, pack);
+
+#if SPIRAL_TEXTURE_CACHE
+  static TextureCache workerTextureCache;
+  workerRenderer.setTextureCache(&workerTextureCache);
+#endif
+
+  BandWork work;
+  work.renderers[0] = &renderer;
+  work.renderers[1] = &workerRenderer;
+  work.batteryFill = batteryFill;
+
+  // One core takes every band when the other never gets to run
+  double oneCoreTime = timeFrames(engineFrames, [&](FrameBuffer &frame, int minute)
+  {
+    work.frame = &frame;
+    work.minute = minute;
+    work.nextBand = 0;
+    drawBands(&work, 0);
+  });
+
+  double twoCoreTime = timeFrames(triangleFrames, [&](FrameBuffer &frame, int minute)
+  {
+    work.frame = &frame;
+    work.minute = minute;
+    work.nextBand = 0;
+    secondCore.run(drawBands, &work);
+  });
+
+  bool identical = true;
+
+  for (int minute = 0; minute < VECTOR_SIZE; minute++)
+    identical &= memcmp(engineFrames[minute].pixels, triangleFrames[minute].pixels, FrameBuffer::BYTES) == 0;
+
+  printf("Face in %d bands\n", BENCH_BANDS);
+  printf("  one core    %8.1f us/frame\n", oneCoreTime);
+  printf("  two cores   %8.1f us/frame (%.2fx)%s\n", twoCoreTime, oneCoreTime / twoCoreTime,
+         identical ? "" : "  FRAMES DIFFER");
+
+  // Every frame starts out with the hour hand an hour behind
+  for (int minute = 0; minute < VECTOR_SIZE; minute++)
+    drawFace(renderer, engineFrames[minute], minute / 5 + 11, minute, batteryFill);
+
+  double wholeTime = timeFrames(triangleFrames, [&](FrameBuffer &frame, int minute)
+  {
+    drawFace(renderer, frame, minute / 5 + 12, minute, batteryFill);
+  });
+
+  // Drawing the same bounds again draws the same pixels
+  const int REPEATS = 10;
+  auto start = std::chrono::steady_clock::now();
+
+  for (int repeat = 0; repeat < REPEATS; repeat++)
+  {
+    for (int minute = 0; minute < VECTOR_SIZE; minute++)
+      redrawHands(renderer, engineFrames[minute], minute / 5 + 12, minute, batteryFill);
+  }
+
+  std::chrono::duration<double, std::micro> handsTime = std::chrono::steady_clock::now() - start;
+  bool handsIdentical = true;
+
+  for (int minute = 0; minute < VECTOR_SIZE; minute++)
+    handsIdentical &= memcmp(engineFrames[minute].pixels, triangleFrames[minute].pixels, FrameBuffer::BYTES) == 0;
+
+  printf("Hour hand moved\n");
+  printf("  whole face  %8.1f us/frame\n", wholeTime);
+  printf("  hand bounds %8.1f us/frame%s\n", handsTime.count() / (REPEATS * VECTOR_SIZE), handsIdentical ? "" : "  FRAMES DIFFER");
+
+  return ok && identical && handsIdentical ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""Stub SNTP server for tools/host/weather.cpp.
+
+Answers every request with the same fixed time after a delay, so the check
+can tell a sync running in the background from one that blocks:
+
+    python3 tools/host/ntp_stub.py [port] [delay seconds]
+"""
+
+import calendar
+import socket
+import struct
+import sys
+import time
+
+# Seconds from 1900, where NTP counts from, to 1970
+NTP_UNIX_OFFSET = 2208988800
+
+# What weather.cpp expects
+STUB_TIME = calendar.timegm((2024, 3, 9, 16, 4, 5))
+
+
+def answer(request):
+    seconds = STUB_TIME + NTP_UNIX_OFFSET
+
+    # No leap warning, version 4, server mode, stratum 1
+    header = struct.pack("!BBbb", 0x24, 1, 0, -20)
+    # Root delay and dispersion, reference id
+    header += struct.pack("!II4s", 0, 0, b"STUB")
+    # Reference, originate (the client's transmit time), receive and transmit
+    return header + struct.pack("!II", seconds, 0) + request[40:48] + struct.pack("!IIII", seconds, 0, seconds, 0)
+
+
+def server(port):
+    """The stub's socket on port, 0 for any free one."""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("127.0.0.1", port))
+    return sock
+
+
+def serve(sock, delay):
+    while True:
+        request, client = sock.recvfrom(512)
+
+        if len(request) < 48:
+            continue
+
+        time.sleep(delay)
+        sock.sendto(answer(request), client)
+
+
+def main():
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else 8123
+    delay = float(sys.argv[2]) if len(sys.argv) > 2 else 1.0
+
+    serve(server(port), delay)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""Builds tools/host/weather.cpp and runs it against both stub servers.
+
+The stubs answer after a delay on free ports of this process, the check fails
+with a non-zero exit status when any of its lines does:
+
+    python3 tools/host/sync_check.py [build dir]
+
+HOST_CXX picks the compiler, as for the asset compiler.
+"""
+
+import os
+import socket
+import subprocess
+import sys
+import tempfile
+import threading
+
+import ntp_stub
+import weather_stub
+
+HOST_DIR = os.path.dirname(os.path.abspath(__file__))
+SOURCE_DIR = os.path.join(HOST_DIR, "..", "..", "src")
+
+# Long enough that a fetch holding up start() shows
+DELAY = 1.0
+
+
+def build(buildDir):
+    if not os.path.isdir(buildDir):
+        os.makedirs(buildDir)
+
+    executable = os.path.join(buildDir, "weather" + (".exe" if os.name == "nt" else ""))
+    command = [os.environ.get("HOST_CXX", "c++"), "-std=c++17", "-O2", "-pthread", "-I" + SOURCE_DIR,
+               os.path.join(HOST_DIR, "weather.cpp"), os.path.join(SOURCE_DIR, "WeatherSync.cpp"),
+               "-o", executable]
+    subprocess.check_call(command)
+    return executable
+
+
+def closedPort():
+    """A port nothing listens on, so a fetch from it is refused."""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    sock.bind(("127.0.0.1", 0))
+    port = sock.getsockname()[1]
+    sock.close()
+    return port
+
+
+def main():
+    buildDir = sys.argv[1] if len(sys.argv) > 1 else tempfile.mkdtemp()
+    executable = build(buildDir)
+
+    weather = weather_stub.server(0, DELAY)
+    ntp = ntp_stub.server(0)
+    threading.Thread(target=weather.serve_forever, daemon=True).start()
+    threading.Thread(target=ntp_stub.serve, args=(ntp, DELAY), daemon=True).start()
+
+    query = "/data/2.5/weather?id=5128581&units=metric&lang=en&appid=x"
+    url = "http://127.0.0.1:%d%s" % (weather.server_address[1], query)
+    unreachable = "http://127.0.0.1:%d%s" % (closedPort(), query)
+
+    return subprocess.call([executable, url, "127.0.0.1:%d" % ntp.getsockname()[1], unreachable])
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,131 @@
+// Host check of WeatherSync against tools/host/weather_stub.py and
+// tools/host/ntp_stub.py: the sync must not hold up the caller, finish() must
+// cache what the weather stub sent and hand back the NTP stub's time in the
+// city's offset, and a failed fetch must keep the cached weather.
+// tools/host/sync_check.py builds it and runs it against both stubs:
+//
+//   python3 tools/host/sync_check.py
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "WeatherSync.h"
+
+// What weather_stub.py answers with
+const int16_t STUB_TEMPERATURE = 216;
+const int16_t STUB_CONDITION = 501;
+const long STUB_TIMEZONE = -4 * 3600;
+
+// What ntp_stub.py answers with, 2024-03-09 16:04:05 UTC
+const int STUB_YEAR = 2024;
+const int STUB_MONTH = 3;
+const int STUB_DAY = 9;
+const int STUB_HOUR = 16;
+const int STUB_MINUTE = 4;
+const int STUB_SECOND = 5;
+
+// settings.h's, which the response's timezone takes over from
+const long GMT_OFFSET = -5 * 3600;
+
+const uint32_t TIMEOUT_MS = 10000;
+
+static bool checkParse()
+{
+  // Keys inside string values and spaces around the colons
+  Weather parsed = {};
+  long offset = GMT_OFFSET;
+  bool ok = WeatherSync::parse("{\"weather\" : [{\"main\": \"main\", \"id\": 800}], \"main\" : {\"temp\": -3.25}}",
+                               parsed, offset) &&
+            parsed.condition == 800 && parsed.temperature == -33 && offset == GMT_OFFSET;
+
+  ok &= WeatherSync::parse("{\"weather\":[{\"id\":200}],\"main\":{\"temp\":30},\"timezone\":19800}", parsed, offset) &&
+        parsed.temperature == 300 && offset == 19800;
+
+  ok &= !WeatherSync::parse("{\"cod\":\"401\",\"message\":\"Invalid API key\"}", parsed, offset);
+
+  printf("parse        %s\n", ok ? "ok" : "FAILED");
+  return ok;
+}
+
+static bool checkExpandUrl()
+{
+  WeatherQuery byCity = {"5128581", "", "", "metric", "en", "key"};
+  WeatherQuery byPlace = {"", "40.7127", "-74.0059", "imperial", "de", "key"};
+  char url[WeatherSync::URL_SIZE];
+  char shortUrl[16];
+
+  bool ok = WeatherSync::expandUrl(url, sizeof(url), "http://x/w?id={cityID}&lang={lang}&units={units}&appid={apiKey}",
+                                   byCity) &&
+            strcmp(url, "http://x/w?id=5128581&lang=en&units=metric&appid=key") == 0;
+
+  ok &= WeatherSync::expandUrl(url, sizeof(url), "http://x/w?lat={lat}&lon={lon}&units={units}&x={other}", byPlace) &&
+        strcmp(url, "http://x/w?lat=40.7127&lon=-74.0059&units=imperial&x={other}") == 0;
+
+  ok &= !WeatherSync::expandUrl(shortUrl, sizeof(shortUrl), "http://x/w?id={cityID}", byCity);
+
+  printf("expand url   %s\n", ok ? "ok" : "FAILED");
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 4)
+  {
+    fprintf(stderr, "Usage: %s <url> <ntp host:port> <unreachable url>\n", argv[0]);
+    return 1;
+  }
+
+  bool parseOk = checkParse();
+  bool expandOk = checkExpandUrl();
+
+  bool dueOk = weatherSync.due(0, 30);
+  auto start = std::chrono::steady_clock::now();
+
+  weatherSync.start(23 * 60 + 50, argv[1], argv[2], GMT_OFFSET);
+
+  std::chrono::duration<double, std::milli> started = std::chrono::steady_clock::now() - start;
+  bool cachedBefore = weatherSync.weather().valid;
+  bool runningOk = weatherSync.running();
+
+  // 20 minutes later is not due yet, across midnight, 30 is
+  dueOk &= !weatherSync.due(10, 30) && weatherSync.due(20, 30);
+  printf("due          %s\n", dueOk ? "ok" : "FAILED");
+
+  struct tm time;
+  bool gotTime = weatherSync.finish(TIMEOUT_MS, time);
+  std::chrono::duration<double, std::milli> finished = std::chrono::steady_clock::now() - start;
+  const Weather &weather = weatherSync.weather();
+
+  runningOk &= !weatherSync.running();
+
+  bool fetchOk = !cachedBefore && weather.valid && weather.temperature == STUB_TEMPERATURE &&
+                 weather.condition == STUB_CONDITION;
+  bool timeOk = gotTime && time.tm_year + 1900 == STUB_YEAR && time.tm_mon + 1 == STUB_MONTH &&
+                time.tm_mday == STUB_DAY && time.tm_hour == STUB_HOUR + STUB_TIMEZONE / 3600 &&
+                time.tm_min == STUB_MINUTE && time.tm_sec == STUB_SECOND;
+
+  printf("start        %8.1f ms\n", started.count());
+  printf("finish       %8.1f ms\n", finished.count());
+  printf("running      %s\n", runningOk ? "ok" : "FAILED");
+  printf("weather      %.1f, condition %d  %s\n", weather.temperature / 10.0f, weather.condition,
+         fetchOk ? "ok" : "FAILED");
+
+  if (gotTime)
+    printf("time         %04d-%02d-%02d %02d:%02d:%02d  %s\n", time.tm_year + 1900, time.tm_mon + 1, time.tm_mday,
+           time.tm_hour, time.tm_min, time.tm_sec, timeOk ? "ok" : "FAILED");
+  else
+    printf("time         none  FAILED\n");
+
+  // A fetch that fails keeps the weather cached, and fails fast
+  start = std::chrono::steady_clock::now();
+  weatherSync.start(0, argv[3], nullptr, GMT_OFFSET);
+
+  bool failedTime = weatherSync.finish(TIMEOUT_MS, time);
+  std::chrono::duration<double, std::milli> failed = std::chrono::steady_clock::now() - start;
+  bool keptOk = !failedTime && weatherSync.weather().valid && weatherSync.weather().temperature == STUB_TEMPERATURE;
+
+  printf("failed fetch %8.1f ms  %s\n", failed.count(), keptOk ? "ok" : "FAILED");
+
+  return parseOk && expandOk && dueOk && runningOk && fetchOk && timeOk && keptOk ? 0 : 1;
+}
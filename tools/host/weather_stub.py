@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Stub of the OpenWeatherMap current weather API for tools/host/weather.cpp.
+
+Answers every GET with the same canned response after a delay, so the check
+can tell a fetch running in the background from one that blocks:
+
+    python3 tools/host/weather_stub.py [port] [delay seconds]
+"""
+
+import json
+import sys
+import time
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+RESPONSE = {
+    "coord": {"lon": -74.006, "lat": 40.7143},
+    "weather": [{"id": 501, "main": "Rain", "description": "moderate rain", "icon": "10d"}],
+    "base": "stations",
+    "main": {"temp": 21.57, "feels_like": 21.66, "temp_min": 20.1, "temp_max": 22.9, "pressure": 1015, "humidity": 77},
+    "visibility": 10000,
+    "wind": {"speed": 4.12, "deg": 200},
+    "timezone": -14400,
+    "id": 5128581,
+    "name": "New York",
+    "cod": 200,
+}
+
+
+class Handler(BaseHTTPRequestHandler):
+    delay = 1.0
+
+    def do_GET(self):
+        time.sleep(self.delay)
+        body = json.dumps(RESPONSE, separators=(",", ":")).encode()
+
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+
+    def log_message(self, format, *args):
+        pass
+
+
+def server(port, delay):
+    """The stub on port, 0 for any free one, not serving yet."""
+    Handler.delay = delay
+    return HTTPServer(("127.0.0.1", port), Handler)
+
+
+def main():
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else 8088
+    delay = float(sys.argv[2]) if len(sys.argv) > 2 else 1.0
+
+    server(port, delay).serve_forever()
+
+
+if __name__ == "__main__":
+    main()
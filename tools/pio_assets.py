@@ -0,0 +1,86 @@
+# PlatformIO pre-build script: compiles the texture assets before the firmware
+# is built (see tools/asset_compiler.py) with the SPIRAL_* switches from
+# build_flags, puts the generated AssetIndex.h on the include path and adds an
+# "uploadassets" target that writes the pack to the "assets" partition. The
+# firmware is checked against the app partition once it is linked.
+#
+#   pio run -t uploadassets
+
+Import("env")
+
+import os, sys
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "tools"))
+import asset_compiler
+
+ASSET_DIR = os.path.join(env.subst("$BUILD_DIR"), "assets")
+PACK = os.path.join(ASSET_DIR, "assets.bin")
+
+
+## Find a partition in the partition table.
+# @return Its (offset, size) strings
+def partition(name):
+    table = os.path.join(env.subst("$PROJECT_DIR"), env.GetProjectOption("board_build.partitions"))
+    with open(table) as f:
+        for line in f:
+            fields = [x.strip() for x in line.split("#")[0].split(",")]
+            if len(fields) >= 5 and fields[0] == name:
+                return fields[3], fields[4]
+    sys.stderr.write("Error: no \"%s\" partition in %s\n" % (name, table))
+    env.Exit(1)
+
+
+## esptool arguments that write only the pack, like the platform's uploadfs.
+#  $UPLOADERFLAGS would also write the bootloader, partition table and
+#  boot_app0 from FLASH_EXTRA_IMAGES.
+def uploaderFlags():
+    board = env.BoardConfig()
+    return [
+        "--chip", board.get("build.mcu", "esp32"),
+        "--port", '"$UPLOAD_PORT"',
+        "--baud", "$UPLOAD_SPEED",
+        "--before", board.get("upload.before_reset", "default_reset"),
+        "--after", board.get("upload.after_reset", "hard_reset"),
+        "write_flash", "-z",
+        partition("assets")[0],
+    ]
+
+
+## Fail the build when the firmware outgrows the app partitions, which this
+#  table shrinks to make room for the assets.
+def checkFirmwareSize(source, target, env):
+    size = os.path.getsize(target[0].get_abspath())
+    capacity = int(partition("app0")[1], 0)
+    print("Firmware: %d of %d bytes of app0 (%.1f%% used)" % (size, capacity, 100.0 * size / capacity))
+    if size > capacity:
+        sys.stderr.write("Error: firmware (%d bytes) does not fit the app0 partition (%d bytes)\n" % (size, capacity))
+        return 1
+    return 0
+
+
+## SPIRAL_* defines from build_flags, name to value string.
+def spiralDefines():
+    flags = env.ParseFlags(env.GetProjectOption("build_flags", ""))
+    defines = {}
+    for define in flags.get("CPPDEFINES", []):
+        name, value = (define, "1") if isinstance(define, str) else (define[0], str(define[1]))
+        if name.startswith("SPIRAL_"):
+            defines[name] = value
+    return defines
+
+
+if not asset_compiler.run(ASSET_DIR, spiralDefines()):
+    env.Exit(1)
+
+env.Append(CPPPATH=[ASSET_DIR])
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.bin", checkFirmwareSize)
+
+env.AddCustomTarget(
+    name="uploadassets",
+    dependencies=PACK,
+    actions=[
+        env.VerboseAction(env.AutodetectUploadPort, "Looking for upload port..."),
+        '"$PYTHONEXE" "$UPLOADER" %s $SOURCE' % " ".join(uploaderFlags()),
+    ],
+    title="Upload Assets",
+    description="Write the texture asset pack to the assets partition")